@@ -0,0 +1,281 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * This benchmark measures how quickly read latency recovers after a restart:
+ * - A tiered table is populated, flushed and read once so the chunk cache holds its content, and
+ * the steady-state read latency is recorded.
+ * - The database is closed and reopened, then random point reads are timed in windows. A database
+ * is considered warm once the p99 latency of a window is within WARM_FACTOR of the steady-state
+ * p99; the time from the start of wiredtiger_open to that point is reported as time-to-warm.
+ * - This is repeated without a chunk cache, with the persistent chunk cache reloaded lazily, and
+ * with the persistent chunk cache preloaded at open.
+ *
+ * The operating system's page cache is not dropped between runs, run the program as a user who can
+ * do that externally for numbers that include device reads.
+ */
+
+#define HOME_BUF_SIZE 512
+#define MAX_VALUE_SIZE 200
+#define NUM_RECORDS (200 * WT_THOUSAND)
+#define NUM_READS (200 * WT_THOUSAND)
+#define PRELOAD_THREADS 8
+#define WARM_FACTOR 2
+#define WINDOW_OPS WT_THOUSAND
+
+static const char conn_config_common[] = "create,cache_size=100MB,statistics=(fast)";
+static const char chunkcache_config[] =
+  "chunk_cache=[enabled=true,chunk_size=1MB,capacity=1GB,type=FILE,storage_path="
+  "WiredTigerChunkCache%s]";
+static const char table_config[] = "leaf_page_max=32KB,key_format=Q,value_format=u";
+
+typedef enum { RUN_NO_CHUNKCACHE, RUN_CHUNKCACHE_LAZY, RUN_CHUNKCACHE_PRELOAD } RUN_TYPE;
+
+static const char *const run_names[] = {
+  "no chunk cache", "chunk cache, lazy reload", "chunk cache, preload at open"};
+
+static TEST_OPTS *opts, _opts;
+
+static WT_RAND_STATE rnd;
+static unsigned char data_str[MAX_VALUE_SIZE];
+static uint64_t latency_ns[WINDOW_OPS];
+
+/* Forward declarations. */
+static void conn_open(const char *, RUN_TYPE, bool, WT_CONNECTION **);
+static uint64_t get_stat(WT_SESSION *, int);
+static int latency_cmp(const void *, const void *);
+static void populate(const char *, RUN_TYPE, uint64_t *);
+static void read_window(WT_SESSION *, WT_CURSOR *, uint64_t *, uint64_t *);
+static void run_test(RUN_TYPE);
+
+/*
+ * main --
+ *     Methods implementation.
+ */
+int
+main(int argc, char *argv[])
+{
+    opts = &_opts;
+    memset(opts, 0, sizeof(*opts));
+
+    /* The chunk cache only holds tiered objects, always run against tiered storage. */
+    opts->tiered_storage = true;
+    opts->nrecords = NUM_RECORDS;
+    opts->nops = NUM_READS;
+    testutil_check(testutil_parse_opts(argc, argv, opts));
+
+    __wt_random_init_custom_seed(&rnd, (uint64_t)getpid());
+
+    printf("%-32s %12s %12s %12s %12s %12s %12s\n", "configuration", "open (ms)", "warm (ms)",
+      "first p50", "first p99", "steady p99", "preloaded");
+    run_test(RUN_NO_CHUNKCACHE);
+    run_test(RUN_CHUNKCACHE_LAZY);
+    run_test(RUN_CHUNKCACHE_PRELOAD);
+
+    testutil_cleanup(opts);
+    return (EXIT_SUCCESS);
+}
+
+/*
+ * conn_open --
+ *     Open a connection with the chunk cache configured for the run type.
+ */
+static void
+conn_open(const char *home, RUN_TYPE type, bool reopen, WT_CONNECTION **connp)
+{
+    char buf[1024], cc_buf[256], preload_buf[64];
+
+    preload_buf[0] = '\0';
+    if (reopen && type == RUN_CHUNKCACHE_PRELOAD)
+        testutil_snprintf(preload_buf, sizeof(preload_buf), ",preload_threads=%d", PRELOAD_THREADS);
+
+    cc_buf[0] = '\0';
+    if (type != RUN_NO_CHUNKCACHE)
+        testutil_snprintf(cc_buf, sizeof(cc_buf), chunkcache_config, preload_buf);
+
+    testutil_snprintf(buf, sizeof(buf), "%s,%s", conn_config_common, cc_buf);
+    testutil_wiredtiger_open(opts, home, buf, NULL, connp, false, true);
+}
+
+/*
+ * get_stat --
+ *     Return the value of a connection statistic.
+ */
+static uint64_t
+get_stat(WT_SESSION *session, int stat_field)
+{
+    WT_CURSOR *cursor;
+    int64_t value;
+    const char *desc, *pvalue;
+
+    testutil_check(session->open_cursor(session, "statistics:", NULL, NULL, &cursor));
+    cursor->set_key(cursor, stat_field);
+    testutil_check(cursor->search(cursor));
+    testutil_check(cursor->get_value(cursor, &desc, &pvalue, &value));
+    testutil_check(cursor->close(cursor));
+    return ((uint64_t)value);
+}
+
+/*
+ * latency_cmp --
+ *     Sort latencies in increasing order.
+ */
+static int
+latency_cmp(const void *a, const void *b)
+{
+    uint64_t x, y;
+
+    x = *(const uint64_t *)a;
+    y = *(const uint64_t *)b;
+    return (x < y ? -1 : (x > y ? 1 : 0));
+}
+
+/*
+ * read_window --
+ *     Time a window of random point reads, returning the p50 and p99 latency in nanoseconds.
+ */
+static void
+read_window(WT_SESSION *session, WT_CURSOR *cursor, uint64_t *p50p, uint64_t *p99p)
+{
+    uint64_t start, stop;
+    u_int i;
+
+    for (i = 0; i < WINDOW_OPS; ++i) {
+        cursor->set_key(cursor, __wt_random(&rnd) % opts->nrecords + 1);
+        start = __wt_clock((WT_SESSION_IMPL *)session);
+        testutil_check(cursor->search(cursor));
+        stop = __wt_clock((WT_SESSION_IMPL *)session);
+        latency_ns[i] = WT_CLOCKDIFF_NS(stop, start);
+    }
+    testutil_check(cursor->reset(cursor));
+
+    __wt_qsort(latency_ns, WINDOW_OPS, sizeof(latency_ns[0]), latency_cmp);
+    *p50p = latency_ns[WINDOW_OPS / 2];
+    *p99p = latency_ns[(WINDOW_OPS * 99) / 100];
+}
+
+/*
+ * populate --
+ *     Create and populate the table, flush it to tiered storage and return the steady-state p99
+ *     read latency.
+ */
+static void
+populate(const char *home, RUN_TYPE type, uint64_t *steady_p99p)
+{
+    WT_CONNECTION *conn;
+    WT_CURSOR *cursor;
+    WT_ITEM item;
+    WT_SESSION *session;
+    uint64_t i, j, p50;
+    char buf[HOME_BUF_SIZE];
+
+    testutil_recreate_dir(home);
+    if (testutil_is_dir_store(opts)) {
+        testutil_snprintf(buf, sizeof(buf), "%s/%s", home, DIR_STORE_BUCKET_NAME);
+        testutil_mkdir(buf);
+    }
+
+    conn_open(home, type, false, &conn);
+    testutil_check(conn->open_session(conn, NULL, NULL, &session));
+    testutil_check(session->create(session, opts->uri, table_config));
+
+    testutil_check(session->open_cursor(session, opts->uri, NULL, NULL, &cursor));
+    for (i = 0; i < opts->nrecords; i++) {
+        for (j = 0; j < MAX_VALUE_SIZE; j++)
+            data_str[j] = 'a' + (uint8_t)(__wt_random(&rnd) % 26);
+        cursor->set_key(cursor, i + 1);
+        item.data = data_str;
+        item.size = sizeof(data_str);
+        cursor->set_value(cursor, &item);
+        testutil_check(cursor->insert(cursor));
+    }
+    testutil_check(cursor->close(cursor));
+
+    testutil_check(session->checkpoint(session, "flush_tier=(enabled,force=true)"));
+
+    /* Read everything once so the chunk cache holds the whole table. */
+    testutil_check(session->open_cursor(session, opts->uri, NULL, NULL, &cursor));
+    while (cursor->next(cursor) == 0)
+        ;
+    read_window(session, cursor, &p50, steady_p99p);
+    testutil_check(cursor->close(cursor));
+
+    testutil_check(session->close(session, NULL));
+    testutil_check(conn->close(conn, NULL));
+}
+
+/*
+ * run_test --
+ *     Populate a database, restart it and measure how long reads take to return to steady state.
+ */
+static void
+run_test(RUN_TYPE type)
+{
+    WT_CONNECTION *conn;
+    WT_CURSOR *cursor;
+    WT_SESSION *session;
+    uint64_t first_p50, first_p99, open_start, open_stop, ops, p50, p99, steady_p99, warm_stop;
+    char home[HOME_BUF_SIZE], warm_buf[32];
+    bool warm;
+
+    testutil_snprintf(home, sizeof(home), "%s_%d", opts->home, (int)type);
+    populate(home, type, &steady_p99);
+
+    open_start = __wt_clock(NULL);
+    conn_open(home, type, true, &conn);
+    open_stop = __wt_clock(NULL);
+    testutil_check(conn->open_session(conn, NULL, NULL, &session));
+    testutil_check(session->open_cursor(session, opts->uri, NULL, NULL, &cursor));
+
+    /* Read in windows until the tail latency settles, or the operation budget runs out. */
+    read_window(session, cursor, &first_p50, &first_p99);
+    warm = first_p99 <= steady_p99 * WARM_FACTOR;
+    for (ops = WINDOW_OPS; !warm && ops < opts->nops; ops += WINDOW_OPS) {
+        read_window(session, cursor, &p50, &p99);
+        warm = p99 <= steady_p99 * WARM_FACTOR;
+    }
+    warm_stop = __wt_clock(NULL);
+
+    if (warm)
+        testutil_snprintf(
+          warm_buf, sizeof(warm_buf), "%" PRIu64, WT_CLOCKDIFF_MS(warm_stop, open_start));
+    else
+        testutil_snprintf(warm_buf, sizeof(warm_buf), "not warm");
+    printf("%-32s %12.3f %12s %10" PRIu64 "us %10" PRIu64 "us %10" PRIu64 "us %12" PRIu64 "\n",
+      run_names[type], WT_CLOCKDIFF_US(open_stop, open_start) / (double)WT_THOUSAND, warm_buf,
+      first_p50 / WT_THOUSAND, first_p99 / WT_THOUSAND, steady_p99 / WT_THOUSAND,
+      get_stat(session, WT_STAT_CONN_CHUNKCACHE_CHUNKS_PRELOADED));
+
+    testutil_check(cursor->close(cursor));
+    testutil_check(session->close(session, NULL));
+    testutil_check(conn->close(conn, NULL));
+
+    if (!opts->preserve)
+        testutil_remove(home);
+}
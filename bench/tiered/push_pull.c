@@ -36,6 +36,9 @@
  * - This test populates tables of different sizes, say 100K, 1MB, 10MB,
  * 100MB and checkpoints with/without flush call and calculates time taken for
  * populate and checkpoint.
+ * - Flushing checkpoints are run once with the tiered storage server copying
+ * objects and once with flush threads copying large objects in parts, and the
+ * flush throughput is reported for each.
  */
 
 #define HOME_BUF_SIZE 512
@@ -43,6 +46,8 @@
 #define MAX_TIERED_FILES 10
 #define NUM_RECORDS 500
 #define MAX_VALUE_SIZE 200
+#define FLUSH_THREADS 4
+#define FLUSH_PART_SIZE "1MB"
 
 /* Constants and variables declaration. */
 static const char conn_config[] =
@@ -55,6 +60,7 @@ static unsigned char data_str[MAX_VALUE_SIZE] = "";
 static TEST_OPTS *opts, _opts;
 static bool read_data = true;
 static bool flush;
+static uint32_t flush_threads;
 
 static WT_RAND_STATE rnd;
 /* Forward declarations. */
@@ -63,6 +69,7 @@ static double calculate_std_deviation(const double *);
 static void compute_wt_file_size(const char *, const char *, uint64_t *);
 static void compute_tiered_file_size(const char *, const char *, uint64_t *);
 static void fill_random_data(void);
+static uint64_t get_flush_bytes(WT_SESSION *);
 static void get_file_size(const char *, uint64_t *);
 static void populate(WT_SESSION *, uint32_t, uint32_t);
 static void recover_validate(const char *, uint32_t, uint64_t, uint32_t);
@@ -73,7 +80,7 @@ static void remove_local_cached_files(const char *);
 #endif
 
 static double avg_wtime_arr[MAX_RUN], avg_rtime_arr[MAX_RUN], avg_wthroughput_arr[MAX_RUN],
-  avg_rthroughput_arr[MAX_RUN];
+  avg_rthroughput_arr[MAX_RUN], avg_ftime_arr[MAX_RUN], avg_fthroughput_arr[MAX_RUN];
 static uint64_t avg_filesize_array[MAX_RUN];
 
 /*
@@ -89,15 +96,25 @@ main(int argc, char *argv[])
     testutil_check(testutil_parse_opts(argc, argv, opts));
 
     flush = false;
+    flush_threads = 0;
     printf("The below benchmarks are average of %d runs\n", MAX_RUN);
 
-    for (i = 0; i < 2; ++i) {
+    /*
+     * Run without flushing, then flushing from the tiered storage server, then flushing from flush
+     * threads with multi-part uploads.
+     */
+    for (i = 0; i < 3; ++i) {
 
         printf(
           "########################################################################################"
           "\n");
-        printf("                        Checkpoint is done with flush_tier %s\n",
-          (opts->tiered_storage && flush) ? "enabled" : "disabled");
+        if (opts->tiered_storage && flush && flush_threads != 0)
+            printf("      Checkpoint is done with flush_tier enabled, %" PRIu32
+                   " flush threads, " FLUSH_PART_SIZE " parts\n",
+              flush_threads);
+        else
+            printf("                        Checkpoint is done with flush_tier %s\n",
+              (opts->tiered_storage && flush) ? "enabled" : "disabled");
         printf(
           "########################################################################################"
           "\n");
@@ -126,6 +143,12 @@ main(int argc, char *argv[])
          * Run test with 100 Mb file size.
          */
         run_test_clean("100MB", NUM_RECORDS * WT_THOUSAND);
+
+        /* There's nothing more to compare without tiered storage. */
+        if (!opts->tiered_storage && flush)
+            break;
+        if (flush)
+            flush_threads = FLUSH_THREADS;
         flush = true;
     }
 
@@ -163,16 +186,17 @@ static void
 run_test_clean(const char *suffix, uint32_t num_records)
 {
     char home_full[HOME_BUF_SIZE];
-    double avg_wtime, avg_rtime, avg_wthroughput, avg_rthroughput;
+    double avg_ftime, avg_fthroughput, avg_wtime, avg_rtime, avg_wthroughput, avg_rthroughput;
     uint64_t avg_file_size;
     uint32_t counter;
 
     avg_file_size = 0;
+    avg_ftime = avg_fthroughput = 0;
     avg_wtime = avg_rtime = avg_rthroughput = avg_wthroughput = 0;
 
     for (counter = 0; counter < MAX_RUN; ++counter) {
-        testutil_snprintf(
-          home_full, HOME_BUF_SIZE, "%s_%s_%d_%" PRIu32, opts->home, suffix, flush, counter);
+        testutil_snprintf(home_full, HOME_BUF_SIZE, "%s_%s_%d_%" PRIu32 "_%" PRIu32, opts->home,
+          suffix, flush, flush_threads, counter);
         run_test(home_full, num_records, counter);
     }
 
@@ -188,6 +212,8 @@ run_test_clean(const char *suffix, uint32_t num_records)
         avg_rtime += avg_rtime_arr[counter];
         avg_wthroughput += avg_wthroughput_arr[counter];
         avg_rthroughput += avg_rthroughput_arr[counter];
+        avg_ftime += avg_ftime_arr[counter];
+        avg_fthroughput += avg_fthroughput_arr[counter];
         avg_file_size += avg_filesize_array[counter];
     }
 
@@ -199,6 +225,28 @@ run_test_clean(const char *suffix, uint32_t num_records)
       avg_wthroughput / MAX_RUN, calculate_std_deviation(avg_wthroughput_arr), avg_rtime / MAX_RUN,
       calculate_std_deviation(avg_rtime_arr), avg_rthroughput / MAX_RUN,
       calculate_std_deviation(avg_rthroughput_arr));
+    if (opts->tiered_storage && flush)
+        printf("    Flush: F_Time: %.3f secs (SD %.3f), F_Tput: %.3f MB/sec (SD %.3f)\n",
+          avg_ftime / MAX_RUN, calculate_std_deviation(avg_ftime_arr), avg_fthroughput / MAX_RUN,
+          calculate_std_deviation(avg_fthroughput_arr));
+}
+
+/*
+ * get_flush_bytes --
+ *     Return the number of bytes flushed to the storage source.
+ */
+static uint64_t
+get_flush_bytes(WT_SESSION *session)
+{
+    WT_CURSOR *cursor;
+    int64_t value;
+
+    testutil_check(session->open_cursor(session, "statistics:", NULL, NULL, &cursor));
+    cursor->set_key(cursor, WT_STAT_CONN_TIERED_FLUSH_BYTES);
+    testutil_check(cursor->search(cursor));
+    testutil_check(cursor->get_value(cursor, NULL, NULL, &value));
+    testutil_check(cursor->close(cursor));
+    return ((uint64_t)value);
 }
 
 /*
@@ -354,10 +402,10 @@ recover_validate(const char *home, uint32_t num_records, uint64_t file_size, uin
 static void
 run_test(const char *home, uint32_t num_records, uint32_t counter)
 {
-    struct timeval start, end;
-    char buf[1024];
-    double diff_sec;
-    uint64_t file_size;
+    struct timeval ckpt_start, end, start;
+    char buf[1024], config[1024];
+    double diff_sec, flush_sec;
+    uint64_t file_size, flush_bytes;
 
     WT_CONNECTION *conn;
     WT_SESSION *session;
@@ -368,7 +416,12 @@ run_test(const char *home, uint32_t num_records, uint32_t counter)
         testutil_mkdir(buf);
     }
 
-    testutil_wiredtiger_open(opts, home, conn_config, NULL, &conn, false, true);
+    testutil_snprintf(config, sizeof(config), "%s", conn_config);
+    if (opts->tiered_storage && flush_threads != 0)
+        testutil_snprintf(config, sizeof(config),
+          "%s,tiered_storage=(flush_threads=%" PRIu32 ",flush_part_size=" FLUSH_PART_SIZE ")",
+          conn_config, flush_threads);
+    testutil_wiredtiger_open(opts, home, config, NULL, &conn, false, true);
     testutil_check(conn->open_session(conn, NULL, NULL, &session));
 
     /* Create and populate table. Checkpoint the data after that. */
@@ -379,11 +432,16 @@ run_test(const char *home, uint32_t num_records, uint32_t counter)
     gettimeofday(&start, 0);
 
     populate(session, num_records, counter);
+    gettimeofday(&ckpt_start, 0);
     testutil_check(session->checkpoint(session, buf));
 
     gettimeofday(&end, 0);
     diff_sec = difftime_sec(start, end);
 
+    /* A flushing checkpoint waits for the objects to be copied to the storage source. */
+    flush_sec = difftime_sec(ckpt_start, end);
+    flush_bytes = opts->tiered_storage && flush ? get_flush_bytes(session) : 0;
+
     testutil_check(session->close(session, NULL));
     testutil_check(conn->close(conn, NULL));
 
@@ -396,6 +454,8 @@ run_test(const char *home, uint32_t num_records, uint32_t counter)
     avg_wtime_arr[counter] = diff_sec;
     avg_wthroughput_arr[counter] = ((file_size / diff_sec) / WT_MEGABYTE);
     avg_filesize_array[counter] = file_size;
+    avg_ftime_arr[counter] = flush_sec;
+    avg_fthroughput_arr[counter] = flush_sec > 0 ? ((flush_bytes / flush_sec) / WT_MEGABYTE) : 0;
 
     if (read_data)
         recover_validate(home, num_records, file_size, counter);
@@ -118,6 +118,12 @@ config_include(
     FILE "dlfcn.h"
 )
 
+config_include(
+    HAVE_LINUX_IO_URING_H
+    "Include header linux/io_uring.h exists."
+    FILE "linux/io_uring.h"
+)
+
 config_include(
     HAVE_MEMORY_H
     "Include header memory.h exists."
@@ -181,6 +187,13 @@ config_func(
     FILES "stdlib.h"
 )
 
+config_func(
+    HAVE_SCHED_GETCPU
+    "Function sched_getcpu exists."
+    FUNC "sched_getcpu"
+    FILES "sched.h"
+)
+
 config_func(
     HAVE_SETRLIMIT
     "Function setrlimit exists."
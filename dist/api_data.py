@@ -272,6 +272,11 @@ file_config = format_meta + file_runtime_config + tiered_config + [
         compression engine name created with WT_CONNECTION::add_compressor. If WiredTiger
         has builtin support for \c "lz4", \c "snappy", \c "zlib" or \c "zstd" compression,
         these names are also available. See @ref compression for more information'''),
+    Config('block_compressor_level', '0', r'''
+        the compression level passed to the block compressor for leaf pages. The meaning of the
+        level is specific to the compression engine, the default value of 0 uses the engine's
+        configured level. See @ref compression for more information''',
+        type='int'),
     Config('checksum', 'on', r'''
         configure block checksums; the permitted values are \c on, \c off, \c uncompressed and
         \c unencrypted. The default is \c on, in which case all block writes include a checksum
@@ -320,6 +325,16 @@ file_config = format_meta + file_runtime_config + tiered_config + [
         misses while searching the tree. The page maximum is the bytes of uncompressed data,
         that is, the limit is applied before any block compression is done''',
         min='512B', max='512MB'),
+    Config('internal_page_compressor', '', r'''
+        configure a compressor for internal page blocks. Permitted values are \c "none" or a
+        compression engine name, as for \c block_compressor. By default, internal pages are
+        compressed with the \c block_compressor engine. Internal pages are read far more often
+        than they are written, \c "none" avoids decompressing them when they are read'''),
+    Config('internal_page_compressor_level', '0', r'''
+        the compression level passed to the internal page compressor. The meaning of the level
+        is specific to the compression engine, the default value of 0 uses the \c
+        block_compressor_level configuration''',
+        type='int'),
     Config('internal_item_max', '0', r'''
         This option is no longer supported, retained for backward compatibility''',
         min=0, undoc=True),
@@ -329,6 +344,17 @@ file_config = format_meta + file_runtime_config + tiered_config + [
     Config('key_gap', '10', r'''
         This option is no longer supported, retained for backward compatibility''',
         min='0'),
+    Config('leaf_bloom_bit_count', '0', r'''
+        the number of bits used per key for an in-memory Bloom filter built for each row-store
+        leaf page when the page is written. While a page isn't in the cache, searches for keys
+        its filter excludes return not-found without reading the page. Filters are kept with the
+        parent page's reference to the leaf page and are discarded when the parent page is
+        evicted. The value 0 disables leaf page Bloom filters; they are also disabled for custom
+        collators''',
+        min='0', max='1000'),
+    Config('leaf_bloom_hash_count', '8', r'''
+        the number of hash values per key used for leaf page Bloom filters''',
+        min='2', max='100'),
     Config('leaf_key_max', '0', r'''
         the largest key stored in a leaf node, in bytes. If set, keys larger than the specified
         size are stored as overflow items (which may require additional I/O to access).
@@ -366,12 +392,38 @@ file_config = format_meta + file_runtime_config + tiered_config + [
         pages to be temporarily larger than this value. This setting is ignored for LSM trees,
         see \c chunk_size''',
         min='512B', max='10TB'),
+    Config('modify_chain', '', r'''
+        configure how chains of WT_CURSOR::modify updates to a value are kept''',
+        type='category', subconfig=[
+        Config('compact', 'false', r'''
+            keep modify updates as deltas until the chain of deltas passes a cost threshold,
+            rather than writing a full copy of the value every few modify calls. Readers rebuild
+            values from longer chains, and versions written to the history store are kept as
+            deltas for longer. Suited to applications making many small changes to large
+            values''',
+            type='boolean'),
+        Config('max_length', '100', r'''
+            with \c compact configured, the number of deltas after which the value is written in
+            full''',
+            min='10', max='1000'),
+        Config('max_pct', '50', r'''
+            with \c compact configured, the memory used by the deltas, as a percentage of the
+            value's size, after which the value is written in full''',
+            min='1', max='1000'),
+        ]),
     Config('prefix_compression', 'false', r'''
         configure prefix compression on row-store leaf pages''',
         type='boolean'),
     Config('prefix_compression_min', '4', r'''
         minimum gain before prefix compression will be used on row-store leaf pages''',
         min=0),
+    Config('prefix_compression_restart', '0', r'''
+        maximum number of keys written between restart keys on row-store leaf pages, where a
+        restart key is written without prefix compression. Restart keys bound the number of keys
+        rolled forward to build a prefix-compressed key, and leaf page searches compare restart
+        keys before building any other key. A value of 0 writes restart keys only where prefix
+        compression would not otherwise be used''',
+        min=0, max=1024),
     Config('split_deepen_min_child', '0', r'''
         minimum entries in a page to consider deepening the tree. Pages will be considered for
         splitting and deepening the search tree as soon as there are more than the configured
@@ -389,6 +441,8 @@ file_config = format_meta + file_runtime_config + tiered_config + [
 
 # File metadata, including both configurable and non-configurable (internal)
 file_meta = file_config + [
+    Config('block_compressor_state', '', r'''
+        the state of a customized block compressor, see WT_COMPRESSOR::get_state'''),
     Config('checkpoint', '', r'''
         the file checkpoint entries'''),
     Config('checkpoint_backup_info', '', r'''
@@ -547,6 +601,11 @@ connection_runtime_config = [
             A database can configure both log_size and wait to set an upper bound for checkpoints;
             setting this value above 0 configures periodic checkpoints''',
             min='0', max='2GB'),
+        Config('threads', '0', r'''
+            the number of helper threads used to reconcile the dirty leaf pages of a tree in
+            parallel during a checkpoint. Internal pages are still written by the checkpoint
+            thread, after their children. Zero means the checkpoint thread writes every page''',
+            min='0', max='20'),
         Config('wait', '0', r'''
             seconds to wait between each checkpoint; setting this value above 0 configures
             periodic checkpoints''',
@@ -628,20 +687,6 @@ connection_runtime_config = [
         ]),
     Config('error_prefix', '', r'''
         prefix string for error messages'''),
-    Config('eviction', '', r'''
-        eviction configuration options''',
-        type='category', subconfig=[
-            Config('threads_max', '8', r'''
-                maximum number of threads WiredTiger will start to help evict pages from cache. The
-                number of threads started will vary depending on the current eviction load. Each
-                eviction worker thread uses a session from the configured session_max''',
-                min=1, max=20),
-            Config('threads_min', '1', r'''
-                minimum number of threads WiredTiger will start to help evict pages from
-                cache. The number of threads currently running will vary depending on the
-                current eviction load''',
-                min=1, max=20),
-            ]),
     Config('eviction_checkpoint_target', '1', r'''
         perform eviction at the beginning of checkpoints to bring the dirty content in cache
         to this level. It is a percentage of the cache size if the value is within the range of
@@ -719,17 +764,6 @@ connection_runtime_config = [
         the number of milliseconds to wait for a resource to drain before timing out in diagnostic
         mode. Default will wait for 4 minutes, 0 will wait forever''',
         min=0),
-    Config('history_store', '', r'''
-        history store configuration options''',
-        type='category', subconfig=[
-        Config('file_max', '0', r'''
-            the maximum number of bytes that WiredTiger is allowed to use for its history store
-            mechanism. If the history store file exceeds this size, a panic will be triggered. The
-            default value means that the history store file is unbounded and may use as much
-            space as the filesystem will accommodate. The minimum non-zero setting is 100MB.''',
-            # !!! Must match WT_HS_FILE_MIN
-            min='0')
-        ]),
     Config('io_capacity', '', r'''
         control how many bytes per second are written and read. Exceeding the capacity results
         in throttling.''',
@@ -949,6 +983,13 @@ wiredtiger_open_log_configuration = [
             compression engine name created with WT_CONNECTION::add_compressor. If WiredTiger
             has builtin support for \c "lz4", \c "snappy", \c "zlib" or \c "zstd" compression,
             these names are also available. See @ref compression for more information'''),
+        Config('compressor_dictionary', '0', r'''
+            the maximum size of a dictionary sampled from recent log records and written at the
+            start of each log file. Log records are compressed with the dictionary of the file
+            they are written in, so repeated key prefixes and field names compress across
+            records. Requires a compressor that supports dictionaries and a compatibility
+            release of 11.3 or later. Zero means log records are compressed independently''',
+            min='0', max='64KB'),
         Config('file_max', '100MB', r'''
             the maximum size of log files''',
             min='100KB',    # !!! Must match WT_LOG_FILE_MIN
@@ -965,7 +1006,18 @@ wiredtiger_open_log_configuration = [
         Config('recover', 'on', r'''
             run recovery or fail with an error if recovery needs to run after an unclean
             shutdown''',
-            choices=['error', 'on'])
+            choices=['error', 'on']),
+        Config('recover_threads', '0', r'''
+            the number of worker threads used to replay the log during recovery. Operations are
+            partitioned across the workers by file, so each file's updates are still applied in
+            log order. Zero means the log is replayed by a single thread''',
+            min='0', max='64'),
+        Config('slot_consolidation', '0', r'''
+            the number of per-CPU sub-slots used to combine concurrent log writes before they join
+            the active log slot. Threads writing on the same sub-slot join the active slot once
+            as a group, reducing contention on the slot with many committing threads. Zero means
+            every write joins the active slot directly''',
+            min='0', max='256'),
     ]),
 ]
 
@@ -1011,6 +1063,72 @@ wiredtiger_open_statistics_log_configuration = [
         ])
 ]
 
+eviction_configuration_common = [
+    Config('threads_max', '8', r'''
+        maximum number of threads WiredTiger will start to help evict pages from cache. The
+        number of threads started will vary depending on the current eviction load. Each
+        eviction worker thread uses a session from the configured session_max''',
+        min=1, max=20),
+    Config('threads_min', '1', r'''
+        minimum number of threads WiredTiger will start to help evict pages from
+        cache. The number of threads currently running will vary depending on the
+        current eviction load''',
+        min=1, max=20),
+]
+connection_reconfigure_eviction_configuration = [
+    Config('eviction', '', r'''
+        eviction configuration options''',
+        type='category', subconfig=eviction_configuration_common)
+]
+wiredtiger_open_eviction_configuration = [
+    Config('eviction', '', r'''
+        eviction configuration options''',
+        type='category', subconfig=
+        eviction_configuration_common + [
+        Config('queue_shards', '1', r'''
+            the number of shards the eviction candidate queues are split into. Each shard has
+            its own pair of queues and lock. Threads evict from a shard chosen by their session
+            and take pages from other shards when theirs is empty, which reduces contention
+            when many threads evict at once''',
+            min=1, max=64),
+    ]),
+]
+
+history_store_configuration_common = [
+    Config('file_max', '0', r'''
+        the maximum number of bytes that WiredTiger is allowed to use for its history store
+        mechanism. If the history store file exceeds this size, a panic will be triggered. The
+        default value means that the history store file is unbounded and may use as much
+        space as the filesystem will accommodate. The minimum non-zero setting is 100MB.''',
+        # !!! Must match WT_HS_FILE_MIN
+        min='0')
+]
+connection_reconfigure_history_store_configuration = [
+    Config('history_store', '', r'''
+        history store configuration options''',
+        type='category', subconfig=history_store_configuration_common)
+]
+wiredtiger_open_history_store_configuration = [
+    Config('history_store', '', r'''
+        history store configuration options''',
+        type='category', subconfig=
+        history_store_configuration_common + [
+        Config('block_compressor', '', r'''
+            configure a compressor for history store file blocks. Permitted values are \c "none"
+            or a compression engine name, as for the WT_SESSION::create \c block_compressor
+            configuration. By default, the history store is compressed with \c "snappy" if
+            WiredTiger has builtin support for it, and is not compressed otherwise. History
+            store pages are written once and rarely read, so a slower engine or a higher level
+            trades little read latency for disk space. Only applied when the history store file
+            is created'''),
+        Config('block_compressor_level', '0', r'''
+            the compression level passed to the history store block compressor. The meaning of
+            the level is specific to the compression engine, the default value of 0 uses the
+            engine's configured level. Only applied when the history store file is created''',
+            type='int'),
+    ]),
+]
+
 tiered_storage_configuration_common = [
     Config('local_retention', '300', r'''
         time in seconds to retain data on tiered storage on the local tier for faster read
@@ -1040,6 +1158,16 @@ wiredtiger_open_tiered_storage_configuration = [
             a directory to store locally cached versions of files in the storage source. By
             default, it is named with \c "-cache" appended to the bucket name. A relative
             directory name is relative to the home directory'''),
+        Config('flush_part_size', '64MB', r'''
+            objects larger than this size are flushed as a multi-part upload of parts of this
+            size, uploaded concurrently by the flush threads, if the storage source supports
+            multi-part uploads. Ignored unless \c flush_threads is non-zero''',
+            min='1MB', max='5GB'),
+        Config('flush_threads', '0', r'''
+            number of threads used to flush objects to the storage source. Objects of different
+            tables are flushed concurrently. If zero, the tiered storage server thread flushes
+            objects one at a time''',
+            min='0', max='20'),
         Config('interval', '60', r'''
             interval in seconds at which to check for tiered storage related work to perform''',
             min=1, max=1000),
@@ -1089,6 +1217,16 @@ wiredtiger_open_chunk_cache_configuration = [
         Config('hashsize', '1024', r'''
             number of buckets in the hashtable that keeps track of objects''',
             min='64', max='1048576'),
+        Config('preload_budget', '0', r'''
+            maximum number of bytes of persistent chunk cache content to read back into memory
+            when the database is opened. The value is ignored unless \c preload_threads is
+            non-zero; a value of 0 means no limit''',
+            min='0', max='100TB'),
+        Config('preload_threads', '0', r'''
+            number of threads used to read persistent chunk cache content back into memory when
+            the database is opened, before ::wiredtiger_open returns. A value of 0 leaves the
+            content to be faulted in as it is read''',
+            min='0', max='64'),
         Config('flushed_data_cache_insertion', 'true', r'''
             enable caching of freshly-flushed data, before it is removed locally.''',
             type='boolean', undoc=True),
@@ -1143,6 +1281,8 @@ wiredtiger_open_common =\
     connection_runtime_config +\
     wiredtiger_open_chunk_cache_configuration +\
     wiredtiger_open_compatibility_configuration +\
+    wiredtiger_open_eviction_configuration +\
+    wiredtiger_open_history_store_configuration +\
     wiredtiger_open_log_configuration +\
     wiredtiger_open_tiered_storage_configuration +\
     wiredtiger_open_statistics_log_configuration + [
@@ -1171,6 +1311,13 @@ wiredtiger_open_common =\
     Config('checkpoint_sync', 'true', r'''
         flush files to stable storage when closing or writing checkpoints''',
         type='boolean'),
+    Config('cursor_pool_max', '0', r'''
+        maximum number of cached cursors kept in a connection-wide pool when sessions are closed.
+        A session that does not find a cursor in its own cache for a URI checks the pool before
+        opening a new cursor, avoiding the allocation and configuration parsing of a cold cursor
+        open. Only cursors on simple tables and files are pooled, and cursors are only pooled if
+        \c cache_cursors is enabled. Zero disables the pool''',
+        min='0', max='100000'),
     Config('direct_io', '', r'''
         Use \c O_DIRECT on POSIX systems, and \c FILE_FLAG_NO_BUFFERING on Windows to access files.
         Options are given as a list, such as <code>"direct_io=[data]"</code>. Configuring \c
@@ -1247,11 +1394,27 @@ wiredtiger_open_common =\
         Config('default', 'false', r'''
             whether pre-fetch is enabled for all sessions by default''',
             type='boolean'),
+        Config('io_depth', '0', r'''
+            number of reads each pre-fetch thread keeps in flight using asynchronous I/O. Only
+            supported on Linux systems with io_uring, and only for files read through the POSIX
+            file system without memory mapping; other reads are done synchronously. A value of 0
+            disables asynchronous reads''',
+            min='0', max='256'),
         ]),
     Config('readonly', 'false', r'''
         open connection in read-only mode. The database must exist. All methods that may
         modify a database are disabled. See @ref readonly for more information''',
         type='boolean'),
+    Config('rollback_to_stable', '', r'''
+        rollback to stable configuration options''',
+        type='category', subconfig=[
+        Config('threads', '0', r'''
+            the number of worker threads used to roll back files to the stable timestamp, both
+            during recovery and in calls to WT_CONNECTION::rollback_to_stable. Files are handed to
+            the workers one at a time, and each worker fixes up the history store entries for the
+            files it processes. Zero means files are processed by a single thread''',
+            min='0', max='64'),
+        ]),
     Config('salvage', 'false', r'''
         open connection and salvage any WiredTiger-owned database and log files that it detects as
         corrupted. This call should only be used after getting an error return of WT_TRY_SALVAGE.
@@ -1803,8 +1966,10 @@ methods = {
         override whether to sync log records when the transaction commits. The default is inherited
         from ::wiredtiger_open \c transaction_sync. The \c off setting does not wait for records
         to be written or synchronized. The \c on setting forces log records to be written to
-        the storage device''',
-        choices=['off', 'on']),
+        the storage device. The \c background setting returns once the log records are in the
+        log buffer, an internal thread then forces them to the storage device; use
+        WT_SESSION::transaction_sync to wait for or check their durability''',
+        choices=['background', 'off', 'on']),
 ]),
 
 'WT_SESSION.prepare_transaction' : Method([
@@ -1851,6 +2016,15 @@ methods = {
         min=0),
 ]),
 
+'WT_SESSION.transaction_sync' : Method([
+    Config('timeout_ms', '1200000', # !!! Must match WT_SESSION_BG_SYNC_MSEC
+        r'''
+        maximum amount of time to wait for background sync to complete in milliseconds. A value
+        of zero checks without waiting, returning ETIMEDOUT if the session's last commit is not
+        yet durable''',
+        type='int'),
+]),
+
 'WT_SESSION.checkpoint' : Method([
     Config('drop', '', r'''
         specify a list of checkpoints to drop. The list may additionally contain one of the
@@ -1943,6 +2117,8 @@ methods = {
 'WT_CONNECTION.reconfigure' : Method(
     connection_reconfigure_chunk_cache_configuration +\
     connection_reconfigure_compatibility_configuration +\
+    connection_reconfigure_eviction_configuration +\
+    connection_reconfigure_history_store_configuration +\
     connection_reconfigure_log_configuration +\
     connection_reconfigure_statistics_log_configuration +\
     connection_reconfigure_tiered_storage_configuration +\
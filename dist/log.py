@@ -170,6 +170,13 @@ def check_redact(optype):
             redact_str += '%s != WT_METAFILE_ID)\n' % (f.fieldname)
             redact_str += '        return(__wt_fprintf(session, args->fs, " REDACTED"));\n'
             return redact_str
+    # Operations with no file ID that log raw bytes (for example, compression dictionaries sampled
+    # from log records) may hold application data, redact them as well.
+    for f in optype.fields:
+        if f.typename == 'WT_ITEM':
+            redact_str = '    if (!FLD_ISSET(args->flags, WT_TXN_PRINTLOG_UNREDACT))\n'
+            redact_str += '        return(__wt_fprintf(session, args->fs, " REDACTED"));\n'
+            return redact_str
     return ''
 
 
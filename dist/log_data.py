@@ -80,6 +80,9 @@ optypes = [
     # Incremental backup IDs.
     LogOperationType('backup_id', 'incremental backup id', [
         ('uint32_t', 'index'), ('uint64_t', 'granularity'), ('string', 'id')]),
+    # Log compression dictionaries, written at the start of a log file.
+    LogOperationType('compress_dict', 'compression dictionary', [
+        ('uint64_t', 'gen'), ('WT_ITEM', 'dict')]),
 
 # diagnostic operations
 # Operations used only for diagnostic purposes should be have their type
@@ -176,7 +176,39 @@ __wt_stat_''' + name + '_init_single(WT_' + name.upper() + '''_STATS *stats)
 }
 ''')
 
-    if handle != None:
+    # The connection sizes its statistics array when it's created, data-source handles use a fixed
+    # number of slots. Either way, the array of structure pointers is NULL-terminated. Freeing memory
+    # updates connection statistics, so the connection's pointer array is freed last, without a
+    # session.
+    if handle != None and name == 'connection':
+        f.write('''
+int
+__wt_stat_''' + name + '''_init(
+    WT_SESSION_IMPL *session, ''' + handle + ''' *handle)
+{
+\tu_int i;
+
+\tWT_RET(__wt_calloc(session, (size_t)handle->stat_slots,
+\t    sizeof(*handle->stat_array), &handle->stat_array));
+\tWT_RET(__wt_calloc_def(
+\t    session, (size_t)handle->stat_slots + 1, &handle->stats));
+
+\tfor (i = 0; i < handle->stat_slots; ++i) {
+\t\thandle->stats[i] = &handle->stat_array[i];
+\t\t__wt_stat_''' + name + '''_init_single(handle->stats[i]);
+\t}
+\treturn (0);
+}
+
+void
+__wt_stat_''' + name + '''_discard(
+    WT_SESSION_IMPL *session, ''' + handle + ''' *handle)
+{
+\t__wt_free(session, handle->stat_array);
+\t__wt_free(NULL, handle->stats);
+}
+''')
+    elif handle != None:
         f.write('''
 int
 __wt_stat_''' + name + '''_init(
@@ -191,6 +223,7 @@ __wt_stat_''' + name + '''_init(
 \t\thandle->stats[i] = &handle->stat_array[i];
 \t\t__wt_stat_''' + name + '''_init_single(handle->stats[i]);
 \t}
+\thandle->stats[WT_COUNTER_SLOTS] = NULL;
 \treturn (0);
 }
 
@@ -222,7 +255,7 @@ __wt_stat_''' + name + '_clear_all(WT_' + name.upper() + '''_STATS **stats)
 {
 \tu_int i;
 
-\tfor (i = 0; i < WT_COUNTER_SLOTS; ++i)
+\tfor (i = 0; stats[i] != NULL; ++i)
 \t\t__wt_stat_''' + name + '''_clear_single(stats[i]);
 }
 ''')
@@ -246,30 +279,36 @@ __wt_stat_''' + name + '''_aggregate_single(
             f.write(o)
         f.write('}\n')
 
-    if name != 'session':
+    # Aggregation takes a snapshot of the array, one structure at a time, then adds the snapshot
+    # to the target.
+    if name == 'dsrc':
         f.write('''
 void
 __wt_stat_''' + name + '''_aggregate(
     WT_''' + name.upper() + '_STATS **from, WT_' + name.upper() + '''_STATS *to)
 {
+\tWT_''' + name.upper() + '''_STATS snap;
+
+\tWT_STATS_SNAPSHOT(from, &snap);
+\t__wt_stat_''' + name + '''_aggregate_single(&snap, to);
+}
+''')
+    elif name != 'session':
+        f.write('''
+void
+__wt_stat_''' + name + '''_aggregate(
+    WT_''' + name.upper() + '_STATS **from, WT_' + name.upper() + '''_STATS *to)
+{
+\tWT_''' + name.upper() + '''_STATS snap;
+
+\tWT_STATS_SNAPSHOT(from, &snap);
 ''')
-        # Connection level aggregation does not currently have any computation
-        # of a maximum value; I'm leaving in support for it, but don't declare
-        # a temporary variable until it's needed.
-        for l in statlist:
-            if 'max_aggregate' in l.flags:
-                f.write('\tint64_t v;\n\n')
-                break;
         for l in statlist:
             if 'max_aggregate' in l.flags:
-                o = '\tif ((v = WT_STAT_READ(from, ' + l.name + ')) > ' +\
-                    'to->' + l.name + ')\n'
-                if len(o) > 72:             # Account for the leading tab.
-                    o = o.replace(' > ', ' >\n\t    ')
-                o +='\t\tto->' + l.name + ' = v;\n'
+                o = '\tif (snap.' + l.name + ' > to->' + l.name + ')\n' +\
+                    '\t\tto->' + l.name + ' = snap.' + l.name + ';\n'
             else:
-                o = '\tto->' + l.name + ' += WT_STAT_READ(from, ' + l.name +\
-                    ');\n'
+                o = '\tto->' + l.name + ' += snap.' + l.name + ';\n'
                 if len(o) > 72:             # Account for the leading tab.
                     o = o.replace(' += ', ' +=\n\t    ')
             f.write(o)
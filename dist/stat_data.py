@@ -244,6 +244,7 @@ conn_stats = [
     BlockCacheStat('block_prefetch_pages_queued', 'pre-fetch pages queued'),
     BlockCacheStat('block_prefetch_failed_start', 'number of times pre-fetch failed to start'),
     BlockCacheStat('block_prefetch_pages_read', 'pre-fetch pages read in background'),
+    BlockCacheStat('block_prefetch_pages_read_async', 'pre-fetch pages read asynchronously'),
     BlockCacheStat('block_prefetch_skipped', 'pre-fetch not triggered by page read'),
     BlockCacheStat('block_prefetch_skipped_disk_read_count', 'pre-fetch not triggered due to disk read count'),
     BlockCacheStat('block_prefetch_skipped_internal_page', 'could not perform pre-fetch on internal page'),
@@ -311,6 +312,7 @@ conn_stats = [
     CacheStat('cache_eviction_get_ref', 'eviction calls to get a page'),
     CacheStat('cache_eviction_get_ref_empty', 'eviction calls to get a page found queue empty'),
     CacheStat('cache_eviction_get_ref_empty2', 'eviction calls to get a page found queue empty after locking'),
+    CacheStat('cache_eviction_get_ref_shard_steal', 'eviction calls to get a page found it in another queue shard'),
     CacheStat('cache_eviction_internal_pages_already_queued', 'internal pages seen by eviction walk that are already queued'),
     CacheStat('cache_eviction_internal_pages_queued', 'internal pages queued for eviction'),
     CacheStat('cache_eviction_internal_pages_seen', 'internal pages seen by eviction walk'),
@@ -394,6 +396,8 @@ conn_stats = [
     CheckpointStat('checkpoint_handle_walked', 'most recent handles walked'),
     CheckpointStat('checkpoint_hs_pages_reconciled', 'number of history store pages caused to be reconciled'),
     CheckpointStat('checkpoint_pages_reconciled', 'number of pages caused to be reconciled'),
+    CheckpointStat('checkpoint_pages_reconciled_helper', 'number of leaf pages reconciled by helper threads'),
+    CheckpointStat('checkpoint_pages_reconciled_helper_wait', 'number of times the checkpoint waited for helper threads'),
     CheckpointStat('checkpoint_pages_visited_internal', 'number of internal pages visited'),
     CheckpointStat('checkpoint_pages_visited_leaf', 'number of leaf pages visited'),
     CheckpointStat('checkpoint_prep_max', 'prepare max time (msecs)', 'no_clear,no_scale'),
@@ -427,11 +431,13 @@ conn_stats = [
     ##########################################
     ChunkCacheStat('chunkcache_bytes_inuse', 'total bytes used by the cache'),
     ChunkCacheStat('chunkcache_bytes_inuse_pinned', 'total bytes used by the cache for pinned chunks'),
+    ChunkCacheStat('chunkcache_bytes_preloaded', 'total bytes preloaded from persistent content on startup'),
     ChunkCacheStat('chunkcache_bytes_read_persistent', 'total bytes read from persistent content'),
     ChunkCacheStat('chunkcache_chunks_evicted', 'chunks evicted'),
     ChunkCacheStat('chunkcache_chunks_inuse', 'total chunks held by the chunk cache'),
     ChunkCacheStat('chunkcache_chunks_loaded_from_flushed_tables', 'number of chunks loaded from flushed tables in chunk cache'),
     ChunkCacheStat('chunkcache_chunks_pinned', 'total pinned chunks held by the chunk cache'),
+    ChunkCacheStat('chunkcache_chunks_preloaded', 'chunks preloaded from persistent content on startup'),
     ChunkCacheStat('chunkcache_created_from_metadata', 'total number of chunks inserted on startup from persisted metadata.'),
     ChunkCacheStat('chunkcache_exceeded_bitmap_capacity', 'could not allocate due to exceeding bitmap capacity'),
     ChunkCacheStat('chunkcache_exceeded_capacity', 'could not allocate due to exceeding capacity'),
@@ -443,6 +449,7 @@ conn_stats = [
     ChunkCacheStat('chunkcache_metadata_work_units_dequeued', 'number of metadata inserts/deletes read by the worker thread'),
     ChunkCacheStat('chunkcache_metadata_work_units_dropped', 'number of metadata inserts/deletes dropped by the worker thread'),
     ChunkCacheStat('chunkcache_misses', 'number of misses'),
+    ChunkCacheStat('chunkcache_preload_time', 'time spent preloading persistent content on startup (usecs)', 'no_clear,no_scale'),
     ChunkCacheStat('chunkcache_retries', 'retried accessing a chunk while I/O was in progress'),
     ChunkCacheStat('chunkcache_retries_checksum_mismatch', 'retries from a chunk cache checksum mismatch'),
     ChunkCacheStat('chunkcache_spans_chunks_read', 'aggregate number of spanned chunks on read'),
@@ -456,12 +463,20 @@ conn_stats = [
     CursorStat('cursor_cached_count', 'cached cursor count', 'no_clear,no_scale'),
     CursorStat('cursor_create', 'cursor create calls'),
     CursorStat('cursor_insert', 'cursor insert calls'),
+    CursorStat('cursor_insert_batch', 'cursor insert batch calls'),
+    CursorStat('cursor_insert_batch_keys', 'cursor insert batch keys inserted'),
+    CursorStat('cursor_insert_batch_pinned', 'cursor insert batch keys inserted on a pinned leaf page'),
     CursorStat('cursor_insert_bulk', 'cursor bulk loaded cursor insert calls'),
     CursorStat('cursor_insert_bytes', 'cursor insert key and value bytes', 'size'),
     CursorStat('cursor_modify', 'cursor modify calls'),
     CursorStat('cursor_modify_bytes', 'cursor modify key and value bytes affected', 'size'),
     CursorStat('cursor_modify_bytes_touch', 'cursor modify value bytes modified', 'size'),
+    CursorStat('cursor_modify_full_value', 'cursor modify calls that write the full value'),
     CursorStat('cursor_next', 'cursor next calls'),
+    CursorStat('cursor_pool_add', 'cursors added to the connection cursor pool'),
+    CursorStat('cursor_pool_count', 'connection cursor pool count', 'no_clear,no_scale'),
+    CursorStat('cursor_pool_discard', 'cursors discarded from the connection cursor pool'),
+    CursorStat('cursor_pool_reuse', 'cursors reused from the connection cursor pool'),
     CursorStat('cursor_prev', 'cursor prev calls'),
     CursorStat('cursor_remove', 'cursor remove calls'),
     CursorStat('cursor_remove_bytes', 'cursor remove key bytes removed', 'size'),
@@ -470,6 +485,9 @@ conn_stats = [
     CursorStat('cursor_reset', 'cursor reset calls'),
     CursorStat('cursor_restart', 'cursor operation restarted'),
     CursorStat('cursor_search', 'cursor search calls'),
+    CursorStat('cursor_search_batch', 'cursor search batch calls'),
+    CursorStat('cursor_search_batch_keys', 'cursor search batch keys searched'),
+    CursorStat('cursor_search_batch_pinned', 'cursor search batch keys resolved on a pinned leaf page'),
     CursorStat('cursor_search_hs', 'cursor search history store calls'),
     CursorStat('cursor_search_near', 'cursor search near calls'),
     CursorStat('cursor_truncate', 'cursor truncate calls'),
@@ -532,6 +550,9 @@ conn_stats = [
     LogStat('log_bytes_payload', 'log bytes of payload data', 'size'),
     LogStat('log_bytes_written', 'log bytes written', 'size'),
     LogStat('log_close_yields', 'yields waiting for previous log file close'),
+    LogStat('log_compress_dict_busy', 'log compression dictionary switches skipped while in use'),
+    LogStat('log_compress_dict_switch', 'log compression dictionary switches'),
+    LogStat('log_compress_dict_writes', 'log records compressed with a dictionary'),
     LogStat('log_compress_len', 'total size of compressed records', 'size'),
     LogStat('log_compress_mem', 'total in-memory size of compressed records', 'size'),
     LogStat('log_compress_small', 'log records too small to compress'),
@@ -559,6 +580,8 @@ conn_stats = [
     LogStat('log_slot_immediate', 'slot join calls did not yield'),
     LogStat('log_slot_no_free_slots', 'slot transitions unable to find free slot'),
     LogStat('log_slot_races', 'slot join atomic update races'),
+    LogStat('log_slot_subslot_groups', 'slot join sub-slot groups joined to the active slot'),
+    LogStat('log_slot_subslot_joins', 'slot join calls consolidated in a sub-slot group'),
     LogStat('log_slot_switch_busy', 'busy returns attempting to switch slots'),
     LogStat('log_slot_unbuffered', 'slot unbuffered writes'),
     LogStat('log_slot_yield', 'slot join calls yielded'),
@@ -567,6 +590,7 @@ conn_stats = [
     LogStat('log_slot_yield_race', 'slot join calls atomic updates raced'),
     LogStat('log_slot_yield_sleep', 'slot join calls slept'),
     LogStat('log_sync', 'log sync operations'),
+    LogStat('log_sync_background', 'log sync operations for background commits'),
     LogStat('log_sync_dir', 'log sync_dir operations'),
     LogStat('log_sync_dir_duration', 'log sync_dir time duration (usecs)', 'no_clear,no_scale'),
     LogStat('log_sync_duration', 'log sync time duration (usecs)', 'no_clear,no_scale'),
@@ -590,6 +614,108 @@ conn_stats = [
     ##########################################
     # Performance Histogram Stats
     ##########################################
+    PerfHistStat('perf_hist_app_evict_latency_gt1048576', 'application thread eviction wait latency histogram (bucket 12) - 1048576us+'),
+    PerfHistStat('perf_hist_app_evict_latency_lt1', 'application thread eviction wait latency histogram (bucket 01) - less than 1us'),
+    PerfHistStat('perf_hist_app_evict_latency_lt4', 'application thread eviction wait latency histogram (bucket 02) - 1-3us'),
+    PerfHistStat('perf_hist_app_evict_latency_lt16', 'application thread eviction wait latency histogram (bucket 03) - 4-15us'),
+    PerfHistStat('perf_hist_app_evict_latency_lt64', 'application thread eviction wait latency histogram (bucket 04) - 16-63us'),
+    PerfHistStat('perf_hist_app_evict_latency_lt256', 'application thread eviction wait latency histogram (bucket 05) - 64-255us'),
+    PerfHistStat('perf_hist_app_evict_latency_lt1024', 'application thread eviction wait latency histogram (bucket 06) - 256-1023us'),
+    PerfHistStat('perf_hist_app_evict_latency_lt4096', 'application thread eviction wait latency histogram (bucket 07) - 1024-4095us'),
+    PerfHistStat('perf_hist_app_evict_latency_lt16384', 'application thread eviction wait latency histogram (bucket 08) - 4096-16383us'),
+    PerfHistStat('perf_hist_app_evict_latency_lt65536', 'application thread eviction wait latency histogram (bucket 09) - 16384-65535us'),
+    PerfHistStat('perf_hist_app_evict_latency_lt262144', 'application thread eviction wait latency histogram (bucket 10) - 65536-262143us'),
+    PerfHistStat('perf_hist_app_evict_latency_lt1048576', 'application thread eviction wait latency histogram (bucket 11) - 262144-1048575us'),
+    PerfHistStat('perf_hist_app_evict_latency_p50', 'application thread eviction wait latency histogram 50th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_app_evict_latency_p90', 'application thread eviction wait latency histogram 90th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_app_evict_latency_p99', 'application thread eviction wait latency histogram 99th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_app_evict_latency_p999', 'application thread eviction wait latency histogram 99.9th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_app_evict_latency_total_usecs', 'application thread eviction wait latency histogram total (usecs)'),
+    PerfHistStat('perf_hist_checkpoint_latency_gt1048576', 'session checkpoint latency histogram (bucket 12) - 1048576us+'),
+    PerfHistStat('perf_hist_checkpoint_latency_lt1', 'session checkpoint latency histogram (bucket 01) - less than 1us'),
+    PerfHistStat('perf_hist_checkpoint_latency_lt4', 'session checkpoint latency histogram (bucket 02) - 1-3us'),
+    PerfHistStat('perf_hist_checkpoint_latency_lt16', 'session checkpoint latency histogram (bucket 03) - 4-15us'),
+    PerfHistStat('perf_hist_checkpoint_latency_lt64', 'session checkpoint latency histogram (bucket 04) - 16-63us'),
+    PerfHistStat('perf_hist_checkpoint_latency_lt256', 'session checkpoint latency histogram (bucket 05) - 64-255us'),
+    PerfHistStat('perf_hist_checkpoint_latency_lt1024', 'session checkpoint latency histogram (bucket 06) - 256-1023us'),
+    PerfHistStat('perf_hist_checkpoint_latency_lt4096', 'session checkpoint latency histogram (bucket 07) - 1024-4095us'),
+    PerfHistStat('perf_hist_checkpoint_latency_lt16384', 'session checkpoint latency histogram (bucket 08) - 4096-16383us'),
+    PerfHistStat('perf_hist_checkpoint_latency_lt65536', 'session checkpoint latency histogram (bucket 09) - 16384-65535us'),
+    PerfHistStat('perf_hist_checkpoint_latency_lt262144', 'session checkpoint latency histogram (bucket 10) - 65536-262143us'),
+    PerfHistStat('perf_hist_checkpoint_latency_lt1048576', 'session checkpoint latency histogram (bucket 11) - 262144-1048575us'),
+    PerfHistStat('perf_hist_checkpoint_latency_p50', 'session checkpoint latency histogram 50th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_checkpoint_latency_p90', 'session checkpoint latency histogram 90th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_checkpoint_latency_p99', 'session checkpoint latency histogram 99th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_checkpoint_latency_p999', 'session checkpoint latency histogram 99.9th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_checkpoint_latency_total_usecs', 'session checkpoint latency histogram total (usecs)'),
+    PerfHistStat('perf_hist_cursor_insert_latency_gt1048576', 'cursor insert latency histogram (bucket 12) - 1048576us+'),
+    PerfHistStat('perf_hist_cursor_insert_latency_lt1', 'cursor insert latency histogram (bucket 01) - less than 1us'),
+    PerfHistStat('perf_hist_cursor_insert_latency_lt4', 'cursor insert latency histogram (bucket 02) - 1-3us'),
+    PerfHistStat('perf_hist_cursor_insert_latency_lt16', 'cursor insert latency histogram (bucket 03) - 4-15us'),
+    PerfHistStat('perf_hist_cursor_insert_latency_lt64', 'cursor insert latency histogram (bucket 04) - 16-63us'),
+    PerfHistStat('perf_hist_cursor_insert_latency_lt256', 'cursor insert latency histogram (bucket 05) - 64-255us'),
+    PerfHistStat('perf_hist_cursor_insert_latency_lt1024', 'cursor insert latency histogram (bucket 06) - 256-1023us'),
+    PerfHistStat('perf_hist_cursor_insert_latency_lt4096', 'cursor insert latency histogram (bucket 07) - 1024-4095us'),
+    PerfHistStat('perf_hist_cursor_insert_latency_lt16384', 'cursor insert latency histogram (bucket 08) - 4096-16383us'),
+    PerfHistStat('perf_hist_cursor_insert_latency_lt65536', 'cursor insert latency histogram (bucket 09) - 16384-65535us'),
+    PerfHistStat('perf_hist_cursor_insert_latency_lt262144', 'cursor insert latency histogram (bucket 10) - 65536-262143us'),
+    PerfHistStat('perf_hist_cursor_insert_latency_lt1048576', 'cursor insert latency histogram (bucket 11) - 262144-1048575us'),
+    PerfHistStat('perf_hist_cursor_insert_latency_p50', 'cursor insert latency histogram 50th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_cursor_insert_latency_p90', 'cursor insert latency histogram 90th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_cursor_insert_latency_p99', 'cursor insert latency histogram 99th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_cursor_insert_latency_p999', 'cursor insert latency histogram 99.9th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_cursor_insert_latency_total_usecs', 'cursor insert latency histogram total (usecs)'),
+    PerfHistStat('perf_hist_cursor_next_latency_gt1048576', 'cursor next latency histogram (bucket 12) - 1048576us+'),
+    PerfHistStat('perf_hist_cursor_next_latency_lt1', 'cursor next latency histogram (bucket 01) - less than 1us'),
+    PerfHistStat('perf_hist_cursor_next_latency_lt4', 'cursor next latency histogram (bucket 02) - 1-3us'),
+    PerfHistStat('perf_hist_cursor_next_latency_lt16', 'cursor next latency histogram (bucket 03) - 4-15us'),
+    PerfHistStat('perf_hist_cursor_next_latency_lt64', 'cursor next latency histogram (bucket 04) - 16-63us'),
+    PerfHistStat('perf_hist_cursor_next_latency_lt256', 'cursor next latency histogram (bucket 05) - 64-255us'),
+    PerfHistStat('perf_hist_cursor_next_latency_lt1024', 'cursor next latency histogram (bucket 06) - 256-1023us'),
+    PerfHistStat('perf_hist_cursor_next_latency_lt4096', 'cursor next latency histogram (bucket 07) - 1024-4095us'),
+    PerfHistStat('perf_hist_cursor_next_latency_lt16384', 'cursor next latency histogram (bucket 08) - 4096-16383us'),
+    PerfHistStat('perf_hist_cursor_next_latency_lt65536', 'cursor next latency histogram (bucket 09) - 16384-65535us'),
+    PerfHistStat('perf_hist_cursor_next_latency_lt262144', 'cursor next latency histogram (bucket 10) - 65536-262143us'),
+    PerfHistStat('perf_hist_cursor_next_latency_lt1048576', 'cursor next latency histogram (bucket 11) - 262144-1048575us'),
+    PerfHistStat('perf_hist_cursor_next_latency_p50', 'cursor next latency histogram 50th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_cursor_next_latency_p90', 'cursor next latency histogram 90th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_cursor_next_latency_p99', 'cursor next latency histogram 99th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_cursor_next_latency_p999', 'cursor next latency histogram 99.9th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_cursor_next_latency_total_usecs', 'cursor next latency histogram total (usecs)'),
+    PerfHistStat('perf_hist_cursor_search_latency_gt1048576', 'cursor search latency histogram (bucket 12) - 1048576us+'),
+    PerfHistStat('perf_hist_cursor_search_latency_lt1', 'cursor search latency histogram (bucket 01) - less than 1us'),
+    PerfHistStat('perf_hist_cursor_search_latency_lt4', 'cursor search latency histogram (bucket 02) - 1-3us'),
+    PerfHistStat('perf_hist_cursor_search_latency_lt16', 'cursor search latency histogram (bucket 03) - 4-15us'),
+    PerfHistStat('perf_hist_cursor_search_latency_lt64', 'cursor search latency histogram (bucket 04) - 16-63us'),
+    PerfHistStat('perf_hist_cursor_search_latency_lt256', 'cursor search latency histogram (bucket 05) - 64-255us'),
+    PerfHistStat('perf_hist_cursor_search_latency_lt1024', 'cursor search latency histogram (bucket 06) - 256-1023us'),
+    PerfHistStat('perf_hist_cursor_search_latency_lt4096', 'cursor search latency histogram (bucket 07) - 1024-4095us'),
+    PerfHistStat('perf_hist_cursor_search_latency_lt16384', 'cursor search latency histogram (bucket 08) - 4096-16383us'),
+    PerfHistStat('perf_hist_cursor_search_latency_lt65536', 'cursor search latency histogram (bucket 09) - 16384-65535us'),
+    PerfHistStat('perf_hist_cursor_search_latency_lt262144', 'cursor search latency histogram (bucket 10) - 65536-262143us'),
+    PerfHistStat('perf_hist_cursor_search_latency_lt1048576', 'cursor search latency histogram (bucket 11) - 262144-1048575us'),
+    PerfHistStat('perf_hist_cursor_search_latency_p50', 'cursor search latency histogram 50th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_cursor_search_latency_p90', 'cursor search latency histogram 90th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_cursor_search_latency_p99', 'cursor search latency histogram 99th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_cursor_search_latency_p999', 'cursor search latency histogram 99.9th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_cursor_search_latency_total_usecs', 'cursor search latency histogram total (usecs)'),
+    PerfHistStat('perf_hist_cursor_update_latency_gt1048576', 'cursor update latency histogram (bucket 12) - 1048576us+'),
+    PerfHistStat('perf_hist_cursor_update_latency_lt1', 'cursor update latency histogram (bucket 01) - less than 1us'),
+    PerfHistStat('perf_hist_cursor_update_latency_lt4', 'cursor update latency histogram (bucket 02) - 1-3us'),
+    PerfHistStat('perf_hist_cursor_update_latency_lt16', 'cursor update latency histogram (bucket 03) - 4-15us'),
+    PerfHistStat('perf_hist_cursor_update_latency_lt64', 'cursor update latency histogram (bucket 04) - 16-63us'),
+    PerfHistStat('perf_hist_cursor_update_latency_lt256', 'cursor update latency histogram (bucket 05) - 64-255us'),
+    PerfHistStat('perf_hist_cursor_update_latency_lt1024', 'cursor update latency histogram (bucket 06) - 256-1023us'),
+    PerfHistStat('perf_hist_cursor_update_latency_lt4096', 'cursor update latency histogram (bucket 07) - 1024-4095us'),
+    PerfHistStat('perf_hist_cursor_update_latency_lt16384', 'cursor update latency histogram (bucket 08) - 4096-16383us'),
+    PerfHistStat('perf_hist_cursor_update_latency_lt65536', 'cursor update latency histogram (bucket 09) - 16384-65535us'),
+    PerfHistStat('perf_hist_cursor_update_latency_lt262144', 'cursor update latency histogram (bucket 10) - 65536-262143us'),
+    PerfHistStat('perf_hist_cursor_update_latency_lt1048576', 'cursor update latency histogram (bucket 11) - 262144-1048575us'),
+    PerfHistStat('perf_hist_cursor_update_latency_p50', 'cursor update latency histogram 50th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_cursor_update_latency_p90', 'cursor update latency histogram 90th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_cursor_update_latency_p99', 'cursor update latency histogram 99th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_cursor_update_latency_p999', 'cursor update latency histogram 99.9th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_cursor_update_latency_total_usecs', 'cursor update latency histogram total (usecs)'),
     PerfHistStat('perf_hist_fsread_latency_gt1000', 'file system read latency histogram (bucket 7) - 1000ms+'),
     PerfHistStat('perf_hist_fsread_latency_lt10', 'file system read latency histogram (bucket 1) - 0-10ms'),
     PerfHistStat('perf_hist_fsread_latency_lt50', 'file system read latency histogram (bucket 2) - 10-49ms'),
@@ -620,6 +746,40 @@ conn_stats = [
     PerfHistStat('perf_hist_opwrite_latency_lt1000', 'operation write latency histogram (bucket 4) - 500-999us'),
     PerfHistStat('perf_hist_opwrite_latency_lt10000', 'operation write latency histogram (bucket 5) - 1000-9999us'),
     PerfHistStat('perf_hist_opwrite_latency_total_usecs', 'operation write latency histogram total (usecs)'),
+    PerfHistStat('perf_hist_txn_begin_latency_gt1048576', 'session begin transaction latency histogram (bucket 12) - 1048576us+'),
+    PerfHistStat('perf_hist_txn_begin_latency_lt1', 'session begin transaction latency histogram (bucket 01) - less than 1us'),
+    PerfHistStat('perf_hist_txn_begin_latency_lt4', 'session begin transaction latency histogram (bucket 02) - 1-3us'),
+    PerfHistStat('perf_hist_txn_begin_latency_lt16', 'session begin transaction latency histogram (bucket 03) - 4-15us'),
+    PerfHistStat('perf_hist_txn_begin_latency_lt64', 'session begin transaction latency histogram (bucket 04) - 16-63us'),
+    PerfHistStat('perf_hist_txn_begin_latency_lt256', 'session begin transaction latency histogram (bucket 05) - 64-255us'),
+    PerfHistStat('perf_hist_txn_begin_latency_lt1024', 'session begin transaction latency histogram (bucket 06) - 256-1023us'),
+    PerfHistStat('perf_hist_txn_begin_latency_lt4096', 'session begin transaction latency histogram (bucket 07) - 1024-4095us'),
+    PerfHistStat('perf_hist_txn_begin_latency_lt16384', 'session begin transaction latency histogram (bucket 08) - 4096-16383us'),
+    PerfHistStat('perf_hist_txn_begin_latency_lt65536', 'session begin transaction latency histogram (bucket 09) - 16384-65535us'),
+    PerfHistStat('perf_hist_txn_begin_latency_lt262144', 'session begin transaction latency histogram (bucket 10) - 65536-262143us'),
+    PerfHistStat('perf_hist_txn_begin_latency_lt1048576', 'session begin transaction latency histogram (bucket 11) - 262144-1048575us'),
+    PerfHistStat('perf_hist_txn_begin_latency_p50', 'session begin transaction latency histogram 50th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_txn_begin_latency_p90', 'session begin transaction latency histogram 90th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_txn_begin_latency_p99', 'session begin transaction latency histogram 99th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_txn_begin_latency_p999', 'session begin transaction latency histogram 99.9th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_txn_begin_latency_total_usecs', 'session begin transaction latency histogram total (usecs)'),
+    PerfHistStat('perf_hist_txn_commit_latency_gt1048576', 'session commit transaction latency histogram (bucket 12) - 1048576us+'),
+    PerfHistStat('perf_hist_txn_commit_latency_lt1', 'session commit transaction latency histogram (bucket 01) - less than 1us'),
+    PerfHistStat('perf_hist_txn_commit_latency_lt4', 'session commit transaction latency histogram (bucket 02) - 1-3us'),
+    PerfHistStat('perf_hist_txn_commit_latency_lt16', 'session commit transaction latency histogram (bucket 03) - 4-15us'),
+    PerfHistStat('perf_hist_txn_commit_latency_lt64', 'session commit transaction latency histogram (bucket 04) - 16-63us'),
+    PerfHistStat('perf_hist_txn_commit_latency_lt256', 'session commit transaction latency histogram (bucket 05) - 64-255us'),
+    PerfHistStat('perf_hist_txn_commit_latency_lt1024', 'session commit transaction latency histogram (bucket 06) - 256-1023us'),
+    PerfHistStat('perf_hist_txn_commit_latency_lt4096', 'session commit transaction latency histogram (bucket 07) - 1024-4095us'),
+    PerfHistStat('perf_hist_txn_commit_latency_lt16384', 'session commit transaction latency histogram (bucket 08) - 4096-16383us'),
+    PerfHistStat('perf_hist_txn_commit_latency_lt65536', 'session commit transaction latency histogram (bucket 09) - 16384-65535us'),
+    PerfHistStat('perf_hist_txn_commit_latency_lt262144', 'session commit transaction latency histogram (bucket 10) - 65536-262143us'),
+    PerfHistStat('perf_hist_txn_commit_latency_lt1048576', 'session commit transaction latency histogram (bucket 11) - 262144-1048575us'),
+    PerfHistStat('perf_hist_txn_commit_latency_p50', 'session commit transaction latency histogram 50th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_txn_commit_latency_p90', 'session commit transaction latency histogram 90th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_txn_commit_latency_p99', 'session commit transaction latency histogram 99th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_txn_commit_latency_p999', 'session commit transaction latency histogram 99.9th percentile (usecs)', 'no_clear,no_scale'),
+    PerfHistStat('perf_hist_txn_commit_latency_total_usecs', 'session commit transaction latency histogram total (usecs)'),
 
     ##########################################
     # Reconciliation statistics
@@ -678,6 +838,9 @@ conn_stats = [
     StorageStat('flush_tier_switched', 'flush_tier tables switched'),
     StorageStat('local_objects_inuse', 'attempts to remove a local object and the object is in use'),
     StorageStat('local_objects_removed', 'local objects removed'),
+    StorageStat('tiered_flush_bytes', 'bytes flushed to the storage source', 'size'),
+    StorageStat('tiered_flush_objects', 'objects flushed to the storage source'),
+    StorageStat('tiered_flush_parts', 'object parts flushed to the storage source in multi-part uploads'),
     StorageStat('tiered_retention', 'tiered storage local retention time (secs)', 'no_clear,no_scale,size'),
     StorageStat('tiered_work_units_created', 'tiered operations scheduled'),
     StorageStat('tiered_work_units_dequeued', 'tiered operations dequeued and processed'),
@@ -711,6 +874,8 @@ conn_stats = [
     TxnStat('txn_prepared_updates_key_repeated', 'Number of prepared updates repeated on the same key'),
     TxnStat('txn_prepared_updates_rolledback', 'Number of prepared updates rolled back'),
     TxnStat('txn_query_ts', 'query timestamp calls'),
+    TxnStat('txn_recover_parallel_batches', 'recovery log batches queued for parallel replay'),
+    TxnStat('txn_recover_parallel_wait', 'recovery log reader waits for a replay worker'),
     TxnStat('txn_rollback', 'transactions rolled back'),
     TxnStat('txn_rollback_oldest_pinned', 'oldest pinned transaction ID rolled back for eviction'),
     TxnStat('txn_rollback_to_stable_running', 'transaction rollback to stable currently running', 'no_clear,no_scale'),
@@ -729,6 +894,7 @@ conn_stats = [
     TxnStat('txn_set_ts_out_of_order', 'set timestamp global oldest timestamp set to be more recent than the global stable timestamp'),
     TxnStat('txn_set_ts_stable', 'set timestamp stable calls'),
     TxnStat('txn_set_ts_stable_upd', 'set timestamp stable updates'),
+    TxnStat('txn_sync', 'transaction sync calls'),
     TxnStat('txn_timestamp_oldest_active_read', 'transaction read timestamp of the oldest active reader', 'no_clear,no_scale'),
     TxnStat('txn_walk_sessions', 'transaction walk of concurrent sessions'),
 
@@ -789,6 +955,7 @@ dsrc_stats = [
     BtreeStat('btree_compact_pages_skipped', 'btree compact pages skipped', 'no_clear,no_scale'),
     BtreeStat('btree_compact_skipped', 'btree skipped by compaction as process would not reduce size', 'no_clear,no_scale'),
     BtreeStat('btree_entries', 'number of key/value pairs', 'no_scale,tree_walk'),
+    BtreeStat('btree_contention_max', 'maximum compare-and-swap retries and restarts modifying a page between reconciliations', 'max_aggregate,no_scale'),
     BtreeStat('btree_fixed_len', 'fixed-record size', 'max_aggregate,no_scale,size'),
     BtreeStat('btree_maximum_depth', 'maximum tree depth', 'max_aggregate,no_scale'),
     BtreeStat('btree_maxintlpage', 'maximum internal page size', 'max_aggregate,no_scale,size'),
@@ -864,11 +1031,14 @@ dsrc_stats = [
     CursorStat('cursor_cache', 'close calls that result in cache'),
     CursorStat('cursor_create', 'create calls'),
     CursorStat('cursor_insert', 'insert calls'),
+    CursorStat('cursor_insert_batch', 'insert batch calls'),
+    CursorStat('cursor_insert_batch_keys', 'insert batch keys inserted'),
     CursorStat('cursor_insert_bulk', 'bulk loaded cursor insert calls'),
     CursorStat('cursor_insert_bytes', 'insert key and value bytes', 'size'),
     CursorStat('cursor_modify', 'modify'),
     CursorStat('cursor_modify_bytes', 'modify key and value bytes affected', 'size'),
     CursorStat('cursor_modify_bytes_touch', 'modify value bytes modified', 'size'),
+    CursorStat('cursor_modify_full_value', 'modify calls that write the full value'),
     CursorStat('cursor_next', 'next calls'),
     CursorStat('cursor_prev', 'prev calls'),
     CursorStat('cursor_remove', 'remove calls'),
@@ -878,6 +1048,8 @@ dsrc_stats = [
     CursorStat('cursor_reset', 'reset calls'),
     CursorStat('cursor_restart', 'operation restarted'),
     CursorStat('cursor_search', 'search calls'),
+    CursorStat('cursor_search_batch', 'search batch calls'),
+    CursorStat('cursor_search_batch_keys', 'search batch keys searched'),
     CursorStat('cursor_search_hs', 'search history store calls'),
     CursorStat('cursor_search_near', 'search near calls'),
     CursorStat('cursor_truncate', 'truncate calls'),
@@ -994,6 +1166,7 @@ conn_dsrc_stats = [
     CacheStat('cache_hs_read_squash', 'history store table reads requiring squashed modifies'),
     CacheStat('cache_hs_write_squash', 'history store table writes requiring squashed modifies'),
     CacheStat('cache_inmem_split', 'in-memory page splits'),
+    CacheStat('cache_inmem_split_contended', 'in-memory page splits queued for contended pages'),
     CacheStat('cache_inmem_splittable', 'in-memory page passed criteria to be split'),
     CacheStat('cache_eviction_blocked_multi_block_reconcilation_during_checkpoint', 'multi-block reconciliation blocked whilst checkpoint is running'),
     CacheStat('cache_pages_prefetch', 'pages requested from the cache due to pre-fetch'),
@@ -1022,6 +1195,8 @@ conn_dsrc_stats = [
     # Cursor operations
     ##########################################
     CursorStat('cursor_bounds_comparisons', 'cursor bounds comparisons performed'),
+    CursorStat('cursor_insert_list_restart', 'cursor insert list compare-and-swap restarts'),
+    CursorStat('cursor_update_cas_retry', 'cursor update chain compare-and-swap retries'),
     CursorStat('cursor_bounds_reset', 'cursor bounds cleared from reset'),
     CursorStat('cursor_bounds_next_early_exit', 'cursor bounds next early exit'),
     CursorStat('cursor_bounds_prev_early_exit', 'cursor bounds prev early exit'),
@@ -1040,6 +1215,7 @@ conn_dsrc_stats = [
     CursorStat('cursor_prev_skip_total', 'Total number of entries skipped by cursor prev calls'),
     CursorStat('cursor_reposition', 'Total number of times cursor temporarily releases pinned page to encourage eviction of hot or large page'),
     CursorStat('cursor_reposition_failed', 'Total number of times cursor fails to temporarily release pinned page to encourage eviction of hot or large page'),
+    CursorStat('cursor_search_leaf_bloom_skip', 'cursor search calls resolved by a leaf page Bloom filter without reading the page'),
     CursorStat('cursor_search_near_prefix_fast_paths', 'Total number of times a search near has exited due to prefix config'),
     CursorStat('cursor_skip_hs_cur_position', 'Total number of entries skipped to position the history store cursor'),
 
@@ -1053,6 +1229,7 @@ conn_dsrc_stats = [
     CursorStat('cursor_equals_error', 'cursor equals calls that return an error'),
     CursorStat('cursor_get_key_error', 'cursor get key calls that return an error'),
     CursorStat('cursor_get_value_error', 'cursor get value calls that return an error'),
+    CursorStat('cursor_insert_batch_error', 'cursor insert batch calls that return an error'),
     CursorStat('cursor_insert_check_error', 'cursor insert check calls that return an error'),
     CursorStat('cursor_insert_error', 'cursor insert calls that return an error'),
     CursorStat('cursor_largest_key_error', 'cursor largest key calls that return an error'),
@@ -1065,6 +1242,7 @@ conn_dsrc_stats = [
     CursorStat('cursor_reserve_error', 'cursor reserve calls that return an error'),
     CursorStat('cursor_reopen_error', 'cursor reopen calls that return an error'),
     CursorStat('cursor_remove_error', 'cursor remove calls that return an error'),
+    CursorStat('cursor_search_batch_error', 'cursor search batch calls that return an error'),
     CursorStat('cursor_search_near_error', 'cursor search near calls that return an error'),
     CursorStat('cursor_search_error', 'cursor search calls that return an error'),
     CursorStat('cursor_update_error', 'cursor update calls that return an error'),
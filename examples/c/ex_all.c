@@ -270,6 +270,26 @@ cursor_ops(WT_SESSION *session)
         /*! [Insert a new record or overwrite an existing record] */
     }
 
+    {
+        /*! [Insert a batch of records] */
+        /* Keys and values are passed in packed form: strings include their trailing nul byte. */
+        const char *batch_keys[] = {"third key", "first key", "second key"};
+        const char *batch_values[] = {"third value", "first value", "second value"};
+        WT_ITEM keys[3], values[3];
+        size_t i;
+
+        memset(keys, 0, sizeof(keys));
+        memset(values, 0, sizeof(values));
+        for (i = 0; i < 3; ++i) {
+            keys[i].data = batch_keys[i];
+            keys[i].size = strlen(batch_keys[i]) + 1;
+            values[i].data = batch_values[i];
+            values[i].size = strlen(batch_values[i]) + 1;
+        }
+        error_check(cursor->insert_batch(cursor, keys, values, 3));
+        /*! [Insert a batch of records] */
+    }
+
     {
         /*! [Search for an exact match] */
         const char *key = "some key";
@@ -278,6 +298,26 @@ cursor_ops(WT_SESSION *session)
         /*! [Search for an exact match] */
     }
 
+    {
+        /*! [Search for a batch of keys] */
+        /* Keys are passed in packed form: string keys include their trailing nul byte. */
+        const char *batch[] = {"some key", "another key", "new key"};
+        WT_ITEM keys[3], values[3];
+        size_t i;
+        int results[3];
+
+        memset(keys, 0, sizeof(keys));
+        for (i = 0; i < 3; ++i) {
+            keys[i].data = batch[i];
+            keys[i].size = strlen(batch[i]) + 1;
+        }
+        error_check(cursor->search_batch(cursor, keys, values, results, 3));
+        for (i = 0; i < 3; ++i)
+            if (results[i] == 0)
+                printf("%s: %s\n", batch[i], (const char *)values[i].data);
+        /*! [Search for a batch of keys] */
+    }
+
     cursor_search_near(cursor);
 
     {
@@ -850,6 +890,19 @@ transaction_ops(WT_SESSION *session_arg)
     error_check(session->commit_transaction(session, NULL));
     /*! [transaction isolation] */
 
+    /*! [transaction sync] */
+    /*
+     * Commit without waiting for the log records to reach the storage device, then wait for them
+     * separately.
+     */
+    error_check(session->begin_transaction(session, NULL));
+    cursor->set_key(cursor, "some-key");
+    cursor->set_value(cursor, "some-value");
+    error_check(cursor->update(cursor));
+    error_check(session->commit_transaction(session, "sync=background"));
+    error_check(session->transaction_sync(session, "timeout_ms=10000"));
+    /*! [transaction sync] */
+
     {
         /*! [transaction prepare] */
         /*
@@ -109,12 +109,13 @@ zfree(void *cookie, void *p)
 }
 
 /*
- * zlib_compress --
- *     WiredTiger zlib compression.
+ * zlib_compress_internal --
+ *     WiredTiger zlib compression, optionally with a preset dictionary.
  */
 static int
-zlib_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
-  uint8_t *dst, size_t dst_len, size_t *result_lenp, int *compression_failed)
+zlib_compress_internal(WT_COMPRESSOR *compressor, WT_SESSION *session, const uint8_t *dict,
+  size_t dict_len, uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len, size_t *result_lenp,
+  int *compression_failed)
 {
     ZLIB_COMPRESSOR *zlib_compressor;
     ZLIB_OPAQUE opaque;
@@ -132,6 +133,11 @@ zlib_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size
 
     if ((ret = deflateInit(&zs, zlib_compressor->zlib_level)) != Z_OK)
         return (zlib_error(compressor, session, "deflateInit", ret));
+    if (dict != NULL &&
+      (ret = deflateSetDictionary(&zs, (const Bytef *)dict, (uInt)dict_len)) != Z_OK) {
+        (void)deflateEnd(&zs);
+        return (zlib_error(compressor, session, "deflateSetDictionary", ret));
+    }
 
     zs.next_in = src;
     zs.avail_in = (uint32_t)src_len;
@@ -150,12 +156,37 @@ zlib_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size
 }
 
 /*
- * zlib_decompress --
- *     WiredTiger zlib decompression.
+ * zlib_compress --
+ *     WiredTiger zlib compression.
  */
 static int
-zlib_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
-  uint8_t *dst, size_t dst_len, size_t *result_lenp)
+zlib_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
+  uint8_t *dst, size_t dst_len, size_t *result_lenp, int *compression_failed)
+{
+    return (zlib_compress_internal(compressor, session, NULL, 0, src, src_len, dst, dst_len,
+      result_lenp, compression_failed));
+}
+
+/*
+ * zlib_compress_dictionary --
+ *     WiredTiger zlib compression with a preset dictionary.
+ */
+static int
+zlib_compress_dictionary(WT_COMPRESSOR *compressor, WT_SESSION *session, const uint8_t *dict,
+  size_t dict_len, uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len, size_t *result_lenp,
+  int *compression_failed)
+{
+    return (zlib_compress_internal(compressor, session, dict, dict_len, src, src_len, dst, dst_len,
+      result_lenp, compression_failed));
+}
+
+/*
+ * zlib_decompress_internal --
+ *     WiredTiger zlib decompression, optionally with a preset dictionary.
+ */
+static int
+zlib_decompress_internal(WT_COMPRESSOR *compressor, WT_SESSION *session, const uint8_t *dict,
+  size_t dict_len, uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len, size_t *result_lenp)
 {
     ZLIB_OPAQUE opaque;
     z_stream zs;
@@ -175,8 +206,14 @@ zlib_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, si
     zs.avail_in = (uint32_t)src_len;
     zs.next_out = dst;
     zs.avail_out = (uint32_t)dst_len;
-    while ((ret = inflate(&zs, Z_FINISH)) == Z_OK)
-        ;
+    for (;;) {
+        ret = inflate(&zs, Z_FINISH);
+        /* Streams compressed with a preset dictionary ask for it before returning any data. */
+        if (ret == Z_NEED_DICT && dict != NULL)
+            ret = inflateSetDictionary(&zs, (const Bytef *)dict, (uInt)dict_len);
+        if (ret != Z_OK)
+            break;
+    }
     if (ret == Z_STREAM_END) {
         *result_lenp = (size_t)zs.total_out;
         ret = Z_OK;
@@ -188,6 +225,30 @@ zlib_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, si
     return (ret == Z_OK ? 0 : zlib_error(compressor, session, "inflate", ret));
 }
 
+/*
+ * zlib_decompress --
+ *     WiredTiger zlib decompression.
+ */
+static int
+zlib_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
+  uint8_t *dst, size_t dst_len, size_t *result_lenp)
+{
+    return (zlib_decompress_internal(
+      compressor, session, NULL, 0, src, src_len, dst, dst_len, result_lenp));
+}
+
+/*
+ * zlib_decompress_dictionary --
+ *     WiredTiger zlib decompression with a preset dictionary.
+ */
+static int
+zlib_decompress_dictionary(WT_COMPRESSOR *compressor, WT_SESSION *session, const uint8_t *dict,
+  size_t dict_len, uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len, size_t *result_lenp)
+{
+    return (zlib_decompress_internal(
+      compressor, session, dict, dict_len, src, src_len, dst, dst_len, result_lenp));
+}
+
 /*
  * zlib_terminate --
  *     WiredTiger zlib compression termination.
@@ -201,6 +262,47 @@ zlib_terminate(WT_COMPRESSOR *compressor, WT_SESSION *session)
     return (0);
 }
 
+/*
+ * zlib_customize --
+ *     WiredTiger zlib per-table customization: if the table's class of page is configured with its
+ *     own compression level, return a compressor with that level.
+ */
+static int
+zlib_customize(WT_COMPRESSOR *compressor, WT_SESSION *session, const char *uri,
+  const char *config, WT_COMPRESSOR **customp)
+{
+    WT_CONFIG_ITEM v;
+    WT_EXTENSION_API *wt_api;
+    ZLIB_COMPRESSOR *custom, *zlib_compressor;
+    int ret;
+
+    (void)uri; /* Unused parameters */
+
+    zlib_compressor = (ZLIB_COMPRESSOR *)compressor;
+    wt_api = zlib_compressor->wt_api;
+
+    if (config == NULL)
+        return (0);
+    if ((ret = wt_api->config_get_string(wt_api, session, config, "level", &v)) != 0)
+        return (ret == WT_NOTFOUND ? 0 : ret);
+
+    /* A level of zero means the level the extension was loaded with. */
+    if (v.val == 0 || v.val == zlib_compressor->zlib_level)
+        return (0);
+    if (v.val < 0 || v.val > 9) {
+        (void)wt_api->err_printf(
+          wt_api, session, "zlib_customize: unsupported compression level %d", (int)v.val);
+        return (EINVAL);
+    }
+
+    if ((custom = calloc(1, sizeof(ZLIB_COMPRESSOR))) == NULL)
+        return (errno);
+    *custom = *zlib_compressor;
+    custom->zlib_level = (int)v.val;
+    *customp = (WT_COMPRESSOR *)custom;
+    return (0);
+}
+
 /*
  * zlib_add_compressor --
  *     Add a zlib compressor.
@@ -218,6 +320,9 @@ zlib_add_compressor(WT_CONNECTION *connection, const char *name, int zlib_level)
     zlib_compressor->compressor.decompress = zlib_decompress;
     zlib_compressor->compressor.pre_size = NULL;
     zlib_compressor->compressor.terminate = zlib_terminate;
+    zlib_compressor->compressor.customize = zlib_customize;
+    zlib_compressor->compressor.compress_dictionary = zlib_compress_dictionary;
+    zlib_compressor->compressor.decompress_dictionary = zlib_decompress_dictionary;
 
     zlib_compressor->wt_api = connection->get_extension_api(connection);
     zlib_compressor->zlib_level = zlib_level;
@@ -27,7 +27,9 @@
  */
 
 #include <zstd.h>
+#include <zdict.h>
 #include <errno.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -64,6 +66,48 @@ struct ZSTD_Context_Pool {
 
 typedef enum { CONTEXT_TYPE_COMPRESS, CONTEXT_TYPE_DECOMPRESS } CONTEXT_TYPE;
 
+/*
+ * Dictionary compression: tables of small, similar records compress poorly a page at a time. When
+ * configured, the compressor is customized for each table: it samples the table's pages, trains a
+ * zstd dictionary from them and compresses later pages with it, training a new dictionary after a
+ * configured number of pages. Every dictionary a table has used is returned as the compressor's
+ * state when the table is checkpointed, WiredTiger stores the state in the table's metadata and
+ * passes it back when the table is opened. A dictionary isn't stored until a checkpoint, but
+ * neither is any page compressed with it. Zstd stores the dictionary ID in each frame, which
+ * selects the dictionary to decompress with.
+ */
+struct ZSTD_Dictionary;
+typedef struct ZSTD_Dictionary ZSTD_DICTIONARY;
+struct ZSTD_Dictionary {
+    unsigned id;       /* Dictionary ID */
+    void *buf;         /* Dictionary */
+    size_t len;        /* Dictionary length */
+    ZSTD_CDict *cdict; /* Digested for compression */
+    ZSTD_DDict *ddict; /* Digested for decompression */
+    ZSTD_DICTIONARY *next;
+};
+
+typedef struct {
+    WT_EXTENSION_SPINLOCK lock; /* Dictionary list and sample lock */
+    ZSTD_DICTIONARY *list;      /* Dictionaries, current (newest) first */
+    unsigned count;             /* Dictionaries */
+
+    char *state;          /* Encoded dictionaries, the compressor's state */
+    size_t state_len;     /* Encoded dictionaries length */
+    unsigned state_count; /* Dictionaries encoded */
+
+    uint64_t pages;       /* Pages compressed since the last training */
+    int trained;          /* A training has been attempted */
+    int training;         /* A thread is training a dictionary */
+    uint8_t *samples;     /* Sampled pages */
+    size_t *sample_sizes; /* Sampled page sizes */
+    size_t sample_len;    /* Sampled bytes */
+    unsigned nsamples;    /* Sampled pages */
+} ZSTD_DICTIONARY_TABLE;
+
+/* Each dictionary in the compressor's state is its length in hex digits, then the dictionary. */
+#define ZSTD_DICTIONARY_LEN_DIGITS 8
+
 /* Local compressor structure. */
 typedef struct {
     WT_COMPRESSOR compressor; /* Must come first */
@@ -71,9 +115,16 @@ typedef struct {
     WT_EXTENSION_API *wt_api; /* Extension API */
 
     int compression_level; /* compression level */
+    int custom;            /* Customized instance, shares the base compressor's resources */
 
     ZSTD_CONTEXT_POOL *cctx_pool; /* Compression context pool. */
     ZSTD_CONTEXT_POOL *dctx_pool; /* Decompression context pool. */
+
+    int dictionary;               /* Dictionary compression configured */
+    size_t dictionary_size;       /* Maximum dictionary size */
+    unsigned dictionary_samples;  /* Pages sampled to train a dictionary */
+    uint64_t dictionary_retrain;  /* Pages compressed between trainings, 0 to train once */
+    ZSTD_DICTIONARY_TABLE *table; /* Table dictionaries, customized compressors only */
 } ZSTD_COMPRESSOR;
 
 /*
@@ -180,24 +231,358 @@ zstd_release_context(
 }
 
 /*
- *  zstd_compress --
- *	WiredTiger Zstd compression.
+ * zstd_dict_current --
+ *     Return the dictionary new pages of a table are compressed with, if any.
+ */
+static ZSTD_DICTIONARY *
+zstd_dict_current(ZSTD_COMPRESSOR *zcompressor, WT_SESSION *session)
+{
+    WT_EXTENSION_API *wt_api;
+    ZSTD_DICTIONARY *dict;
+    ZSTD_DICTIONARY_TABLE *table;
+
+    wt_api = zcompressor->wt_api;
+    table = zcompressor->table;
+
+    wt_api->spin_lock(wt_api, session, &table->lock);
+    dict = table->list;
+    wt_api->spin_unlock(wt_api, session, &table->lock);
+    return (dict);
+}
+
+/*
+ * zstd_dict_lookup --
+ *     Return a table's dictionary with the given ID, if any.
+ */
+static ZSTD_DICTIONARY *
+zstd_dict_lookup(ZSTD_COMPRESSOR *zcompressor, WT_SESSION *session, unsigned id)
+{
+    ZSTD_DICTIONARY *dict;
+
+    /* Dictionaries are only added to the head of the list, the rest of the list doesn't change. */
+    for (dict = zstd_dict_current(zcompressor, session); dict != NULL; dict = dict->next)
+        if (dict->id == id)
+            break;
+    return (dict);
+}
+
+/*
+ * zstd_dict_create --
+ *     Digest a dictionary for compression and decompression.
  */
 static int
-zstd_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
-  uint8_t *dst, size_t dst_len, size_t *result_lenp, int *compression_failed)
+zstd_dict_create(
+  ZSTD_COMPRESSOR *zcompressor, const void *buf, size_t len, ZSTD_DICTIONARY **dictp)
+{
+    ZSTD_DICTIONARY *dict;
+
+    *dictp = NULL;
+
+    if ((dict = calloc(1, sizeof(ZSTD_DICTIONARY))) == NULL)
+        return (errno);
+    if ((dict->id = ZDICT_getDictID(buf, len)) == 0) {
+        free(dict);
+        return (EINVAL);
+    }
+    dict->cdict = ZSTD_createCDict(buf, len, zcompressor->compression_level);
+    dict->ddict = ZSTD_createDDict(buf, len);
+    if (dict->cdict == NULL || dict->ddict == NULL) {
+        ZSTD_freeCDict(dict->cdict);
+        ZSTD_freeDDict(dict->ddict);
+        free(dict);
+        return (ENOMEM);
+    }
+    if ((dict->buf = malloc(len)) == NULL) {
+        ZSTD_freeCDict(dict->cdict);
+        ZSTD_freeDDict(dict->ddict);
+        free(dict);
+        return (errno);
+    }
+    memcpy(dict->buf, buf, len);
+    dict->len = len;
+
+    *dictp = dict;
+    return (0);
+}
+
+/*
+ * zstd_dict_free --
+ *     Discard a dictionary.
+ */
+static void
+zstd_dict_free(ZSTD_DICTIONARY *dict)
+{
+    ZSTD_freeCDict(dict->cdict);
+    ZSTD_freeDDict(dict->ddict);
+    free(dict->buf);
+    free(dict);
+}
+
+/*
+ * zstd_dict_train --
+ *     Train a table dictionary from sampled pages and make it the dictionary new pages are
+ *     compressed with.
+ */
+static void
+zstd_dict_train(ZSTD_COMPRESSOR *zcompressor, WT_SESSION *session, const uint8_t *samples,
+  const size_t *sample_sizes, unsigned nsamples)
+{
+    WT_EXTENSION_API *wt_api;
+    ZSTD_DICTIONARY *dict;
+    ZSTD_DICTIONARY_TABLE *table;
+    size_t len;
+    void *buf;
+
+    wt_api = zcompressor->wt_api;
+    table = zcompressor->table;
+
+    if ((buf = malloc(zcompressor->dictionary_size)) == NULL)
+        return;
+
+    /*
+     * Training fails if the samples don't have enough in common to build a dictionary, that's not
+     * an error, the table's pages continue to be compressed as they were.
+     */
+    len = ZDICT_trainFromBuffer(buf, zcompressor->dictionary_size, samples, sample_sizes, nsamples);
+    if (ZDICT_isError(len) ||
+      zstd_dict_lookup(zcompressor, session, ZDICT_getDictID(buf, len)) != NULL)
+        goto err;
+
+    if (zstd_dict_create(zcompressor, buf, len, &dict) != 0)
+        goto err;
+
+    wt_api->spin_lock(wt_api, session, &table->lock);
+    dict->next = table->list;
+    table->list = dict;
+    ++table->count;
+    wt_api->spin_unlock(wt_api, session, &table->lock);
+
+err:
+    free(buf);
+}
+
+/*
+ * zstd_dict_sample --
+ *     Sample a table page for dictionary training, training a dictionary once enough pages have
+ *     been sampled.
+ */
+static void
+zstd_dict_sample(
+  ZSTD_COMPRESSOR *zcompressor, WT_SESSION *session, const uint8_t *src, size_t src_len)
+{
+    WT_EXTENSION_API *wt_api;
+    ZSTD_DICTIONARY_TABLE *table;
+    size_t *sample_sizes;
+    unsigned nsamples;
+    uint8_t *samples;
+
+    wt_api = zcompressor->wt_api;
+    table = zcompressor->table;
+
+    /*
+     * Sample until the first training, then wait for the configured number of pages before sampling
+     * again. One thread trains at a time, other threads don't sample while it does.
+     */
+    wt_api->spin_lock(wt_api, session, &table->lock);
+    if (table->training ||
+      (table->trained &&
+        (zcompressor->dictionary_retrain == 0 ||
+          table->pages++ < zcompressor->dictionary_retrain)))
+        goto done;
+
+    if (table->sample_sizes == NULL &&
+      (table->sample_sizes = calloc(zcompressor->dictionary_samples, sizeof(size_t))) == NULL)
+        goto done;
+    if ((samples = realloc(table->samples, table->sample_len + src_len)) == NULL)
+        goto done;
+    memcpy(samples + table->sample_len, src, src_len);
+    table->samples = samples;
+    table->sample_len += src_len;
+    table->sample_sizes[table->nsamples] = src_len;
+    if (++table->nsamples < zcompressor->dictionary_samples)
+        goto done;
+
+    /* Take the samples and train without holding the lock. */
+    samples = table->samples;
+    sample_sizes = table->sample_sizes;
+    nsamples = table->nsamples;
+    table->samples = NULL;
+    table->sample_sizes = NULL;
+    table->sample_len = 0;
+    table->nsamples = 0;
+    table->training = 1;
+    wt_api->spin_unlock(wt_api, session, &table->lock);
+
+    zstd_dict_train(zcompressor, session, samples, sample_sizes, nsamples);
+    free(samples);
+    free(sample_sizes);
+
+    wt_api->spin_lock(wt_api, session, &table->lock);
+    table->pages = 0;
+    table->trained = 1;
+    table->training = 0;
+done:
+    wt_api->spin_unlock(wt_api, session, &table->lock);
+}
+
+/*
+ * zstd_dict_load --
+ *     Load a table's dictionaries from the compressor's state.
+ */
+static int
+zstd_dict_load(ZSTD_COMPRESSOR *zcompressor, WT_SESSION *session, const char *state, size_t len)
+{
+    WT_EXTENSION_API *wt_api;
+    ZSTD_DICTIONARY *dict, **tailp;
+    ZSTD_DICTIONARY_TABLE *table;
+    size_t dict_len, i;
+    int ret;
+    uint8_t *buf;
+    char hex[ZSTD_DICTIONARY_LEN_DIGITS + 1], *p;
+
+    wt_api = zcompressor->wt_api;
+    table = zcompressor->table;
+
+    /* The state lists the dictionaries newest first, the order of the table's list. */
+    buf = NULL;
+    ret = 0;
+    for (tailp = &table->list; len > 0; tailp = &dict->next) {
+        if (len < ZSTD_DICTIONARY_LEN_DIGITS)
+            goto corrupt;
+        memcpy(hex, state, ZSTD_DICTIONARY_LEN_DIGITS);
+        hex[ZSTD_DICTIONARY_LEN_DIGITS] = '\0';
+        dict_len = (size_t)strtoul(hex, &p, 16);
+        if (*p != '\0' || dict_len == 0 || dict_len > (len - ZSTD_DICTIONARY_LEN_DIGITS) / 2)
+            goto corrupt;
+        state += ZSTD_DICTIONARY_LEN_DIGITS;
+        len -= ZSTD_DICTIONARY_LEN_DIGITS;
+
+        if ((buf = malloc(dict_len)) == NULL) {
+            ret = errno;
+            goto err;
+        }
+        for (i = 0; i < dict_len; ++i, state += 2) {
+            memcpy(hex, state, 2);
+            hex[2] = '\0';
+            buf[i] = (uint8_t)strtoul(hex, &p, 16);
+            if (*p != '\0')
+                goto corrupt;
+        }
+        len -= dict_len * 2;
+
+        if ((ret = zstd_dict_create(zcompressor, buf, dict_len, &dict)) != 0)
+            goto err;
+        *tailp = dict;
+        ++table->count;
+        free(buf);
+        buf = NULL;
+    }
+    return (0);
+
+corrupt:
+    ret = WT_ERROR;
+err:
+    (void)wt_api->err_printf(
+      wt_api, session, "zstd dictionary load: %s", wt_api->strerror(wt_api, session, ret));
+    free(buf);
+    return (ret);
+}
+
+/*
+ * zstd_get_state --
+ *     WiredTiger Zstd compressor state: a table's dictionaries, encoded as hex.
+ */
+static int
+zstd_get_state(WT_COMPRESSOR *compressor, WT_SESSION *session, WT_ITEM *state)
+{
+    static const char hex[] = "0123456789abcdef";
+    WT_EXTENSION_API *wt_api;
+    ZSTD_COMPRESSOR *zcompressor;
+    ZSTD_DICTIONARY *dict, *list;
+    ZSTD_DICTIONARY_TABLE *table;
+    size_t i, len;
+    unsigned count;
+    char *p;
+
+    zcompressor = (ZSTD_COMPRESSOR *)compressor;
+    wt_api = zcompressor->wt_api;
+
+    state->data = NULL;
+    state->size = 0;
+    if ((table = zcompressor->table) == NULL)
+        return (0);
+
+    /* Dictionaries are only added to the head of the list, the rest of the list doesn't change. */
+    wt_api->spin_lock(wt_api, session, &table->lock);
+    list = table->list;
+    count = table->count;
+    wt_api->spin_unlock(wt_api, session, &table->lock);
+
+    /* Only re-encode the dictionaries if there's a new one since the last call. */
+    if (count != table->state_count) {
+        for (len = 0, dict = list; dict != NULL; dict = dict->next)
+            len += ZSTD_DICTIONARY_LEN_DIGITS + dict->len * 2;
+        if ((p = malloc(len + 1)) == NULL)
+            return (errno);
+        free(table->state);
+        table->state = p;
+        table->state_len = len;
+        table->state_count = count;
+        for (dict = list; dict != NULL; dict = dict->next) {
+            (void)snprintf(p, ZSTD_DICTIONARY_LEN_DIGITS + 1, "%08x", (unsigned)dict->len);
+            p += ZSTD_DICTIONARY_LEN_DIGITS;
+            for (i = 0; i < dict->len; ++i) {
+                *p++ = hex[((uint8_t *)dict->buf)[i] >> 4];
+                *p++ = hex[((uint8_t *)dict->buf)[i] & 0x0f];
+            }
+        }
+    }
+
+    state->data = table->state;
+    state->size = table->state_len;
+    return (0);
+}
+
+/*
+ * zstd_compress_internal --
+ *     WiredTiger Zstd compression, optionally with a caller's raw content dictionary.
+ */
+static int
+zstd_compress_internal(WT_COMPRESSOR *compressor, WT_SESSION *session, const uint8_t *raw_dict,
+  size_t raw_dict_len, uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len,
+  size_t *result_lenp, int *compression_failed)
 {
+    ZSTD_CCtx *cctx;
     ZSTD_COMPRESSOR *zcompressor;
     ZSTD_CONTEXT *context = NULL;
+    ZSTD_DICTIONARY *dict;
     size_t zstd_ret;
     uint64_t zstd_len;
 
     zcompressor = (ZSTD_COMPRESSOR *)compressor;
 
+    dict = zcompressor->table == NULL ? NULL : zstd_dict_current(zcompressor, session);
+
     zstd_get_context(zcompressor, session, CONTEXT_TYPE_COMPRESS, &context);
 
-    /* Compress, starting past the prefix bytes. */
-    if (context != NULL) {
+    /*
+     * Compress, starting past the prefix bytes. Without a pooled context, compress without the
+     * table's dictionary, the page is readable either way. A caller's dictionary is required to
+     * read the data back, it's always used.
+     */
+    if (raw_dict != NULL) {
+        if (context != NULL)
+            cctx = (ZSTD_CCtx *)context->ctx;
+        else if ((cctx = ZSTD_createCCtx()) == NULL)
+            return (ENOMEM);
+        zstd_ret = ZSTD_compress_usingDict(cctx, dst + ZSTD_PREFIX, dst_len - ZSTD_PREFIX, src,
+          src_len, raw_dict, raw_dict_len, zcompressor->compression_level);
+        if (context == NULL)
+            ZSTD_freeCCtx(cctx);
+    } else if (context != NULL && dict != NULL) {
+        zstd_ret = ZSTD_compress_usingCDict((ZSTD_CCtx *)context->ctx, dst + ZSTD_PREFIX,
+          dst_len - ZSTD_PREFIX, src, src_len, dict->cdict);
+    } else if (context != NULL) {
         zstd_ret = ZSTD_compressCCtx((ZSTD_CCtx *)context->ctx, dst + ZSTD_PREFIX,
           dst_len - ZSTD_PREFIX, src, src_len, zcompressor->compression_level);
     } else {
@@ -206,6 +591,9 @@ zstd_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size
     }
 
     zstd_release_context(zcompressor, session, CONTEXT_TYPE_COMPRESS, context);
+
+    if (zcompressor->table != NULL && zcompressor->dictionary)
+        zstd_dict_sample(zcompressor, session, src, src_len);
     /*
      * If compression succeeded and the compressed length is smaller than the original size, return
      * success.
@@ -235,18 +623,47 @@ zstd_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size
 }
 
 /*
- * zstd_decompress --
- *     WiredTiger Zstd decompression.
+ *  zstd_compress --
+ *	WiredTiger Zstd compression.
  */
 static int
-zstd_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
-  uint8_t *dst, size_t dst_len, size_t *result_lenp)
+zstd_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
+  uint8_t *dst, size_t dst_len, size_t *result_lenp, int *compression_failed)
+{
+    return (zstd_compress_internal(compressor, session, NULL, 0, src, src_len, dst, dst_len,
+      result_lenp, compression_failed));
+}
+
+/*
+ * zstd_compress_dictionary --
+ *     WiredTiger Zstd compression with a raw content dictionary.
+ */
+static int
+zstd_compress_dictionary(WT_COMPRESSOR *compressor, WT_SESSION *session, const uint8_t *dict,
+  size_t dict_len, uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len, size_t *result_lenp,
+  int *compression_failed)
+{
+    return (zstd_compress_internal(compressor, session, dict, dict_len, src, src_len, dst, dst_len,
+      result_lenp, compression_failed));
+}
+
+/*
+ * zstd_decompress_internal --
+ *     WiredTiger Zstd decompression, optionally with a caller's raw content dictionary.
+ */
+static int
+zstd_decompress_internal(WT_COMPRESSOR *compressor, WT_SESSION *session, const uint8_t *raw_dict,
+  size_t raw_dict_len, uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len,
+  size_t *result_lenp)
 {
     WT_EXTENSION_API *wt_api;
     ZSTD_COMPRESSOR *zcompressor;
     ZSTD_CONTEXT *context = NULL;
+    ZSTD_DCtx *dctx;
+    ZSTD_DICTIONARY *dict;
     size_t zstd_ret;
     uint64_t zstd_len;
+    unsigned dict_id;
 
     wt_api = ((ZSTD_COMPRESSOR *)compressor)->wt_api;
     zcompressor = (ZSTD_COMPRESSOR *)compressor;
@@ -264,13 +681,37 @@ zstd_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, si
         return (WT_ERROR);
     }
 
+    /* Find the dictionary the page was compressed with, if any. */
+    dict = NULL;
+    if (raw_dict == NULL &&
+      (dict_id = ZSTD_getDictID_fromFrame(src + ZSTD_PREFIX, (size_t)zstd_len)) != 0 &&
+      (zcompressor->table == NULL ||
+        (dict = zstd_dict_lookup(zcompressor, session, dict_id)) == NULL)) {
+        (void)wt_api->err_printf(
+          wt_api, session, "WT_COMPRESSOR.decompress: zstd dictionary %u not found", dict_id);
+        return (WT_ERROR);
+    }
+
     /*
      * This type of context management is useful to avoid repeated context allocation overhead. This
      * is typically for block compression, for streaming compression, context could be reused over
      * and over again for performance gains.
      */
     zstd_get_context(zcompressor, session, CONTEXT_TYPE_DECOMPRESS, &context);
-    if (context != NULL) {
+    if (raw_dict != NULL || dict != NULL) {
+        if (context != NULL)
+            dctx = (ZSTD_DCtx *)context->ctx;
+        else if ((dctx = ZSTD_createDCtx()) == NULL)
+            return (ENOMEM);
+        if (raw_dict != NULL)
+            zstd_ret = ZSTD_decompress_usingDict(
+              dctx, dst, dst_len, src + ZSTD_PREFIX, (size_t)zstd_len, raw_dict, raw_dict_len);
+        else
+            zstd_ret = ZSTD_decompress_usingDDict(
+              dctx, dst, dst_len, src + ZSTD_PREFIX, (size_t)zstd_len, dict->ddict);
+        if (context == NULL)
+            ZSTD_freeDCtx(dctx);
+    } else if (context != NULL) {
         zstd_ret = ZSTD_decompressDCtx(
           (ZSTD_DCtx *)context->ctx, dst, dst_len, src + ZSTD_PREFIX, (size_t)zstd_len);
     } else {
@@ -285,6 +726,30 @@ zstd_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, si
     return (zstd_error(compressor, session, "ZSTD_decompress", zstd_ret));
 }
 
+/*
+ * zstd_decompress --
+ *     WiredTiger Zstd decompression.
+ */
+static int
+zstd_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
+  uint8_t *dst, size_t dst_len, size_t *result_lenp)
+{
+    return (zstd_decompress_internal(
+      compressor, session, NULL, 0, src, src_len, dst, dst_len, result_lenp));
+}
+
+/*
+ * zstd_decompress_dictionary --
+ *     WiredTiger Zstd decompression with a raw content dictionary.
+ */
+static int
+zstd_decompress_dictionary(WT_COMPRESSOR *compressor, WT_SESSION *session, const uint8_t *dict,
+  size_t dict_len, uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len, size_t *result_lenp)
+{
+    return (zstd_decompress_internal(
+      compressor, session, dict, dict_len, src, src_len, dst, dst_len, result_lenp));
+}
+
 /*
  * zstd_pre_size --
  *     WiredTiger Zstd destination buffer sizing for compression.
@@ -403,23 +868,127 @@ static int
 zstd_terminate(WT_COMPRESSOR *compressor, WT_SESSION *session)
 {
     ZSTD_COMPRESSOR *zcompressor;
+    ZSTD_DICTIONARY *dict;
+    ZSTD_DICTIONARY_TABLE *table;
 
     zcompressor = (ZSTD_COMPRESSOR *)compressor;
 
     (void)session; /* Unused parameters. */
 
+    /* A customized compressor shares everything but its level and its table's dictionaries. */
+    if (zcompressor->custom) {
+        if ((table = zcompressor->table) != NULL) {
+            while ((dict = table->list) != NULL) {
+                table->list = dict->next;
+                zstd_dict_free(dict);
+            }
+            zcompressor->wt_api->spin_destroy(zcompressor->wt_api, &table->lock);
+            free(table->samples);
+            free(table->sample_sizes);
+            free(table->state);
+            free(table);
+        }
+        free(compressor);
+        return (0);
+    }
+
     zstd_terminate_context_pool(compressor, CONTEXT_TYPE_COMPRESS, &(zcompressor->cctx_pool));
     zstd_terminate_context_pool(compressor, CONTEXT_TYPE_DECOMPRESS, &(zcompressor->dctx_pool));
     free(compressor);
     return (0);
 }
 
+/*
+ * zstd_customize --
+ *     WiredTiger Zstd per-table customization: if the table's class of page is configured with its
+ *     own compression level, dictionary compression is configured for leaf pages or the table has
+ *     dictionaries, return a compressor with the level and the table's dictionaries.
+ */
+static int
+zstd_customize(WT_COMPRESSOR *compressor, WT_SESSION *session, const char *uri,
+  const char *config, WT_COMPRESSOR **customp)
+{
+    WT_CONFIG_ITEM state, v;
+    WT_EXTENSION_API *wt_api;
+    ZSTD_COMPRESSOR *custom, *zcompressor;
+    ZSTD_DICTIONARY_TABLE *table;
+    int dictionary, leaf, level, ret;
+
+    (void)uri; /* Unused parameters */
+
+    zcompressor = (ZSTD_COMPRESSOR *)compressor;
+    wt_api = zcompressor->wt_api;
+
+    /* A level of zero means the level the extension was loaded with. */
+    level = zcompressor->compression_level;
+    leaf = 1;
+    state.str = NULL;
+    state.len = 0;
+    if (config != NULL) {
+        if ((ret = wt_api->config_get_string(wt_api, session, config, "level", &v)) == 0) {
+            if (v.val < ZSTD_minCLevel() || v.val > ZSTD_maxCLevel()) {
+                (void)wt_api->err_printf(
+                  wt_api, session, "zstd_customize: unsupported compression level %d", (int)v.val);
+                return (EINVAL);
+            }
+            if (v.val != 0)
+                level = (int)v.val;
+        } else if (ret != WT_NOTFOUND)
+            return (ret);
+
+        /* Dictionaries are trained on leaf pages, internal pages hold nothing but keys. */
+        if ((ret = wt_api->config_get_string(wt_api, session, config, "page_type", &v)) == 0)
+            leaf = v.len == strlen("leaf") && strncmp(v.str, "leaf", v.len) == 0;
+        else if (ret != WT_NOTFOUND)
+            return (ret);
+
+        /* The table's dictionaries, loaded whether or not dictionary compression is configured. */
+        if ((ret = wt_api->config_get_string(wt_api, session, config, "state", &state)) != 0 &&
+          ret != WT_NOTFOUND)
+            return (ret);
+    }
+    dictionary = leaf && (zcompressor->dictionary || state.len != 0);
+
+    if (!dictionary && level == zcompressor->compression_level)
+        return (0);
+
+    if ((custom = calloc(1, sizeof(ZSTD_COMPRESSOR))) == NULL)
+        return (errno);
+    *custom = *zcompressor;
+    custom->custom = 1;
+    custom->compression_level = level;
+    if (!dictionary) {
+        *customp = (WT_COMPRESSOR *)custom;
+        return (0);
+    }
+    if ((table = calloc(1, sizeof(ZSTD_DICTIONARY_TABLE))) == NULL) {
+        free(custom);
+        return (errno);
+    }
+    if ((ret = wt_api->spin_init(wt_api, &table->lock, "zstd dictionary")) != 0) {
+        free(table);
+        free(custom);
+        return (ret);
+    }
+    custom->table = table;
+    if ((ret = zstd_dict_load(custom, session, state.str, state.len)) != 0) {
+        (void)zstd_terminate((WT_COMPRESSOR *)custom, session);
+        return (ret);
+    }
+
+    /* A table with dictionaries is retrained on schedule rather than immediately. */
+    table->trained = table->list != NULL;
+
+    *customp = (WT_COMPRESSOR *)custom;
+    return (0);
+}
+
 /*
  * zstd_init_config --
  *     Handle zstd configuration.
  */
 static int
-zstd_init_config(WT_CONNECTION *connection, WT_CONFIG_ARG *config, int *compression_levelp)
+zstd_init_config(WT_CONNECTION *connection, WT_CONFIG_ARG *config, ZSTD_COMPRESSOR *zcompressor)
 {
     WT_CONFIG_ITEM v;
     WT_EXTENSION_API *wt_api;
@@ -434,14 +1003,38 @@ zstd_init_config(WT_CONNECTION *connection, WT_CONFIG_ARG *config, int *compress
      */
     wt_api = connection->get_extension_api(connection);
     if ((ret = wt_api->config_get(wt_api, NULL, config, "compression_level", &v)) == 0)
-        *compression_levelp = (int)v.val;
-    else if (ret != WT_NOTFOUND) {
-        (void)wt_api->err_printf(
-          wt_api, NULL, "zstd_init_config: %s", wt_api->strerror(wt_api, NULL, ret));
-        return (ret);
+        zcompressor->compression_level = (int)v.val;
+    else if (ret != WT_NOTFOUND)
+        goto err;
+
+    /* Dictionary compression. */
+    if ((ret = wt_api->config_get(wt_api, NULL, config, "dictionary", &v)) == 0)
+        zcompressor->dictionary = v.val != 0;
+    else if (ret != WT_NOTFOUND)
+        goto err;
+    if ((ret = wt_api->config_get(wt_api, NULL, config, "dictionary_size", &v)) == 0)
+        zcompressor->dictionary_size = (size_t)v.val;
+    else if (ret != WT_NOTFOUND)
+        goto err;
+    if ((ret = wt_api->config_get(wt_api, NULL, config, "dictionary_samples", &v)) == 0)
+        zcompressor->dictionary_samples = (unsigned)v.val;
+    else if (ret != WT_NOTFOUND)
+        goto err;
+    if ((ret = wt_api->config_get(wt_api, NULL, config, "dictionary_retrain", &v)) == 0)
+        zcompressor->dictionary_retrain = (uint64_t)v.val;
+    else if (ret != WT_NOTFOUND)
+        goto err;
+    if (zcompressor->dictionary_size == 0 || zcompressor->dictionary_samples == 0) {
+        ret = EINVAL;
+        goto err;
     }
+    ret = 0;
 
-    return (0);
+err:
+    if (ret != 0)
+        (void)wt_api->err_printf(
+          wt_api, NULL, "zstd_init_config: %s", wt_api->strerror(wt_api, NULL, ret));
+    return (ret);
 }
 
 int zstd_extension_init(WT_CONNECTION *, WT_CONFIG_ARG *);
@@ -455,7 +1048,10 @@ int
 zstd_extension_init(WT_CONNECTION *connection, WT_CONFIG_ARG *config)
 {
     ZSTD_COMPRESSOR *zstd_compressor;
-    int compression_level, ret;
+    int ret;
+
+    if ((zstd_compressor = calloc(1, sizeof(ZSTD_COMPRESSOR))) == NULL)
+        return (errno);
 
     /*
      * Zstd's sweet-spot is better compression than zlib at significantly
@@ -481,22 +1077,31 @@ zstd_extension_init(WT_CONNECTION *connection, WT_CONFIG_ARG *config)
      * ratio). In other words, position zstd as a zlib replacement, having
      * similar compression at much higher compression/decompression speeds.
      */
-    compression_level = 6;
-    if ((ret = zstd_init_config(connection, config, &compression_level)) != 0)
-        return (ret);
+    zstd_compressor->compression_level = 6;
 
-    if ((zstd_compressor = calloc(1, sizeof(ZSTD_COMPRESSOR))) == NULL)
-        return (errno);
+    /*
+     * Dictionary compression is off by default. The dictionary size is zstd's default, training
+     * needs about a hundred times its size in samples.
+     */
+    zstd_compressor->dictionary_size = 110 * 1024;
+    zstd_compressor->dictionary_samples = 100;
+    zstd_compressor->dictionary_retrain = 100000;
+    if ((ret = zstd_init_config(connection, config, zstd_compressor)) != 0) {
+        free(zstd_compressor);
+        return (ret);
+    }
 
     zstd_compressor->compressor.compress = zstd_compress;
     zstd_compressor->compressor.decompress = zstd_decompress;
     zstd_compressor->compressor.pre_size = zstd_pre_size;
     zstd_compressor->compressor.terminate = zstd_terminate;
+    zstd_compressor->compressor.customize = zstd_customize;
+    zstd_compressor->compressor.get_state = zstd_get_state;
+    zstd_compressor->compressor.compress_dictionary = zstd_compress_dictionary;
+    zstd_compressor->compressor.decompress_dictionary = zstd_decompress_dictionary;
 
     zstd_compressor->wt_api = connection->get_extension_api(connection);
 
-    zstd_compressor->compression_level = compression_level;
-
     zstd_init_context_pool(
       zstd_compressor, CONTEXT_TYPE_COMPRESS, CONTEXT_POOL_SIZE, &(zstd_compressor->cctx_pool));
     zstd_init_context_pool(
@@ -727,6 +727,10 @@ wiredtiger_extension_init(WT_CONNECTION *connection, WT_CONFIG_ARG *config)
     azure_storage->store.terminate = azure_terminate;
     azure_storage->store.ss_flush = azure_flush;
     azure_storage->store.ss_flush_finish = azure_flush_finish;
+    // Multi-part uploads are not supported, objects are always flushed whole.
+    azure_storage->store.ss_flush_part = nullptr;
+    azure_storage->store.ss_flush_parts_complete = nullptr;
+    azure_storage->store.ss_flush_parts_abort = nullptr;
 
     // The first reference is implied by the call to add_storage_source.
     azure_storage->reference_count = 1;
@@ -95,6 +95,7 @@ typedef struct {
      */
     uint64_t fh_ops;        /* Non-read/write operations in file handles */
     uint64_t object_writes; /* (What would be) writes to the cloud */
+    uint64_t object_parts;  /* (What would be) multi-part upload parts written to the cloud */
     uint64_t object_reads;  /* (What would be) reads to the cloud */
     uint64_t op_count;      /* Number of operations done on dir_store */
     uint64_t read_ops;
@@ -141,6 +142,7 @@ static int dir_store_err(DIR_STORE *, WT_SESSION *, int, const char *, ...);
 static int dir_store_file_copy(
   DIR_STORE *, WT_SESSION *, const char *, const char *, WT_FS_OPEN_FILE_TYPE, bool);
 static int dir_store_get_directory(const char *, const char *, ssize_t len, bool, char **);
+static int dir_store_multipart_path(WT_FILE_SYSTEM *, const char *, char **);
 static int dir_store_path(WT_FILE_SYSTEM *, const char *, const char *, char **);
 static int dir_store_stat(
   WT_FILE_SYSTEM *, WT_SESSION *, const char *, const char *, bool, struct stat *);
@@ -155,6 +157,12 @@ static int dir_store_flush(
   WT_STORAGE_SOURCE *, WT_SESSION *, WT_FILE_SYSTEM *, const char *, const char *, const char *);
 static int dir_store_flush_finish(
   WT_STORAGE_SOURCE *, WT_SESSION *, WT_FILE_SYSTEM *, const char *, const char *, const char *);
+static int dir_store_flush_part(WT_STORAGE_SOURCE *, WT_SESSION *, WT_FILE_SYSTEM *, const char *,
+  const char *, uint32_t, wt_off_t, size_t, const char *);
+static int dir_store_flush_parts_abort(WT_STORAGE_SOURCE *, WT_SESSION *, WT_FILE_SYSTEM *,
+  const char *, const char *, uint32_t, const char *);
+static int dir_store_flush_parts_complete(WT_STORAGE_SOURCE *, WT_SESSION *, WT_FILE_SYSTEM *,
+  const char *, const char *, uint32_t, const char *);
 static int dir_store_terminate(WT_STORAGE_SOURCE *, WT_SESSION *);
 
 /*
@@ -431,6 +439,32 @@ dir_store_home_path(WT_FILE_SYSTEM *file_system, const char *name, char **pathp)
       dir_store_path(file_system, ((DIR_STORE_FILE_SYSTEM *)file_system)->home_dir, name, pathp));
 }
 
+/*
+ * dir_store_multipart_path --
+ *     Construct the pathname of the file a multi-part upload of an object is assembled in. Parts
+ *     are written directly at their offsets, there's nothing to concatenate when the upload
+ *     completes.
+ */
+static int
+dir_store_multipart_path(WT_FILE_SYSTEM *file_system, const char *object, char **pathp)
+{
+    size_t len;
+    int ret;
+    char *dest_path, *p;
+
+    if ((ret = dir_store_bucket_path(file_system, object, &dest_path)) != 0)
+        return (ret);
+    len = strlen(dest_path) + sizeof(".MULTIPART");
+    if ((p = malloc(len)) == NULL) {
+        free(dest_path);
+        return (dir_store_err(FS2DS(file_system), NULL, ENOMEM, "dir_store_multipart_path"));
+    }
+    (void)snprintf(p, len, "%s.MULTIPART", dest_path);
+    free(dest_path);
+    *pathp = p;
+    return (0);
+}
+
 /*
  * dir_store_path --
  *     Construct a pathname from the file system and dir_store name.
@@ -810,6 +844,182 @@ err:
     return (ret);
 }
 
+/*
+ * dir_store_flush_part --
+ *     Copy one part of a file to the bucket, as part of a multi-part upload.
+ */
+static int
+dir_store_flush_part(WT_STORAGE_SOURCE *storage_source, WT_SESSION *session,
+  WT_FILE_SYSTEM *file_system, const char *source, const char *object, uint32_t part,
+  wt_off_t offset, size_t length, const char *config)
+{
+    DIR_STORE *dir_store;
+    WT_FILE_HANDLE *dest, *src;
+    WT_FILE_SYSTEM *wt_fs;
+    wt_off_t copy_size, left, pos;
+    int ret, t_ret;
+    char buffer[1024 * 64], *dest_path, *src_path;
+
+    (void)config; /* unused */
+    dest = src = NULL;
+    dest_path = src_path = NULL;
+    dir_store = (DIR_STORE *)storage_source;
+
+    if (file_system == NULL || source == NULL || object == NULL)
+        return dir_store_err(
+          dir_store, session, EINVAL, "ss_flush_part: required arguments missing");
+
+    if ((ret = dir_store_home_path(file_system, source, &src_path)) != 0)
+        goto err;
+
+    if ((ret = dir_store_multipart_path(file_system, object, &dest_path)) != 0)
+        goto err;
+
+    /* Each part stands in for a separate request, delay it as one. */
+    if ((ret = dir_store_delay(dir_store)) != 0)
+        goto err;
+
+    if ((ret = dir_store->wt_api->file_system_get(dir_store->wt_api, session, &wt_fs)) != 0) {
+        ret = dir_store_err(
+          dir_store, session, ret, "dir_store_file_system: cannot get WiredTiger file system");
+        goto err;
+    }
+    if ((ret = wt_fs->fs_open_file(
+           wt_fs, session, src_path, WT_FS_OPEN_FILE_TYPE_DATA, WT_FS_OPEN_READONLY, &src)) != 0) {
+        ret = dir_store_err(dir_store, session, ret, "%s: cannot open for read", src_path);
+        goto err;
+    }
+
+    /* Parts may be copied concurrently, each one opens the shared file without exclusive access. */
+    if ((ret = wt_fs->fs_open_file(
+           wt_fs, session, dest_path, WT_FS_OPEN_FILE_TYPE_DATA, WT_FS_OPEN_CREATE, &dest)) != 0) {
+        ret = dir_store_err(dir_store, session, ret, "%s: cannot create", dest_path);
+        goto err;
+    }
+    for (pos = offset, left = (wt_off_t)length; left > 0; pos += copy_size, left -= copy_size) {
+        copy_size = left < (wt_off_t)sizeof(buffer) ? left : (wt_off_t)sizeof(buffer);
+        if ((ret = src->fh_read(src, session, pos, (size_t)copy_size, buffer)) != 0) {
+            ret = dir_store_err(dir_store, session, ret, "%s: cannot read", src_path);
+            goto err;
+        }
+        if ((ret = dest->fh_write(dest, session, pos, (size_t)copy_size, buffer)) != 0) {
+            ret = dir_store_err(dir_store, session, ret, "%s: cannot write", dest_path);
+            goto err;
+        }
+    }
+
+    dir_store->object_parts++;
+    VERBOSE_LS(dir_store,
+      "Flush part %" PRIu32 " of %s: %" PRIu64 " bytes at offset %" PRId64 "\n", part, object,
+      (uint64_t)length, (int64_t)offset);
+
+err:
+    if (src != NULL && (t_ret = src->close(src, session)) != 0)
+        if (ret == 0)
+            ret = t_ret;
+    if (dest != NULL && (t_ret = dest->close(dest, session)) != 0)
+        if (ret == 0)
+            ret = t_ret;
+    free(dest_path);
+    free(src_path);
+    return (ret);
+}
+
+/*
+ * dir_store_flush_parts_complete --
+ *     Complete a multi-part upload, making the object visible in the bucket.
+ */
+static int
+dir_store_flush_parts_complete(WT_STORAGE_SOURCE *storage_source, WT_SESSION *session,
+  WT_FILE_SYSTEM *file_system, const char *source, const char *object, uint32_t part_count,
+  const char *config)
+{
+    DIR_STORE *dir_store;
+    WT_FILE_SYSTEM *wt_fs;
+    int ret;
+    char *dest_path, *tmp_path;
+    bool dest_exists;
+
+    (void)config;     /* unused */
+    (void)part_count; /* unused */
+    dest_path = tmp_path = NULL;
+    dir_store = (DIR_STORE *)storage_source;
+
+    if (file_system == NULL || source == NULL || object == NULL)
+        return dir_store_err(
+          dir_store, session, EINVAL, "ss_flush_parts_complete: required arguments missing");
+
+    if ((ret = dir_store_multipart_path(file_system, object, &tmp_path)) != 0)
+        goto err;
+
+    if ((ret = dir_store_bucket_path(file_system, object, &dest_path)) != 0)
+        goto err;
+
+    if ((ret = dir_store->wt_api->file_system_get(dir_store->wt_api, session, &wt_fs)) != 0) {
+        ret = dir_store_err(
+          dir_store, session, ret, "dir_store_file_system: cannot get WiredTiger file system");
+        goto err;
+    }
+
+    if (chmod(tmp_path, 0444) < 0) {
+        ret = dir_store_err(dir_store, session, errno, "%s: parts complete chmod failed", tmp_path);
+        goto err;
+    }
+
+    /* Objects are immutable, as with a single copy, never replace an existing object. */
+    if ((ret = wt_fs->fs_exist(wt_fs, session, dest_path, &dest_exists)) != 0) {
+        ret = dir_store_err(dir_store, session, ret, "%s: cannot check existence", dest_path);
+        goto err;
+    }
+    if (dest_exists) {
+        ret = dir_store_err(dir_store, session, EEXIST, "%s: already exists", dest_path);
+        goto err;
+    }
+    if ((ret = wt_fs->fs_rename(wt_fs, session, tmp_path, dest_path, 0)) != 0) {
+        ret =
+          dir_store_err(dir_store, session, ret, "%s: cannot rename from %s", dest_path, tmp_path);
+        goto err;
+    }
+
+    dir_store->object_writes++;
+
+err:
+    if (ret != 0 && tmp_path != NULL)
+        (void)unlink(tmp_path);
+    free(dest_path);
+    free(tmp_path);
+    return (ret);
+}
+
+/*
+ * dir_store_flush_parts_abort --
+ *     Abandon a multi-part upload, discarding the parts copied so far.
+ */
+static int
+dir_store_flush_parts_abort(WT_STORAGE_SOURCE *storage_source, WT_SESSION *session,
+  WT_FILE_SYSTEM *file_system, const char *source, const char *object, uint32_t part_count,
+  const char *config)
+{
+    DIR_STORE *dir_store;
+    int ret;
+    char *tmp_path;
+
+    (void)config;     /* unused */
+    (void)part_count; /* unused */
+    dir_store = (DIR_STORE *)storage_source;
+
+    if (file_system == NULL || source == NULL || object == NULL)
+        return dir_store_err(
+          dir_store, session, EINVAL, "ss_flush_parts_abort: required arguments missing");
+
+    if ((ret = dir_store_multipart_path(file_system, object, &tmp_path)) != 0)
+        return (ret);
+    if (unlink(tmp_path) != 0 && errno != ENOENT)
+        ret = dir_store_err(dir_store, session, errno, "%s: parts abort unlink failed", tmp_path);
+    free(tmp_path);
+    return (ret);
+}
+
 /*
  * dir_store_flush_finish --
  *     Cache a file in the new file system.
@@ -1495,6 +1705,9 @@ wiredtiger_extension_init(WT_CONNECTION *connection, WT_CONFIG_ARG *config)
     dir_store->storage_source.ss_customize_file_system = dir_store_customize_file_system;
     dir_store->storage_source.ss_flush = dir_store_flush;
     dir_store->storage_source.ss_flush_finish = dir_store_flush_finish;
+    dir_store->storage_source.ss_flush_part = dir_store_flush_part;
+    dir_store->storage_source.ss_flush_parts_abort = dir_store_flush_parts_abort;
+    dir_store->storage_source.ss_flush_parts_complete = dir_store_flush_parts_complete;
     dir_store->storage_source.terminate = dir_store_terminate;
 
     /*
@@ -712,6 +712,10 @@ wiredtiger_extension_init(WT_CONNECTION *connection, WT_CONFIG_ARG *config)
     gcp->storage_source.terminate = gcp_terminate;
     gcp->storage_source.ss_flush = gcp_flush;
     gcp->storage_source.ss_flush_finish = gcp_flush_finish;
+    // Multi-part uploads are not supported, objects are always flushed whole.
+    gcp->storage_source.ss_flush_part = nullptr;
+    gcp->storage_source.ss_flush_parts_complete = nullptr;
+    gcp->storage_source.ss_flush_parts_abort = nullptr;
 
     // The first reference is implied by the call to add_storage_source.
     gcp->reference_count = 1;
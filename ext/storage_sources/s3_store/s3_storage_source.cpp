@@ -783,6 +783,10 @@ wiredtiger_extension_init(WT_CONNECTION *connection, WT_CONFIG_ARG *config)
     s3->storageSource.terminate = S3Terminate;
     s3->storageSource.ss_flush = S3Flush;
     s3->storageSource.ss_flush_finish = S3FlushFinish;
+    // Multi-part uploads are not supported, objects are always flushed whole.
+    s3->storageSource.ss_flush_part = nullptr;
+    s3->storageSource.ss_flush_parts_complete = nullptr;
+    s3->storageSource.ss_flush_parts_abort = nullptr;
 
     // The first reference is implied by the call to add_storage_source.
     s3->referenceCount = 1;
@@ -629,6 +629,10 @@ COMPARE_NOTFOUND_OK(__wt_cursor::_search_near)
 /* Replace get_raw_key_value method with a Python equivalent */
 %ignore __wt_cursor::get_raw_key_value;
 
+/* The batch methods use C arrays of items, they aren't exposed to Python. */
+%ignore __wt_cursor::insert_batch;
+%ignore __wt_cursor::search_batch;
+
 /* Next, override methods that return integers via arguments. */
 %ignore __wt_cursor::compare(WT_CURSOR *, WT_CURSOR *, int *);
 %ignore __wt_cursor::equals(WT_CURSOR *, WT_CURSOR *, int *);
@@ -1085,6 +1089,22 @@ SIDESTEP_METHOD(__wt_storage_source, ss_flush_finish,
     const char *source, const char *object, const char *config),
   (self, session, file_system, source, object, config))
 
+SIDESTEP_METHOD(__wt_storage_source, ss_flush_part,
+  (WT_SESSION *session, WT_FILE_SYSTEM *file_system, const char *source,
+    const char *object, uint32_t part, wt_off_t offset, size_t length,
+    const char *config),
+  (self, session, file_system, source, object, part, offset, length, config))
+
+SIDESTEP_METHOD(__wt_storage_source, ss_flush_parts_complete,
+  (WT_SESSION *session, WT_FILE_SYSTEM *file_system, const char *source,
+    const char *object, uint32_t part_count, const char *config),
+  (self, session, file_system, source, object, part_count, config))
+
+SIDESTEP_METHOD(__wt_storage_source, ss_flush_parts_abort,
+  (WT_SESSION *session, WT_FILE_SYSTEM *file_system, const char *source,
+    const char *object, uint32_t part_count, const char *config),
+  (self, session, file_system, source, object, part_count, config))
+
 SIDESTEP_METHOD(__wt_storage_source, terminate,
   (WT_SESSION *session),
   (self, session))
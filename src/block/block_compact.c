@@ -518,29 +518,22 @@ __compact_page_skip(
 {
     WT_DECL_RET;
     WT_EXT *ext;
-    WT_EXTLIST *el;
     wt_off_t limit;
 
     *skipp = true; /* Return a default skip. */
 
     /*
-     * If this block is in the chosen percentage of the file and there's a block on the available
-     * list that appears before that percentage of the file, rewrite the block. Checking the
+     * If this block is in the chosen percentage of the file and the first-fit block on the available
+     * list appears before that percentage of the file, rewrite the block. Checking the
      * available list is necessary (otherwise writing the block would extend the file), but there's
      * an obvious race if the file is sufficiently busy.
      */
     __wt_spin_lock(session, &block->live_lock);
     limit = block->size - ((block->size / 10) * block->compact_pct_tenths);
     if (offset > limit) {
-        el = &block->live.avail;
-        WT_EXT_FOREACH (ext, el->off) {
-            if (ext->off >= limit)
-                break;
-            if (ext->size >= size) {
-                *skipp = false;
-                break;
-            }
-        }
+        ext = __wt_block_first_fit(session, &block->live.avail, (wt_off_t)size);
+        if (ext != NULL && ext->off < limit)
+            *skipp = false;
     }
     __wt_spin_unlock(session, &block->live_lock);
 
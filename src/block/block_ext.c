@@ -26,6 +26,7 @@ static int __block_append(WT_SESSION_IMPL *, WT_BLOCK *, WT_EXTLIST *, wt_off_t,
 static int __block_ext_overlap(
   WT_SESSION_IMPL *, WT_BLOCK *, WT_EXTLIST *, WT_EXT **, WT_EXTLIST *, WT_EXT **);
 static int __block_extlist_dump(WT_SESSION_IMPL *, WT_BLOCK *, WT_EXTLIST *, const char *);
+static int __block_extlist_merge_linear(WT_SESSION_IMPL *, WT_BLOCK *, WT_EXTLIST *, WT_EXTLIST *);
 static int __block_merge(WT_SESSION_IMPL *, WT_BLOCK *, WT_EXTLIST *, wt_off_t, wt_off_t);
 
 /*
@@ -127,6 +128,139 @@ __block_size_srch(WT_SIZE **head, wt_off_t size, WT_SIZE ***stack)
             stack[i--] = szp--;
 }
 
+/*
+ * __block_size_class --
+ *     Return the size class of an extent size.
+ */
+static inline u_int
+__block_size_class(wt_off_t size)
+{
+    uint64_t v;
+    u_int size_class;
+
+    for (size_class = 0, v = (uint64_t)size; v > 1; v >>= 1)
+        ++size_class;
+    return (size_class);
+}
+
+/*
+ * __block_size_class_end --
+ *     Return the smallest size past the end of a size class.
+ */
+static inline wt_off_t
+__block_size_class_end(u_int size_class)
+{
+    return (size_class >= WT_BLOCK_SIZE_CLASSES - 1 ? INT64_MAX : (wt_off_t)1 << (size_class + 1));
+}
+
+/*
+ * __block_size_first_srch --
+ *     Search the by-size skiplist for the lowest-offset extent of a size range.
+ */
+static inline WT_EXT *
+__block_size_first_srch(WT_SIZE **head, wt_off_t size, wt_off_t end)
+{
+    WT_EXT *ext, *first;
+    WT_SIZE *szp, **sstack[WT_SKIP_MAXDEPTH];
+
+    /*
+     * Each by-size entry's offset skiplist is sorted, the lowest-offset extent of the range is the
+     * lowest of the first extents of its sizes.
+     */
+    first = NULL;
+    __block_size_srch(head, size, sstack);
+    for (szp = *sstack[0]; szp != NULL && szp->size < end; szp = szp->next[0]) {
+        ext = szp->off[0];
+        if (first == NULL || ext->off < first->off)
+            first = ext;
+    }
+    return (first);
+}
+
+/*
+ * __block_size_class_first --
+ *     Return the lowest-offset extent of a size class.
+ */
+static inline WT_EXT *
+__block_size_class_first(WT_EXTLIST *el, u_int size_class)
+{
+    uint64_t mask;
+
+    mask = (uint64_t)1 << size_class;
+    if (FLD_ISSET(el->class_stale, mask)) {
+        el->class_first[size_class] = __block_size_first_srch(
+          el->sz, (wt_off_t)1 << size_class, __block_size_class_end(size_class));
+        FLD_CLR(el->class_stale, mask);
+    }
+    return (el->class_first[size_class]);
+}
+
+/*
+ * __block_size_class_insert --
+ *     Update the size classes for an extent inserted into an extent list.
+ */
+static inline void
+__block_size_class_insert(WT_EXTLIST *el, WT_EXT *ext)
+{
+    WT_EXT *first;
+    u_int size_class;
+
+    /* A stale class is searched when next needed, which will find the extent. */
+    size_class = __block_size_class(ext->size);
+    if (FLD_ISSET(el->class_stale, (uint64_t)1 << size_class))
+        return;
+    first = el->class_first[size_class];
+    if (first == NULL || ext->off < first->off)
+        el->class_first[size_class] = ext;
+}
+
+/*
+ * __block_size_class_remove --
+ *     Update the size classes for an extent removed from an extent list.
+ */
+static inline void
+__block_size_class_remove(WT_EXTLIST *el, WT_EXT *ext)
+{
+    u_int size_class;
+
+    /* If the class' lowest-offset extent is removed, the class has to be searched again. */
+    size_class = __block_size_class(ext->size);
+    if (el->class_first[size_class] == ext) {
+        el->class_first[size_class] = NULL;
+        FLD_SET(el->class_stale, (uint64_t)1 << size_class);
+    }
+}
+
+/*
+ * __wt_block_first_fit --
+ *     Return the lowest-offset extent at least as large as the specified size from an extent list
+ *     maintaining the per-size skiplist.
+ */
+WT_EXT *
+__wt_block_first_fit(WT_SESSION_IMPL *session, WT_EXTLIST *el, wt_off_t size)
+{
+    WT_EXT *ext, *first;
+    u_int i, size_class;
+
+    WT_ASSERT(session, el->track_size);
+
+    /*
+     * Extents in the requested size's class may be too small, search the by-size skiplist from the
+     * requested size to the end of the class, unless the whole class is large enough. Every extent
+     * in a larger class is large enough, check the lowest-offset extent of each.
+     */
+    size_class = __block_size_class(size);
+    if (size == (wt_off_t)1 << size_class)
+        first = __block_size_class_first(el, size_class);
+    else
+        first = __block_size_first_srch(el->sz, size, __block_size_class_end(size_class));
+    for (i = size_class + 1; i < WT_BLOCK_SIZE_CLASSES; ++i)
+        if ((ext = __block_size_class_first(el, i)) != NULL &&
+          (first == NULL || ext->off < first->off))
+            first = ext;
+    return (first);
+}
+
 /*
  * __block_off_srch_pair --
  *     Search a by-offset skiplist for before/after records of the specified offset.
@@ -199,6 +333,8 @@ __block_ext_insert(WT_SESSION_IMPL *session, WT_EXTLIST *el, WT_EXT *ext)
             ext->next[i + ext->depth] = *astack[i];
             *astack[i] = ext;
         }
+
+        __block_size_class_insert(el, ext);
     }
 #ifdef HAVE_DIAGNOSTIC
     if (!el->track_size)
@@ -363,6 +499,8 @@ __block_off_remove(
                 *sstack[i] = szp->next[i];
             __wt_block_size_free(session, szp);
         }
+
+        __block_size_class_remove(el, ext);
     }
 #ifdef HAVE_DIAGNOSTIC
     if (!el->track_size) {
@@ -501,7 +639,10 @@ __block_extend(
 int
 __wt_block_alloc(WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t *offp, wt_off_t size)
 {
-    WT_EXT *ext, **estack[WT_SKIP_MAXDEPTH];
+    WT_EXT *ext;
+#ifdef HAVE_DIAGNOSTIC
+    WT_EXT **estack[WT_SKIP_MAXDEPTH];
+#endif
     WT_EXTLIST *el;
     WT_SIZE *szp, **sstack[WT_SKIP_MAXDEPTH];
 
@@ -523,7 +664,7 @@ __wt_block_alloc(WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t *offp, wt_o
 
     /*
      * Allocation is either first-fit (lowest offset), or best-fit (best size). If it's first-fit,
-     * walk the offset list linearly until we find an entry that will work.
+     * take the lowest offset entry that will work from the size classes.
      *
      * If it's best-fit by size, search the by-size skiplist for the size and take the first entry
      * on the by-size offset list. This means we prefer best-fit over lower offset, but within a
@@ -534,9 +675,13 @@ __wt_block_alloc(WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t *offp, wt_o
     if (block->live.avail.bytes < (uint64_t)size)
         goto append;
     if (block->allocfirst) {
-        if (!__block_first_srch(block->live.avail.off, size, estack))
+        if ((ext = __wt_block_first_fit(session, &block->live.avail, size)) == NULL)
             goto append;
-        ext = *estack[0];
+#ifdef HAVE_DIAGNOSTIC
+        /* The size classes must find the entry a walk of the offset list finds. */
+        WT_ASSERT(session,
+          __block_first_srch(block->live.avail.off, size, estack) && *estack[0] == ext);
+#endif
     } else {
         __block_size_srch(block->live.avail.sz, size, sstack);
         if ((szp = *sstack[0]) == NULL) {
@@ -907,6 +1052,98 @@ __block_ext_overlap(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *ael,
     return (0);
 }
 
+/*
+ * __block_extlist_merge_linear --
+ *     Merge one extent list into another, rebuilding the target list in offset order.
+ */
+static int
+__block_extlist_merge_linear(
+  WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *a, WT_EXTLIST *b)
+{
+    WT_DECL_RET;
+    WT_EXT *acopy, *ahead, **atail, *ext, *last, *next, *prev, **stack[WT_SKIP_MAXDEPTH];
+    u_int i;
+
+    WT_ASSERT(session, !b->track_size);
+
+    /*
+     * Check for overlaps before changing anything: __block_merge would fail on the first
+     * overlapping range, leaving the target list as it was.
+     */
+    prev = NULL;
+    for (acopy = a->off[0], ext = b->off[0]; acopy != NULL || ext != NULL; prev = last) {
+        if (ext == NULL || (acopy != NULL && acopy->off < ext->off)) {
+            last = acopy;
+            acopy = acopy->next[0];
+        } else {
+            last = ext;
+            ext = ext->next[0];
+        }
+        if (prev != NULL && prev->off + prev->size > last->off)
+            WT_BLOCK_RET(session, block, EINVAL,
+              "%s: merge range %" PRIdMAX "-%" PRIdMAX " overlaps with range %" PRIdMAX
+              "-%" PRIdMAX,
+              b->name, (intmax_t)prev->off, (intmax_t)(prev->off + prev->size),
+              (intmax_t)last->off, (intmax_t)(last->off + last->size));
+    }
+
+    /*
+     * Copy the merged list's entries, linked by their first skiplist level, so an allocation
+     * failure leaves the target list as it was.
+     */
+    ahead = NULL;
+    atail = &ahead;
+    WT_EXT_FOREACH (ext, a->off) {
+        WT_ERR(__wt_block_ext_alloc(session, &acopy));
+        acopy->off = ext->off;
+        acopy->size = ext->size;
+        *atail = acopy;
+        atail = &acopy->next[0];
+    }
+
+    /*
+     * Relink the target list in offset order, appending at each skiplist level and combining
+     * adjacent ranges.
+     */
+    ext = b->off[0];
+    for (i = 0; i < WT_SKIP_MAXDEPTH; i++) {
+        b->off[i] = NULL;
+        stack[i] = &b->off[i];
+    }
+    b->bytes += a->bytes;
+    b->entries = 0;
+    for (last = NULL; ahead != NULL || ext != NULL;) {
+        if (ext == NULL || (ahead != NULL && ahead->off < ext->off)) {
+            acopy = ahead;
+            ahead = ahead->next[0];
+        } else {
+            acopy = ext;
+            ext = ext->next[0];
+        }
+        if (last != NULL && last->off + last->size == acopy->off) {
+            last->size += acopy->size;
+            __wt_block_ext_free(session, acopy);
+            continue;
+        }
+        for (i = 0; i < acopy->depth; ++i) {
+            acopy->next[i] = NULL;
+            *stack[i] = acopy;
+            stack[i] = &acopy->next[i];
+        }
+        ++b->entries;
+        last = acopy;
+    }
+    b->last = last;
+    return (0);
+
+err:
+    for (; ahead != NULL; ahead = next) {
+        next = ahead->next[0];
+        __wt_block_ext_free(session, ahead);
+    }
+    return (ret);
+}
+
 /*
  * __wt_block_extlist_merge --
  *     Merge one extent list into another.
@@ -942,8 +1179,22 @@ __wt_block_extlist_merge(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *
             a->sz[i] = b->sz[i];
             b->sz[i] = tmp.sz[i];
         }
+        for (i = 0; i < WT_BLOCK_SIZE_CLASSES; i++) {
+            a->class_first[i] = b->class_first[i];
+            b->class_first[i] = tmp.class_first[i];
+        }
+        a->class_stale = b->class_stale;
+        b->class_stale = tmp.class_stale;
     }
 
+    /*
+     * Merging each entry searches the target list: unless the list we are merging is much smaller
+     * than the target list, rebuilding the target list in a single pass over both lists is cheaper.
+     * That's only possible if the target list isn't tracking sizes.
+     */
+    if (!b->track_size && (uint64_t)a->entries * WT_SKIP_MAXDEPTH >= b->entries)
+        return (__block_extlist_merge_linear(session, block, a, b));
+
     WT_EXT_FOREACH (ext, a->off)
         WT_RET(__block_merge(session, block, b, ext->off, ext->size));
 
@@ -1451,4 +1702,11 @@ __ut_block_size_srch(WT_SIZE **head, wt_off_t size, WT_SIZE ***stack)
 {
     __block_size_srch(head, size, stack);
 }
+
+int
+__ut_block_extlist_merge_linear(
+  WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *a, WT_EXTLIST *b)
+{
+    return (__block_extlist_merge_linear(session, block, a, b));
+}
 #endif
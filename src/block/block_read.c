@@ -166,6 +166,7 @@ __wt_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, uin
   wt_off_t offset, uint32_t size, uint32_t checksum)
 {
     WT_BLOCK_HEADER *blk, swap;
+    WT_PREFETCH_READ *staged;
     size_t bufsize, check_size;
     int failures, max_failures;
     bool chunkcache_hit, full_checksum_mismatch;
@@ -223,8 +224,20 @@ __wt_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, uin
             }
         }
         if (!chunkcache_hit || failures > 0) {
-            __wt_capacity_throttle(session, size, WT_THROTTLE_READ);
-            WT_RET(__wt_read(session, block->fh, offset, size, buf->mem));
+            /*
+             * Pre-fetch threads may have already read the block asynchronously, use their copy on
+             * the first attempt if it's for the same block.
+             */
+            staged = session->pf.io_staged;
+            if (failures == 0 && staged != NULL && staged->fh == block->fh &&
+              staged->offset == offset && staged->size == size && staged->checksum == checksum) {
+                memcpy(buf->mem, staged->buf.mem, size);
+                session->pf.io_staged = NULL;
+                WT_STAT_CONN_INCR(session, block_prefetch_pages_read_async);
+            } else {
+                __wt_capacity_throttle(session, size, WT_THROTTLE_READ);
+                WT_RET(__wt_read(session, block->fh, offset, size, buf->mem));
+            }
         }
 
         /*
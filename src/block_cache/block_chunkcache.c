@@ -1265,6 +1265,11 @@ __wt_chunkcache_setup(WT_SESSION_IMPL *session, const char *cfg[])
           &chunkcache->free_bitmap));
     }
 
+    WT_RET(__wt_config_gets(session, cfg, "chunk_cache.preload_threads", &cval));
+    chunkcache->preload_threads = (u_int)cval.val;
+    WT_RET(__wt_config_gets(session, cfg, "chunk_cache.preload_budget", &cval));
+    chunkcache->preload_budget = (uint64_t)cval.val;
+
     WT_RET(__wt_config_gets(session, cfg, "chunk_cache.flushed_data_cache_insertion", &cval));
     if (cval.val != 0)
         F_SET(chunkcache, WT_CHUNK_CACHE_FLUSHED_DATA_INSERTION);
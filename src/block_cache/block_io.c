@@ -67,7 +67,6 @@ __wt_blkcache_read(WT_SESSION_IMPL *session, WT_ITEM *buf, const uint8_t *addr,
     blkcache_item = NULL;
     btree = S2BT(session);
     bm = btree->bm;
-    compressor = btree->compressor;
     encryptor = btree->kencryptor == NULL ? NULL : btree->kencryptor->encryptor;
     blkcache_found = found = false;
     skip_cache_put = (blkcache->type == WT_BLKCACHE_UNCONFIGURED);
@@ -78,7 +77,8 @@ __wt_blkcache_read(WT_SESSION_IMPL *session, WT_ITEM *buf, const uint8_t *addr,
      * the caller's buffer. Else, start with the caller's buffer.
      */
     ip = buf;
-    expect_conversion = compressor != NULL || encryptor != NULL;
+    expect_conversion =
+      btree->compressor != NULL || btree->intl_compressor != NULL || encryptor != NULL;
     if (expect_conversion) {
         WT_RET(__wt_scr_alloc(session, 4 * 1024, &tmp));
         ip = tmp;
@@ -161,6 +161,7 @@ __wt_blkcache_read(WT_SESSION_IMPL *session, WT_ITEM *buf, const uint8_t *addr,
 
     dsk = ip->data;
     if (F_ISSET(dsk, WT_PAGE_COMPRESSED)) {
+        compressor = __wt_btree_compressor(btree, dsk->type);
         if (compressor == NULL || compressor->decompress == NULL) {
             ret = __blkcache_read_corrupt(session, WT_ERROR, addr, addr_size,
               "compressed block for which no compression configured");
@@ -180,7 +181,7 @@ __wt_blkcache_read(WT_SESSION_IMPL *session, WT_ITEM *buf, const uint8_t *addr,
          * In other words, the "tmp" in the decompress call isn't a mistake.
          */
         memcpy(buf->mem, ip->data, WT_BLOCK_COMPRESS_SKIP);
-        ret = compressor->decompress(btree->compressor, &session->iface,
+        ret = compressor->decompress(compressor, &session->iface,
           (uint8_t *)ip->data + WT_BLOCK_COMPRESS_SKIP, tmp->size - WT_BLOCK_COMPRESS_SKIP,
           (uint8_t *)buf->mem + WT_BLOCK_COMPRESS_SKIP, dsk->mem_size - WT_BLOCK_COMPRESS_SKIP,
           &result_len);
@@ -238,6 +239,7 @@ __wt_blkcache_write(WT_SESSION_IMPL *session, WT_ITEM *buf, uint8_t *addr, size_
     WT_BLKCACHE *blkcache;
     WT_BM *bm;
     WT_BTREE *btree;
+    WT_COMPRESSOR *compressor;
     WT_DECL_ITEM(ctmp);
     WT_DECL_ITEM(etmp);
     WT_DECL_RET;
@@ -260,9 +262,11 @@ __wt_blkcache_write(WT_SESSION_IMPL *session, WT_ITEM *buf, uint8_t *addr, size_
 
     /*
      * Optionally stream-compress the data, but don't compress blocks that are already as small as
-     * they're going to get.
+     * they're going to get. Internal and leaf pages can have different compressors.
      */
-    if (btree->compressor == NULL || btree->compressor->compress == NULL || compressed)
+    dsk = buf->mem;
+    compressor = __wt_btree_compressor(btree, dsk->type);
+    if (compressor == NULL || compressor->compress == NULL || compressed)
         ip = buf;
     else if (buf->size <= btree->allocsize) {
         ip = buf;
@@ -279,11 +283,10 @@ __wt_blkcache_write(WT_SESSION_IMPL *session, WT_ITEM *buf, uint8_t *addr, size_
          * memory because they don't stop just because there's no more memory into which to
          * compress.
          */
-        if (btree->compressor->pre_size == NULL)
+        if (compressor->pre_size == NULL)
             len = src_len;
         else
-            WT_ERR(
-              btree->compressor->pre_size(btree->compressor, &session->iface, src, src_len, &len));
+            WT_ERR(compressor->pre_size(compressor, &session->iface, src, src_len, &len));
 
         size = len + WT_BLOCK_COMPRESS_SKIP;
         WT_ERR(bm->write_size(bm, session, &size));
@@ -294,8 +297,8 @@ __wt_blkcache_write(WT_SESSION_IMPL *session, WT_ITEM *buf, uint8_t *addr, size_
         dst_len = len;
 
         compression_failed = 0;
-        WT_ERR(btree->compressor->compress(btree->compressor, &session->iface, src, src_len, dst,
-          dst_len, &result_len, &compression_failed));
+        WT_ERR(compressor->compress(compressor, &session->iface, src, src_len, dst, dst_len,
+          &result_len, &compression_failed));
         result_len += WT_BLOCK_COMPRESS_SKIP;
 
         /*
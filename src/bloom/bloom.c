@@ -401,3 +401,63 @@ __wt_bloom_drop(WT_BLOOM *bloom, const char *config) WT_GCC_FUNC_ATTRIBUTE((visi
 
     return (ret);
 }
+
+/*
+ * __wt_page_bloom_create --
+ *     Allocate an in-memory Bloom filter sized for the given number of keys.
+ */
+int
+__wt_page_bloom_create(
+  WT_SESSION_IMPL *session, uint64_t n, uint32_t factor, uint32_t k, WT_PAGE_BLOOM **bloomp)
+{
+    WT_PAGE_BLOOM *bloom;
+    size_t memsize;
+    uint64_t m;
+
+    *bloomp = NULL;
+
+    /* An empty page gets a minimal filter, every search of it is a miss. */
+    m = WT_MAX(n * factor, 8);
+    memsize = sizeof(WT_PAGE_BLOOM) + (size_t)__bitstr_size(m);
+    WT_RET(__wt_calloc(session, 1, memsize, &bloom));
+    bloom->m = m;
+    bloom->k = k;
+    bloom->memsize = memsize;
+
+    *bloomp = bloom;
+    return (0);
+}
+
+/*
+ * __wt_page_bloom_insert --
+ *     Add a key to an in-memory Bloom filter.
+ */
+void
+__wt_page_bloom_insert(WT_PAGE_BLOOM *bloom, const void *data, size_t size)
+{
+    uint64_t h1, h2;
+    uint32_t i;
+
+    h1 = __wt_hash_fnv64(data, size);
+    h2 = __wt_hash_city64(data, size);
+    for (i = 0; i < bloom->k; i++, h1 += h2)
+        __bit_set(WT_PAGE_BLOOM_BITSTRING(bloom), h1 % bloom->m);
+}
+
+/*
+ * __wt_page_bloom_test --
+ *     Return if a key may be in an in-memory Bloom filter, false means the key was never inserted.
+ */
+bool
+__wt_page_bloom_test(WT_PAGE_BLOOM *bloom, const void *data, size_t size)
+{
+    uint64_t h1, h2;
+    uint32_t i;
+
+    h1 = __wt_hash_fnv64(data, size);
+    h2 = __wt_hash_city64(data, size);
+    for (i = 0; i < bloom->k; i++, h1 += h2)
+        if (!__bit_test(WT_PAGE_BLOOM_BITSTRING(bloom), h1 % bloom->m))
+            return (false);
+    return (true);
+}
@@ -832,9 +832,13 @@ __wt_btcur_search(WT_CURSOR_BTREE *cbt)
     if (!valid) {
         WT_ERR(__wt_cursor_func_init(cbt, true));
 
-        if (btree->type == BTREE_ROW)
-            WT_ERR(__cursor_row_search(cbt, false, NULL, NULL));
-        else
+        if (btree->type == BTREE_ROW) {
+            /* Only an exact-match search can be answered by a leaf page's key filter. */
+            F_SET(cbt, WT_CBT_SEARCH_EXACT);
+            ret = __cursor_row_search(cbt, false, NULL, NULL);
+            F_CLR(cbt, WT_CBT_SEARCH_EXACT);
+            WT_ERR(ret);
+        } else
             WT_ERR(__cursor_col_search(cbt, NULL, NULL));
 
         if (cbt->compare == 0)
@@ -882,6 +886,77 @@ err:
     return (ret);
 }
 
+/*
+ * __wt_btcur_search_batch_key --
+ *     Search for one key of a sorted batch. Unlike a standalone search, the cursor stays positioned
+ *     on its leaf page when the key isn't found, so following keys of the batch can be resolved on
+ *     that page without another descent of the tree. Whenever the search does descend the tree, the
+ *     remaining keys of the batch are used to pre-fetch the leaf pages they will need.
+ */
+int
+__wt_btcur_search_batch_key(WT_CURSOR_BTREE *cbt, const WT_ITEM **next, size_t next_count)
+{
+    WT_CURSOR *cursor;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+    bool key_out_of_bounds, leaf_found, resolved, valid;
+
+    cursor = &cbt->iface;
+    key_out_of_bounds = resolved = valid = false;
+    session = CUR2S(cbt);
+
+    WT_ASSERT(session, CUR2BT(cbt)->type == BTREE_ROW);
+
+    WT_RET(__wt_txn_search_check(session));
+    __cursor_novalue(cursor);
+
+    WT_RET(__btcur_bounds_contains_key(
+      session, cursor, &cursor->key, cursor->recno, &key_out_of_bounds, NULL));
+    if (key_out_of_bounds) {
+        WT_STAT_CONN_DATA_INCR(session, cursor_bounds_search_early_exit);
+        return (WT_NOTFOUND);
+    }
+
+    /*
+     * Search any pinned page first. As with search-near, only trust the pinned page's result if the
+     * search ends on a slot other than the page's boundary slots, otherwise a neighbor page might
+     * hold the key. That's also true of misses, which is where the batch search does better than a
+     * series of standalone searches.
+     */
+    if (__cursor_page_pinned(cbt, true)) {
+        __wt_txn_cursor_op(session);
+
+        WT_RET(__cursor_row_search(cbt, false, cbt->ref, &leaf_found));
+        if (leaf_found && cbt->slot != 0 && cbt->slot != cbt->ref->page->entries - 1) {
+            resolved = true;
+            WT_STAT_CONN_INCR(session, cursor_search_batch_pinned);
+            if (cbt->compare == 0)
+                WT_RET(__wt_cursor_valid(cbt, &valid, false));
+        }
+    }
+    if (!resolved) {
+        WT_RET(__wt_cursor_func_init(cbt, true));
+
+        WT_RET(__cursor_row_search(cbt, false, NULL, NULL));
+        if (cbt->compare == 0)
+            WT_RET(__wt_cursor_valid(cbt, &valid, false));
+
+        if (next_count != 0) {
+            WT_WITH_PAGE_INDEX(
+              session, ret = __wt_btree_prefetch_batch(session, cbt->ref, next, next_count));
+            WT_RET(ret);
+        }
+    }
+    if (!valid)
+        return (WT_NOTFOUND);
+
+#ifdef HAVE_DIAGNOSTIC
+    WT_RET(__wt_cursor_key_order_init(cbt));
+#endif
+    return (F_ISSET(cursor, WT_CURSTD_KEY_ONLY) ? __wt_key_return(cbt) :
+                                                  __cursor_kv_return(cbt, cbt->upd_value));
+}
+
 /*
  * __btcur_search_neighboring --
  *     Search for a valid record around the cursor location.
@@ -1282,6 +1357,67 @@ done:
     return (ret);
 }
 
+/*
+ * __wt_btcur_insert_batch_key --
+ *     Insert or overwrite a single key/value pair of a batch of row-store inserts. Unlike insert,
+ *     the cursor is left positioned on the leaf page, so the next key of the sorted batch can
+ *     usually be inserted without another search of the tree.
+ */
+int
+__wt_btcur_insert_batch_key(WT_CURSOR_BTREE *cbt)
+{
+    WT_CURSOR *cursor;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+    uint64_t yield_count, sleep_usecs;
+    bool key_out_of_bounds, leaf_found;
+
+    cursor = &cbt->iface;
+    session = CUR2S(cbt);
+    yield_count = sleep_usecs = 0;
+
+    WT_ASSERT(session, CUR2BT(cbt)->type == BTREE_ROW);
+
+    WT_RET(__cursor_size_chk(session, &cursor->key));
+    WT_RET(__cursor_size_chk(session, &cursor->value));
+
+    WT_RET(__btcur_bounds_contains_key(
+      session, cursor, &cursor->key, cursor->recno, &key_out_of_bounds, NULL));
+    if (key_out_of_bounds)
+        return (WT_NOTFOUND);
+
+    /*
+     * Search any pinned page first. The key belongs on the pinned page if the search ends on a slot
+     * other than the page's boundary slots, in which case the page's insert lists can be updated
+     * directly. Otherwise, or if the page changed underneath us, fall back to a full search.
+     */
+    if (__cursor_page_pinned(cbt, true)) {
+        WT_RET(__wt_txn_autocommit_check(session));
+
+        WT_RET(__cursor_row_search(cbt, true, cbt->ref, &leaf_found));
+        if (leaf_found && cbt->slot != 0 && cbt->slot != cbt->ref->page->entries - 1) {
+            ret = __cursor_row_modify(cbt, &cursor->value, WT_UPDATE_STANDARD);
+            if (ret != WT_RESTART) {
+                if (ret == 0)
+                    WT_STAT_CONN_INCR(session, cursor_insert_batch_pinned);
+                return (ret);
+            }
+        }
+    }
+
+retry:
+    WT_ERR(__wt_cursor_func_init(cbt, true));
+    WT_ERR(__cursor_row_search(cbt, true, NULL, NULL));
+    ret = __cursor_row_modify(cbt, &cursor->value, WT_UPDATE_STANDARD);
+
+err:
+    if (ret == WT_RESTART) {
+        __cursor_restart(session, &yield_count, &sleep_usecs);
+        goto retry;
+    }
+    return (ret);
+}
+
 /*
  * __curfile_update_check --
  *     Check whether an update would conflict. This function expects the cursor to already be
@@ -1723,6 +1859,7 @@ done:
 static bool
 __cursor_chain_needs_full_upd(WT_CURSOR_BTREE *cbt)
 {
+    WT_BTREE *btree;
     WT_CURSOR *cursor;
     WT_PAGE *page;
     WT_SESSION_IMPL *session;
@@ -1730,6 +1867,7 @@ __cursor_chain_needs_full_upd(WT_CURSOR_BTREE *cbt)
     size_t upd_size;
     int i;
 
+    btree = CUR2BT(cbt);
     cursor = &cbt->iface;
     page = cbt->ref->page;
     session = CUR2S(cbt);
@@ -1754,6 +1892,22 @@ __cursor_chain_needs_full_upd(WT_CURSOR_BTREE *cbt)
     if (upd != NULL && (upd->txnid == WT_TXN_ABORTED || upd->type == WT_UPDATE_TOMBSTONE))
         return (true);
 
+    /*
+     * Tables configured to keep compact modify chains only write a full value once the chain's cost
+     * passes the configured limits: the number of deltas readers apply to rebuild the value, or the
+     * memory the deltas use relative to the value's size. Many small changes to a large value then
+     * cost a full copy of the value every few hundred modify calls rather than every few.
+     */
+    if (btree->modify_chain_compact) {
+        for (i = 0, upd_size = 0; upd != NULL && upd->type == WT_UPDATE_MODIFY;
+             ++i, upd = upd->next) {
+            if (i >= (int)btree->modify_chain_max_length)
+                return (true);
+            upd_size += WT_UPDATE_MEMSIZE(upd);
+        }
+        return (upd_size * 100 >= cursor->value.size * btree->modify_chain_max_pct);
+    }
+
     /*
      * Step through the modify operations at the beginning of the chain.
      *
@@ -1851,9 +2005,10 @@ __wt_btcur_modify(WT_CURSOR_BTREE *cbt, WT_MODIFY *entries, int nentries)
      */
     overwrite = F_ISSET(cursor, WT_CURSTD_OVERWRITE);
     F_CLR(cursor, WT_CURSTD_OVERWRITE);
-    if (cursor->value.size <= 64 || __cursor_chain_needs_full_upd(cbt))
+    if (cursor->value.size <= 64 || __cursor_chain_needs_full_upd(cbt)) {
+        WT_STAT_CONN_DATA_INCR(session, cursor_modify_full_value);
         ret = __btcur_update(cbt, &cursor->value, WT_UPDATE_STANDARD);
-    else
+    } else
         ret = __btcur_update(cbt, modify, WT_UPDATE_MODIFY);
     if (overwrite)
         F_SET(cursor, WT_CURSTD_OVERWRITE);
@@ -178,6 +178,7 @@ __free_page_modify(WT_SESSION_IMPL *session, WT_PAGE *page)
              */
             __wt_free(session, multi->disk_image);
             __wt_free(session, multi->addr.addr);
+            __wt_free(session, multi->addr.bloom);
         }
         __wt_free(session, mod->mod_multi);
         break;
@@ -194,6 +195,7 @@ __free_page_modify(WT_SESSION_IMPL *session, WT_PAGE *page)
          * Therefore, no need to reconcile the page again if it remains clean.
          */
         __wt_free(session, mod->mod_replace.addr);
+        __wt_free(session, mod->mod_replace.bloom);
         __wt_free(session, mod->mod_disk_image);
         break;
     }
@@ -260,6 +262,9 @@ __ref_addr_safe_free(WT_SESSION_IMPL *session, void *ref_addr)
     split_gen = __wt_gen(session, WT_GEN_SPLIT);
     WT_TRET(__wt_stash_add(
       session, WT_GEN_SPLIT, split_gen, ((WT_ADDR *)ref_addr)->addr, ((WT_ADDR *)ref_addr)->size));
+    if (((WT_ADDR *)ref_addr)->bloom != NULL)
+        WT_TRET(__wt_stash_add(session, WT_GEN_SPLIT, split_gen, ((WT_ADDR *)ref_addr)->bloom,
+          ((WT_ADDR *)ref_addr)->bloom->memsize));
     WT_TRET(__wt_stash_add(session, WT_GEN_SPLIT, split_gen, ref_addr, sizeof(WT_ADDR)));
     __wt_gen_next(session, WT_GEN_SPLIT, NULL);
 
@@ -269,11 +274,13 @@ __ref_addr_safe_free(WT_SESSION_IMPL *session, void *ref_addr)
 
 /*
  * __wt_ref_addr_free --
- *     Free the address in a reference, if necessary.
+ *     Free the address in a reference, if necessary. If the reference's home page remains in
+ *     memory, release the memory charged to it for the address.
  */
 void
-__wt_ref_addr_free(WT_SESSION_IMPL *session, WT_REF *ref)
+__wt_ref_addr_free(WT_SESSION_IMPL *session, WT_REF *ref, bool home_charged)
 {
+    WT_ADDR *addr;
     WT_PAGE *home;
     void *ref_addr;
 
@@ -306,8 +313,13 @@ __wt_ref_addr_free(WT_SESSION_IMPL *session, WT_REF *ref)
         __wt_yield();
     }
 
-    if (home == NULL || __wt_off_page(home, ref_addr))
+    if (home == NULL || __wt_off_page(home, ref_addr)) {
+        /* Leaf page Bloom filters are charged to the page referencing them. */
+        addr = ref_addr;
+        if (home_charged && home != NULL && addr->bloom != NULL)
+            __wt_cache_page_inmem_decr(session, home, addr->bloom->memsize);
         __ref_addr_safe_free(session, ref_addr);
+    }
 }
 
 /*
@@ -357,7 +369,7 @@ __wt_free_ref(WT_SESSION_IMPL *session, WT_REF *ref, int page_type, bool free_pa
     }
 
     /* Free any address allocation. */
-    __wt_ref_addr_free(session, ref);
+    __wt_ref_addr_free(session, ref, false);
 
     /* Free any backing fast-truncate memory. */
     __wt_free(session, ref->page_del);
@@ -378,6 +390,8 @@ __free_page_int(WT_SESSION_IMPL *session, WT_PAGE *page)
     for (pindex = WT_INTL_INDEX_GET_SAFE(page), i = 0; i < pindex->entries; ++i)
         __wt_free_ref(session, pindex->index[i], page->type, false);
 
+    if (pindex->prefix != WT_PAGE_INDEX_PREFIX_DISCARDED)
+        __wt_free(session, pindex->prefix);
     __wt_free(session, pindex);
 }
 
@@ -410,6 +424,8 @@ __wt_free_ref_index(WT_SESSION_IMPL *session, WT_PAGE *page, WT_PAGE_INDEX *pind
 
         __wt_free_ref(session, ref, page->type, free_pages);
     }
+    if (pindex->prefix != WT_PAGE_INDEX_PREFIX_DISCARDED)
+        __wt_free(session, pindex->prefix);
     __wt_free(session, pindex);
 }
 
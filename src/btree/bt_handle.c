@@ -39,6 +39,12 @@ __btree_clear(WT_SESSION_IMPL *session)
     if (btree->collator_owned && btree->collator->terminate != NULL)
         WT_TRET(btree->collator->terminate(btree->collator, &session->iface));
 
+    /* Terminate any associated compressors. */
+    if (btree->compressor_owned && btree->compressor->terminate != NULL)
+        WT_TRET(btree->compressor->terminate(btree->compressor, &session->iface));
+    if (btree->intl_compressor_owned && btree->intl_compressor->terminate != NULL)
+        WT_TRET(btree->intl_compressor->terminate(btree->intl_compressor, &session->iface));
+
     /* Destroy locks. */
     __wt_rwlock_destroy(session, &btree->ovfl_lock);
     __wt_spin_destroy(session, &btree->flush_lock);
@@ -298,6 +304,61 @@ __wt_btree_config_encryptor(
     return (0);
 }
 
+/*
+ * __btree_compressor_conf --
+ *     Configure the leaf and internal page compressors. Each class of page is configured with its
+ *     own compression level, passed to the compressor when it's customized for the tree. The leaf
+ *     page compressor is also passed any state it stored for the tree.
+ */
+static int
+__btree_compressor_conf(WT_SESSION_IMPL *session, const char **cfg)
+{
+    WT_BTREE *btree;
+    WT_CONFIG_ITEM cval, intl_cval, level, state;
+    WT_DECL_ITEM(config);
+    WT_DECL_RET;
+    int64_t intl_level;
+
+    btree = S2BT(session);
+
+    WT_RET(__wt_config_gets(session, cfg, "block_compressor_state", &state));
+    WT_RET(__wt_scr_alloc(session, 64 + state.len, &config));
+
+    WT_ERR(__wt_config_gets_none(session, cfg, "block_compressor", &cval));
+    WT_ERR(__wt_config_gets(session, cfg, "block_compressor_level", &level));
+    WT_ERR(__wt_buf_fmt(session, config, "page_type=leaf,level=%" PRId64, level.val));
+    if (state.len != 0)
+        WT_ERR(__wt_buf_catfmt(session, config, ",state=\"%.*s\"", (int)state.len, state.str));
+    WT_ERR(__wt_compressor_config(session, btree->dhandle->name, &cval, config->data,
+      &btree->compressor, &btree->compressor_owned));
+
+    /*
+     * Internal pages default to the leaf page compressor and level, in which case they share the
+     * leaf page compressor.
+     */
+    WT_ERR(__wt_config_gets(session, cfg, "internal_page_compressor", &intl_cval));
+    WT_ERR(__wt_config_gets(session, cfg, "internal_page_compressor_level", &level));
+    if (intl_cval.len == 0 && level.val == 0) {
+        btree->intl_compressor = btree->compressor;
+        btree->intl_compressor_owned = 0;
+        goto err;
+    }
+    if (intl_cval.len == 0)
+        intl_cval = cval;
+    intl_level = level.val;
+    if (intl_level == 0) {
+        WT_ERR(__wt_config_gets(session, cfg, "block_compressor_level", &level));
+        intl_level = level.val;
+    }
+    WT_ERR(__wt_buf_fmt(session, config, "page_type=internal,level=%" PRId64, intl_level));
+    WT_ERR(__wt_compressor_config(session, btree->dhandle->name, &intl_cval, config->data,
+      &btree->intl_compressor, &btree->intl_compressor_owned));
+
+err:
+    __wt_scr_free(session, &config);
+    return (ret);
+}
+
 /*
  * __btree_conf --
  *     Configure a WT_BTREE structure.
@@ -475,6 +536,17 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt, bool is_ckpt)
         btree->prefix_compression = cval.val != 0;
         WT_RET(__wt_config_gets(session, cfg, "prefix_compression_min", &cval));
         btree->prefix_compression_min = (u_int)cval.val;
+        WT_RET(__wt_config_gets(session, cfg, "prefix_compression_restart", &cval));
+        btree->prefix_compression_restart = (u_int)cval.val;
+
+        /*
+         * Leaf page Bloom filters hash the key bytes, a custom collator can consider different byte
+         * strings equal, ignore the filters in that case.
+         */
+        WT_RET(__wt_config_gets(session, cfg, "leaf_bloom_bit_count", &cval));
+        btree->leaf_bloom_bit_count = btree->collator == NULL ? (uint32_t)cval.val : 0;
+        WT_RET(__wt_config_gets(session, cfg, "leaf_bloom_hash_count", &cval));
+        btree->leaf_bloom_hash_count = (uint32_t)cval.val;
     /* FALLTHROUGH */
     case BTREE_COL_VAR:
         WT_RET(__wt_config_gets(session, cfg, "dictionary", &cval));
@@ -482,8 +554,14 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt, bool is_ckpt)
         break;
     }
 
-    WT_RET(__wt_config_gets_none(session, cfg, "block_compressor", &cval));
-    WT_RET(__wt_compressor_config(session, &cval, &btree->compressor));
+    WT_RET(__wt_config_gets(session, cfg, "modify_chain.compact", &cval));
+    btree->modify_chain_compact = cval.val != 0;
+    WT_RET(__wt_config_gets(session, cfg, "modify_chain.max_length", &cval));
+    btree->modify_chain_max_length = (u_int)cval.val;
+    WT_RET(__wt_config_gets(session, cfg, "modify_chain.max_pct", &cval));
+    btree->modify_chain_max_pct = (u_int)cval.val;
+
+    WT_RET(__btree_compressor_conf(session, cfg));
 
     /*
      * Configure compression adjustment.
@@ -500,8 +578,7 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt, bool is_ckpt)
     btree->maxintlpage_precomp = btree->maxintlpage;
     btree->leafpage_compadjust = false;
     btree->maxleafpage_precomp = btree->maxleafpage;
-    if (btree->compressor != NULL && btree->compressor->compress != NULL &&
-      btree->type != BTREE_COL_FIX) {
+    if (btree->type != BTREE_COL_FIX) {
         /*
          * Don't do compression adjustment when on-disk page sizes are less than 16KB. There's not
          * enough compression going on to fine-tune the size, all we end up doing is hammering
@@ -509,12 +586,17 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt, bool is_ckpt)
          *
          * Don't do compression adjustment when on-disk page sizes are equal to the maximum
          * in-memory page image, the bytes taken for compression can't grow past the base value.
+         *
+         * Internal and leaf pages can have different compressors, adjust each class of page only
+         * if it's compressed.
          */
-        if (btree->maxintlpage >= 16 * 1024 && btree->maxmempage_image > btree->maxintlpage) {
+        if (btree->intl_compressor != NULL && btree->intl_compressor->compress != NULL &&
+          btree->maxintlpage >= 16 * 1024 && btree->maxmempage_image > btree->maxintlpage) {
             btree->intlpage_compadjust = true;
             btree->maxintlpage_precomp = btree->maxmempage_image;
         }
-        if (btree->maxleafpage >= 16 * 1024 && btree->maxmempage_image > btree->maxleafpage) {
+        if (btree->compressor != NULL && btree->compressor->compress != NULL &&
+          btree->maxleafpage >= 16 * 1024 && btree->maxmempage_image > btree->maxleafpage) {
             btree->leafpage_compadjust = true;
             btree->maxleafpage_precomp = btree->maxmempage_image;
         }
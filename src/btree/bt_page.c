@@ -811,6 +811,63 @@ __inmem_col_var(
     return (0);
 }
 
+/*
+ * __wt_page_index_prefix_build --
+ *     Build the fixed-width key prefixes for a row-store internal page index.
+ */
+int
+__wt_page_index_prefix_build(
+  WT_SESSION_IMPL *session, WT_PAGE *page, WT_PAGE_INDEX *pindex, WT_PAGE_INDEX_PREFIX **prefixp)
+{
+    WT_PAGE_INDEX_PREFIX *prefix;
+    size_t first_size, last_size, memsize, size, skip;
+    uint32_t distinct, i;
+    const void *data, *first, *last;
+
+    *prefixp = NULL;
+
+    /*
+     * Skip the leading bytes every key shares, they don't tell keys apart. The keys are sorted, so
+     * the bytes shared by the first and last keys are shared by all of them. The 0th key is never
+     * compared (see the comment in the search function), ignore it.
+     */
+    __wt_ref_key(page, pindex->index[1], &first, &first_size);
+    __wt_ref_key(page, pindex->index[pindex->entries - 1], &last, &last_size);
+    skip = __wt_lex_match(first, last, WT_MIN(first_size, last_size));
+
+    /*
+     * A single allocation holds the prefixes, then a copy of the shared bytes, so searches only
+     * read the page's keys on a prefix tie.
+     */
+    memsize = sizeof(WT_PAGE_INDEX_PREFIX) + pindex->entries * sizeof(int64_t) + skip;
+    WT_RET(__wt_calloc(session, 1, memsize, &prefix));
+    prefix->memsize = memsize;
+    prefix->skip = (uint32_t)skip;
+    prefix->slot = (int64_t *)(prefix + 1);
+    prefix->shared = (uint8_t *)(prefix->slot + pindex->entries);
+    if (skip != 0)
+        memcpy(prefix->shared, first, skip);
+    for (distinct = 0, i = 1; i < pindex->entries; ++i) {
+        __wt_ref_key(page, pindex->index[i], &data, &size);
+        prefix->slot[i] = __wt_lex_prefix(data, size, skip);
+        if (i == 1 || prefix->slot[i] != prefix->slot[i - 1])
+            ++distinct;
+    }
+
+    /*
+     * If few keys have distinct prefixes, comparing prefixes won't narrow searches, keep a stub so
+     * searches don't try again.
+     */
+    if (distinct < pindex->entries / 4) {
+        __wt_free(session, prefix);
+        WT_RET(__wt_calloc_one(session, &prefix));
+        prefix->memsize = sizeof(WT_PAGE_INDEX_PREFIX);
+    }
+
+    *prefixp = prefix;
+    return (0);
+}
+
 /*
  * __inmem_row_int --
  *     Build in-memory index for row-store internal pages.
@@ -923,6 +980,13 @@ __inmem_row_int(WT_SESSION_IMPL *session, WT_PAGE *page, size_t *sizep)
     if (overflow_keys)
         F_SET_ATOMIC_16(page, WT_PAGE_INTL_OVERFLOW_KEYS);
 
+    /*
+     * Build the fixed-width key prefixes searches compare before the keys themselves, while the
+     * keys are in cache.
+     */
+    if (btree->collator == NULL && pindex->entries >= WT_PAGE_INDEX_PREFIX_MIN)
+        WT_ERR(__wt_page_index_prefix_build(session, page, pindex, &pindex->prefix));
+
 err:
     __wt_scr_free(session, &current);
     return (ret);
@@ -92,6 +92,87 @@ __wt_btree_prefetch(WT_SESSION_IMPL *session, WT_REF *ref)
     return (ret);
 }
 
+/*
+ * __wt_btree_prefetch_batch --
+ *     Pre-load the leaf pages a sorted batch of keys is going to need. This session holds a hazard
+ *     pointer on the ref passed in, the leaf page the batch is currently positioned on, and must be
+ *     in a split generation. Walk the parent's index alongside the remaining keys and queue each
+ *     child page on disk that one of the keys will be searched for in.
+ */
+int
+__wt_btree_prefetch_batch(WT_SESSION_IMPL *session, WT_REF *ref, const WT_ITEM **keys, size_t count)
+{
+    WT_BTREE *btree;
+    WT_CONNECTION_IMPL *conn;
+    WT_ITEM key;
+    WT_PAGE *home;
+    WT_PAGE_INDEX *pindex;
+    WT_REF *last_ref, *next_ref;
+    size_t i;
+    uint64_t block_preload;
+    uint32_t slot;
+
+    btree = S2BT(session);
+    conn = S2C(session);
+    block_preload = 0;
+
+    /*
+     * Batches don't need the history of disk reads standalone pre-fetch uses to detect scans, but
+     * otherwise follow the same rules: pre-fetch must be enabled in the session, and special trees
+     * and internal sessions are skipped. Skip trees with custom collators, the batch keys are in
+     * lexicographic order.
+     */
+    if (!F_ISSET(session, WT_SESSION_PREFETCH_ENABLED) || F_ISSET(session, WT_SESSION_INTERNAL) ||
+      F_ISSET(btree, WT_BTREE_SPECIAL_FLAGS) || btree->collator != NULL ||
+      btree->evict_disabled > 0 || session->dhandle->type != WT_DHANDLE_TYPE_BTREE ||
+      __wt_session_gen(session, WT_GEN_SPLIT) == 0)
+        return (0);
+
+    /*
+     * Find the current page's slot in its parent. If the hint is wrong the parent split or a page
+     * was deleted, give up rather than search for the slot, this is only an optimization.
+     */
+    home = ref->home;
+    WT_INTL_INDEX_GET(session, home, pindex);
+    slot = ref->pindex_hint;
+    if (slot >= pindex->entries || pindex->index[slot] != ref)
+        return (0);
+
+    for (last_ref = ref, i = 0; i < count; ++i) {
+        /*
+         * Move to the child page holding the key, the last slot with a starting key less than or
+         * equal to the key. Stop at the parent's last slot, keys past it might belong to another
+         * internal page.
+         */
+        for (; slot + 1 < pindex->entries; ++slot) {
+            __wt_ref_key(home, pindex->index[slot + 1], &key.data, &key.size);
+            if (__wt_lex_compare(keys[i], &key) < 0)
+                break;
+        }
+        next_ref = pindex->index[slot];
+
+        /* Don't let the pre-fetch queue get overwhelmed. */
+        if (conn->prefetch_queue_count > WT_MAX_PREFETCH_QUEUE ||
+          block_preload > WT_PREFETCH_QUEUE_PER_TRIGGER)
+            break;
+
+        /* As with scans, only queue leaf pages that aren't in cache, deleted or already queued. */
+        if (next_ref != last_ref && next_ref->state == WT_REF_DISK &&
+          F_ISSET(next_ref, WT_REF_FLAG_LEAF) && next_ref->page_del == NULL &&
+          !F_ISSET(next_ref, WT_REF_FLAG_PREFETCH)) {
+            WT_RET(__wt_conn_prefetch_queue_push(session, next_ref));
+            ++block_preload;
+        }
+        last_ref = next_ref;
+
+        if (slot + 1 == pindex->entries)
+            break;
+    }
+
+    WT_STAT_CONN_INCRV(session, block_prefetch_pages_queued, block_preload);
+    return (0);
+}
+
 /*
  * __wt_prefetch_page_in --
  *     Does the heavy lifting of reading a page into the cache. Immediately releases the page since
@@ -129,3 +210,56 @@ err:
     WT_LEAVE_GENERATION(session, WT_GEN_SPLIT);
     return (ret);
 }
+
+/*
+ * __wt_prefetch_read_submit --
+ *     Queue an asynchronous read of a queued page's block. The read is only queued if the page is
+ *     still on disk and its block can be read through the ring, otherwise the page is read
+ *     synchronously when it's brought into the cache. Must be called while holding a dhandle.
+ */
+int
+__wt_prefetch_read_submit(
+  WT_SESSION_IMPL *session, WT_PREFETCH_READ *pr, WT_IO_URING *ring, uint64_t id)
+{
+    WT_ADDR_COPY addr;
+    WT_BM *bm;
+    WT_DECL_RET;
+    wt_off_t offset;
+    uint32_t checksum, objectid, size;
+    bool copied;
+
+    pr->fh = NULL;
+    pr->done = false;
+
+    /*
+     * Tiered trees read blocks through per-object handles that can come and go, leave them to the
+     * synchronous path.
+     */
+    bm = S2BT(session)->bm;
+    if (bm->is_multi_handle || pr->pe->ref->state != WT_REF_DISK || pr->pe->ref->page_del != NULL)
+        return (0);
+
+    WT_ENTER_GENERATION(session, WT_GEN_SPLIT);
+    copied = __wt_ref_addr_copy(session, pr->pe->ref, &addr);
+    WT_LEAVE_GENERATION(session, WT_GEN_SPLIT);
+    if (!copied)
+        return (0);
+
+    WT_RET(__wt_block_addr_unpack(
+      session, bm->block, addr.addr, addr.size, &objectid, &offset, &size, &checksum));
+
+    F_SET(&pr->buf, WT_ITEM_ALIGNED);
+    WT_RET(__wt_buf_init(session, &pr->buf, size));
+
+    /* File handles without a descriptor the ring can use are read synchronously. */
+    if ((ret = __wt_io_uring_read(
+           session, ring, bm->block->fh, offset, (size_t)size, pr->buf.mem, id)) == ENOTSUP)
+        return (0);
+    WT_RET(ret);
+
+    pr->fh = bm->block->fh;
+    pr->offset = offset;
+    pr->size = size;
+    pr->checksum = checksum;
+    return (0);
+}
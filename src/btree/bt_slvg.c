@@ -1329,7 +1329,7 @@ __slvg_col_build_leaf(WT_SESSION_IMPL *session, WT_TRACK *trk, WT_REF *ref)
      * should the salvage run eventually fail, the original information would have been lost.) Clear
      * the reference addr so eviction doesn't free the underlying blocks.
      */
-    __wt_ref_addr_free(session, ref);
+    __wt_ref_addr_free(session, ref, false);
 
     /*
      * Reconciliation may skip a key/value pair (based on timestamps), and in that case, if the
@@ -1987,7 +1987,7 @@ __slvg_row_build_leaf(WT_SESSION_IMPL *session, WT_TRACK *trk, WT_REF *ref, WT_S
      * should the salvage run eventually fail, the original information would have been lost.) Clear
      * the reference addr so eviction doesn't free the underlying blocks.
      */
-    __wt_ref_addr_free(session, ref);
+    __wt_ref_addr_free(session, ref, false);
 
     /*
      * Reconciliation may skip a key/value pair (based on timestamps), and in that case, if the
@@ -48,6 +48,26 @@ __split_safe_free(WT_SESSION_IMPL *session, uint64_t split_gen, bool exclusive,
     return (__wt_stash_add(session, WT_GEN_SPLIT, split_gen, p, s));
 }
 
+/*
+ * __split_prefix_safe_free --
+ *     Free the key prefixes of a page index being replaced. Searchers still using the page index may
+ *     be building them, mark them discarded so a late build isn't published.
+ */
+static int
+__split_prefix_safe_free(
+  WT_SESSION_IMPL *session, uint64_t split_gen, bool exclusive, WT_PAGE_INDEX *pindex)
+{
+    WT_PAGE_INDEX_PREFIX *prefix;
+
+    do {
+        WT_ORDERED_READ(prefix, pindex->prefix);
+    } while (!__wt_atomic_cas_ptr(&pindex->prefix, prefix, WT_PAGE_INDEX_PREFIX_DISCARDED));
+
+    if (prefix == NULL || prefix == WT_PAGE_INDEX_PREFIX_DISCARDED)
+        return (0);
+    return (__split_safe_free(session, split_gen, exclusive, prefix, prefix->memsize));
+}
+
 /*
  * __split_verify_intl_key_order --
  *     Verify the key order on an internal page after a split.
@@ -271,7 +291,9 @@ __split_ref_move(WT_SESSION_IMPL *session, WT_PAGE *from_home, WT_REF **from_ref
         /* If the compare-and-swap is successful, clear addr to skip the free at the end. */
         if (__wt_atomic_cas_ptr(&ref->addr, ref_addr, addr))
             addr = NULL;
-    }
+    } else if (ref_addr != NULL && ((WT_ADDR *)ref_addr)->bloom != NULL)
+        /* Leaf page Bloom filters are charged to the page referencing them, move the charge. */
+        WT_MEM_TRANSFER(*decrp, *incrp, ((WT_ADDR *)ref_addr)->bloom->memsize);
 
     /* And finally, copy the WT_REF pointer itself. */
     *to_refp = ref;
@@ -548,6 +570,7 @@ __split_root(WT_SESSION_IMPL *session, WT_PAGE *root)
      * may already be using the new index.
      */
     WT_SPLIT_PAGE_SAVE_STATE(root, session, root->entries, split_gen);
+    WT_TRET(__split_prefix_safe_free(session, split_gen, false, pindex));
     size = sizeof(WT_PAGE_INDEX) + pindex->entries * sizeof(WT_REF *);
     WT_TRET(__split_safe_free(session, split_gen, false, pindex, size));
     root_decr += size;
@@ -833,6 +856,7 @@ __split_parent(WT_SESSION_IMPL *session, WT_REF *ref, WT_REF **ref_new, uint32_t
      * discard list, to be freed when it's safe.
      */
     WT_SPLIT_PAGE_SAVE_STATE(parent, session, parent_entries, split_gen);
+    WT_TRET(__split_prefix_safe_free(session, split_gen, exclusive, pindex));
     size = sizeof(WT_PAGE_INDEX) + pindex->entries * sizeof(WT_REF *);
     WT_TRET(__split_safe_free(session, split_gen, exclusive, pindex, size));
     parent_decr += size;
@@ -1084,6 +1108,7 @@ __split_internal(WT_SESSION_IMPL *session, WT_PAGE *parent, WT_PAGE *page)
      * using the new parent page.
      */
     WT_SPLIT_PAGE_SAVE_STATE(page, session, page->entries, split_gen);
+    WT_TRET(__split_prefix_safe_free(session, split_gen, false, pindex));
     size = sizeof(WT_PAGE_INDEX) + pindex->entries * sizeof(WT_REF *);
     WT_TRET(__split_safe_free(session, split_gen, false, pindex, size));
     page_decr += size;
@@ -1732,6 +1757,12 @@ __wt_multi_to_ref(WT_SESSION_IMPL *session, WT_PAGE *page, WT_MULTI *multi, WT_R
         WT_RET(__wt_memdup(session, multi->addr.addr, multi->addr.size, &addr->addr));
         addr->size = multi->addr.size;
         addr->type = multi->addr.type;
+        if (multi->addr.bloom != NULL) {
+            WT_RET(
+              __wt_memdup(session, multi->addr.bloom, multi->addr.bloom->memsize, &addr->bloom));
+            if (incrp)
+                *incrp += addr->bloom->memsize;
+        }
 
         WT_REF_SET_STATE(ref, WT_REF_DISK);
     }
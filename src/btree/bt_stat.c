@@ -32,6 +32,7 @@ __wt_btree_stat_init(WT_SESSION_IMPL *session, WT_CURSOR_STAT *cst)
 
     WT_RET(bm->stat(bm, session, stats[0]));
 
+    WT_STAT_SET(session, stats, btree_contention_max, btree->contention_max);
     WT_STAT_SET(session, stats, btree_fixed_len, btree->bitcnt);
     WT_STAT_SET(session, stats, btree_maximum_depth, btree->maximum_depth);
     WT_STAT_SET(session, stats, btree_maxintlpage, btree->maxintlpage);
@@ -197,6 +197,240 @@ __sync_page_skip(
     return (0);
 }
 
+/*
+ * __sync_helper_claim --
+ *     Claim the checkpoint helper threads to reconcile the current tree's dirty leaf pages.
+ */
+static int
+__sync_helper_claim(WT_SESSION_IMPL *session, uint32_t rec_flags, bool *claimedp)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_TXN *helper_txn, *txn;
+    uint32_t queue_max, threads;
+
+    *claimedp = false;
+
+    conn = S2C(session);
+    txn = session->txn;
+
+    /*
+     * Helpers reconcile using a copy of the checkpoint's transaction, ignore other sessions writing
+     * a tree. The metadata is written with the checkpoint's own updates in a single pass.
+     */
+    if ((threads = conn->ckpt_helper_threads_num) == 0 || !WT_SESSION_IS_CHECKPOINT(session) ||
+      WT_IS_METADATA(session->dhandle))
+        return (0);
+
+    /*
+     * Limit the queue to a few pages per helper: each queued page holds one of our hazard pointers
+     * until the queue is drained.
+     */
+    queue_max = threads * 4;
+    WT_RET(__wt_realloc_def(
+      session, &conn->ckpt_helper_queue_alloc, queue_max, &conn->ckpt_helper_queue));
+
+    if (conn->ckpt_helper_txn == NULL)
+        WT_RET(__wt_calloc(session, 1,
+          sizeof(WT_TXN) + sizeof(txn->snapshot_data.snapshot[0]) * conn->session_array.size,
+          &conn->ckpt_helper_txn));
+
+    /* Copy the checkpoint's visibility information, the helpers never modify it. */
+    helper_txn = conn->ckpt_helper_txn;
+    *helper_txn = *txn;
+    helper_txn->snapshot_data.snapshot = helper_txn->__snapshot;
+    if (txn->snapshot_data.snapshot_count != 0)
+        memcpy(helper_txn->__snapshot, txn->snapshot_data.snapshot,
+          txn->snapshot_data.snapshot_count * sizeof(txn->snapshot_data.snapshot[0]));
+    helper_txn->backup_snapshot_data = NULL;
+    helper_txn->mod = NULL;
+    helper_txn->mod_alloc = 0;
+    helper_txn->mod_count = 0;
+    helper_txn->logrec = NULL;
+    helper_txn->ckpt_snapshot = NULL;
+
+    __wt_spin_lock(session, &conn->ckpt_helper_lock);
+    WT_ASSERT(session, conn->ckpt_helper_owner == NULL);
+    conn->ckpt_helper_dhandle = session->dhandle;
+    conn->ckpt_helper_read_ts = WT_SESSION_TXN_SHARED(session)->read_timestamp;
+    conn->ckpt_helper_rec_flags = rec_flags;
+    conn->ckpt_helper_queue_max = queue_max;
+    conn->ckpt_helper_queue_cnt = conn->ckpt_helper_queue_next = 0;
+    conn->ckpt_helper_busy = 0;
+    conn->ckpt_helper_ret = 0;
+    conn->ckpt_helper_owner = session;
+    __wt_spin_unlock(session, &conn->ckpt_helper_lock);
+
+    *claimedp = true;
+    return (0);
+}
+
+/*
+ * __sync_helper_drain --
+ *     Reconcile the queued leaf pages alongside the helper threads, wait for the helpers to finish
+ *     and release the pages.
+ */
+static int
+__sync_helper_drain(WT_SESSION_IMPL *session, uint32_t flags)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    uint32_t busy, i;
+    bool didwork, waited;
+
+    conn = S2C(session);
+
+    if (conn->ckpt_helper_queue_cnt == 0)
+        return (0);
+
+    do {
+        __wt_sync_file_helper(session, &didwork);
+    } while (didwork);
+
+    /* Wait for helper threads still reconciling pages taken from the queue. */
+    for (waited = false;; waited = true) {
+        WT_ORDERED_READ(busy, conn->ckpt_helper_busy);
+        if (busy == 0)
+            break;
+        if (!waited)
+            WT_STAT_CONN_INCR(session, checkpoint_pages_reconciled_helper_wait);
+        __wt_yield();
+    }
+
+    /* Every queued page has been taken, only the checkpoint looks at the queue. */
+    for (i = 0; i < conn->ckpt_helper_queue_cnt; ++i)
+        WT_TRET(__wt_page_release(session, conn->ckpt_helper_queue[i], flags));
+
+    __wt_spin_lock(session, &conn->ckpt_helper_lock);
+    conn->ckpt_helper_queue_cnt = conn->ckpt_helper_queue_next = 0;
+    if (ret == 0)
+        ret = conn->ckpt_helper_ret;
+    conn->ckpt_helper_ret = 0;
+    __wt_spin_unlock(session, &conn->ckpt_helper_lock);
+
+    return (ret);
+}
+
+/*
+ * __sync_helper_push --
+ *     Queue a dirty leaf page for the checkpoint helper threads.
+ */
+static int
+__sync_helper_push(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
+{
+    WT_CONNECTION_IMPL *conn;
+
+    conn = S2C(session);
+
+    if (conn->ckpt_helper_queue_cnt == conn->ckpt_helper_queue_max)
+        WT_RET(__sync_helper_drain(session, flags));
+
+    /* The tree walk moves on, the queue holds its own hazard pointer. */
+    WT_RET(__sync_dup_hazard_pointer(session, ref));
+
+    __wt_spin_lock(session, &conn->ckpt_helper_lock);
+    conn->ckpt_helper_queue[conn->ckpt_helper_queue_cnt++] = ref;
+    __wt_spin_unlock(session, &conn->ckpt_helper_lock);
+
+    __wt_cond_signal(session, conn->ckpt_helper_threads.wait_cond);
+    return (0);
+}
+
+/*
+ * __sync_helper_release --
+ *     Drain the checkpoint helper queue and give up the helper threads.
+ */
+static int
+__sync_helper_release(WT_SESSION_IMPL *session, uint32_t flags)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+
+    conn = S2C(session);
+
+    ret = __sync_helper_drain(session, flags);
+
+    __wt_spin_lock(session, &conn->ckpt_helper_lock);
+    conn->ckpt_helper_owner = NULL;
+    conn->ckpt_helper_dhandle = NULL;
+    __wt_spin_unlock(session, &conn->ckpt_helper_lock);
+
+    return (ret);
+}
+
+/*
+ * __wt_sync_file_helper --
+ *     Reconcile a leaf page queued by a checkpoint, called by both the checkpoint and its helper
+ *     threads. Errors are saved for the checkpoint, which checks them when draining the queue.
+ */
+void
+__wt_sync_file_helper(WT_SESSION_IMPL *session, bool *didworkp)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DATA_HANDLE *dhandle;
+    WT_DECL_RET;
+    WT_REF *ref;
+    WT_TXN *helper_txn, saved_txn, *txn;
+    WT_TXN_SHARED *txn_shared;
+    wt_timestamp_t saved_read_ts;
+    uint32_t rec_flags;
+    bool is_helper;
+
+    *didworkp = false;
+
+    conn = S2C(session);
+    txn = session->txn;
+    txn_shared = WT_SESSION_TXN_SHARED(session);
+    saved_read_ts = WT_TS_NONE;
+
+    __wt_spin_lock(session, &conn->ckpt_helper_lock);
+    if (conn->ckpt_helper_owner == NULL ||
+      conn->ckpt_helper_queue_next == conn->ckpt_helper_queue_cnt) {
+        __wt_spin_unlock(session, &conn->ckpt_helper_lock);
+        return;
+    }
+    ref = conn->ckpt_helper_queue[conn->ckpt_helper_queue_next++];
+    ++conn->ckpt_helper_busy;
+    is_helper = conn->ckpt_helper_owner != session;
+    dhandle = conn->ckpt_helper_dhandle;
+    rec_flags = conn->ckpt_helper_rec_flags;
+    __wt_spin_unlock(session, &conn->ckpt_helper_lock);
+
+    /*
+     * Helper threads take on the checkpoint's snapshot and read timestamp for the duration of the
+     * reconciliation. The copy is stable: the checkpoint doesn't release the helpers until there
+     * are no busy pages.
+     */
+    if (is_helper) {
+        helper_txn = conn->ckpt_helper_txn;
+        saved_txn = *txn;
+        *txn = *helper_txn;
+        txn->snapshot_data.snapshot = txn->__snapshot;
+        if (helper_txn->snapshot_data.snapshot_count != 0)
+            memcpy(txn->__snapshot, helper_txn->__snapshot,
+              helper_txn->snapshot_data.snapshot_count * sizeof(txn->__snapshot[0]));
+        saved_read_ts = txn_shared->read_timestamp;
+        txn_shared->read_timestamp = conn->ckpt_helper_read_ts;
+        F_SET(session, WT_SESSION_CHECKPOINT_HELPER);
+    }
+
+    WT_WITH_DHANDLE(session, dhandle, ret = __wt_reconcile(session, ref, NULL, rec_flags));
+
+    if (is_helper) {
+        F_CLR(session, WT_SESSION_CHECKPOINT_HELPER);
+        txn_shared->read_timestamp = saved_read_ts;
+        *txn = saved_txn;
+        WT_STAT_CONN_INCR(session, checkpoint_pages_reconciled_helper);
+    }
+
+    __wt_spin_lock(session, &conn->ckpt_helper_lock);
+    if (ret != 0 && conn->ckpt_helper_ret == 0)
+        conn->ckpt_helper_ret = ret;
+    --conn->ckpt_helper_busy;
+    __wt_spin_unlock(session, &conn->ckpt_helper_lock);
+
+    *didworkp = true;
+}
+
 /*
  * __wt_sync_file --
  *     Flush pages for a specific file.
@@ -214,13 +448,13 @@ __wt_sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
     uint64_t internal_bytes, internal_pages, leaf_bytes, leaf_pages;
     uint64_t oldest_id, saved_pinned_id, time_start, time_stop;
     uint32_t flags, rec_flags;
-    bool dirty, internal_cleanup, is_hs, is_internal, tried_eviction;
+    bool dirty, helpers, internal_cleanup, is_hs, is_internal, tried_eviction;
 
     conn = S2C(session);
     btree = S2BT(session);
     prev = walk = NULL;
     txn = session->txn;
-    tried_eviction = false;
+    helpers = tried_eviction = false;
 
     /* Don't bump page read generations. */
     flags = WT_READ_NO_GEN;
@@ -321,6 +555,9 @@ __wt_sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
         if (!is_hs && !WT_IS_METADATA(btree->dhandle))
             rec_flags |= WT_REC_HS;
 
+        /* Hand dirty leaf pages to the checkpoint helper threads, if configured. */
+        WT_ERR(__sync_helper_claim(session, rec_flags, &helpers));
+
         /* Write all dirty in-cache pages. */
         LF_SET(WT_READ_NO_EVICT);
 
@@ -352,7 +589,13 @@ __wt_sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
             if (walk == NULL)
                 break;
 
+            /*
+             * Internal pages are written after their children: the walk is post-order, wait for
+             * the helpers to finish with any queued leaf pages before looking at the internal page.
+             */
             is_internal = F_ISSET(walk, WT_REF_FLAG_INTERNAL);
+            if (is_internal && helpers)
+                WT_ERR(__sync_helper_drain(session, flags));
             if (is_internal && internal_cleanup) {
                 WT_WITH_PAGE_INDEX(session, ret = __wt_sync_obsolete_cleanup(session, walk));
                 WT_ERR(ret);
@@ -439,7 +682,10 @@ __wt_sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
             if (FLD_ISSET(rec_flags, WT_REC_HS))
                 WT_STAT_CONN_INCR(session, checkpoint_hs_pages_reconciled);
 
-            WT_ERR(__wt_reconcile(session, walk, NULL, rec_flags));
+            if (helpers && !is_internal)
+                WT_ERR(__sync_helper_push(session, walk, flags));
+            else
+                WT_ERR(__wt_reconcile(session, walk, NULL, rec_flags));
 
             /*
              * Update checkpoint IO tracking data if configured to log verbose progress messages.
@@ -486,6 +732,10 @@ __wt_sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
     }
 
 err:
+    /* Wait for any pages queued for the helper threads. */
+    if (helpers)
+        WT_TRET(__sync_helper_release(session, flags));
+
     /* On error, clear any left-over tree walk. */
     WT_TRET(__wt_page_release(session, walk, flags));
     WT_TRET(__wt_page_release(session, prev, flags));
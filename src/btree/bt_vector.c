@@ -0,0 +1,228 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Vectorized key comparison: the functions here are selected once, when the library initializes,
+ * based on the instruction sets the CPU supports. The 16-byte (SSE2) comparisons inlined in the
+ * btree comparison functions are always available on x86, wider versions are called for long keys.
+ */
+#if defined(HAVE_X86INTRIN_H) && !defined(_MSC_VER) && (defined(__amd64) || defined(__x86_64))
+#define WT_VECTOR_X86 1
+#endif
+
+/*
+ * __lex_match_default --
+ *     Return the number of leading bytes two buffers have in common.
+ */
+static size_t
+__lex_match_default(const uint8_t *userp, const uint8_t *treep, size_t len)
+{
+    size_t match;
+
+    match = 0;
+#ifdef HAVE_X86INTRIN_H
+    {
+        __m128i u, t;
+
+        for (; len - match >= WT_VECTOR_SIZE; match += WT_VECTOR_SIZE) {
+            u = _mm_loadu_si128((const __m128i *)(userp + match));
+            t = _mm_loadu_si128((const __m128i *)(treep + match));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(u, t)) != 65535)
+                break;
+        }
+    }
+#endif
+    for (; match < len; ++match)
+        if (userp[match] != treep[match])
+            break;
+    return (match);
+}
+
+/*
+ * __prefix_count_default --
+ *     Return the number of slots in a sorted prefix array less than a key.
+ */
+static uint32_t
+__prefix_count_default(const int64_t *slot, uint32_t entries, int64_t key)
+{
+    uint32_t i;
+
+    for (i = 0; i < entries; ++i)
+        if (slot[i] >= key)
+            break;
+    return (i);
+}
+
+#ifdef WT_VECTOR_X86
+static size_t __lex_match_avx2(const uint8_t *, const uint8_t *, size_t)
+  WT_GCC_FUNC_DECL_ATTRIBUTE((target("avx2")));
+static size_t __lex_match_avx512(const uint8_t *, const uint8_t *, size_t)
+  WT_GCC_FUNC_DECL_ATTRIBUTE((target("avx512f,avx512bw")));
+static uint32_t __prefix_count_avx2(const int64_t *, uint32_t, int64_t)
+  WT_GCC_FUNC_DECL_ATTRIBUTE((target("avx2")));
+static uint32_t __prefix_count_avx512(const int64_t *, uint32_t, int64_t)
+  WT_GCC_FUNC_DECL_ATTRIBUTE((target("avx512f")));
+
+/*
+ * __lex_match_avx2 --
+ *     Return the number of leading bytes two buffers have in common, 32 bytes at a time.
+ */
+static size_t
+__lex_match_avx2(const uint8_t *userp, const uint8_t *treep, size_t len)
+{
+    __m256i u, t;
+    size_t match;
+    uint32_t eq;
+
+    for (match = 0; len - match >= 32; match += 32) {
+        u = _mm256_loadu_si256((const __m256i *)(userp + match));
+        t = _mm256_loadu_si256((const __m256i *)(treep + match));
+        eq = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(u, t));
+        if (eq != UINT32_MAX)
+            return (match + (size_t)__builtin_ctz(~eq));
+    }
+    return (match + __lex_match_default(userp + match, treep + match, len - match));
+}
+
+/*
+ * __lex_match_avx512 --
+ *     Return the number of leading bytes two buffers have in common, 64 bytes at a time.
+ */
+static size_t
+__lex_match_avx512(const uint8_t *userp, const uint8_t *treep, size_t len)
+{
+    __m512i u, t;
+    __mmask64 ne;
+    size_t match;
+
+    for (match = 0; len - match >= 64; match += 64) {
+        u = _mm512_loadu_si512((const void *)(userp + match));
+        t = _mm512_loadu_si512((const void *)(treep + match));
+        if ((ne = _mm512_cmpneq_epi8_mask(u, t)) != 0)
+            return (match + (size_t)__builtin_ctzll(ne));
+    }
+
+    /* Compare the remaining bytes with a masked load rather than falling back to a byte loop. */
+    if (match < len) {
+        ne = ((uint64_t)1 << (len - match)) - 1;
+        u = _mm512_maskz_loadu_epi8(ne, userp + match);
+        t = _mm512_maskz_loadu_epi8(ne, treep + match);
+        if ((ne = _mm512_cmpneq_epi8_mask(u, t)) != 0)
+            return (match + (size_t)__builtin_ctzll(ne));
+    }
+    return (len);
+}
+
+/*
+ * __prefix_count_avx2 --
+ *     Return the number of slots in a sorted prefix array less than a key, 4 slots at a time.
+ */
+static uint32_t
+__prefix_count_avx2(const int64_t *slot, uint32_t entries, int64_t key)
+{
+    __m256i k;
+    uint32_t i, lt;
+
+    k = _mm256_set1_epi64x(key);
+    for (i = 0; entries - i >= 4; i += 4) {
+        lt = (uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(
+          _mm256_cmpgt_epi64(k, _mm256_loadu_si256((const __m256i *)(slot + i)))));
+        /* The slots are sorted, the first slot not less than the key ends the run. */
+        if (lt != 0xf)
+            return (i + (uint32_t)__builtin_ctz(~lt));
+    }
+    return (i + __prefix_count_default(slot + i, entries - i, key));
+}
+
+/*
+ * __prefix_count_avx512 --
+ *     Return the number of slots in a sorted prefix array less than a key, 8 slots at a time.
+ */
+static uint32_t
+__prefix_count_avx512(const int64_t *slot, uint32_t entries, int64_t key)
+{
+    __m512i k;
+    uint32_t i, lt;
+
+    k = _mm512_set1_epi64(key);
+    for (i = 0; entries - i >= 8; i += 8) {
+        lt = (uint32_t)_mm512_cmplt_epi64_mask(_mm512_loadu_si512((const void *)(slot + i)), k);
+        /* The slots are sorted, the first slot not less than the key ends the run. */
+        if (lt != 0xff)
+            return (i + (uint32_t)__builtin_ctz(~lt));
+    }
+    return (i + __prefix_count_default(slot + i, entries - i, key));
+}
+
+/*
+ * __vector_cpuid --
+ *     Execute the cpuid instruction.
+ */
+static void
+__vector_cpuid(uint32_t leaf, uint32_t subleaf, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp)
+{
+    uint32_t eax, ebx, ecx, edx;
+
+    __asm__ __volatile__("cpuid"
+                         : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+                         : "a"(leaf), "c"(subleaf));
+    *eaxp = eax;
+    *ebxp = ebx;
+    *ecxp = ecx;
+}
+#endif
+
+/*
+ * __wt_btree_vector_init --
+ *     Select the key comparison functions for the instruction sets the CPU supports.
+ */
+void
+__wt_btree_vector_init(void)
+{
+#ifdef WT_VECTOR_X86
+    uint32_t eax, ebx, ecx, xcr0_lo, xcr0_hi;
+#endif
+
+    __wt_process.lex_match = __lex_match_default;
+    __wt_process.prefix_count = __prefix_count_default;
+
+#ifdef WT_VECTOR_X86
+    /* The instructions need CPU support, and the operating system must save the wide registers. */
+    __vector_cpuid(0, 0, &eax, &ebx, &ecx);
+    if (eax < 7)
+        return;
+    __vector_cpuid(1, 0, &eax, &ebx, &ecx);
+#define CPUID_ECX_HAS_OSXSAVE (1u << 27)
+#define CPUID_ECX_HAS_AVX (1u << 28)
+    if ((ecx & (CPUID_ECX_HAS_OSXSAVE | CPUID_ECX_HAS_AVX)) !=
+      (CPUID_ECX_HAS_OSXSAVE | CPUID_ECX_HAS_AVX))
+        return;
+    __asm__ __volatile__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+    WT_UNUSED(xcr0_hi);
+
+    __vector_cpuid(7, 0, &eax, &ebx, &ecx);
+#define CPUID_EBX_HAS_AVX2 (1u << 5)
+#define CPUID_EBX_HAS_AVX512F (1u << 16)
+#define CPUID_EBX_HAS_AVX512BW (1u << 30)
+#define XCR0_AVX_STATE 0x06u    /* XMM and YMM registers */
+#define XCR0_AVX512_STATE 0xe6u /* XMM, YMM, opmask and ZMM registers */
+    if ((xcr0_lo & XCR0_AVX_STATE) != XCR0_AVX_STATE || (ebx & CPUID_EBX_HAS_AVX2) == 0)
+        return;
+    __wt_process.lex_match = __lex_match_avx2;
+    __wt_process.prefix_count = __prefix_count_avx2;
+
+    if ((xcr0_lo & XCR0_AVX512_STATE) != XCR0_AVX512_STATE ||
+      (ebx & (CPUID_EBX_HAS_AVX512F | CPUID_EBX_HAS_AVX512BW)) !=
+        (CPUID_EBX_HAS_AVX512F | CPUID_EBX_HAS_AVX512BW))
+        return;
+    __wt_process.lex_match = __lex_match_avx512;
+    __wt_process.prefix_count = __prefix_count_avx512;
+#endif
+}
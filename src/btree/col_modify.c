@@ -255,6 +255,10 @@ __wt_col_modify(WT_CURSOR_BTREE *cbt, uint64_t recno, const WT_ITEM *value, WT_U
 
     inserted_to_update_chain = true;
 
+    /* Check if threads racing to modify the page have made it worth splitting. */
+    if (!exclusive)
+        __wt_page_contention_check(session, cbt->ref);
+
     /*
      * If the update was successful, add it to the in-memory log.
      *
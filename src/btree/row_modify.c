@@ -247,6 +247,10 @@ __wt_row_modify(WT_CURSOR_BTREE *cbt, const WT_ITEM *key, const WT_ITEM *value,
 
     inserted_to_update_chain = true;
 
+    /* Check if threads racing to modify the page have made it worth splitting. */
+    if (!exclusive)
+        __wt_page_contention_check(session, cbt->ref);
+
     /*
      * If the update was successful, add it to the in-memory log.
      *
@@ -282,6 +282,168 @@ __validate_next_stack(
     return (0);
 }
 
+/*
+ * __row_search_prefix_lower --
+ *     Return the first slot in a range of sorted key prefixes not less than the search prefix.
+ */
+static inline uint32_t
+__row_search_prefix_lower(const int64_t *slot, uint32_t lo, uint32_t hi, int64_t key)
+{
+    uint32_t mid;
+
+    /* Binary search down to a few cache lines of prefixes, then compare them several at a time. */
+    while (hi - lo > 32) {
+        mid = lo + ((hi - lo) >> 1);
+        if (slot[mid] < key)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return (lo + __wt_prefix_count(slot + lo, hi - lo, key));
+}
+
+/*
+ * __row_search_prefix --
+ *     Narrow the binary search of a row-store internal page to the slots whose key prefixes match
+ *     the search key's prefix. Keys with smaller prefixes sort before the search key, keys with
+ *     larger prefixes sort after it, so the range can be empty, and the slot to descend is known.
+ */
+static inline int
+__row_search_prefix(WT_SESSION_IMPL *session, WT_PAGE *page, WT_PAGE_INDEX *pindex,
+  WT_ITEM *srch_key, uint32_t *basep, uint32_t *limitp)
+{
+    WT_PAGE_INDEX_PREFIX *prefix;
+    int64_t key;
+    uint32_t hi, lo;
+    int cmp;
+
+    /*
+     * The prefixes are built when a page is read, page indexes created by splits are built by their
+     * first search. Threads can race to build them, the losers discard their copies. If the page
+     * index has been replaced by a split, the prefixes are marked discarded so a late build isn't
+     * published and leaked.
+     */
+    WT_ORDERED_READ(prefix, pindex->prefix);
+    if (prefix == NULL) {
+        WT_RET(__wt_page_index_prefix_build(session, page, pindex, &prefix));
+        if (!__wt_atomic_cas_ptr(&pindex->prefix, NULL, prefix)) {
+            __wt_free(session, prefix);
+            WT_ORDERED_READ(prefix, pindex->prefix);
+        }
+    }
+    if (prefix == WT_PAGE_INDEX_PREFIX_DISCARDED || prefix->slot == NULL)
+        return (0);
+
+    /*
+     * A search key that differs in the bytes every key shares sorts before or after all of them.
+     * The shared bytes are copied next to the prefixes, the page's keys are only read on a prefix
+     * tie.
+     */
+    if (prefix->skip != 0) {
+        cmp = memcmp(srch_key->data, prefix->shared, WT_MIN(srch_key->size, prefix->skip));
+        if (cmp != 0 || srch_key->size < prefix->skip) {
+            *basep = cmp > 0 ? pindex->entries : 1;
+            *limitp = 0;
+            return (0);
+        }
+    }
+
+    key = __wt_lex_prefix(srch_key->data, srch_key->size, prefix->skip);
+    lo = __row_search_prefix_lower(prefix->slot, 1, pindex->entries, key);
+    hi = key == INT64_MAX ? pindex->entries :
+                            __row_search_prefix_lower(prefix->slot, lo, pindex->entries, key + 1);
+    *basep = lo;
+    *limitp = hi - lo;
+    return (0);
+}
+
+/*
+ * __row_search_leaf_bloom_skip --
+ *     Return if a leaf page that isn't in memory can't hold the search key, according to the key
+ *     filter built when the page was written.
+ */
+static inline bool
+__row_search_leaf_bloom_skip(WT_REF *ref, WT_ITEM *srch_key)
+{
+    WT_ADDR *addr;
+    WT_PAGE_BLOOM *bloom;
+
+    /*
+     * A page on disk has no in-memory updates, the filter describes every key it holds. The address
+     * may be swapped for a newer one once we look away from the state; that address and its filter
+     * are just as current, and the WT_ADDR can't be freed while we hold the split generation.
+     */
+    if (!F_ISSET(ref, WT_REF_FLAG_LEAF) || ref->state != WT_REF_DISK)
+        return (false);
+    WT_ORDERED_READ(addr, ref->addr);
+    if (addr == NULL || !__wt_off_page(ref->home, addr) || (bloom = addr->bloom) == NULL)
+        return (false);
+    return (!__wt_page_bloom_test(bloom, srch_key->data, srch_key->size));
+}
+
+/*
+ * __row_search_leaf_restart --
+ *     Narrow the binary search of a row-store leaf page to the slots between two restart keys, keys
+ *     that aren't prefix compressed (or are already instantiated), and so can be compared without
+ *     building them. Return the matching slot if a restart key matches the search key.
+ */
+static inline int
+__row_search_leaf_restart(WT_SESSION_IMPL *session, WT_PAGE *page, WT_COLLATOR *collator,
+  WT_ITEM *srch_key, WT_ITEM *item, uint32_t *basep, uint32_t *limitp, WT_ROW **matchp)
+{
+    WT_ROW *rip;
+    size_t key_size;
+    uint32_t base, indx, restart, slot, top;
+    uint8_t key_prefix;
+    int cmp;
+    void *copy;
+    const void *key_data;
+
+    *matchp = NULL;
+    restart = S2BT(session)->prefix_compression_restart;
+
+    /*
+     * Binary search the restart keys: take the middle slot of the range, step back to the closest
+     * restart key and compare the search key against it. Reconciliation writes a restart key at
+     * least every N keys so the step back is bounded. If there's no restart key in that distance
+     * (the page was written with a different configuration, or there's a run of overflow keys),
+     * leave the rest of the range to the caller's binary search.
+     */
+    base = 0;
+    top = page->entries;
+    while (top - base > restart) {
+        indx = base + ((top - base) >> 1);
+        for (slot = indx;; --slot) {
+            rip = page->pg_row + slot;
+
+            /* The row-store key can change underfoot; explicitly take a copy. */
+            copy = WT_ROW_KEY_COPY(rip);
+            __wt_row_leaf_key_info(page, copy, NULL, NULL, &key_data, &key_size, &key_prefix);
+            if (key_data != NULL && key_prefix == 0)
+                break;
+            if (slot == base || indx - slot + 1 >= restart)
+                goto done;
+        }
+
+        item->data = key_data;
+        item->size = key_size;
+        WT_RET(__wt_compare(session, collator, srch_key, item, &cmp));
+        if (cmp == 0) {
+            *matchp = rip;
+            return (0);
+        }
+        if (cmp > 0)
+            base = slot + 1;
+        else
+            top = slot;
+    }
+
+done:
+    *basep = base;
+    *limitp = top - base;
+    return (0);
+}
+
 /*
  * __check_leaf_key_range --
  *     Check the search key is in the leaf page's key range.
@@ -369,7 +531,7 @@ __wt_row_search(WT_CURSOR_BTREE *cbt, WT_ITEM *srch_key, bool insert, WT_REF *le
     size_t match, skiphigh, skiplow;
     uint32_t base, indx, limit, read_flags;
     int cmp, depth;
-    bool append_check, descend_right, done;
+    bool append_check, descend_right, done, instantiate;
 
     session = CUR2S(cbt);
     btree = S2BT(session);
@@ -465,9 +627,14 @@ restart:
          * the loop costs about 5%.
          *
          * Reference the comment above about the 0th key: we continue to special-case it.
+         *
+         * Large pages without a collator first compare fixed-width key prefixes, several slots at
+         * a time, leaving only the slots with the search key's prefix for the binary search.
          */
         base = 1;
         limit = pindex->entries - 1;
+        if (collator == NULL && pindex->entries >= WT_PAGE_INDEX_PREFIX_MIN)
+            WT_ERR(__row_search_prefix(session, page, pindex, srch_key, &base, &limit));
         if (collator == NULL && srch_key->size <= WT_COMPARE_SHORT_MAXLEN)
             for (; limit != 0; limit >>= 1) {
                 indx = base + (limit >> 1);
@@ -566,6 +733,15 @@ descend:
          *
          * On other error, simply return, the swap call ensures we're holding nothing on failure.
          */
+        /*
+         * An exact-match search doesn't need to read a leaf page whose key filter excludes the
+         * search key, the key isn't in the tree.
+         */
+        if (F_ISSET(cbt, WT_CBT_SEARCH_EXACT) && __row_search_leaf_bloom_skip(descent, srch_key)) {
+            WT_STAT_CONN_DATA_INCR(session, cursor_search_leaf_bloom_skip);
+            WT_ERR(WT_NOTFOUND);
+        }
+
         read_flags = WT_READ_RESTART_OK;
         if (F_ISSET(cbt, WT_CBT_READ_ONCE))
             FLD_SET(read_flags, WT_READ_WONT_NEED);
@@ -627,14 +803,26 @@ leaf_only:
      * Binary search of an leaf page. There are three versions (keys with no application-specified
      * collation order, in long and short versions, and keys with an application-specified collation
      * order), because doing the tests and error handling inside the loop costs about 5%.
+     *
+     * If the tree is configured to write restart keys, first narrow the search to the slots between
+     * two restart keys. The remaining keys are built by rolling forward from a restart key through
+     * a bounded number of keys, don't instantiate them and grow the page's memory footprint.
      */
     base = 0;
     limit = page->entries;
+    instantiate = true;
+    if (btree->prefix_compression_restart != 0) {
+        WT_ERR(__row_search_leaf_restart(
+          session, page, collator, srch_key, item, &base, &limit, &rip));
+        if (rip != NULL)
+            goto leaf_match;
+        instantiate = false;
+    }
     if (collator == NULL && srch_key->size <= WT_COMPARE_SHORT_MAXLEN)
         for (; limit != 0; limit >>= 1) {
             indx = base + (limit >> 1);
             rip = page->pg_row + indx;
-            WT_ERR(__wt_row_leaf_key(session, page, rip, item, true));
+            WT_ERR(__wt_row_leaf_key(session, page, rip, item, instantiate));
 
             cmp = __wt_lex_compare_short(srch_key, item);
             if (cmp > 0) {
@@ -665,7 +853,7 @@ leaf_only:
         for (; limit != 0; limit >>= 1) {
             indx = base + (limit >> 1);
             rip = page->pg_row + indx;
-            WT_ERR(__wt_row_leaf_key(session, page, rip, item, true));
+            WT_ERR(__wt_row_leaf_key(session, page, rip, item, instantiate));
 
             match = WT_MIN(skiplow, skiphigh);
             cmp = __wt_lex_compare_skip(session, srch_key, item, &match);
@@ -682,7 +870,7 @@ leaf_only:
         for (; limit != 0; limit >>= 1) {
             indx = base + (limit >> 1);
             rip = page->pg_row + indx;
-            WT_ERR(__wt_row_leaf_key(session, page, rip, item, true));
+            WT_ERR(__wt_row_leaf_key(session, page, rip, item, instantiate));
 
             WT_ERR(__wt_compare(session, collator, srch_key, item, &cmp));
             if (cmp > 0) {
@@ -204,12 +204,36 @@ __compressor_confchk(WT_SESSION_IMPL *session, WT_CONFIG_ITEM *cval, WT_COMPRESS
 
 /*
  * __wt_compressor_config --
- *     Given a configuration, configure the compressor.
+ *     Given a configuration, configure the compressor. Data sources pass their URI and the
+ *     configuration of the class of page the compressor is used for, so the compressor can be
+ *     customized for them, if it's customized the caller owns the returned instance.
  */
 int
-__wt_compressor_config(WT_SESSION_IMPL *session, WT_CONFIG_ITEM *cval, WT_COMPRESSOR **compressorp)
+__wt_compressor_config(WT_SESSION_IMPL *session, const char *uri, WT_CONFIG_ITEM *cval,
+  const char *config, WT_COMPRESSOR **compressorp, int *ownp)
 {
-    return (__compressor_confchk(session, cval, compressorp));
+    WT_COMPRESSOR *compressor, *custom;
+
+    *compressorp = NULL;
+    if (ownp != NULL)
+        *ownp = 0;
+
+    WT_RET(__compressor_confchk(session, cval, &compressor));
+    if (compressor == NULL)
+        return (0);
+
+    custom = NULL;
+    if (uri != NULL && compressor->customize != NULL)
+        WT_RET(compressor->customize(compressor, &session->iface, uri, config, &custom));
+
+    if (custom == NULL)
+        *compressorp = compressor;
+    else {
+        WT_ASSERT(session, ownp != NULL);
+        *compressorp = custom;
+        *ownp = 1;
+    }
+    return (0);
 }
 
 /*
@@ -1741,9 +1765,11 @@ __conn_hash_config(WT_SESSION_IMPL *session, const char *cfg[])
 
     /* Hash bucket arrays. */
     WT_RET(__wt_calloc_def(session, conn->hash_size, &conn->blockhash));
+    WT_RET(__wt_calloc_def(session, conn->hash_size, &conn->cursor_pool));
     WT_RET(__wt_calloc_def(session, conn->hash_size, &conn->fhhash));
     for (i = 0; i < conn->hash_size; ++i) {
         TAILQ_INIT(&conn->blockhash[i]);
+        TAILQ_INIT(&conn->cursor_pool[i]);
         TAILQ_INIT(&conn->fhhash[i]);
     }
     WT_RET(__wt_calloc_def(session, conn->dh_hash_size, &conn->dh_bucket_count));
@@ -2696,6 +2722,7 @@ wiredtiger_dummy_session_init(WT_CONNECTION_IMPL *conn, WT_EVENT_HANDLER *event_
 
     /* Statistics */
     session->stat_bucket = 0;
+    session->stat_conn_bucket = 0;
 
     /*
      * Set the default session's strerror method. If one of the extensions being loaded reports an
@@ -3025,6 +3052,8 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const char *c
     WT_ERR(__wt_config_gets(session, cfg, "cache_cursors", &cval));
     if (cval.val)
         F_SET(conn, WT_CONN_CACHE_CURSORS);
+    WT_ERR(__wt_config_gets(session, cfg, "cursor_pool_max", &cval));
+    conn->cursor_pool_max = (uint32_t)cval.val;
 
     WT_ERR(__wt_config_gets(session, cfg, "checkpoint_cleanup", &cval));
     if (WT_STRING_MATCH("reclaim_space", cval.str, cval.len))
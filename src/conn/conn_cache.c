@@ -222,9 +222,11 @@ int
 __wt_cache_create(WT_SESSION_IMPL *session, const char *cfg[])
 {
     WT_CACHE *cache;
+    WT_CONFIG_ITEM cval;
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
-    int i;
+    WT_EVICT_SHARD *shard;
+    u_int i;
 
     conn = S2C(session);
 
@@ -264,17 +266,29 @@ __wt_cache_create(WT_SESSION_IMPL *session, const char *cfg[])
            conn, "evict pass", false, WT_SESSION_NO_DATA_HANDLES, 0, &cache->walk_session)) != 0)
         WT_RET_MSG(NULL, ret, "Failed to create session for eviction walks");
 
-    /* Allocate the LRU eviction queue. */
+    /*
+     * Allocate the LRU eviction queues: two ordinary queues for each shard, followed by the urgent
+     * queue. The number of shards is fixed for the life of the connection.
+     */
+    WT_RET(__wt_config_gets(session, cfg, "eviction.queue_shards", &cval));
+    cache->evict_shard_count = (u_int)cval.val;
+    cache->evict_queue_count = 2 * cache->evict_shard_count + 1;
     cache->evict_slots = WT_EVICT_WALK_BASE + WT_EVICT_WALK_INCR;
-    for (i = 0; i < WT_EVICT_QUEUE_MAX; ++i) {
+    WT_RET(__wt_calloc_def(session, cache->evict_queue_count, &cache->evict_queues));
+    for (i = 0; i < cache->evict_queue_count; ++i) {
         WT_RET(__wt_calloc_def(session, cache->evict_slots, &cache->evict_queues[i].evict_queue));
         WT_RET(__wt_spin_init(session, &cache->evict_queues[i].evict_lock, "cache eviction"));
     }
-
-    /* Ensure there are always non-NULL queues. */
-    cache->evict_current_queue = cache->evict_fill_queue = &cache->evict_queues[0];
-    cache->evict_other_queue = &cache->evict_queues[1];
-    cache->evict_urgent_queue = &cache->evict_queues[WT_EVICT_URGENT_QUEUE];
+    WT_RET(__wt_calloc_def(session, cache->evict_shard_count, &cache->evict_shards));
+    for (i = 0; i < cache->evict_shard_count; ++i) {
+        shard = &cache->evict_shards[i];
+        WT_RET(__wt_spin_init(session, &shard->evict_queue_lock, "cache eviction shard"));
+
+        /* Ensure there are always non-NULL queues. */
+        shard->evict_current_queue = shard->evict_fill_queue = &cache->evict_queues[2 * i];
+        shard->evict_other_queue = &cache->evict_queues[2 * i + 1];
+    }
+    cache->evict_urgent_queue = &cache->evict_queues[cache->evict_queue_count - 1];
 
     /*
      * We get/set some values in the cache statistics (rather than have two copies), configure them.
@@ -363,7 +377,7 @@ __wt_cache_destroy(WT_SESSION_IMPL *session)
     WT_CACHE *cache;
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
-    int i;
+    u_int i;
 
     conn = S2C(session);
     cache = conn->cache;
@@ -396,10 +410,16 @@ __wt_cache_destroy(WT_SESSION_IMPL *session)
     if (cache->walk_session != NULL)
         WT_TRET(__wt_session_close_internal(cache->walk_session));
 
-    for (i = 0; i < WT_EVICT_QUEUE_MAX; ++i) {
-        __wt_spin_destroy(session, &cache->evict_queues[i].evict_lock);
-        __wt_free(session, cache->evict_queues[i].evict_queue);
-    }
+    if (cache->evict_queues != NULL)
+        for (i = 0; i < cache->evict_queue_count; ++i) {
+            __wt_spin_destroy(session, &cache->evict_queues[i].evict_lock);
+            __wt_free(session, cache->evict_queues[i].evict_queue);
+        }
+    __wt_free(session, cache->evict_queues);
+    if (cache->evict_shards != NULL)
+        for (i = 0; i < cache->evict_shard_count; ++i)
+            __wt_spin_destroy(session, &cache->evict_shards[i].evict_queue_lock);
+    __wt_free(session, cache->evict_shards);
 
     __wt_free(session, conn->cache);
     return (ret);
@@ -73,13 +73,112 @@ __chunkcache_verify_metadata_config(WT_SESSION_IMPL *session, char *md_config, u
     return (0);
 }
 
+/*
+ * WT_CHUNKCACHE_PRELOAD --
+ *     Chunks instantiated from the metadata file, waiting for their content to be read back into
+ *     memory by the preload threads.
+ */
+typedef struct {
+    uint64_t cache_offset;
+    size_t data_sz;
+} WT_CHUNKCACHE_PRELOAD_CHUNK;
+
+typedef struct {
+    uint8_t *memory; /* Base of the mapped chunk cache */
+    size_t page_size;
+
+    WT_CHUNKCACHE_PRELOAD_CHUNK *chunks;
+    size_t chunks_allocated, count;
+    uint64_t bytes; /* Bytes queued, bounded by the budget */
+
+    wt_shared size_t next; /* Next chunk to claim */
+} WT_CHUNKCACHE_PRELOAD;
+
+/*
+ * __chunkcache_preload_worker --
+ *     Claim chunks in turn and fault their content in from the chunk cache file.
+ */
+static WT_THREAD_RET
+__chunkcache_preload_worker(void *arg)
+{
+    WT_CHUNKCACHE_PRELOAD *preload;
+    size_t i;
+    uint8_t *p, *end;
+    volatile uint8_t sink;
+
+    preload = arg;
+    sink = 0;
+
+    while ((i = __wt_atomic_addsize(&preload->next, 1) - 1) < preload->count) {
+        /* Touching one byte in each page is enough to fault the whole page in. */
+        p = preload->memory + preload->chunks[i].cache_offset;
+        end = p + preload->chunks[i].data_sz;
+        for (; p < end; p += preload->page_size)
+            sink ^= *(volatile uint8_t *)p;
+    }
+    WT_UNUSED(sink);
+
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __chunkcache_preload --
+ *     Read the content of the chunks instantiated from the metadata file back into memory, using
+ *     the configured number of threads.
+ */
+static int
+__chunkcache_preload(WT_SESSION_IMPL *session, WT_CHUNKCACHE_PRELOAD *preload)
+{
+    WT_CHUNKCACHE *chunkcache;
+    WT_DECL_RET;
+    wt_thread_t *tids;
+    uint64_t time_start, time_stop;
+    u_int i, nthreads, started;
+
+    chunkcache = &S2C(session)->chunkcache;
+    tids = NULL;
+    started = 0;
+
+    if (preload->count == 0)
+        return (0);
+
+    nthreads = (u_int)WT_MIN(chunkcache->preload_threads, preload->count);
+    WT_RET(__wt_calloc_def(session, nthreads, &tids));
+
+    time_start = __wt_clock(session);
+    for (started = 0; started < nthreads; ++started)
+        WT_ERR(__wt_thread_create(session, &tids[started], __chunkcache_preload_worker, preload));
+
+err:
+    /* Any threads that started drain the whole list, join them even if a later create failed. */
+    for (i = 0; i < started; ++i)
+        WT_TRET(__wt_thread_join(session, &tids[i]));
+    time_stop = __wt_clock(session);
+
+    if (ret == 0) {
+        WT_STAT_CONN_INCRV(session, chunkcache_chunks_preloaded, preload->count);
+        WT_STAT_CONN_INCRV(session, chunkcache_bytes_preloaded, preload->bytes);
+        WT_STAT_CONN_SET(session, chunkcache_preload_time, WT_CLOCKDIFF_US(time_stop, time_start));
+        __wt_verbose(session, WT_VERB_CHUNKCACHE,
+          "preloaded %" WT_SIZET_FMT " chunks (%" PRIu64 " bytes) with %u threads in %" PRIu64
+          "us",
+          preload->count, preload->bytes, nthreads, WT_CLOCKDIFF_US(time_stop, time_start));
+    }
+
+    __wt_free(session, tids);
+    return (ret);
+}
+
 /*
  * __chunkcache_apply_metadata_content --
- *     Extract key/value pairs from a metadata file to allocate chunks in the chunk cache.
+ *     Extract key/value pairs from a metadata file to allocate chunks in the chunk cache. If
+ *     preloading is configured, read the chunks back into memory before returning.
  */
 static int
 __chunkcache_apply_metadata_content(WT_SESSION_IMPL *session)
 {
+    WT_CHUNKCACHE *chunkcache;
+    WT_CHUNKCACHE_PRELOAD preload;
     WT_CURSOR *cursor;
     WT_DECL_RET;
     wt_off_t file_offset;
@@ -87,6 +186,14 @@ __chunkcache_apply_metadata_content(WT_SESSION_IMPL *session)
     uint64_t cache_offset;
     uint32_t id;
     const char *name;
+    bool do_preload;
+
+    chunkcache = &S2C(session)->chunkcache;
+    cursor = NULL;
+    WT_CLEAR(preload);
+    preload.memory = chunkcache->memory;
+    preload.page_size = (size_t)S2C(session)->page_size;
+    do_preload = chunkcache->preload_threads != 0;
 
     WT_ERR(__wt_open_cursor(session, WT_CC_METAFILE_URI, NULL, NULL, &cursor));
 
@@ -95,12 +202,29 @@ __chunkcache_apply_metadata_content(WT_SESSION_IMPL *session)
         WT_ERR(cursor->get_value(cursor, &cache_offset, &data_sz));
         WT_ERR(__wt_chunkcache_create_from_metadata(
           session, name, id, file_offset, cache_offset, data_sz));
+
+        if (!do_preload)
+            continue;
+        if (chunkcache->preload_budget != 0 &&
+          preload.bytes + data_sz > chunkcache->preload_budget) {
+            do_preload = false;
+            continue;
+        }
+        WT_ERR(__wt_realloc_def(
+          session, &preload.chunks_allocated, preload.count + 1, &preload.chunks));
+        preload.chunks[preload.count].cache_offset = cache_offset;
+        preload.chunks[preload.count].data_sz = data_sz;
+        ++preload.count;
+        preload.bytes += data_sz;
     }
     WT_ERR_NOTFOUND_OK(ret, false);
 
+    WT_ERR(__chunkcache_preload(session, &preload));
+
 err:
     if (cursor != NULL)
         WT_TRET(cursor->close(cursor));
+    __wt_free(session, preload.chunks);
 
     return (ret);
 }
@@ -120,6 +120,87 @@ err:
     return (WT_THREAD_RET_VALUE);
 }
 
+/*
+ * __ckpt_helper_run_chk --
+ *     Check to decide if the checkpoint helper threads should continue running.
+ */
+static bool
+__ckpt_helper_run_chk(WT_SESSION_IMPL *session)
+{
+    return (FLD_ISSET(S2C(session)->server_flags, WT_CONN_SERVER_CHECKPOINT_HELPER));
+}
+
+/*
+ * __ckpt_helper_run --
+ *     Entry function for a checkpoint helper thread. This is called repeatedly from the thread
+ *     group code so it does not need to loop itself.
+ */
+static int
+__ckpt_helper_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+    WT_CONNECTION_IMPL *conn;
+    bool didwork, worked;
+
+    WT_UNUSED(thread);
+
+    conn = S2C(session);
+    worked = false;
+
+    /* Reconcile queued leaf pages until the queue is empty. */
+    while (__ckpt_helper_run_chk(session)) {
+        __wt_sync_file_helper(session, &didwork);
+        if (!didwork)
+            break;
+        worked = true;
+    }
+
+    /*
+     * Helper threads keep their reconciliation structures while working through a tree, discard
+     * them once the queue is empty. If there was no work, wait for the checkpoint to queue some.
+     */
+    if (worked)
+        return (__wt_session_release_resources(session));
+    __wt_cond_wait(
+      session, conn->ckpt_helper_threads.wait_cond, 10 * WT_THOUSAND, __ckpt_helper_run_chk);
+    return (0);
+}
+
+/*
+ * __ckpt_helper_config --
+ *     Parse the checkpoint helper thread configuration, starting or resizing the helper threads.
+ */
+static int
+__ckpt_helper_config(WT_SESSION_IMPL *session, const char **cfg)
+{
+    WT_CONFIG_ITEM cval;
+    WT_CONNECTION_IMPL *conn;
+    uint32_t threads;
+
+    conn = S2C(session);
+
+    WT_RET(__wt_config_gets(session, cfg, "checkpoint.threads", &cval));
+    threads = (uint32_t)cval.val;
+
+    /*
+     * Unlike the checkpoint server, the helper threads aren't restarted on each reconfiguration: a
+     * checkpoint may be using them. Shrinking the group waits for helpers to finish their current
+     * page, the checkpoint itself reconciles anything left on the queue.
+     */
+    if (!FLD_ISSET(conn->server_flags, WT_CONN_SERVER_CHECKPOINT_HELPER)) {
+        if (threads == 0)
+            return (0);
+        FLD_SET(conn->server_flags, WT_CONN_SERVER_CHECKPOINT_HELPER);
+        WT_RET(__wt_thread_group_create(session, &conn->ckpt_helper_threads, "checkpoint-helper",
+          threads, threads, WT_THREAD_CAN_WAIT | WT_THREAD_PANIC_FAIL, __ckpt_helper_run_chk,
+          __ckpt_helper_run, NULL));
+    } else if (threads != conn->ckpt_helper_threads_num)
+        WT_RET(__wt_thread_group_resize(session, &conn->ckpt_helper_threads, threads, threads,
+          WT_THREAD_CAN_WAIT | WT_THREAD_PANIC_FAIL));
+    conn->ckpt_helper_threads_num = threads;
+
+    return (0);
+}
+
 /*
  * __ckpt_server_start --
  *     Start the checkpoint server thread.
@@ -182,6 +263,8 @@ __wt_checkpoint_server_create(WT_SESSION_IMPL *session, const char *cfg[])
     if (conn->ckpt_session != NULL)
         WT_RET(__wt_checkpoint_server_destroy(session));
 
+    WT_RET(__ckpt_helper_config(session, cfg));
+
     WT_RET(__ckpt_server_config(session, cfg, &start));
     if (start)
         WT_RET(__ckpt_server_start(conn));
@@ -224,6 +307,35 @@ __wt_checkpoint_server_destroy(WT_SESSION_IMPL *session)
     return (ret);
 }
 
+/*
+ * __wt_checkpoint_helper_destroy --
+ *     Destroy the checkpoint helper threads.
+ */
+int
+__wt_checkpoint_helper_destroy(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+
+    conn = S2C(session);
+
+    if (!FLD_ISSET(conn->server_flags, WT_CONN_SERVER_CHECKPOINT_HELPER))
+        return (0);
+
+    FLD_CLR(conn->server_flags, WT_CONN_SERVER_CHECKPOINT_HELPER);
+    conn->ckpt_helper_threads_num = 0;
+
+    __wt_writelock(session, &conn->ckpt_helper_threads.lock);
+    WT_TRET(__wt_thread_group_destroy(session, &conn->ckpt_helper_threads));
+
+    WT_ASSERT(session, conn->ckpt_helper_owner == NULL);
+    __wt_free(session, conn->ckpt_helper_queue);
+    conn->ckpt_helper_queue_alloc = 0;
+    __wt_free(session, conn->ckpt_helper_txn);
+
+    return (ret);
+}
+
 /*
  * __wt_checkpoint_signal --
  *     Signal the checkpoint thread if sufficient log has been written.
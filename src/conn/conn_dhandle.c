@@ -74,7 +74,8 @@ __conn_dhandle_config_set(WT_SESSION_IMPL *session)
          * the rest of the metadata string, that is essentially static and unchanging and then
          * concatenate the new checkpoint related information on each checkpoint. The reason is
          * performance and avoiding a lot of calls to the config parsing functions during a
-         * checkpoint for information that changes in a very well known way.
+         * checkpoint for information that changes in a very well known way. The block compressor's
+         * state is written with each checkpoint too.
          *
          * First collapse and overwrite checkpoint information because we do not know the name of or
          * how many checkpoints may be in this metadata. Similarly, for backup information, we want
@@ -97,10 +98,10 @@ __conn_dhandle_config_set(WT_SESSION_IMPL *session)
         cfg[1] = NULL;
         if (dhandle->type == WT_DHANDLE_TYPE_TIERED)
             strip =
-              "checkpoint=,checkpoint_backup_info=,checkpoint_lsn=,flush_time=,flush_timestamp=,"
-              "last=,tiers=()";
+              "block_compressor_state=,checkpoint=,checkpoint_backup_info=,checkpoint_lsn=,"
+              "flush_time=,flush_timestamp=,last=,tiers=()";
         else
-            strip = "checkpoint=,checkpoint_backup_info=,checkpoint_lsn=";
+            strip = "block_compressor_state=,checkpoint=,checkpoint_backup_info=,checkpoint_lsn=";
         WT_ERR(__wt_config_merge(session, cfg, strip, &base));
         __wt_free(session, tmp);
         break;
@@ -225,8 +226,9 @@ __wt_conn_dhandle_alloc(WT_SESSION_IMPL *session, const char *uri, const char *c
      * We are holding the data handle list lock, which protects most threads from seeing the new
      * handle until that lock is released.
      *
-     * However, the sweep server scans the list of handles without holding that lock, so we need a
-     * write barrier here to ensure the sweep server doesn't see a partially filled in structure.
+     * However, the sweep server scans the list of handles and lookups search the hash lists
+     * without holding that lock, so we need a write barrier here to ensure they don't see a
+     * partially filled in structure.
      */
     WT_WRITE_BARRIER();
 
@@ -285,6 +287,68 @@ __wt_conn_dhandle_find(WT_SESSION_IMPL *session, const char *uri, const char *ch
     return (WT_NOTFOUND);
 }
 
+/*
+ * __conn_dhandle_match --
+ *     Return if a data handle matches a URI and checkpoint name.
+ */
+static inline bool
+__conn_dhandle_match(WT_DATA_HANDLE *dhandle, const char *uri, const char *checkpoint)
+{
+    if (strcmp(uri, dhandle->name) != 0)
+        return (false);
+    if (checkpoint == NULL)
+        return (dhandle->checkpoint == NULL);
+    return (dhandle->checkpoint != NULL && strcmp(checkpoint, dhandle->checkpoint) == 0);
+}
+
+/*
+ * __wt_conn_dhandle_find_acquire --
+ *     Find a previously opened data handle without locking the handle list, and acquire a
+ *     reference to it.
+ */
+int
+__wt_conn_dhandle_find_acquire(WT_SESSION_IMPL *session, const char *uri, const char *checkpoint)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DATA_HANDLE *dhandle;
+    WT_DECL_RET;
+    uint64_t bucket, hash;
+
+    conn = S2C(session);
+    ret = WT_NOTFOUND;
+
+    hash = __wt_hash_city64(uri, strlen(uri));
+    bucket = hash & (conn->dh_hash_size - 1);
+
+    /*
+     * Handles are only freed after they've been removed from the list and the data handle
+     * generation has drained, so handles can't be freed underneath the walk.
+     *
+     * A handle can be removed once it has no references. Removal flags the handle before checking
+     * its references, we acquire a reference before checking the flag: either the removal sees our
+     * reference and fails, or we see the flag and let our caller fall back to a locked search.
+     */
+    WT_ENTER_GENERATION(session, WT_GEN_DHANDLE);
+    WT_ORDERED_READ(dhandle, TAILQ_FIRST(&conn->dhhash[bucket]));
+    while (dhandle != NULL) {
+        if (dhandle->name_hash == hash && !F_ISSET(dhandle, WT_DHANDLE_DEAD) &&
+          __conn_dhandle_match(dhandle, uri, checkpoint)) {
+            WT_DHANDLE_ACQUIRE(dhandle);
+            if (dhandle->removing)
+                WT_DHANDLE_RELEASE(dhandle);
+            else {
+                session->dhandle = dhandle;
+                ret = 0;
+            }
+            break;
+        }
+        WT_ORDERED_READ(dhandle, TAILQ_NEXT(dhandle, hashq));
+    }
+    WT_LEAVE_GENERATION(session, WT_GEN_DHANDLE);
+
+    return (ret);
+}
+
 /*
  * __wt_conn_dhandle_close --
  *     Sync and close the underlying btree handle.
@@ -837,9 +901,17 @@ __conn_dhandle_remove(WT_SESSION_IMPL *session, bool final)
     WT_ASSERT(session, FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_WRITE));
     WT_ASSERT(session, dhandle != conn->cache->walk_tree);
 
-    /* Check if the handle was reacquired by a session while we waited. */
-    if (!final && (dhandle->session_inuse != 0 || dhandle->references != 0))
+    /*
+     * Check if the handle was reacquired by a session while we waited. Lookups acquire references
+     * without the handle list lock: flag the handle before checking, see the comment in
+     * __wt_conn_dhandle_find_acquire.
+     */
+    dhandle->removing = true;
+    WT_FULL_BARRIER();
+    if (!final && (dhandle->session_inuse != 0 || dhandle->references != 0)) {
+        dhandle->removing = false;
         return (__wt_set_return(session, EBUSY));
+    }
 
     WT_CONN_DHANDLE_REMOVE(conn, dhandle, bucket);
     return (0);
@@ -884,9 +956,11 @@ __wt_conn_dhandle_discard_single(WT_SESSION_IMPL *session, bool final, bool mark
     WT_TRET(tret);
 
     /*
-     * After successfully removing the handle, clean it up.
+     * After successfully removing the handle, wait for lookups that might have found the handle in
+     * the list to finish, then clean it up.
      */
     if (ret == 0 || final) {
+        __wt_gen_next_drain(session, WT_GEN_DHANDLE);
         WT_TRET(__conn_dhandle_destroy(session, dhandle, final));
         session->dhandle = NULL;
     }
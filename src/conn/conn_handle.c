@@ -30,6 +30,7 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
     TAILQ_INIT(&conn->extractorqh);           /* Extractor list */
     TAILQ_INIT(&conn->storagesrcqh);          /* Storage source list */
     TAILQ_INIT(&conn->tieredqh);              /* Tiered work unit list */
+    TAILQ_INIT(&conn->tiered_flushqh);        /* Tiered multi-part upload list */
     TAILQ_INIT(&conn->pfqh);                  /* Pre-fetch reference list */
 
     TAILQ_INIT(&conn->lsmqh); /* WT_LSM_TREE list */
@@ -45,14 +46,17 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
     /* Configuration. */
     WT_RET(__wt_conn_config_init(session));
 
-    /* Statistics. */
+    /* Statistics, with a slot per CPU where possible. */
+    conn->stat_slots = WT_MIN(WT_MAX(__wt_cpu_count(), WT_COUNTER_SLOTS), WT_COUNTER_SLOTS_MAX);
     WT_RET(__wt_stat_connection_init(session, conn));
 
     /* Spinlocks. */
     WT_RET(__wt_spin_init(session, &conn->api_lock, "api"));
     WT_SPIN_INIT_TRACKED(session, &conn->checkpoint_lock, checkpoint);
+    WT_RET(__wt_spin_init(session, &conn->ckpt_helper_lock, "checkpoint helper"));
     WT_RET(__wt_spin_init(session, &conn->background_compact.lock, "background compact"));
     WT_RET(__wt_spin_init(session, &conn->chunkcache_metadata_lock, "chunk cache metadata"));
+    WT_RET(__wt_spin_init(session, &conn->cursor_pool_lock, "cursor pool"));
     WT_RET(__wt_spin_init(session, &conn->encryptor_lock, "encryptor"));
     WT_RET(__wt_spin_init(session, &conn->fh_lock, "file list"));
     WT_RET(__wt_spin_init(session, &conn->flush_tier_lock, "flush tier"));
@@ -122,7 +126,9 @@ __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
     __wt_spin_destroy(session, &conn->background_compact.lock);
     __wt_spin_destroy(session, &conn->block_lock);
     __wt_spin_destroy(session, &conn->checkpoint_lock);
+    __wt_spin_destroy(session, &conn->ckpt_helper_lock);
     __wt_spin_destroy(session, &conn->chunkcache_metadata_lock);
+    __wt_spin_destroy(session, &conn->cursor_pool_lock);
     __wt_rwlock_destroy(session, &conn->debug_log_retention_lock);
     __wt_rwlock_destroy(session, &conn->dhandle_lock);
     __wt_spin_destroy(session, &conn->encryptor_lock);
@@ -146,6 +152,7 @@ __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
 
     /* Free allocated hash buckets. */
     __wt_free(session, conn->blockhash);
+    __wt_free(session, conn->cursor_pool);
     __wt_free(session, conn->dh_bucket_count);
     __wt_free(session, conn->dhhash);
     __wt_free(session, conn->fhhash);
@@ -103,6 +103,8 @@ __logmgr_get_log_version(WT_VERSION version)
         return (3);
     else if (__wt_version_lt(version, WT_LOG_V5_VERSION))
         return (4);
+    else if (__wt_version_lt(version, WT_LOG_V6_VERSION))
+        return (5);
     else
         return (WT_LOG_VERSION);
 }
@@ -256,7 +258,7 @@ __wt_logmgr_config(WT_SESSION_IMPL *session, const char **cfg, bool reconfig)
     if (!reconfig) {
         conn->log_compressor = NULL;
         WT_RET(__wt_config_gets_none(session, cfg, "log.compressor", &cval));
-        WT_RET(__wt_compressor_config(session, &cval, &conn->log_compressor));
+        WT_RET(__wt_compressor_config(session, NULL, &cval, NULL, &conn->log_compressor, NULL));
 
         conn->log_path = NULL;
         WT_RET(__wt_config_gets(session, cfg, "log.path", &cval));
@@ -298,6 +300,28 @@ __wt_logmgr_config(WT_SESSION_IMPL *session, const char **cfg, bool reconfig)
         if (conn->log_extend_len == WT_CONFIG_UNSET || conn->log_extend_len > conn->log_file_max)
             conn->log_extend_len = conn->log_file_max;
         WT_STAT_CONN_SET(session, log_max_filesize, conn->log_file_max);
+
+        /*
+         * Compression dictionaries are written at the start of every log file, keep the current and
+         * previous ones to a fraction of the file.
+         */
+        WT_RET(__wt_config_gets(session, cfg, "log.compressor_dictionary", &cval));
+        conn->log_compress_dict = (uint32_t)WT_MIN(cval.val, conn->log_file_max / 8);
+        if (conn->log_compress_dict != 0 &&
+          (conn->log_compressor == NULL || conn->log_compressor->compress_dictionary == NULL ||
+            conn->log_compressor->decompress_dictionary == NULL))
+            WT_RET_MSG(session, EINVAL,
+              "log=(compressor_dictionary) requires a log compressor that supports dictionaries");
+        if (conn->log_compress_dict != 0 &&
+          __wt_version_lt(conn->compat_version, WT_LOG_V6_VERSION))
+            WT_RET_MSG(session, EINVAL,
+              "log=(compressor_dictionary) requires a compatibility release of %" PRIu16 ".%" PRIu16
+              " or later",
+              WT_LOG_V6_VERSION.major, WT_LOG_V6_VERSION.minor);
+
+        /* The join consolidation sub-slots are allocated with the slot pool. */
+        WT_RET(__wt_config_gets(session, cfg, "log.slot_consolidation", &cval));
+        conn->log_slot_consolidation = (uint32_t)cval.val;
     }
 
     WT_RET(__wt_config_gets(session, cfg, "log.os_cache_dirty_pct", &cval));
@@ -590,9 +614,10 @@ __log_file_server(void *arg)
     WT_DECL_RET;
     WT_FH *close_fh;
     WT_LOG *log;
-    WT_LSN close_end_lsn;
+    WT_LSN bg_lsn, close_end_lsn, min_lsn;
     WT_SESSION_IMPL *session;
     uint32_t filenum;
+    bool bg_pending;
 
     session = arg;
     conn = S2C(session);
@@ -652,8 +677,24 @@ __log_file_server(void *arg)
             }
         }
 
-        /* Wait until the next event. */
-        __wt_cond_wait(session, conn->log_file_cond, 100 * WT_THOUSAND, NULL);
+        /*
+         * If a thread committed with background sync, sync the log once its records are written.
+         * Syncing earlier log files is left to the close handling above, only sync once the written
+         * records are in the same log file as the last sync.
+         */
+        WT_ASSIGN_LSN(&bg_lsn, &log->bg_sync_lsn);
+        if (__wt_log_cmp(&bg_lsn, &log->sync_lsn) >= 0) {
+            WT_ASSIGN_LSN(&min_lsn, &log->write_lsn);
+            if (__wt_log_cmp(&bg_lsn, &min_lsn) < 0 && log->sync_lsn.l.file == min_lsn.l.file) {
+                WT_ERR(__wt_log_force_sync(session, &min_lsn));
+                WT_STAT_CONN_INCR(session, log_sync_background);
+            }
+        }
+        bg_pending = __wt_log_cmp(&log->bg_sync_lsn, &log->sync_lsn) >= 0;
+
+        /* Wait until the next event, check again soon if a background sync is still pending. */
+        __wt_cond_wait(
+          session, conn->log_file_cond, bg_pending ? WT_THOUSAND : 100 * WT_THOUSAND, NULL);
     }
 
     if (0) {
@@ -978,6 +1019,7 @@ __wt_logmgr_create(WT_SESSION_IMPL *session)
      */
     WT_RET(__wt_calloc_one(session, &conn->log));
     log = conn->log;
+    WT_RET(__wt_spin_init(session, &log->log_dict_lock, "log dictionary"));
     WT_RET(__wt_spin_init(session, &log->log_lock, "log"));
     WT_RET(__wt_spin_init(session, &log->log_fs_lock, "log files"));
     WT_RET(__wt_spin_init(session, &log->log_slot_lock, "log slot"));
@@ -989,6 +1031,7 @@ __wt_logmgr_create(WT_SESSION_IMPL *session)
     else
         log->allocsize = WT_LOG_ALIGN;
     WT_INIT_LSN(&log->alloc_lsn);
+    WT_ZERO_LSN(&log->bg_sync_lsn);
     WT_INIT_LSN(&log->ckpt_lsn);
     WT_INIT_LSN(&log->first_lsn);
     WT_INIT_LSN(&log->sync_lsn);
@@ -1000,6 +1043,8 @@ __wt_logmgr_create(WT_SESSION_IMPL *session)
     WT_INIT_LSN(&log->write_lsn);
     WT_INIT_LSN(&log->write_start_lsn);
     log->fileid = 0;
+    if (conn->log_compress_dict != 0)
+        WT_RET(__wt_buf_init(session, &log->dict_sample, conn->log_compress_dict));
     WT_RET(__logmgr_version(session, false));
 
     WT_RET(__wt_cond_alloc(session, "log sync", &log->log_sync_cond));
@@ -1152,7 +1197,11 @@ __wt_logmgr_destroy(WT_SESSION_IMPL *session)
 
     __wt_cond_destroy(session, &conn->log->log_sync_cond);
     __wt_cond_destroy(session, &conn->log->log_write_cond);
+    __wt_buf_free(session, &conn->log->dict[0].dict);
+    __wt_buf_free(session, &conn->log->dict[1].dict);
+    __wt_buf_free(session, &conn->log->dict_sample);
     __wt_rwlock_destroy(session, &conn->log->log_remove_lock);
+    __wt_spin_destroy(session, &conn->log->log_dict_lock);
     __wt_spin_destroy(session, &conn->log->log_lock);
     __wt_spin_destroy(session, &conn->log->log_fs_lock);
     __wt_spin_destroy(session, &conn->log->log_slot_lock);
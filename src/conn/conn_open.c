@@ -15,6 +15,7 @@
 int
 __wt_connection_open(WT_CONNECTION_IMPL *conn, const char *cfg[])
 {
+    WT_CONFIG_ITEM cval;
     WT_SESSION_IMPL *session;
 
     /* Default session. */
@@ -53,6 +54,9 @@ __wt_connection_open(WT_CONNECTION_IMPL *conn, const char *cfg[])
     WT_RET(__wt_txn_global_init(session, cfg));
 
     __wt_rollback_to_stable_init(conn);
+    WT_RET(__wt_config_gets(session, cfg, "rollback_to_stable.threads", &cval));
+    conn->rts->threads_num = (u_int)cval.val;
+
     WT_STAT_CONN_SET(session, dh_conn_handle_size, sizeof(WT_DATA_HANDLE));
     return (0);
 }
@@ -92,6 +96,7 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
      */
     WT_TRET(__wt_background_compact_server_destroy(session));
     WT_TRET(__wt_checkpoint_server_destroy(session));
+    WT_TRET(__wt_checkpoint_helper_destroy(session));
     WT_TRET(__wt_statlog_destroy(session, true));
     WT_TRET(__wt_tiered_storage_destroy(session, false));
     WT_TRET(__wt_sweep_destroy(session));
@@ -108,6 +113,9 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
     F_SET(conn, WT_CONN_CLOSING_NO_MORE_OPENS);
     WT_FULL_BARRIER();
 
+    /* Close pooled cursors, they hold data handle references. */
+    WT_TRET(__wt_cursor_pool_sweep(session, true));
+
     /* Close open data handles. */
     WT_TRET(__wt_conn_dhandle_discard(session));
 
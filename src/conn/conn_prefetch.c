@@ -33,6 +33,8 @@ __wt_prefetch_create(WT_SESSION_IMPL *session, const char *cfg[])
      */
     WT_RET(__wt_config_gets(session, cfg, "prefetch.available", &cval));
     conn->prefetch_available = cval.val != 0;
+    WT_RET(__wt_config_gets(session, cfg, "prefetch.io_depth", &cval));
+    conn->prefetch_io_depth = (u_int)cval.val;
 
     /*
      * Pre-fetch functionality isn't runtime configurable, so don't bother starting utility threads
@@ -45,7 +47,8 @@ __wt_prefetch_create(WT_SESSION_IMPL *session, const char *cfg[])
 
     session_flags = WT_THREAD_CAN_WAIT | WT_THREAD_PANIC_FAIL | WT_SESSION_PREFETCH_THREAD;
     WT_ERR(__wt_thread_group_create(session, &conn->prefetch_threads, "prefetch-server", 8, 8,
-      session_flags, __wt_prefetch_thread_chk, __wt_prefetch_thread_run, NULL));
+      session_flags, __wt_prefetch_thread_chk, __wt_prefetch_thread_run,
+      __wt_prefetch_thread_stop));
 
     return (0);
 
@@ -65,6 +68,122 @@ __wt_prefetch_thread_chk(WT_SESSION_IMPL *session)
     return (F_ISSET(S2C(session), WT_CONN_PREFETCH_RUN));
 }
 
+/*
+ * __prefetch_io_init --
+ *     Set up a pre-fetch thread's asynchronous reads.
+ */
+static int
+__prefetch_io_init(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+
+    conn = S2C(session);
+
+    /*
+     * Allocate the reads first, they also mark the thread's setup as done. If the ring can't be
+     * created the thread reads synchronously. The chunk cache is checked before any read of the
+     * file, don't read pages asynchronously it might already hold.
+     */
+    WT_RET(__wt_calloc_def(session, conn->prefetch_io_depth, &session->pf.io_reads));
+    if (F_ISSET(&conn->chunkcache, WT_CHUNKCACHE_CONFIGURED))
+        return (0);
+
+    if ((ret = __wt_io_uring_create(session, conn->prefetch_io_depth, &session->pf.io_uring)) ==
+      ENOTSUP) {
+        __wt_verbose_notice(session, WT_VERB_PREFETCH, "%s",
+          "asynchronous reads are not supported, pre-fetch pages are read synchronously");
+        return (0);
+    }
+    return (ret);
+}
+
+/*
+ * __prefetch_read_batch --
+ *     Dequeue a batch of pages, read their blocks asynchronously and then bring the pages into the
+ *     cache using the blocks that were read.
+ */
+static int
+__prefetch_read_batch(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_IO_URING *ring;
+    WT_PREFETCH_QUEUE_ENTRY *pe;
+    WT_PREFETCH_READ *pr;
+    size_t nbytes;
+    uint64_t id;
+    u_int count, i;
+    int error, tret;
+
+    conn = S2C(session);
+    ring = session->pf.io_uring;
+
+    /*
+     * Wait and cycle if there aren't any pages on the queue. It would be nice if this was interrupt
+     * driven, but for now just backoff and re-check.
+     */
+    if (conn->prefetch_queue_count == 0) {
+        __wt_sleep(0, 5000);
+        return (0);
+    }
+
+    __wt_spin_lock(session, &conn->prefetch_lock);
+    for (count = 0; count < conn->prefetch_io_depth && (pe = TAILQ_FIRST(&conn->pfqh)) != NULL;
+         ++count) {
+        TAILQ_REMOVE(&conn->pfqh, pe, q);
+        --conn->prefetch_queue_count;
+
+        WT_PREFETCH_ASSERT(
+          session, F_ISSET(pe->ref, WT_REF_FLAG_PREFETCH), block_prefetch_skipped_no_flag_set);
+        session->pf.io_reads[count].pe = pe;
+    }
+    __wt_spin_unlock(session, &conn->prefetch_lock);
+
+    /* Queue a read of each page's block, as with synchronous reads skip fast deleted pages. */
+    for (i = 0; i < count && ret == 0; ++i) {
+        pr = &session->pf.io_reads[i];
+        if (!F_ISSET(conn, WT_CONN_DATA_CORRUPTION))
+            WT_WITH_DHANDLE(
+              session, pr->pe->dhandle, ret = __wt_prefetch_read_submit(session, pr, ring, i));
+    }
+
+    /* Reap every read that was queued, even after an error: the kernel owns their buffers. */
+    while ((tret = __wt_io_uring_wait(session, ring, &id, &nbytes, &error)) == 0) {
+        pr = &session->pf.io_reads[id];
+        pr->done = error == 0 && nbytes == pr->size;
+        if (!pr->done)
+            __wt_verbose_debug1(session, WT_VERB_PREFETCH,
+              "asynchronous read of %s failed, reading synchronously: %s", pr->fh->name,
+              error == 0 ? "short read" : __wt_strerror(session, error, NULL, 0));
+    }
+    if (tret != WT_NOTFOUND)
+        WT_TRET(tret);
+
+    /*
+     * Bring the pages into the cache. The page's block read uses the staged buffer, if the page's
+     * address hasn't changed since its read was queued.
+     */
+    for (i = 0; i < count; ++i) {
+        pr = &session->pf.io_reads[i];
+        pe = pr->pe;
+        pr->pe = NULL;
+
+        if (ret == 0 && !F_ISSET(conn, WT_CONN_DATA_CORRUPTION) && pe->ref->page_del == NULL) {
+            session->pf.io_staged = pr->done ? pr : NULL;
+            WT_WITH_DHANDLE(session, pe->dhandle, ret = __wt_prefetch_page_in(session, pe));
+            session->pf.io_staged = NULL;
+        }
+
+        __wt_spin_lock(session, &conn->prefetch_lock);
+        F_CLR(pe->ref, WT_REF_FLAG_PREFETCH);
+        __wt_spin_unlock(session, &conn->prefetch_lock);
+        __wt_free(session, pe);
+    }
+
+    return (ret);
+}
+
 /*
  * __wt_prefetch_thread_run --
  *     Entry function for a prefetch thread. This is called repeatedly from the thread group code so
@@ -86,6 +205,12 @@ __wt_prefetch_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
     conn = S2C(session);
     locked = false;
 
+    /* Threads configured for asynchronous reads process the queue in batches. */
+    if (conn->prefetch_io_depth != 0 && session->pf.io_reads == NULL)
+        WT_RET(__prefetch_io_init(session));
+    if (session->pf.io_uring != NULL)
+        return (__prefetch_read_batch(session));
+
     WT_RET(__wt_scr_alloc(session, 0, &tmp));
 
     while (F_ISSET(conn, WT_CONN_PREFETCH_RUN)) {
@@ -145,6 +270,27 @@ err:
     return (ret);
 }
 
+/*
+ * __wt_prefetch_thread_stop --
+ *     Shutdown function for a pre-fetch thread.
+ */
+int
+__wt_prefetch_thread_stop(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+    WT_DECL_RET;
+    u_int i;
+
+    WT_UNUSED(thread);
+
+    WT_TRET(__wt_io_uring_destroy(session, &session->pf.io_uring));
+    if (session->pf.io_reads != NULL) {
+        for (i = 0; i < S2C(session)->prefetch_io_depth; ++i)
+            __wt_buf_free(session, &session->pf.io_reads[i].buf);
+        __wt_free(session, session->pf.io_reads);
+    }
+    return (ret);
+}
+
 /*
  * __wt_conn_prefetch_queue_push --
  *     Push a ref onto the pre-fetch queue.
@@ -144,6 +144,13 @@ __wt_conn_compat_config(WT_SESSION_IMPL *session, const char **cfg, bool reconfi
           conn->compat_req_min.major, conn->compat_req_min.minor, new_compat.major,
           new_compat.minor);
 
+    /* Log records compressed with a dictionary can't be written in older log file versions. */
+    if (reconfig && conn->log_compress_dict != 0 && __wt_version_lt(new_compat, WT_LOG_V6_VERSION))
+        WT_RET_MSG(session, ENOTSUP,
+          WT_COMPAT_MSG_PREFIX "log=(compressor_dictionary) requires a compatibility release of "
+                               "%" PRIu16 ".%" PRIu16 " or later, not %" PRIu16 ".%" PRIu16,
+          WT_LOG_V6_VERSION.major, WT_LOG_V6_VERSION.minor, new_compat.major, new_compat.minor);
+
     conn->compat_version = new_compat;
 
     /*
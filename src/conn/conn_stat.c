@@ -60,6 +60,69 @@ __stat_config_discard(WT_SESSION_IMPL *session)
     return (ret);
 }
 
+/*
+ * __stat_latency_percentile --
+ *     Estimate a percentile, in microseconds, from a latency histogram by interpolating within the
+ *     bucket holding the requested rank. The last bucket is unbounded, report its lower bound.
+ */
+static int64_t
+__stat_latency_percentile(const int64_t *buckets, u_int permille)
+{
+    static const int64_t bounds[WT_STAT_LATENCY_BUCKETS + 1] = {
+      0, 1, 4, 16, 64, 256, 1024, 4096, 16384, 65536, 262144, 1048576, 4194304};
+    int64_t cum, rank, total;
+    u_int i;
+
+    for (total = 0, i = 0; i < WT_STAT_LATENCY_BUCKETS; ++i)
+        if (buckets[i] > 0)
+            total += buckets[i];
+    if (total == 0)
+        return (0);
+
+    /* The rank of the requested percentile, rounded up so it always falls in a non-empty bucket. */
+    rank = (total * (int64_t)permille + 999) / 1000;
+    for (cum = 0, i = 0; i < WT_STAT_LATENCY_BUCKETS; ++i) {
+        if (buckets[i] <= 0)
+            continue;
+        if (cum + buckets[i] >= rank) {
+            if (i == WT_STAT_LATENCY_BUCKETS - 1)
+                return (bounds[i]);
+            return (bounds[i] + (bounds[i + 1] - bounds[i]) * (rank - cum) / buckets[i]);
+        }
+        cum += buckets[i];
+    }
+    return (bounds[WT_STAT_LATENCY_BUCKETS - 1]);
+}
+
+/*
+ * WT_STAT_LATENCY_PERCENTILES --
+ *     Read an API latency histogram and set its percentile statistics.
+ */
+#define WT_STAT_LATENCY_PERCENTILES(session, stats, name)                          \
+    do {                                                                           \
+        int64_t __buckets[WT_STAT_LATENCY_BUCKETS];                                \
+        __buckets[0] = WT_STAT_READ(stats, perf_hist_##name##_latency_lt1);        \
+        __buckets[1] = WT_STAT_READ(stats, perf_hist_##name##_latency_lt4);        \
+        __buckets[2] = WT_STAT_READ(stats, perf_hist_##name##_latency_lt16);       \
+        __buckets[3] = WT_STAT_READ(stats, perf_hist_##name##_latency_lt64);       \
+        __buckets[4] = WT_STAT_READ(stats, perf_hist_##name##_latency_lt256);      \
+        __buckets[5] = WT_STAT_READ(stats, perf_hist_##name##_latency_lt1024);     \
+        __buckets[6] = WT_STAT_READ(stats, perf_hist_##name##_latency_lt4096);     \
+        __buckets[7] = WT_STAT_READ(stats, perf_hist_##name##_latency_lt16384);    \
+        __buckets[8] = WT_STAT_READ(stats, perf_hist_##name##_latency_lt65536);    \
+        __buckets[9] = WT_STAT_READ(stats, perf_hist_##name##_latency_lt262144);   \
+        __buckets[10] = WT_STAT_READ(stats, perf_hist_##name##_latency_lt1048576); \
+        __buckets[11] = WT_STAT_READ(stats, perf_hist_##name##_latency_gt1048576); \
+        WT_STAT_SET(session, stats, perf_hist_##name##_latency_p50,                \
+          __stat_latency_percentile(__buckets, 500));                              \
+        WT_STAT_SET(session, stats, perf_hist_##name##_latency_p90,                \
+          __stat_latency_percentile(__buckets, 900));                              \
+        WT_STAT_SET(session, stats, perf_hist_##name##_latency_p99,                \
+          __stat_latency_percentile(__buckets, 990));                              \
+        WT_STAT_SET(session, stats, perf_hist_##name##_latency_p999,               \
+          __stat_latency_percentile(__buckets, 999));                              \
+    } while (0)
+
 /*
  * __wt_conn_stat_init --
  *     Initialize the per-connection statistics.
@@ -81,6 +144,15 @@ __wt_conn_stat_init(WT_SESSION_IMPL *session)
     WT_STAT_SET(session, stats, dh_conn_handle_count, conn->dhandle_count);
     WT_STAT_SET(session, stats, rec_split_stashed_objects, conn->stashed_objects);
     WT_STAT_SET(session, stats, rec_split_stashed_bytes, conn->stashed_bytes);
+
+    WT_STAT_LATENCY_PERCENTILES(session, stats, app_evict);
+    WT_STAT_LATENCY_PERCENTILES(session, stats, checkpoint);
+    WT_STAT_LATENCY_PERCENTILES(session, stats, cursor_insert);
+    WT_STAT_LATENCY_PERCENTILES(session, stats, cursor_next);
+    WT_STAT_LATENCY_PERCENTILES(session, stats, cursor_search);
+    WT_STAT_LATENCY_PERCENTILES(session, stats, cursor_update);
+    WT_STAT_LATENCY_PERCENTILES(session, stats, txn_begin);
+    WT_STAT_LATENCY_PERCENTILES(session, stats, txn_commit);
 }
 
 /*
@@ -407,6 +407,12 @@ __sweep_server(void *arg)
         if (conn->sweep_idle_time != 0 && conn->open_btree_count >= conn->sweep_handles_min)
             WT_ERR(__sweep_expire(session, now));
 
+        /*
+         * Close pooled cursors on handles that can't be reopened, pooled cursors hold references
+         * that would otherwise prevent those handles from being removed.
+         */
+        WT_ERR(__wt_cursor_pool_sweep(session, false));
+
         WT_ERR(__sweep_discard_trees(session, &dead_handles));
 
         if (dead_handles > 0)
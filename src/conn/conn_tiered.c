@@ -185,6 +185,148 @@ err:
     return (ret);
 }
 
+/*
+ * __tier_flush_part --
+ *     Copy one part of a multi-part upload.
+ */
+static void
+__tier_flush_part(WT_SESSION_IMPL *session, WT_TIERED_FLUSH_JOB *job, uint32_t part)
+{
+    WT_DECL_RET;
+    WT_STORAGE_SOURCE *storage_source;
+    wt_off_t offset;
+    size_t len;
+
+    /* Once a part has failed the upload will be abandoned, don't copy the rest. */
+    if (job->ret == 0) {
+        storage_source = job->storage_source;
+        offset = (wt_off_t)(part * job->part_size);
+        len = (size_t)WT_MIN(job->part_size, (uint64_t)(job->size - offset));
+        ret = storage_source->ss_flush_part(storage_source, &session->iface, job->file_system,
+          job->source, job->object, part, offset, len, NULL);
+        if (ret == 0)
+            WT_STAT_CONN_INCR(session, tiered_flush_parts);
+        else
+            (void)__wt_atomic_casiv32(&job->ret, 0, ret);
+    }
+
+    /* This is our last reference to the job, the owner frees it once every part is done. */
+    (void)__wt_atomic_addv32(&job->part_done, 1);
+}
+
+/*
+ * __tier_flush_part_claim --
+ *     Claim the next part to copy, either of the given upload or, if none is given, of any upload
+ *     in progress.
+ */
+static WT_TIERED_FLUSH_JOB *
+__tier_flush_part_claim(WT_SESSION_IMPL *session, WT_TIERED_FLUSH_JOB *own, uint32_t *partp)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_TIERED_FLUSH_JOB *job;
+
+    conn = S2C(session);
+    if (TAILQ_EMPTY(&conn->tiered_flushqh))
+        return (NULL);
+
+    __wt_spin_lock(session, &conn->tiered_lock);
+    TAILQ_FOREACH (job, &conn->tiered_flushqh, q)
+        if ((own == NULL || job == own) && job->part_next < job->part_count) {
+            *partp = job->part_next++;
+            break;
+        }
+    __wt_spin_unlock(session, &conn->tiered_lock);
+    return (job);
+}
+
+/*
+ * __tier_flush_multipart --
+ *     Copy an object to shared storage as a multi-part upload. Other flush threads copy parts while
+ *     they have no object of their own, this thread copies parts until none are left to claim.
+ */
+static int
+__tier_flush_multipart(WT_SESSION_IMPL *session, WT_STORAGE_SOURCE *storage_source,
+  WT_FILE_SYSTEM *bucket_fs, const char *local_name, const char *object, wt_off_t size)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_TIERED_FLUSH_JOB *job;
+    uint32_t done, part;
+
+    conn = S2C(session);
+
+    WT_RET(__wt_calloc_one(session, &job));
+    job->storage_source = storage_source;
+    job->file_system = bucket_fs;
+    job->source = local_name;
+    job->object = object;
+    job->size = size;
+    job->part_size = conn->tiered_flush_part_size;
+    job->part_count = (uint32_t)(((uint64_t)size + job->part_size - 1) / job->part_size);
+
+    __wt_spin_lock(session, &conn->tiered_lock);
+    TAILQ_INSERT_TAIL(&conn->tiered_flushqh, job, q);
+    __wt_spin_unlock(session, &conn->tiered_lock);
+    __wt_cond_signal(session, conn->tiered_flush_threads.wait_cond);
+
+    while (__tier_flush_part_claim(session, job, &part) != NULL)
+        __tier_flush_part(session, job, part);
+
+    /* Every part has been claimed, wait for the ones other threads are copying. */
+    __wt_spin_lock(session, &conn->tiered_lock);
+    TAILQ_REMOVE(&conn->tiered_flushqh, job, q);
+    __wt_spin_unlock(session, &conn->tiered_lock);
+    for (;;) {
+        WT_ORDERED_READ(done, job->part_done);
+        if (done == job->part_count)
+            break;
+        __wt_sleep(0, WT_THOUSAND);
+    }
+
+    if ((ret = job->ret) == 0)
+        ret = storage_source->ss_flush_parts_complete(
+          storage_source, &session->iface, bucket_fs, local_name, object, job->part_count, NULL);
+    else
+        WT_TRET(storage_source->ss_flush_parts_abort(
+          storage_source, &session->iface, bucket_fs, local_name, object, job->part_count, NULL));
+    __wt_free(session, job);
+    return (ret);
+}
+
+/*
+ * __tier_flush_object --
+ *     Copy an object to shared storage, in parts if it is large and there are flush threads to
+ *     share them.
+ */
+static int
+__tier_flush_object(WT_SESSION_IMPL *session, WT_STORAGE_SOURCE *storage_source,
+  WT_FILE_SYSTEM *bucket_fs, const char *local_name, const char *object)
+{
+    WT_CONNECTION_IMPL *conn;
+    wt_off_t size;
+    bool exist;
+
+    conn = S2C(session);
+
+    /* The table may have been dropped, let our caller ignore that quietly. */
+    WT_RET(__wt_fs_exist(session, local_name, &exist));
+    if (!exist)
+        return (ENOENT);
+    WT_RET(__wt_fs_size(session, local_name, &size));
+
+    if (conn->tiered_flush_threads_num != 0 && storage_source->ss_flush_part != NULL &&
+      (uint64_t)size > conn->tiered_flush_part_size)
+        WT_RET(
+          __tier_flush_multipart(session, storage_source, bucket_fs, local_name, object, size));
+    else
+        WT_RET(storage_source->ss_flush(
+          storage_source, &session->iface, bucket_fs, local_name, object, NULL));
+
+    WT_STAT_CONN_INCR(session, tiered_flush_objects);
+    WT_STAT_CONN_INCRV(session, tiered_flush_bytes, size);
+    return (0);
+}
+
 /*
  * __tier_do_operation --
  *     Perform one iteration of copying newly flushed objects to shared storage or post-flush
@@ -239,8 +381,7 @@ __tier_do_operation(WT_SESSION_IMPL *session, WT_TIERED *tiered, uint32_t id, co
     else {
         /* WT_TIERED_WORK_FLUSH */
         /* This call make take a while, and may fail due to network timeout. */
-        ret = storage_source->ss_flush(
-          storage_source, &session->iface, bucket_fs, local_name, tmp, NULL);
+        ret = __tier_flush_object(session, storage_source, bucket_fs, local_name, tmp);
         if (ret == 0)
             WT_WITH_CHECKPOINT_LOCK(session,
               WT_WITH_SCHEMA_LOCK(
@@ -352,11 +493,11 @@ err:
 }
 
 /*
- * __tier_storage_copy --
- *     Perform one iteration of copying newly flushed objects to the shared storage.
+ * __tier_storage_copy_one --
+ *     Copy one newly flushed object to the shared storage, if there is one ready.
  */
 static int
-__tier_storage_copy(WT_SESSION_IMPL *session)
+__tier_storage_copy_one(WT_SESSION_IMPL *session, bool *didworkp)
 {
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
@@ -364,41 +505,92 @@ __tier_storage_copy(WT_SESSION_IMPL *session)
     uint64_t ckpt_gen;
     bool ckpt_running;
 
+    *didworkp = false;
+
     conn = S2C(session);
     /* There is nothing to do until the checkpoint after the flush completes. */
     if (!conn->flush_ckpt_complete)
         return (0);
-    entry = NULL;
-    for (;;) {
-        /* Check if we're quitting or being reconfigured. */
-        if (!__tiered_server_run_chk(session))
-            break;
 
-        /*
-         * We use the checkpoint generation to avoid processing the flush items for tables that are
-         * added during an in-progress flush_tier. This thread could run due to a condition timeout
-         * rather than a signal. First get the checkpoint generation, then check if it is running.
-         * If the checkpoint is running we can't process items from this generation count. If the
-         * checkpoint is not running, we can process the items with the read generation count. If
-         * the checkpoint starts after checking, it would push flush units of a higher count.
-         */
-        WT_ORDERED_READ(ckpt_gen, __wt_gen(session, WT_GEN_CHECKPOINT));
-        WT_ORDERED_READ(ckpt_running, conn->txn_global.checkpoint_running);
-        __wt_tiered_get_flush(session, (ckpt_running ? ckpt_gen : ckpt_gen + 1), &entry);
-        if (entry == NULL)
+    /*
+     * We use the checkpoint generation to avoid processing the flush items for tables that are
+     * added during an in-progress flush_tier. This thread could run due to a condition timeout
+     * rather than a signal. First get the checkpoint generation, then check if it is running. If
+     * the checkpoint is running we can't process items from this generation count. If the
+     * checkpoint is not running, we can process the items with the read generation count. If the
+     * checkpoint starts after checking, it would push flush units of a higher count.
+     */
+    WT_ORDERED_READ(ckpt_gen, __wt_gen(session, WT_GEN_CHECKPOINT));
+    WT_ORDERED_READ(ckpt_running, conn->txn_global.checkpoint_running);
+    __wt_tiered_get_flush(session, (ckpt_running ? ckpt_gen : ckpt_gen + 1), &entry);
+    if (entry == NULL)
+        return (0);
+    ret = __tier_operation(session, entry->tiered, entry->id, WT_TIERED_WORK_FLUSH);
+    __wt_tiered_flush_release(session, entry->tiered);
+    /*
+     * We are responsible for freeing the work unit when we're done with it.
+     */
+    __wt_tiered_work_free(session, entry);
+    *didworkp = true;
+    return (ret);
+}
+
+/*
+ * __tier_storage_copy --
+ *     Perform one iteration of copying newly flushed objects to the shared storage.
+ */
+static int
+__tier_storage_copy(WT_SESSION_IMPL *session)
+{
+    bool didwork;
+
+    /* Check if we're quitting or being reconfigured. */
+    while (__tiered_server_run_chk(session)) {
+        WT_RET(__tier_storage_copy_one(session, &didwork));
+        if (!didwork)
             break;
-        WT_ERR(__tier_operation(session, entry->tiered, entry->id, WT_TIERED_WORK_FLUSH));
-        /*
-         * We are responsible for freeing the work unit when we're done with it.
-         */
-        __wt_tiered_work_free(session, entry);
-        entry = NULL;
     }
+    return (0);
+}
 
-err:
-    if (entry != NULL)
-        __wt_tiered_work_free(session, entry);
-    return (ret);
+/*
+ * __tier_flush_run_chk --
+ *     Check to decide if the tiered flush threads should continue running.
+ */
+static bool
+__tier_flush_run_chk(WT_SESSION_IMPL *session)
+{
+    return (FLD_ISSET(S2C(session)->server_flags, WT_CONN_SERVER_TIERED_FLUSH));
+}
+
+/*
+ * __tier_flush_run --
+ *     Entry function for a tiered flush thread. This is called repeatedly from the thread group
+ *     code so it does not need to loop itself.
+ */
+static int
+__tier_flush_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_TIERED_FLUSH_JOB *job;
+    uint32_t part;
+    bool didwork;
+
+    WT_UNUSED(thread);
+
+    conn = S2C(session);
+
+    /* Parts of uploads in progress come first, another flush thread is waiting for them. */
+    if ((job = __tier_flush_part_claim(session, NULL, &part)) != NULL) {
+        __tier_flush_part(session, job, part);
+        return (0);
+    }
+
+    WT_RET(__tier_storage_copy_one(session, &didwork));
+    if (!didwork)
+        __wt_cond_wait(
+          session, conn->tiered_flush_threads.wait_cond, 100 * WT_THOUSAND, __tier_flush_run_chk);
+    return (0);
 }
 
 /*
@@ -457,13 +649,17 @@ __tiered_server(void *arg)
         timediff = WT_CLOCKDIFF_SEC(time_stop, time_start);
         /*
          * Here is where we do work. Work we expect to do:
-         *  - Copy any files that need moving from a flush tier call.
+         *  - Copy any files that need moving from a flush tier call, or wake the flush threads to
+         *    do it.
          *  - Perform any shared storage processing after flushing.
          *  - Remove any cached objects that are aged out.
          */
         if (timediff >= conn->tiered_interval || signalled) {
             msg = "tier_storage_copy";
-            WT_ERR(__tier_storage_copy(session));
+            if (conn->tiered_flush_threads_num != 0)
+                __wt_cond_signal(session, conn->tiered_flush_threads.wait_cond);
+            else
+                WT_ERR(__tier_storage_copy(session));
             msg = "tier_storage_finish";
             WT_ERR(__tier_storage_finish(session));
             msg = "tier_storage_remove";
@@ -511,6 +707,15 @@ __wt_tiered_storage_create(WT_SESSION_IMPL *session)
     WT_ERR(__wt_thread_create(session, &conn->tiered_tid, __tiered_server, session));
     conn->tiered_tid_set = true;
 
+    /* Start any flush threads, the server wakes them when there are objects to copy. */
+    if (conn->tiered_flush_threads_num != 0) {
+        FLD_SET(conn->server_flags, WT_CONN_SERVER_TIERED_FLUSH);
+        WT_ERR(__wt_thread_group_create(session, &conn->tiered_flush_threads, "tiered-flush",
+          conn->tiered_flush_threads_num, conn->tiered_flush_threads_num,
+          WT_THREAD_CAN_WAIT | WT_THREAD_PANIC_FAIL, __tier_flush_run_chk, __tier_flush_run,
+          NULL));
+    }
+
     if (0) {
 err:
         FLD_CLR(conn->server_flags, WT_CONN_SERVER_TIERED);
@@ -548,10 +753,20 @@ __wt_tiered_storage_destroy(WT_SESSION_IMPL *session, bool final_flush)
         __wt_cond_signal(session, conn->tiered_cond);
         WT_TRET(__wt_thread_join(session, &conn->tiered_tid));
         conn->tiered_tid_set = false;
-        while ((entry = TAILQ_FIRST(&conn->tieredqh)) != NULL) {
-            TAILQ_REMOVE(&conn->tieredqh, entry, q);
-            __wt_tiered_work_free(session, entry);
-        }
+    }
+    /*
+     * Stop the flush threads once the server can no longer wake them. A flush thread finishes the
+     * object or part it is copying before it exits.
+     */
+    if (FLD_ISSET(conn->server_flags, WT_CONN_SERVER_TIERED_FLUSH)) {
+        FLD_CLR(conn->server_flags, WT_CONN_SERVER_TIERED_FLUSH);
+        __wt_writelock(session, &conn->tiered_flush_threads.lock);
+        WT_TRET(__wt_thread_group_destroy(session, &conn->tiered_flush_threads));
+        WT_ASSERT(session, TAILQ_EMPTY(&conn->tiered_flushqh));
+    }
+    while ((entry = TAILQ_FIRST(&conn->tieredqh)) != NULL) {
+        TAILQ_REMOVE(&conn->tieredqh, entry, q);
+        __wt_tiered_work_free(session, entry);
     }
     if (conn->tiered_session != NULL) {
         WT_TRET(__wt_session_close_internal(conn->tiered_session));
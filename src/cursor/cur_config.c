@@ -46,7 +46,9 @@ __wt_curconfig_open(
       __wt_cursor_noop,                               /* reset */
       __wt_cursor_notsup,                             /* search */
       __wt_cursor_search_near_notsup,                 /* search-near */
+      __wt_cursor_search_batch_notsup,                /* search-batch */
       __wt_cursor_notsup,                             /* insert */
+      __wt_cursor_insert_batch_notsup,                /* insert-batch */
       __wt_cursor_modify_notsup,                      /* modify */
       __wt_cursor_notsup,                             /* update */
       __wt_cursor_notsup,                             /* remove */
@@ -442,7 +442,9 @@ __wt_curds_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner, con
       __curds_reset,                                  /* reset */
       __curds_search,                                 /* search */
       __curds_search_near,                            /* search-near */
+      __wt_cursor_search_batch,                       /* search-batch */
       __curds_insert,                                 /* insert */
+      __wt_cursor_insert_batch,                       /* insert-batch */
       __wt_cursor_modify_value_format_notsup,         /* modify */
       __curds_update,                                 /* update */
       __curds_remove,                                 /* remove */
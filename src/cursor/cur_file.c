@@ -15,6 +15,14 @@
 WT_STAT_USECS_HIST_INCR_FUNC(opread, perf_hist_opread_latency)
 WT_STAT_USECS_HIST_INCR_FUNC(opwrite, perf_hist_opwrite_latency)
 
+/*
+ * Define functions that increment the per-call latency histograms for the common cursor methods.
+ */
+WT_STAT_LATENCY_HIST_INCR_FUNC(cursor_insert, perf_hist_cursor_insert_latency)
+WT_STAT_LATENCY_HIST_INCR_FUNC(cursor_next, perf_hist_cursor_next_latency)
+WT_STAT_LATENCY_HIST_INCR_FUNC(cursor_search, perf_hist_cursor_search_latency)
+WT_STAT_LATENCY_HIST_INCR_FUNC(cursor_update, perf_hist_cursor_update_latency)
+
 /*
  * Wrapper for substituting checkpoint state when doing checkpoint cursor operations.
  *
@@ -182,6 +190,7 @@ __curfile_next(WT_CURSOR *cursor)
     WT_CURSOR_BTREE *cbt;
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
+    uint64_t time_start, time_stop;
 
     cbt = (WT_CURSOR_BTREE *)cursor;
     CURSOR_API_CALL(cursor, session, next, CUR2BT(cbt));
@@ -191,7 +200,10 @@ __curfile_next(WT_CURSOR *cursor)
 
     WT_ERR(__curfile_check_cbt_txn(session, cbt));
 
+    time_start = __wt_clock(session);
     WT_WITH_CHECKPOINT(session, cbt, ret = __wt_btcur_next(cbt, false));
+    time_stop = __wt_clock(session);
+    __wt_stat_latency_hist_incr_cursor_next(session, WT_CLOCKDIFF_US(time_stop, time_start));
     WT_ERR(ret);
 
     /* Next maintains a position, key and value. */
@@ -325,8 +337,9 @@ __curfile_search(WT_CURSOR *cursor)
 
     time_start = __wt_clock(session);
     WT_WITH_CHECKPOINT(session, cbt, ret = __wt_btcur_search(cbt));
-    WT_ERR(ret);
     time_stop = __wt_clock(session);
+    __wt_stat_latency_hist_incr_cursor_search(session, WT_CLOCKDIFF_US(time_stop, time_start));
+    WT_ERR(ret);
     __wt_stat_usecs_hist_incr_opread(session, WT_CLOCKDIFF_US(time_stop, time_start));
 
     /* Search maintains a position, key and value. */
@@ -378,6 +391,64 @@ err:
     API_END_RET_STAT(session, ret, cursor_search_near);
 }
 
+/*
+ * __curfile_search_batch --
+ *     WT_CURSOR->search_batch method for the btree cursor type.
+ */
+static int
+__curfile_search_batch(
+  WT_CURSOR *cursor, const WT_ITEM *keys, WT_ITEM *values, int *results, size_t count)
+{
+    WT_CURSOR_BTREE *cbt;
+    WT_DECL_ITEM(tmp);
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+    size_t i, *offsets, slot;
+    const WT_ITEM **sorted;
+
+    cbt = (WT_CURSOR_BTREE *)cursor;
+
+    /* Column-stores don't share leaf pages between searches, use the default implementation. */
+    if (CUR2BT(cbt)->type != BTREE_ROW)
+        return (__wt_cursor_search_batch(cursor, keys, values, results, count));
+
+    CURSOR_API_CALL(cursor, session, search_batch, CUR2BT(cbt));
+    WT_STAT_CONN_DATA_INCR(session, cursor_search_batch);
+    WT_STAT_CONN_DATA_INCRV(session, cursor_search_batch_keys, count);
+
+    WT_ERR(__cursor_copy_release(cursor));
+    WT_ERR(__curfile_check_cbt_txn(session, cbt));
+
+    WT_ERR(__wt_scr_alloc(session, 0, &tmp));
+    WT_ERR(__wt_cursor_batch_init(cursor, keys, values, results, count, tmp, &sorted, &offsets));
+
+    /*
+     * Keys are set directly rather than through the set-key method: the keys are in their packed
+     * form and row-store keys are stored packed, so there's nothing to do.
+     */
+    for (i = 0; i < count; ++i) {
+        slot = (size_t)(sorted[i] - keys);
+        cursor->key.data = sorted[i]->data;
+        cursor->key.size = sorted[i]->size;
+        F_CLR(cursor, WT_CURSTD_KEY_INT);
+        F_SET(cursor, WT_CURSTD_KEY_EXT);
+
+        WT_WITH_CHECKPOINT(session, cbt,
+          ret = __wt_btcur_search_batch_key(cbt, sorted + i + 1, count - (i + 1)));
+        WT_ERR_NOTFOUND_OK(ret, true);
+        if ((results[slot] = ret) == 0)
+            WT_ERR(
+              __wt_cursor_batch_value_save(cursor, &cursor->value, &values[slot], &offsets[slot]));
+        ret = 0;
+    }
+    __wt_cursor_batch_values_set(cursor, values, results, offsets, count);
+
+err:
+    WT_TRET(__wt_btcur_reset(cbt));
+    __wt_scr_free(session, &tmp);
+    API_END_RET_STAT(session, ret, cursor_search_batch);
+}
+
 /*
  * __curfile_insert --
  *     WT_CURSOR->insert method for the btree cursor type.
@@ -399,8 +470,10 @@ __curfile_insert(WT_CURSOR *cursor)
     WT_ERR(__cursor_checkvalue(cursor));
 
     time_start = __wt_clock(session);
-    WT_ERR(__wt_btcur_insert(cbt));
+    ret = __wt_btcur_insert(cbt);
     time_stop = __wt_clock(session);
+    __wt_stat_latency_hist_incr_cursor_insert(session, WT_CLOCKDIFF_US(time_stop, time_start));
+    WT_ERR(ret);
     __wt_stat_usecs_hist_incr_opwrite(session, WT_CLOCKDIFF_US(time_stop, time_start));
 
     /*
@@ -419,6 +492,63 @@ err:
     return (ret);
 }
 
+/*
+ * __curfile_insert_batch --
+ *     WT_CURSOR->insert_batch method for the btree cursor type.
+ */
+static int
+__curfile_insert_batch(WT_CURSOR *cursor, const WT_ITEM *keys, const WT_ITEM *values, size_t count)
+{
+    WT_CURSOR_BTREE *cbt;
+    WT_DECL_ITEM(tmp);
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+    size_t i, slot;
+    const WT_ITEM **sorted;
+
+    cbt = (WT_CURSOR_BTREE *)cursor;
+
+    /* Column-stores don't share leaf pages between inserts, use the default implementation. */
+    if (CUR2BT(cbt)->type != BTREE_ROW)
+        return (__wt_cursor_insert_batch(cursor, keys, values, count));
+
+    CURSOR_UPDATE_API_CALL_BTREE(cursor, session, insert_batch);
+    WT_STAT_CONN_DATA_INCR(session, cursor_insert_batch);
+    WT_STAT_CONN_DATA_INCRV(session, cursor_insert_batch_keys, count);
+    WT_ERR(__cursor_copy_release(cursor));
+
+    if (count != 0 && (keys == NULL || values == NULL))
+        WT_ERR_MSG(session, EINVAL, "batch inserts require key and value arrays");
+
+    /* It's no longer possible to bulk-load into the tree. */
+    __wt_btree_disable_bulk(session);
+
+    WT_ERR(__wt_scr_alloc(session, 0, &tmp));
+    WT_ERR(__wt_cursor_batch_sort(session, keys, count, 0, tmp, &sorted));
+
+    /*
+     * Keys and values are set directly rather than through the set-key and set-value methods: they
+     * are in their packed form, and row-store keys and values are stored packed.
+     */
+    for (i = 0; i < count; ++i) {
+        slot = (size_t)(sorted[i] - keys);
+        cursor->key.data = sorted[i]->data;
+        cursor->key.size = sorted[i]->size;
+        cursor->value.data = values[slot].data;
+        cursor->value.size = values[slot].size;
+        F_CLR(cursor, WT_CURSTD_KEY_INT | WT_CURSTD_VALUE_INT);
+        F_SET(cursor, WT_CURSTD_KEY_EXT | WT_CURSTD_VALUE_EXT);
+
+        WT_ERR(__wt_btcur_insert_batch_key(cbt));
+    }
+
+err:
+    WT_TRET(__wt_btcur_reset(cbt));
+    __wt_scr_free(session, &tmp);
+    CURSOR_UPDATE_API_END_STAT(session, ret, cursor_insert_batch);
+    return (ret);
+}
+
 /*
  * __wt_curfile_insert_check --
  *     WT_CURSOR->insert_check method for the btree cursor type.
@@ -501,8 +631,10 @@ __curfile_update(WT_CURSOR *cursor)
     WT_ERR(__cursor_checkvalue(cursor));
 
     time_start = __wt_clock(session);
-    WT_ERR(__wt_btcur_update(cbt));
+    ret = __wt_btcur_update(cbt);
     time_stop = __wt_clock(session);
+    __wt_stat_latency_hist_incr_cursor_update(session, WT_CLOCKDIFF_US(time_stop, time_start));
+    WT_ERR(ret);
     __wt_stat_usecs_hist_incr_opwrite(session, WT_CLOCKDIFF_US(time_stop, time_start));
 
     /* Update maintains a position, key and value. */
@@ -959,7 +1091,9 @@ __curfile_create(WT_SESSION_IMPL *session, WT_CURSOR *owner, const char *cfg[],
       __curfile_reset,                                /* reset */
       __curfile_search,                               /* search */
       __curfile_search_near,                          /* search-near */
+      __curfile_search_batch,                         /* search-batch */
       __curfile_insert,                               /* insert */
+      __curfile_insert_batch,                         /* insert-batch */
       __wt_cursor_modify_value_format_notsup,         /* modify */
       __curfile_update,                               /* update */
       __curfile_remove,                               /* remove */
@@ -1243,7 +1243,9 @@ __wt_curhs_open(WT_SESSION_IMPL *session, WT_CURSOR *owner, WT_CURSOR **cursorp)
       __curhs_reset,                                  /* reset */
       __wt_cursor_notsup,                             /* search */
       __curhs_search_near,                            /* search-near */
+      __wt_cursor_search_batch_notsup,                /* search-batch */
       __curhs_insert,                                 /* insert */
+      __wt_cursor_insert_batch_notsup,                /* insert-batch */
       __wt_cursor_modify_value_format_notsup,         /* modify */
       __curhs_update,                                 /* update */
       __curhs_remove,                                 /* remove */
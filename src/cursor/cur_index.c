@@ -572,7 +572,9 @@ __wt_curindex_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner,
       __curindex_reset,                               /* reset */
       __curindex_search,                              /* search */
       __curindex_search_near,                         /* search-near */
+      __wt_cursor_search_batch,                       /* search-batch */
       __wt_cursor_notsup,                             /* insert */
+      __wt_cursor_insert_batch_notsup,                /* insert-batch */
       __wt_cursor_modify_notsup,                      /* modify */
       __wt_cursor_notsup,                             /* update */
       __wt_cursor_notsup,                             /* remove */
@@ -190,6 +190,37 @@ __wt_cursor_search_near_notsup(WT_CURSOR *cursor, int *exact)
     return (__wt_cursor_notsup(cursor));
 }
 
+/*
+ * __wt_cursor_search_batch_notsup --
+ *     Unsupported cursor search-batch.
+ */
+int
+__wt_cursor_search_batch_notsup(
+  WT_CURSOR *cursor, const WT_ITEM *keys, WT_ITEM *values, int *results, size_t count)
+{
+    WT_UNUSED(keys);
+    WT_UNUSED(values);
+    WT_UNUSED(results);
+    WT_UNUSED(count);
+
+    return (__wt_cursor_notsup(cursor));
+}
+
+/*
+ * __wt_cursor_insert_batch_notsup --
+ *     Unsupported cursor insert-batch.
+ */
+int
+__wt_cursor_insert_batch_notsup(
+  WT_CURSOR *cursor, const WT_ITEM *keys, const WT_ITEM *values, size_t count)
+{
+    WT_UNUSED(keys);
+    WT_UNUSED(values);
+    WT_UNUSED(count);
+
+    return (__wt_cursor_notsup(cursor));
+}
+
 /*
  * __wt_cursor_config_notsup --
  *     Unsupported cursor API call which takes config.
@@ -238,6 +269,8 @@ __wt_cursor_set_notsup(WT_CURSOR *cursor)
     cursor->reset = __wt_cursor_noop;
     cursor->search = __wt_cursor_notsup;
     cursor->search_near = __wt_cursor_search_near_notsup;
+    cursor->search_batch = __wt_cursor_search_batch_notsup;
+    cursor->insert_batch = __wt_cursor_insert_batch_notsup;
     cursor->update = __wt_cursor_notsup;
 }
 
@@ -832,6 +865,145 @@ err:
     return (ret);
 }
 
+/*
+ * __wt_cursor_pool_put --
+ *     Move a cached cursor from a closing session's cache into the connection's cursor pool.
+ *     Returns WT_NOTFOUND if the cursor can't be pooled and must be closed instead.
+ */
+int
+__wt_cursor_pool_put(WT_SESSION_IMPL *session, WT_CURSOR *cursor)
+{
+    WT_CONNECTION_IMPL *conn;
+    uint64_t bucket;
+    bool pooled;
+
+    conn = S2C(session);
+    WT_ASSERT(session, F_ISSET(cursor, WT_CURSTD_CACHED));
+
+    /*
+     * Only pool btree cursors whose handle can still be reopened. Internal sessions are closed
+     * after the pool is drained at shutdown, their cursors are never pooled.
+     */
+    if (conn->cursor_pool_max == 0 || F_ISSET(session, WT_SESSION_INTERNAL) ||
+      !WT_BTREE_PREFIX(cursor->internal_uri) || cursor->reopen(cursor, true) != 0)
+        return (WT_NOTFOUND);
+
+    bucket = cursor->uri_hash & (conn->hash_size - 1);
+    pooled = false;
+    __wt_spin_lock(session, &conn->cursor_pool_lock);
+    if (conn->cursor_pool_count < conn->cursor_pool_max) {
+        TAILQ_REMOVE(&session->cursor_cache[bucket], cursor, q);
+        TAILQ_INSERT_HEAD(&conn->cursor_pool[bucket], cursor, q);
+        ++conn->cursor_pool_count;
+        WT_STAT_CONN_SET(session, cursor_pool_count, conn->cursor_pool_count);
+        pooled = true;
+    }
+    __wt_spin_unlock(session, &conn->cursor_pool_lock);
+
+    if (!pooled)
+        return (WT_NOTFOUND);
+    WT_STAT_CONN_INCR(session, cursor_pool_add);
+    return (0);
+}
+
+/*
+ * __cursor_pool_get --
+ *     Adopt a matching cursor from the connection's cursor pool into the session's cursor cache.
+ */
+static WT_CURSOR *
+__cursor_pool_get(WT_SESSION_IMPL *session, const char *uri, uint64_t hash_value)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_CURSOR *cursor;
+    uint64_t bucket;
+
+    conn = S2C(session);
+    if (conn->cursor_pool_count == 0)
+        return (NULL);
+
+    bucket = hash_value & (conn->hash_size - 1);
+    __wt_spin_lock(session, &conn->cursor_pool_lock);
+    TAILQ_FOREACH (cursor, &conn->cursor_pool[bucket], q)
+        if (cursor->uri_hash == hash_value && strcmp(cursor->uri, uri) == 0) {
+            TAILQ_REMOVE(&conn->cursor_pool[bucket], cursor, q);
+            --conn->cursor_pool_count;
+            WT_STAT_CONN_SET(session, cursor_pool_count, conn->cursor_pool_count);
+            break;
+        }
+    __wt_spin_unlock(session, &conn->cursor_pool_lock);
+
+    /*
+     * The cursor now belongs to this session and is reopened from the session's cache like any
+     * other cached cursor.
+     */
+    if (cursor != NULL) {
+        cursor->session = (WT_SESSION *)session;
+        TAILQ_INSERT_HEAD(&session->cursor_cache[bucket], cursor, q);
+        WT_STAT_CONN_INCR(session, cursor_pool_reuse);
+    }
+    return (cursor);
+}
+
+/*
+ * __wt_cursor_pool_sweep --
+ *     Close pooled cursors referencing handles that can no longer be reopened, or all pooled
+ *     cursors if discarding the pool.
+ */
+int
+__wt_cursor_pool_sweep(WT_SESSION_IMPL *session, bool discard_all)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_CURSOR *cursor, *cursor_tmp;
+    WT_CURSOR_LIST discard;
+    WT_DECL_RET;
+    uint64_t bucket, i;
+    uint32_t ndiscard;
+    bool cache_cursors;
+
+    conn = S2C(session);
+    if (conn->cursor_pool_count == 0)
+        return (0);
+
+    /*
+     * Pull the cursors out of the pool with the lock held, then close them without it: closing a
+     * cursor may have to wait on its data handle.
+     */
+    TAILQ_INIT(&discard);
+    ndiscard = 0;
+    __wt_spin_lock(session, &conn->cursor_pool_lock);
+    for (i = 0; i < conn->hash_size; ++i)
+        TAILQ_FOREACH_SAFE(cursor, &conn->cursor_pool[i], q, cursor_tmp)
+        {
+            cursor->session = (WT_SESSION *)session;
+            if (!discard_all && cursor->reopen(cursor, true) == 0)
+                continue;
+            TAILQ_REMOVE(&conn->cursor_pool[i], cursor, q);
+            TAILQ_INSERT_HEAD(&discard, cursor, q);
+            --conn->cursor_pool_count;
+            ++ndiscard;
+        }
+    WT_STAT_CONN_SET(session, cursor_pool_count, conn->cursor_pool_count);
+    __wt_spin_unlock(session, &conn->cursor_pool_lock);
+
+    /* Close the cursors through this session's cache, the same way a session cursor sweep does. */
+    cache_cursors = F_ISSET(session, WT_SESSION_CACHE_CURSORS);
+    F_CLR(session, WT_SESSION_CACHE_CURSORS);
+    WT_TAILQ_SAFE_REMOVE_BEGIN(cursor, &discard, q, cursor_tmp)
+    {
+        bucket = cursor->uri_hash & (conn->hash_size - 1);
+        TAILQ_REMOVE(&discard, cursor, q);
+        TAILQ_INSERT_HEAD(&session->cursor_cache[bucket], cursor, q);
+        WT_TRET_NOTFOUND_OK(cursor->reopen(cursor, false));
+        WT_TRET(cursor->close(cursor));
+    }
+    WT_TAILQ_SAFE_REMOVE_END
+    if (cache_cursors)
+        F_SET(session, WT_SESSION_CACHE_CURSORS);
+
+    WT_STAT_CONN_INCRV(session, cursor_pool_discard, ndiscard);
+    return (ret);
+}
+
 /*
  * __wt_cursor_get_hash --
  *     Get hash value from the given uri.
@@ -917,68 +1089,71 @@ __wt_cursor_cache_get(WT_SESSION_IMPL *session, const char *uri, uint64_t hash_v
      * it.
      */
     bucket = hash_value & (S2C(session)->hash_size - 1);
-    TAILQ_FOREACH (cursor, &session->cursor_cache[bucket], q) {
-        if (cursor->uri_hash == hash_value && strcmp(cursor->uri, uri) == 0) {
-            if ((ret = cursor->reopen(cursor, false)) != 0) {
-                F_CLR(cursor, WT_CURSTD_CACHEABLE);
-                session->dhandle = NULL;
-                (void)cursor->close(cursor);
-                return (ret);
-            }
+    TAILQ_FOREACH (cursor, &session->cursor_cache[bucket], q)
+        if (cursor->uri_hash == hash_value && strcmp(cursor->uri, uri) == 0)
+            break;
 
-            /*
-             * For these configuration values, there is no difference in the resulting cursor other
-             * than flag values, so fix them up according to the given configuration.
-             */
-            F_CLR(cursor, WT_CURSTD_APPEND | WT_CURSTD_OVERWRITE | WT_CURSTD_RAW);
-            F_SET(cursor, overwrite_flag);
-            /*
-             * If this is a btree cursor, clear its read_once flag.
-             */
-            if (WT_BTREE_PREFIX(cursor->internal_uri)) {
-                cbt = (WT_CURSOR_BTREE *)cursor;
-                F_CLR(cbt, WT_CBT_READ_ONCE);
-            } else {
-                cbt = NULL;
-            }
+    /* If this session has no matching cursor, try to adopt one from the connection's pool. */
+    if (cursor == NULL && (cursor = __cursor_pool_get(session, uri, hash_value)) == NULL)
+        return (WT_NOTFOUND);
 
-            if (have_config) {
-                /*
-                 * The append flag is only relevant to column stores.
-                 */
-                if (WT_CURSOR_RECNO(cursor)) {
-                    WT_RET(__wt_config_gets_def(session, cfg, "append", 0, &cval));
-                    if (cval.val != 0)
-                        F_SET(cursor, WT_CURSTD_APPEND);
-                }
-
-                WT_RET(__wt_config_gets_def(session, cfg, "overwrite", 1, &cval));
-                if (cval.val == 0)
-                    F_CLR(cursor, WT_CURSTD_OVERWRITE);
-
-                WT_RET(__wt_config_gets_def(session, cfg, "raw", 0, &cval));
-                if (cval.val != 0)
-                    F_SET(cursor, WT_CURSTD_RAW);
-
-                if (cbt) {
-                    WT_RET(__wt_config_gets_def(session, cfg, "read_once", 0, &cval));
-                    if (cval.val != 0)
-                        F_SET(cbt, WT_CBT_READ_ONCE);
-                }
-            }
+    if ((ret = cursor->reopen(cursor, false)) != 0) {
+        F_CLR(cursor, WT_CURSTD_CACHEABLE);
+        session->dhandle = NULL;
+        (void)cursor->close(cursor);
+        return (ret);
+    }
 
-            /*
-             * A side effect of a cursor open is to leave the session's data handle set. Honor that
-             * for a "reopen".
-             */
-            if (cbt != NULL)
-                session->dhandle = cbt->dhandle;
+    /*
+     * For these configuration values, there is no difference in the resulting cursor other than
+     * flag values, so fix them up according to the given configuration.
+     */
+    F_CLR(cursor, WT_CURSTD_APPEND | WT_CURSTD_OVERWRITE | WT_CURSTD_RAW);
+    F_SET(cursor, overwrite_flag);
+    /*
+     * If this is a btree cursor, clear its read_once flag.
+     */
+    if (WT_BTREE_PREFIX(cursor->internal_uri)) {
+        cbt = (WT_CURSOR_BTREE *)cursor;
+        F_CLR(cbt, WT_CBT_READ_ONCE);
+    } else {
+        cbt = NULL;
+    }
 
-            *cursorp = cursor;
-            return (0);
+    if (have_config) {
+        /*
+         * The append flag is only relevant to column stores.
+         */
+        if (WT_CURSOR_RECNO(cursor)) {
+            WT_RET(__wt_config_gets_def(session, cfg, "append", 0, &cval));
+            if (cval.val != 0)
+                F_SET(cursor, WT_CURSTD_APPEND);
+        }
+
+        WT_RET(__wt_config_gets_def(session, cfg, "overwrite", 1, &cval));
+        if (cval.val == 0)
+            F_CLR(cursor, WT_CURSTD_OVERWRITE);
+
+        WT_RET(__wt_config_gets_def(session, cfg, "raw", 0, &cval));
+        if (cval.val != 0)
+            F_SET(cursor, WT_CURSTD_RAW);
+
+        if (cbt) {
+            WT_RET(__wt_config_gets_def(session, cfg, "read_once", 0, &cval));
+            if (cval.val != 0)
+                F_SET(cbt, WT_CBT_READ_ONCE);
         }
     }
-    return (WT_NOTFOUND);
+
+    /*
+     * A side effect of a cursor open is to leave the session's data handle set. Honor that for a
+     * "reopen".
+     */
+    if (cbt != NULL)
+        session->dhandle = cbt->dhandle;
+
+    *cursorp = cursor;
+    return (0);
 }
 
 /*
@@ -1003,6 +1178,7 @@ __wt_cursor_close(WT_CURSOR *cursor)
 
     __wt_buf_free(session, &cursor->lower_bound);
     __wt_buf_free(session, &cursor->upper_bound);
+    __wt_buf_free(session, &cursor->batch_values);
 
     __wt_free(session, cursor->internal_uri);
     __wt_free(session, cursor->uri);
@@ -1029,6 +1205,216 @@ err:
     API_END_RET_STAT(session, ret, cursor_equals);
 }
 
+/*
+ * __cursor_batch_key_compare --
+ *     Qsort function: sort batch key references in lexicographic key order. Duplicate keys are
+ *     sorted in the order they appear in the batch, the keys are elements of a single array.
+ */
+static int WT_CDECL
+__cursor_batch_key_compare(const void *a, const void *b)
+{
+    const WT_ITEM *akey, *bkey;
+    int cmp;
+
+    akey = *(const WT_ITEM **)a;
+    bkey = *(const WT_ITEM **)b;
+    if ((cmp = __wt_lex_compare(akey, bkey)) != 0)
+        return (cmp);
+    return (akey < bkey ? -1 : (akey > bkey ? 1 : 0));
+}
+
+/*
+ * __wt_cursor_batch_sort --
+ *     Return the order in which to process a batch of keys, an array of key references allocated in
+ *     the caller's scratch buffer, followed by room for an additional per-key array of the given
+ *     element size. Keys are processed in lexicographic order: for trees with custom collators
+ *     that's not the tree order, but batch operations don't depend on the order for correctness.
+ */
+int
+__wt_cursor_batch_sort(WT_SESSION_IMPL *session, const WT_ITEM *keys, size_t count,
+  size_t extra_size, WT_ITEM *tmp, const WT_ITEM ***sortedp)
+{
+    const WT_ITEM **sorted;
+    size_t i;
+
+    WT_RET(__wt_buf_init(session, tmp, count * (sizeof(WT_ITEM *) + extra_size)));
+    sorted = tmp->mem;
+    for (i = 0; i < count; ++i)
+        sorted[i] = &keys[i];
+    __wt_qsort(sorted, count, sizeof(WT_ITEM *), __cursor_batch_key_compare);
+
+    *sortedp = sorted;
+    return (0);
+}
+
+/*
+ * __wt_cursor_batch_init --
+ *     Set up a batch search: check the arguments, discard the values returned by any previous
+ *     batch, and return the keys' search order and an array of value offsets, both allocated in
+ *     the caller's scratch buffer.
+ */
+int
+__wt_cursor_batch_init(WT_CURSOR *cursor, const WT_ITEM *keys, WT_ITEM *values, int *results,
+  size_t count, WT_ITEM *tmp, const WT_ITEM ***sortedp, size_t **offsetsp)
+{
+    WT_SESSION_IMPL *session;
+    const WT_ITEM **sorted;
+    size_t i;
+
+    session = CUR2S(cursor);
+
+    if (count != 0 && (keys == NULL || values == NULL || results == NULL))
+        WT_RET_MSG(session, EINVAL, "batch operations require key, value and result arrays");
+
+    WT_RET(__wt_buf_init(session, &cursor->batch_values, 0));
+
+    WT_RET(__wt_cursor_batch_sort(session, keys, count, sizeof(size_t), tmp, &sorted));
+    for (i = 0; i < count; ++i) {
+        values[i].data = NULL;
+        values[i].size = 0;
+        results[i] = WT_NOTFOUND;
+    }
+
+    *sortedp = sorted;
+    *offsetsp = (size_t *)(sorted + count);
+    return (0);
+}
+
+/*
+ * __wt_cursor_batch_value_save --
+ *     Append a value returned by a batch operation to the cursor's batch buffer. The buffer may be
+ *     reallocated as it grows, so remember the value's offset rather than its address.
+ */
+int
+__wt_cursor_batch_value_save(
+  WT_CURSOR *cursor, const WT_ITEM *value, WT_ITEM *slot_value, size_t *offsetp)
+{
+    WT_ITEM *buf;
+
+    buf = &cursor->batch_values;
+
+    WT_RET(__wt_buf_grow(CUR2S(cursor), buf, buf->size + value->size));
+    if (value->size != 0)
+        memcpy((uint8_t *)buf->mem + buf->size, value->data, value->size);
+    *offsetp = buf->size;
+    slot_value->size = value->size;
+    buf->size += value->size;
+    return (0);
+}
+
+/*
+ * __wt_cursor_batch_values_set --
+ *     Point the values returned by a batch operation into the cursor's batch buffer.
+ */
+void
+__wt_cursor_batch_values_set(
+  WT_CURSOR *cursor, WT_ITEM *values, const int *results, const size_t *offsets, size_t count)
+{
+    size_t i;
+
+    for (i = 0; i < count; ++i)
+        if (results[i] == 0)
+            values[i].data = (const uint8_t *)cursor->batch_values.data + offsets[i];
+}
+
+/*
+ * __wt_cursor_search_batch --
+ *     WT_CURSOR->search_batch default implementation: search for each key in turn, in sorted order.
+ */
+int
+__wt_cursor_search_batch(
+  WT_CURSOR *cursor, const WT_ITEM *keys, WT_ITEM *values, int *results, size_t count)
+{
+    WT_DECL_ITEM(tmp);
+    WT_DECL_RET;
+    WT_ITEM value;
+    WT_SESSION_IMPL *session;
+    size_t i, *offsets, slot;
+    const WT_ITEM **sorted;
+    bool raw_set;
+
+    raw_set = F_ISSET(cursor, WT_CURSTD_RAW);
+
+    CURSOR_API_CALL(cursor, session, search_batch, NULL);
+    WT_STAT_CONN_DATA_INCR(session, cursor_search_batch);
+    WT_STAT_CONN_DATA_INCRV(session, cursor_search_batch_keys, count);
+
+    WT_ERR(__wt_scr_alloc(session, 0, &tmp));
+    WT_ERR(__wt_cursor_batch_init(cursor, keys, values, results, count, tmp, &sorted, &offsets));
+
+    /* Keys and values are in their packed form: force raw mode for the duration of the batch. */
+    F_SET(cursor, WT_CURSTD_RAW);
+    for (i = 0; i < count; ++i) {
+        slot = (size_t)(sorted[i] - keys);
+        cursor->set_key(cursor, sorted[i]);
+        WT_ERR_NOTFOUND_OK(cursor->search(cursor), true);
+        if ((results[slot] = ret) == 0) {
+            WT_ERR(cursor->get_value(cursor, &value));
+            WT_ERR(__wt_cursor_batch_value_save(cursor, &value, &values[slot], &offsets[slot]));
+        }
+        ret = 0;
+    }
+    __wt_cursor_batch_values_set(cursor, values, results, offsets, count);
+
+err:
+    if (!raw_set)
+        F_CLR(cursor, WT_CURSTD_RAW);
+    WT_TRET(cursor->reset(cursor));
+    __wt_scr_free(session, &tmp);
+    API_END_RET_STAT(session, ret, cursor_search_batch);
+}
+
+/*
+ * __wt_cursor_insert_batch --
+ *     WT_CURSOR->insert_batch default implementation: insert each key/value pair in turn, in sorted
+ *     key order, in a single transaction.
+ */
+int
+__wt_cursor_insert_batch(WT_CURSOR *cursor, const WT_ITEM *keys, const WT_ITEM *values, size_t count)
+{
+    WT_DECL_ITEM(tmp);
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+    size_t i, slot;
+    const WT_ITEM **sorted;
+    bool overwrite_set, raw_set;
+
+    overwrite_set = F_ISSET(cursor, WT_CURSTD_OVERWRITE);
+    raw_set = F_ISSET(cursor, WT_CURSTD_RAW);
+
+    CURSOR_UPDATE_API_CALL(cursor, session, insert_batch);
+    WT_STAT_CONN_DATA_INCR(session, cursor_insert_batch);
+    WT_STAT_CONN_DATA_INCRV(session, cursor_insert_batch_keys, count);
+
+    if (count != 0 && (keys == NULL || values == NULL))
+        WT_ERR_MSG(session, EINVAL, "batch inserts require key and value arrays");
+
+    WT_ERR(__wt_scr_alloc(session, 0, &tmp));
+    WT_ERR(__wt_cursor_batch_sort(session, keys, count, 0, tmp, &sorted));
+
+    /*
+     * Keys and values are in their packed form and existing keys are overwritten: force raw and
+     * overwrite modes for the duration of the batch.
+     */
+    F_SET(cursor, WT_CURSTD_OVERWRITE | WT_CURSTD_RAW);
+    for (i = 0; i < count; ++i) {
+        slot = (size_t)(sorted[i] - keys);
+        cursor->set_key(cursor, sorted[i]);
+        cursor->set_value(cursor, &values[slot]);
+        WT_ERR(cursor->insert(cursor));
+    }
+
+err:
+    if (!overwrite_set)
+        F_CLR(cursor, WT_CURSTD_OVERWRITE);
+    if (!raw_set)
+        F_CLR(cursor, WT_CURSTD_RAW);
+    WT_TRET(cursor->reset(cursor));
+    __wt_scr_free(session, &tmp);
+    CURSOR_UPDATE_API_END_STAT(session, ret, cursor_insert_batch);
+    return (ret);
+}
+
 /*
  * __cursor_modify --
  *     WT_CURSOR->modify default implementation.
@@ -1455,6 +1841,7 @@ __wt_cursor_init(
     }
     if (readonly) {
         cursor->insert = __wt_cursor_notsup;
+        cursor->insert_batch = __wt_cursor_insert_batch_notsup;
         cursor->modify = __wt_cursor_modify_notsup;
         cursor->remove = __wt_cursor_notsup;
         cursor->reserve = __wt_cursor_notsup;
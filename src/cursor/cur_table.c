@@ -97,7 +97,9 @@ __wt_apply_single_idx(WT_SESSION_IMPL *session, WT_INDEX *idx, WT_CURSOR *cur,
       __wt_cursor_notsup,                             /* reset */
       __wt_cursor_notsup,                             /* search */
       __wt_cursor_search_near_notsup,                 /* search-near */
+      __wt_cursor_search_batch_notsup,                /* search-batch */
       __curextract_insert,                            /* insert */
+      __wt_cursor_insert_batch_notsup,                /* insert-batch */
       __wt_cursor_modify_notsup,                      /* modify */
       __wt_cursor_notsup,                             /* update */
       __wt_cursor_notsup,                             /* remove */
@@ -1059,7 +1061,9 @@ __wt_curtable_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner,
       __curtable_reset,                                 /* reset */
       __curtable_search,                                /* search */
       __curtable_search_near,                           /* search-near */
+      __wt_cursor_search_batch,                         /* search-batch */
       __curtable_insert,                                /* insert */
+      __wt_cursor_insert_batch,                         /* insert-batch */
       __wt_cursor_modify_notsup,                        /* modify */
       __curtable_update,                                /* update */
       __curtable_remove,                                /* remove */
@@ -611,7 +611,9 @@ __wt_curversion_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner
       __curversion_reset,                              /* reset */
       __curversion_search,                             /* search */
       __wt_cursor_search_near_notsup,                  /* search-near */
+      __wt_cursor_search_batch_notsup,                 /* search-batch */
       __wt_cursor_notsup,                              /* insert */
+      __wt_cursor_insert_batch_notsup,                 /* insert-batch */
       __wt_cursor_modify_notsup,                       /* modify */
       __wt_cursor_notsup,                              /* update */
       __wt_cursor_notsup,                              /* remove */
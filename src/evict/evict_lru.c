@@ -22,6 +22,12 @@ static int __evict_walk_tree(WT_SESSION_IMPL *, WT_EVICT_QUEUE *, u_int, u_int *
 
 #define WT_EVICT_HAS_WORKERS(s) (S2C(s)->evict_threads.current_threads > 1)
 
+/*
+ * Define a function that increments the latency histogram for application threads waiting on
+ * eviction.
+ */
+WT_STAT_LATENCY_HIST_INCR_FUNC(app_evict, perf_hist_app_evict_latency)
+
 /*
  * __evict_lock_handle_list --
  *     Try to get the handle list lock, with yield and sleep back off. Keep timing statistics
@@ -168,8 +174,9 @@ __evict_list_clear_page_locked(WT_SESSION_IMPL *session, WT_REF *ref, bool exclu
     uint32_t elem, i, q, last_queue_idx;
     bool found;
 
-    last_queue_idx = exclude_urgent ? WT_EVICT_URGENT_QUEUE : WT_EVICT_QUEUE_MAX;
     cache = S2C(session)->cache;
+    /* The urgent queue is always the last one. */
+    last_queue_idx = exclude_urgent ? cache->evict_queue_count - 1 : cache->evict_queue_count;
     found = false;
 
     WT_ASSERT_SPINLOCK_OWNED(session, &cache->evict_queue_lock);
@@ -929,7 +936,7 @@ __wt_evict_file_exclusive_on(WT_SESSION_IMPL *session)
      */
     __wt_spin_lock(session, &cache->evict_queue_lock);
 
-    for (q = 0; q < WT_EVICT_QUEUE_MAX; q++) {
+    for (q = 0; q < cache->evict_queue_count; q++) {
         __wt_spin_lock(session, &cache->evict_queues[q].evict_lock);
         elem = cache->evict_queues[q].evict_max;
         for (i = 0, evict = cache->evict_queues[q].evict_queue; i < elem; i++, evict++)
@@ -1202,10 +1209,12 @@ __evict_lru_walk(WT_SESSION_IMPL *session)
     WT_CACHE *cache;
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
-    WT_EVICT_QUEUE *queue, *other_queue;
+    WT_EVICT_QUEUE *base_queue, *other_queue, *queue;
+    WT_EVICT_SHARD *shard;
     WT_TRACK_OP_DECL;
     uint64_t read_gen_oldest;
     uint32_t candidates, entries;
+    u_int i;
 
     WT_TRACK_OP_INIT(session);
     conn = S2C(session);
@@ -1215,14 +1224,26 @@ __evict_lru_walk(WT_SESSION_IMPL *session)
     if (cache->evict_empty_score > 0)
         --cache->evict_empty_score;
 
-    /* Fill the next queue (that isn't the urgent queue). */
-    queue = cache->evict_fill_queue;
-    other_queue = cache->evict_queues + (1 - (queue - cache->evict_queues));
-    cache->evict_fill_queue = other_queue;
+    /*
+     * Fill the next queue (that isn't the urgent queue). Shards are filled in turn, skipping any
+     * shard whose queues are both full.
+     */
+    for (i = 0;;) {
+        shard = &cache->evict_shards[cache->evict_fill_shard];
+        if (++cache->evict_fill_shard == cache->evict_shard_count)
+            cache->evict_fill_shard = 0;
 
-    /* If this queue is full, try the other one. */
-    if (__evict_queue_full(queue) && !__evict_queue_full(other_queue))
-        queue = other_queue;
+        queue = shard->evict_fill_queue;
+        base_queue = cache->evict_queues + 2 * (shard - cache->evict_shards);
+        other_queue = base_queue + (1 - (queue - base_queue));
+        shard->evict_fill_queue = other_queue;
+
+        /* If this queue is full, try the other one. */
+        if (__evict_queue_full(queue) && !__evict_queue_full(other_queue))
+            queue = other_queue;
+        if (!__evict_queue_full(queue) || ++i == cache->evict_shard_count)
+            break;
+    }
 
     /*
      * If both queues are full and haven't been empty on recent refills, we're done.
@@ -1259,7 +1280,7 @@ __evict_lru_walk(WT_SESSION_IMPL *session)
      * We have locked the queue: in the (unusual) case where we are filling the current queue, mark
      * it empty so that subsequent requests switch to the other queue.
      */
-    if (queue == cache->evict_current_queue)
+    if (queue == shard->evict_current_queue)
         queue->evict_current = NULL;
 
     entries = queue->evict_entries;
@@ -2164,41 +2185,27 @@ fast:
 }
 
 /*
- * __evict_get_ref --
- *     Get a page for eviction.
+ * __evict_get_ref_shard --
+ *     Get a page for eviction from a queue shard, or from the urgent queue if allowed.
  */
 static int
-__evict_get_ref(WT_SESSION_IMPL *session, bool is_server, WT_BTREE **btreep, WT_REF **refp,
-  uint8_t *previous_statep)
+__evict_get_ref_shard(WT_SESSION_IMPL *session, WT_EVICT_SHARD *shard, bool is_server,
+  bool urgent_ok, WT_BTREE **btreep, WT_REF **refp, uint8_t *previous_statep)
 {
     WT_CACHE *cache;
     WT_EVICT_ENTRY *evict;
     WT_EVICT_QUEUE *queue, *other_queue, *urgent_queue;
     uint32_t candidates;
     uint8_t previous_state;
-    bool is_app, server_only, urgent_ok;
-
-    *btreep = NULL;
-    /*
-     * It is polite to initialize output variables, but it isn't safe for callers to use the
-     * previous state if we don't return a locked ref.
-     */
-    *previous_statep = WT_REF_MEM;
-    *refp = NULL;
+    bool server_only;
 
     cache = S2C(session)->cache;
-    is_app = !F_ISSET(session, WT_SESSION_INTERNAL);
     server_only = is_server && !WT_EVICT_HAS_WORKERS(session);
-    /* Application threads do eviction when cache is full of dirty data */
-    urgent_ok = (!is_app && !is_server) || !WT_EVICT_HAS_WORKERS(session) ||
-      (is_app && F_ISSET(cache, WT_CACHE_EVICT_DIRTY_HARD));
     urgent_queue = cache->evict_urgent_queue;
 
-    WT_STAT_CONN_INCR(session, cache_eviction_get_ref);
-
     /* Avoid the LRU lock if no pages are available. */
-    if (__evict_queue_empty(cache->evict_current_queue, is_server) &&
-      __evict_queue_empty(cache->evict_other_queue, is_server) &&
+    if (__evict_queue_empty(shard->evict_current_queue, is_server) &&
+      __evict_queue_empty(shard->evict_other_queue, is_server) &&
       (!urgent_ok || __evict_queue_empty(urgent_queue, false))) {
         WT_STAT_CONN_INCR(session, cache_eviction_get_ref_empty);
         return (WT_NOTFOUND);
@@ -2213,13 +2220,13 @@ __evict_get_ref(WT_SESSION_IMPL *session, bool is_server, WT_BTREE **btreep, WT_
      * refill the queues. Such cases are extremely rare in real applications.
      */
     if (is_server && (!urgent_ok || __evict_queue_empty(urgent_queue, false)) &&
-      !__evict_queue_full(cache->evict_current_queue) &&
-      !__evict_queue_full(cache->evict_fill_queue) &&
+      !__evict_queue_full(shard->evict_current_queue) &&
+      !__evict_queue_full(shard->evict_fill_queue) &&
       (cache->evict_empty_score > WT_EVICT_SCORE_CUTOFF ||
-        __evict_queue_empty(cache->evict_fill_queue, false)))
+        __evict_queue_empty(shard->evict_fill_queue, false)))
         return (WT_NOTFOUND);
 
-    __wt_spin_lock(session, &cache->evict_queue_lock);
+    __wt_spin_lock(session, &shard->evict_queue_lock);
 
     /* Check the urgent queue first. */
     if (urgent_ok && !__evict_queue_empty(urgent_queue, false))
@@ -2231,16 +2238,16 @@ __evict_get_ref(WT_SESSION_IMPL *session, bool is_server, WT_BTREE **btreep, WT_
          * The server will only evict half of the pages before looking for more, but should only
          * switch queues if there are no other eviction workers.
          */
-        queue = cache->evict_current_queue;
-        other_queue = cache->evict_other_queue;
+        queue = shard->evict_current_queue;
+        other_queue = shard->evict_other_queue;
         if (__evict_queue_empty(queue, server_only) &&
           !__evict_queue_empty(other_queue, server_only)) {
-            cache->evict_current_queue = other_queue;
-            cache->evict_other_queue = queue;
+            shard->evict_current_queue = other_queue;
+            shard->evict_other_queue = queue;
         }
     }
 
-    __wt_spin_unlock(session, &cache->evict_queue_lock);
+    __wt_spin_unlock(session, &shard->evict_queue_lock);
 
     /*
      * We got the queue lock, which should be fast, and chose a queue. Now we want to get the lock
@@ -2327,6 +2334,62 @@ __evict_get_ref(WT_SESSION_IMPL *session, bool is_server, WT_BTREE **btreep, WT_
     return (*refp == NULL ? WT_NOTFOUND : 0);
 }
 
+/*
+ * __evict_get_ref --
+ *     Get a page for eviction.
+ */
+static int
+__evict_get_ref(WT_SESSION_IMPL *session, bool is_server, WT_BTREE **btreep, WT_REF **refp,
+  uint8_t *previous_statep)
+{
+    WT_CACHE *cache;
+    WT_DECL_RET;
+    u_int i, shard_count, start;
+    bool is_app, urgent_ok;
+
+    *btreep = NULL;
+    /*
+     * It is polite to initialize output variables, but it isn't safe for callers to use the
+     * previous state if we don't return a locked ref.
+     */
+    *previous_statep = WT_REF_MEM;
+    *refp = NULL;
+
+    cache = S2C(session)->cache;
+    is_app = !F_ISSET(session, WT_SESSION_INTERNAL);
+    /* Application threads do eviction when cache is full of dirty data */
+    urgent_ok = (!is_app && !is_server) || !WT_EVICT_HAS_WORKERS(session) ||
+      (is_app && F_ISSET(cache, WT_CACHE_EVICT_DIRTY_HARD));
+
+    WT_STAT_CONN_INCR(session, cache_eviction_get_ref);
+
+    /*
+     * The server evicts from the shard it fills next, its choices there decide when that shard is
+     * refilled.
+     */
+    if (is_server)
+        return (__evict_get_ref_shard(session, &cache->evict_shards[cache->evict_fill_shard], true,
+          urgent_ok, btreep, refp, previous_statep));
+
+    /*
+     * Other threads start with a shard chosen by their session, which spreads them across the
+     * shard locks, and take pages from the other shards when theirs is empty. Only check the
+     * urgent queue once.
+     */
+    shard_count = cache->evict_shard_count;
+    start = session->id % shard_count;
+    for (i = 0; i < shard_count; ++i) {
+        ret = __evict_get_ref_shard(session, &cache->evict_shards[(start + i) % shard_count], false,
+          urgent_ok && i == 0, btreep, refp, previous_statep);
+        if (ret != WT_NOTFOUND) {
+            if (ret == 0 && i != 0)
+                WT_STAT_CONN_INCR(session, cache_eviction_get_ref_shard_steal);
+            break;
+        }
+    }
+    return (ret);
+}
+
 /*
  * __evict_page --
  *     Called by both eviction and application threads to evict a page.
@@ -2522,6 +2585,7 @@ err:
         time_stop = __wt_clock(session);
         elapsed = WT_CLOCKDIFF_US(time_stop, time_start);
         WT_STAT_CONN_INCRV(session, application_cache_time, elapsed);
+        __wt_stat_latency_hist_incr_app_evict(session, elapsed);
         WT_STAT_SESSION_INCRV(session, cache_time, elapsed);
         session->cache_wait_us += elapsed;
         /*
@@ -2568,7 +2632,7 @@ __wt_page_evict_urgent(WT_SESSION_IMPL *session, WT_REF *ref)
         return (false);
 
     /* Append to the urgent queue if we can. */
-    urgent_queue = &cache->evict_queues[WT_EVICT_URGENT_QUEUE];
+    urgent_queue = cache->evict_urgent_queue;
     queued = false;
 
     __wt_spin_lock(session, &cache->evict_queue_lock);
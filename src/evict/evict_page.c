@@ -505,6 +505,9 @@ __evict_page_dirty_update(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t evict_
         *addr = mod->mod_replace;
         mod->mod_replace.addr = NULL;
         mod->mod_replace.size = 0;
+        mod->mod_replace.bloom = NULL;
+        if (addr->bloom != NULL)
+            __wt_cache_page_inmem_incr(session, ref->home, addr->bloom->memsize);
         ref->addr = addr;
 
         /*
@@ -132,7 +132,10 @@ err:
 int
 __wt_hs_open(WT_SESSION_IMPL *session, const char **cfg)
 {
+    WT_CONFIG_ITEM cval, level;
     WT_CONNECTION_IMPL *conn;
+    WT_DECL_ITEM(tmp);
+    WT_DECL_RET;
 
     conn = S2C(session);
 
@@ -143,12 +146,28 @@ __wt_hs_open(WT_SESSION_IMPL *session, const char **cfg)
     /* Drop the lookaside file if it still exists. */
     WT_RET(__hs_cleanup_las(session));
 
-    /* Create the table. */
-    WT_RET(__wt_session_create(session, WT_HS_URI, WT_HS_CONFIG));
-
-    WT_RET(__wt_hs_config(session, cfg));
+    /*
+     * Create the table. History store pages are written once and rarely read, the application can
+     * choose their compressor and level. The configuration is stored with the table when it's
+     * created, later changes don't apply to an existing history store.
+     */
+    WT_RET(__wt_config_gets(session, cfg, "history_store.block_compressor", &cval));
+    WT_RET(__wt_config_gets(session, cfg, "history_store.block_compressor_level", &level));
+    WT_RET(__wt_scr_alloc(session, 0, &tmp));
+    if (cval.len == 0)
+        WT_ERR(__wt_buf_fmt(session, tmp, "%s,block_compressor_level=%" PRId64, WT_HS_CONFIG,
+          level.val));
+    else
+        WT_ERR(__wt_buf_fmt(session, tmp,
+          "%s,block_compressor=%.*s,block_compressor_level=%" PRId64, WT_HS_CONFIG,
+          (int)cval.len, cval.str, level.val));
+    WT_ERR(__wt_session_create(session, WT_HS_URI, tmp->data));
+
+    WT_ERR(__wt_hs_config(session, cfg));
 
-    return (0);
+err:
+    __wt_scr_free(session, &tmp);
+    return (ret);
 }
 
 /*
@@ -345,7 +345,7 @@ __wt_hs_insert_updates(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_MULTI *mult
     WT_UPDATE *newest_hs, *no_ts_upd, *oldest_upd, *prev_upd, *ref_upd, *tombstone, *upd;
     WT_TIME_WINDOW tw;
     wt_off_t hs_size;
-    uint64_t insert_cnt, max_hs_size, modify_cnt;
+    uint64_t insert_cnt, max_hs_size, max_modify_cnt, modify_cnt;
     uint64_t cache_hs_insert_full_update, cache_hs_insert_reverse_modify, cache_hs_write_squash;
     uint32_t i;
     int nentries;
@@ -407,6 +407,13 @@ __wt_hs_insert_updates(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_MULTI *mult
         enable_reverse_modify =
           (WT_STREQ(btree->value_format, "S") || WT_STREQ(btree->value_format, "u"));
 
+        /*
+         * Tables keeping compact modify chains in memory keep them compact in the history store too,
+         * allowing as many consecutive reverse modifies as deltas in memory.
+         */
+        max_modify_cnt = btree->modify_chain_compact ? btree->modify_chain_max_length :
+                                                       WT_MAX_CONSECUTIVE_REVERSE_MODIFY;
+
         /*
          * If there exists an on page tombstone without a timestamp, consider it as a no timestamp
          * update to clear the timestamps of all the updates that are inserted into the history
@@ -689,8 +696,7 @@ __wt_hs_insert_updates(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_MULTI *mult
              * the RTS.
              */
             nentries = MAX_REVERSE_MODIFY_NUM;
-            if (upd != newest_hs && enable_reverse_modify &&
-              modify_cnt < WT_MAX_CONSECUTIVE_REVERSE_MODIFY &&
+            if (upd != newest_hs && enable_reverse_modify && modify_cnt < max_modify_cnt &&
               __wt_calc_modify(session, prev_full_value, full_value, prev_full_value->size / 10,
                 entries, &nentries) == 0) {
                 WT_ERR(__wt_modify_pack(hs_cursor, entries, nentries, &modify_value));
@@ -80,9 +80,15 @@
     WT_TRACK_OP_INIT(s);                                                \
     if ((s)->api_call_counter == 1 && !F_ISSET(s, WT_SESSION_INTERNAL)) \
         __wt_op_timer_start(s);                                         \
-    /* Reset wait time if this isn't an API reentry. */                 \
-    if ((s)->api_call_counter == 1)                                     \
+    /*                                                                  \
+     * Reset wait time and move the statistics buckets to follow the    \
+     * thread if this isn't an API reentry.                             \
+     */                                                                 \
+    if ((s)->api_call_counter == 1) {                                   \
         (s)->cache_wait_us = 0;                                         \
+        if (WT_STAT_ENABLED(s))                                         \
+            __wt_stat_bucket_set(s, false);                             \
+    }                                                                   \
     __wt_verbose((s), WT_VERB_API, "%s", "CALL: " #struct_name ":" #func_name)
 
 #define API_CALL_NOCONF(s, struct_name, func_name, dh) \
@@ -39,7 +39,16 @@
  *
  * One final complication: we only maintain the per-size skiplist for the avail
  * list, the alloc and discard extent lists are not searched based on size.
+ *
+ * Lists maintaining the per-size skiplist also segregate extents into power-of-two
+ * size classes (extents in class N are at least 2^N and less than 2^(N+1) bytes)
+ * and cache the lowest-offset extent in each class. First-fit allocation takes the
+ * lowest-offset extent of the larger classes and only searches the by-size list
+ * for the class of the requested size, rather than walking the by-offset list.
+ * When the cached extent of a class is removed, the class is marked stale and its
+ * lowest-offset extent is found again from the by-size list when next needed.
  */
+#define WT_BLOCK_SIZE_CLASSES 63 /* Extent size classes, sizes are positive wt_off_t values */
 
 /*
  * WT_EXTLIST --
@@ -62,6 +71,9 @@ struct __wt_extlist {
 
     WT_EXT *off[WT_SKIP_MAXDEPTH]; /* Size/offset skiplists */
     WT_SIZE *sz[WT_SKIP_MAXDEPTH];
+
+    WT_EXT *class_first[WT_BLOCK_SIZE_CLASSES]; /* Size class lowest-offset extents */
+    uint64_t class_stale;                       /* Size classes to search again */
 };
 
 /*
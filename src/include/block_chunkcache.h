@@ -112,6 +112,10 @@ struct __wt_chunkcache {
     uint8_t *free_bitmap; /* Bitmap of free chunks in file */
     uint8_t *memory;      /* Memory location for the assigned chunk space */
 
+    /* Startup preload of persistent content. */
+    uint64_t preload_budget; /* Maximum bytes to preload, 0 for no limit */
+    u_int preload_threads;   /* Number of preload threads, 0 to load lazily */
+
     /* Content management. */
     wt_thread_t evict_thread_tid;
     unsigned int evict_trigger; /* When this percent of cache is full, we trigger eviction. */
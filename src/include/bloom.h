@@ -22,3 +22,16 @@ struct __wt_bloom {
 struct __wt_bloom_hash {
     uint64_t h1, h2; /* The two hashes used to calculate bits. */
 };
+
+/*
+ * WT_PAGE_BLOOM --
+ *	An in-memory Bloom filter of the keys on a single row-store leaf page, built when the page is
+ * written and kept with the page's address. The bit string follows the structure in the same
+ * allocation.
+ */
+struct __wt_page_bloom {
+    uint64_t m;     /* The number of slots in the bit string. */
+    uint32_t k;     /* The number of hash functions used. */
+    size_t memsize; /* Allocation size, including the bit string. */
+};
+#define WT_PAGE_BLOOM_BITSTRING(bloom) ((uint8_t *)(bloom) + sizeof(WT_PAGE_BLOOM))
@@ -136,6 +136,12 @@ struct __wt_addr {
     uint8_t *addr; /* Block-manager's cookie */
     uint8_t size;  /* Block-manager's cookie length */
 
+    /*
+     * Row-store leaf page key filter, its memory is charged to the footprint of the page holding the
+     * reference to the leaf page.
+     */
+    WT_PAGE_BLOOM *bloom;
+
 #define WT_ADDR_INT 1     /* Internal page */
 #define WT_ADDR_LEAF 2    /* Leaf page */
 #define WT_ADDR_LEAF_NO 3 /* Leaf page, no overflow */
@@ -327,6 +333,15 @@ struct __wt_page_modify {
     wt_shared size_t bytes_dirty;
     wt_shared size_t bytes_updates;
 
+    /*
+     * Compare-and-swap retries and insert list restarts modifying the page since it was last
+     * reconciled, and the count when the page was last checked for a contention split. Both are
+     * reset by reconciliation, so a page is only considered contended while the contention is
+     * recent.
+     */
+    wt_shared uint32_t contention;
+    uint32_t contention_checked;
+
     /*
      * When pages are reconciled, the result is one or more replacement blocks. A replacement block
      * can be in one of two states: it was written to disk, and so we have a block address, or it
@@ -503,6 +518,25 @@ struct __wt_page_index {
     uint32_t entries;
     wt_shared uint32_t deleted_entries;
     WT_REF **index;
+
+    wt_shared WT_PAGE_INDEX_PREFIX *prefix; /* Row-store key prefixes */
+};
+
+/*
+ * WT_PAGE_INDEX_PREFIX --
+ *	Fixed-width prefixes of the keys in a row-store internal page index, so searches can compare
+ * several slots at once before comparing full keys. Each prefix is the 8 bytes following the bytes
+ * shared by all of the page's keys (zero-padded, read big-endian, with the sign bit flipped so
+ * signed integer comparisons order them the same as the keys). They're built when a page is read
+ * and when a search first uses a page index created by a split.
+ */
+#define WT_PAGE_INDEX_PREFIX_DISCARDED ((WT_PAGE_INDEX_PREFIX *)(uintptr_t)1)
+#define WT_PAGE_INDEX_PREFIX_MIN 64 /* Minimum page index entries */
+struct __wt_page_index_prefix {
+    size_t memsize;  /* Allocation size */
+    uint32_t skip;   /* Leading bytes shared by every key */
+    int64_t *slot;   /* Key prefixes, NULL if they don't discriminate */
+    uint8_t *shared; /* Copy of the shared leading bytes */
 };
 
 /*
@@ -949,6 +983,22 @@ struct __wt_prefetch_queue_entry {
     TAILQ_ENTRY(__wt_prefetch_queue_entry) q; /* List of pages queued for pre-fetch. */
 };
 
+/*
+ * WT_PREFETCH_READ --
+ *	An asynchronous block read issued by a pre-fetch thread.
+ */
+struct __wt_prefetch_read {
+    WT_PREFETCH_QUEUE_ENTRY *pe; /* Queue entry being read */
+    WT_ITEM buf;                 /* Read buffer */
+
+    WT_FH *fh; /* Block location */
+    wt_off_t offset;
+    uint32_t size;
+    uint32_t checksum;
+
+    bool done; /* Read completed successfully */
+};
+
 /*
  * WT_REF --
  *	A single in-memory page and state information.
@@ -128,10 +128,18 @@ struct __wt_btree {
     /*
      * Reconciliation...
      */
-    u_int dictionary;             /* Dictionary slots */
-    bool internal_key_truncate;   /* Internal key truncate */
-    bool prefix_compression;      /* Prefix compression */
-    u_int prefix_compression_min; /* Prefix compression min */
+    u_int dictionary;                 /* Dictionary slots */
+    bool internal_key_truncate;       /* Internal key truncate */
+    bool prefix_compression;          /* Prefix compression */
+    u_int prefix_compression_min;     /* Prefix compression min */
+    u_int prefix_compression_restart; /* Prefix compression restart interval */
+
+    uint32_t leaf_bloom_bit_count;  /* Leaf page Bloom filter bits per key */
+    uint32_t leaf_bloom_hash_count; /* Leaf page Bloom filter hash functions */
+
+    bool modify_chain_compact;     /* Keep modify updates as deltas */
+    u_int modify_chain_max_length; /* Deltas before writing a full value */
+    u_int modify_chain_max_pct;    /* Delta memory before writing a full value */
 
 #define WT_SPLIT_DEEPEN_MIN_CHILD_DEF (10 * WT_THOUSAND)
     u_int split_deepen_min_child; /* Minimum entries to deepen tree */
@@ -139,8 +147,11 @@ struct __wt_btree {
     u_int split_deepen_per_child; /* Entries per child when deepened */
     int split_pct;                /* Split page percent */
 
-    WT_COMPRESSOR *compressor;    /* Page compressor */
-                                  /*
+    WT_COMPRESSOR *compressor;      /* Leaf page compressor */
+    int compressor_owned;           /* The compressor needs to be terminated */
+    WT_COMPRESSOR *intl_compressor; /* Internal page compressor */
+    int intl_compressor_owned;      /* The internal page compressor needs to be terminated */
+                                    /*
                                    * When doing compression, the pre-compression in-memory byte size
                                    * is optionally adjusted based on previous compression results.
                                    * It's an 8B value because it's updated without a lock.
@@ -157,6 +168,7 @@ struct __wt_btree {
 
     int maximum_depth;        /* Maximum tree depth during search */
     u_int rec_multiblock_max; /* Maximum blocks written for a page */
+    uint32_t contention_max;  /* Maximum retries modifying a page */
 
     uint64_t last_recno; /* Column-store last record number */
 
@@ -186,12 +198,19 @@ struct __wt_btree {
  * running), so no new operations should start that would conflict with the sync.
  * WT_SESSION_BTREE_SYNC indicates if the session is performing a sync on its current tree.
  * WT_SESSION_BTREE_SYNC_SAFE checks whether it is safe to perform an operation that would conflict
- * with a sync.
+ * with a sync. A checkpoint helper thread reconciling pages on behalf of the syncing session is
+ * treated as part of the sync.
  */
 #define WT_BTREE_SYNCING(btree) ((btree)->syncing != WT_BTREE_SYNC_OFF)
-#define WT_SESSION_BTREE_SYNC(session) (S2BT(session)->sync_session == (session))
-#define WT_SESSION_BTREE_SYNC_SAFE(session, btree) \
-    ((btree)->syncing != WT_BTREE_SYNC_RUNNING || (btree)->sync_session == (session))
+#define WT_SESSION_BTREE_SYNC_HELPER(session, btree)            \
+    (F_ISSET(session, WT_SESSION_CHECKPOINT_HELPER) &&          \
+      (btree)->sync_session == S2C(session)->ckpt_helper_owner)
+#define WT_SESSION_BTREE_SYNC(session)                      \
+    (S2BT(session)->sync_session == (session) ||            \
+      WT_SESSION_BTREE_SYNC_HELPER(session, S2BT(session)))
+#define WT_SESSION_BTREE_SYNC_SAFE(session, btree)                                      \
+    ((btree)->syncing != WT_BTREE_SYNC_RUNNING || (btree)->sync_session == (session) || \
+      WT_SESSION_BTREE_SYNC_HELPER(session, btree))
 
     wt_shared uint64_t bytes_dirty_intl;  /* Bytes in dirty internal pages. */
     wt_shared uint64_t bytes_dirty_leaf;  /* Bytes in dirty leaf pages. */
@@ -19,6 +19,9 @@
 #define WT_ALIGNED_16(p) (((uintptr_t)(p)&0x0f) == 0)
 #define WT_VECTOR_SIZE 16 /* chunk size */
 
+/* Minimum length worth calling the CPU-specific (AVX2, AVX-512) comparison function. */
+#define WT_VECTOR_WIDE_MIN 64
+
 /*
  * __wt_lex_compare --
  *     Lexicographic comparison routine. Returns: < 0 if user_item is lexicographically < tree_item,
@@ -40,8 +43,16 @@ __wt_lex_compare(const WT_ITEM *user_item, const WT_ITEM *tree_item)
     treep = (const uint8_t *)tree_item->data;
 
 #ifdef HAVE_X86INTRIN_H
-    /* Use vector instructions if we'll execute at least 2 of them. */
-    if (len >= WT_VECTOR_SIZE * 2) {
+    /* Long keys use the widest vector instructions the CPU supports. */
+    if (len >= WT_VECTOR_WIDE_MIN) {
+        size_t match;
+
+        match = __wt_lex_match(userp, treep, len);
+        len -= match;
+        userp += match;
+        treep += match;
+    } else if (len >= WT_VECTOR_SIZE * 2) {
+        /* Use vector instructions if we'll execute at least 2 of them. */
         size_t remain;
         __m128i res_eq, u, t;
 
@@ -187,8 +198,17 @@ __wt_lex_compare_skip(
     treep = (const uint8_t *)tree_item->data + *matchp;
 
 #ifdef HAVE_X86INTRIN_H
-    /* Use vector instructions if we'll execute at least 2 of them. */
-    if (len >= WT_VECTOR_SIZE * 2) {
+    /* Long keys use the widest vector instructions the CPU supports. */
+    if (len >= WT_VECTOR_WIDE_MIN) {
+        size_t match;
+
+        match = __wt_lex_match(userp, treep, len);
+        len -= match;
+        userp += match;
+        treep += match;
+        *matchp += match;
+    } else if (len >= WT_VECTOR_SIZE * 2) {
+        /* Use vector instructions if we'll execute at least 2 of them. */
         size_t remain;
         __m128i res_eq, u, t;
 
@@ -366,3 +386,24 @@ __wt_lex_compare_short(const WT_ITEM *user_item, const WT_ITEM *tree_item)
     }
     return (*userp < *treep ? -1 : 1);
 }
+
+/*
+ * __wt_lex_prefix --
+ *     Return a key's fixed-width prefix: the 8 bytes following the skipped bytes, zero-padded, read
+ *     big-endian with the sign bit flipped, so signed comparisons of prefixes order keys the same as
+ *     lexicographic comparisons of the keys, except that keys with equal prefixes may differ.
+ */
+static inline int64_t
+__wt_lex_prefix(const void *data, size_t size, size_t skip)
+{
+    size_t i;
+    uint64_t v;
+    const uint8_t *p;
+
+    v = 0;
+    p = (const uint8_t *)data + skip;
+    size = size > skip ? WT_MIN(size - skip, sizeof(uint64_t)) : 0;
+    for (i = 0; i < size; ++i)
+        v |= (uint64_t)p[i] << (8 * (7 - i));
+    return ((int64_t)(v ^ ((uint64_t)1 << 63)));
+}
@@ -183,6 +183,19 @@ __wt_btree_block_free(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr
     return (bm->free(bm, session, addr, addr_size));
 }
 
+/*
+ * __wt_btree_compressor --
+ *     Return the compressor for a disk page type, internal and leaf pages can be configured with
+ *     different compressors.
+ */
+static inline WT_COMPRESSOR *
+__wt_btree_compressor(WT_BTREE *btree, uint8_t type)
+{
+    if (type == WT_PAGE_COL_INT || type == WT_PAGE_ROW_INT)
+        return (btree->intl_compressor);
+    return (btree->compressor);
+}
+
 /*
  * __wt_btree_bytes_inuse --
  *     Return the number of bytes in use.
@@ -1609,7 +1622,7 @@ __wt_ref_block_free(WT_SESSION_IMPL *session, WT_REF *ref)
     WT_ERR(__wt_btree_block_free(session, addr.addr, addr.size));
 
     /* Clear the address (so we don't free it twice). */
-    __wt_ref_addr_free(session, ref);
+    __wt_ref_addr_free(session, ref, true);
 
 err:
     WT_LEAVE_GENERATION(session, WT_GEN_SPLIT);
@@ -1725,6 +1738,13 @@ __wt_btree_syncing_by_other_session(WT_SESSION_IMPL *session)
     return (WT_BTREE_SYNCING(btree) && !WT_SESSION_BTREE_SYNC(session));
 }
 
+/*
+ * Pages are contended once threads modifying them have retried this many compare-and-swap
+ * operations or restarted this many insert list searches since the page was last reconciled.
+ * Contended pages are checked for an in-memory split every time they see this many more.
+ */
+#define WT_PAGE_CONTENTION_SPLIT 1000
+
 /*
  * __wt_leaf_page_can_split --
  *     Check whether a page can be split in memory.
@@ -1737,6 +1757,7 @@ __wt_leaf_page_can_split(WT_SESSION_IMPL *session, WT_PAGE *page)
     WT_INSERT_HEAD *ins_head;
     size_t size, mem_split_threshold;
     int count;
+    bool contended;
 
     btree = S2BT(session);
 
@@ -1763,8 +1784,13 @@ __wt_leaf_page_can_split(WT_SESSION_IMPL *session, WT_PAGE *page)
      * Ignore anything other than large, dirty leaf pages. We depend on the page being dirty for
      * correctness (the page must be reconciled again before being evicted after the split,
      * information from a previous reconciliation will be wrong, so we can't evict immediately).
+     *
+     * Pages where threads are racing to modify the last skiplist don't have to be large: splitting
+     * moves the skiplist onto its own page, the racing threads aren't helped by waiting for the
+     * page to grow.
      */
-    if (page->memory_footprint < btree->splitmempage)
+    contended = page->modify != NULL && page->modify->contention >= WT_PAGE_CONTENTION_SPLIT;
+    if (page->memory_footprint < btree->splitmempage && !contended)
         return (false);
     if (WT_PAGE_IS_INTERNAL(page))
         return (false);
@@ -1821,7 +1847,7 @@ __wt_leaf_page_can_split(WT_SESSION_IMPL *session, WT_PAGE *page)
          * background thread.
          */
         mem_split_threshold = (size_t)WT_MIN(btree->maxleafpage, btree->splitmempage);
-        if (count > WT_MIN_SPLIT_COUNT && size > mem_split_threshold) {
+        if (count > WT_MIN_SPLIT_COUNT && (contended || size > mem_split_threshold)) {
             WT_STAT_CONN_DATA_INCR(session, cache_inmem_splittable);
             return (true);
         }
@@ -1829,6 +1855,47 @@ __wt_leaf_page_can_split(WT_SESSION_IMPL *session, WT_PAGE *page)
     return (false);
 }
 
+/*
+ * __wt_page_contention_check --
+ *     Queue a contended leaf page for an in-memory split, if it can split.
+ */
+static inline void
+__wt_page_contention_check(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+    WT_BTREE *btree;
+    WT_PAGE *page;
+    WT_PAGE_MODIFY *mod;
+    uint32_t contention;
+
+    btree = S2BT(session);
+    page = ref->page;
+    mod = page->modify;
+
+    /*
+     * The counts are approximate: racing threads can check the page more than once, and a check
+     * racing with reconciliation resetting the counts at worst delays the next check until the page
+     * is reconciled again.
+     */
+    contention = mod->contention;
+    if (contention < mod->contention_checked + WT_PAGE_CONTENTION_SPLIT)
+        return;
+    mod->contention_checked = contention;
+    if (contention > btree->contention_max)
+        btree->contention_max = contention;
+
+    /*
+     * The split happens when a thread releases the page: that's typically the thread that got us
+     * here, and it doesn't wait for the page to be reconciled.
+     */
+    if (!__wt_leaf_page_can_split(session, page))
+        return;
+    WT_STAT_CONN_DATA_INCR(session, cache_inmem_split_contended);
+    __wt_verbose(session, WT_VERB_SPLIT,
+      "%p: contended page queued for in-memory split, %" PRIu32 " retries", (void *)ref,
+      contention);
+    __wt_page_evict_soon(session, ref);
+}
+
 /*
  * __wt_page_evict_retry --
  *     Avoid busy-spinning attempting to evict the same page all the time.
@@ -30,9 +30,6 @@ struct __wt_evict_entry {
     uint64_t score;  /* Relative eviction priority */
 };
 
-#define WT_EVICT_QUEUE_MAX 3    /* Two ordinary queues plus urgent */
-#define WT_EVICT_URGENT_QUEUE 2 /* Urgent queue index */
-
 /*
  * WT_EVICT_QUEUE --
  *	Encapsulation of an eviction candidate queue.
@@ -46,6 +43,24 @@ struct __wt_evict_queue {
     wt_shared volatile uint32_t evict_max; /* LRU maximum eviction slot used */
 };
 
+/*
+ * WT_EVICT_SHARD --
+ *	A shard of the ordinary eviction queues: a pair of queues, one being consumed while the
+ *	eviction server fills the other. Threads evict from their own shard and move to the other
+ *	shards when it is empty.
+ */
+struct __wt_evict_shard {
+    WT_SPINLOCK evict_queue_lock;        /* Eviction current queue lock */
+    WT_EVICT_QUEUE *evict_current_queue; /* LRU current queue in use */
+    WT_EVICT_QUEUE *evict_fill_queue;    /* LRU next queue to fill.
+                                            This is usually the same as the
+                                            "other" queue but under heavy
+                                            load the eviction server will
+                                            start filling the current queue
+                                            before it switches. */
+    WT_EVICT_QUEUE *evict_other_queue;   /* LRU queue not in use */
+};
+
 /* Cache operations. */
 typedef enum __wt_cache_op {
     WT_SYNC_CHECKPOINT,
@@ -160,18 +175,14 @@ struct __wt_cache {
     WT_SESSION_IMPL *walk_session; /* Eviction pass session */
     WT_DATA_HANDLE *walk_tree;     /* LRU walk current tree */
 
-    WT_SPINLOCK evict_queue_lock; /* Eviction current queue lock */
-    WT_EVICT_QUEUE evict_queues[WT_EVICT_QUEUE_MAX];
-    WT_EVICT_QUEUE *evict_current_queue; /* LRU current queue in use */
-    WT_EVICT_QUEUE *evict_fill_queue;    /* LRU next queue to fill.
-                                            This is usually the same as the
-                                            "other" queue but under heavy
-                                            load the eviction server will
-                                            start filling the current queue
-                                            before it switches. */
-    WT_EVICT_QUEUE *evict_other_queue;   /* LRU queue not in use */
-    WT_EVICT_QUEUE *evict_urgent_queue;  /* LRU urgent queue */
-    uint32_t evict_slots;                /* LRU list eviction slots */
+    WT_SPINLOCK evict_queue_lock;       /* Eviction queue list lock */
+    WT_EVICT_QUEUE *evict_queues;       /* Shard queues, then the urgent queue */
+    u_int evict_queue_count;            /* Number of eviction queues */
+    WT_EVICT_SHARD *evict_shards;       /* Ordinary queue shards */
+    u_int evict_shard_count;            /* Number of queue shards */
+    u_int evict_fill_shard;             /* Next shard to fill */
+    WT_EVICT_QUEUE *evict_urgent_queue; /* LRU urgent queue */
+    uint32_t evict_slots;               /* LRU list eviction slots */
 
 #define WT_EVICT_SCORE_BUMP 10
 #define WT_EVICT_SCORE_CUTOFF 10
@@ -25,6 +25,11 @@ struct __wt_process {
 #define __wt_checksum_with_seed(seed, chunk, len) __wt_process.checksum_with_seed(seed, chunk, len)
     uint32_t (*checksum_with_seed)(uint32_t, const void *, size_t);
 
+#define __wt_lex_match(userp, treep, len) __wt_process.lex_match(userp, treep, len)
+    size_t (*lex_match)(const uint8_t *, const uint8_t *, size_t);
+#define __wt_prefix_count(slot, entries, key) __wt_process.prefix_count(slot, entries, key)
+    uint32_t (*prefix_count)(const int64_t *, uint32_t, int64_t);
+
 #define WT_TSC_DEFAULT_RATIO 1.0
     double tsc_nsec_ratio; /* rdtsc ticks to nanoseconds */
     bool use_epochtime;    /* use expensive time */
@@ -246,11 +251,21 @@ struct __wt_name_flag {
  * Macros to ensure the dhandle is inserted or removed from both the main queue and the hashed
  * queue.
  */
+/*
+ * Handles are found in the hash lists without locking: link the handle into its hash list before
+ * publishing it at the head of the list. Removing a handle only swaps a single pointer, lookups
+ * already on the handle continue down the list through its unchanged next pointer.
+ */
 #define WT_CONN_DHANDLE_INSERT(conn, dhandle, bucket)                                            \
     do {                                                                                         \
         WT_ASSERT(session, FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_WRITE)); \
         TAILQ_INSERT_HEAD(&(conn)->dhqh, dhandle, q);                                            \
-        TAILQ_INSERT_HEAD(&(conn)->dhhash[bucket], dhandle, hashq);                              \
+        if ((TAILQ_NEXT(dhandle, hashq) = TAILQ_FIRST(&(conn)->dhhash[bucket])) != NULL)         \
+            TAILQ_FIRST(&(conn)->dhhash[bucket])->hashq.tqe_prev = &TAILQ_NEXT(dhandle, hashq);  \
+        else                                                                                     \
+            (conn)->dhhash[bucket].tqh_last = &TAILQ_NEXT(dhandle, hashq);                       \
+        (dhandle)->hashq.tqe_prev = &TAILQ_FIRST(&(conn)->dhhash[bucket]);                       \
+        WT_PUBLISH(TAILQ_FIRST(&(conn)->dhhash[bucket]), dhandle);                               \
         ++(conn)->dh_bucket_count[bucket];                                                       \
         ++(conn)->dhandle_count;                                                                 \
     } while (0)
@@ -421,6 +436,15 @@ struct __wt_connection_impl {
     TAILQ_HEAD(__wt_blockhash, __wt_block) * blockhash;
     TAILQ_HEAD(__wt_block_qh, __wt_block) blockqh;
 
+    /*
+     * Cached cursors left behind by closed sessions, available to be adopted by any session. The
+     * hash table key is the cursor's URI hash, the same key used by the session cursor caches.
+     */
+    WT_SPINLOCK cursor_pool_lock;         /* Locked: cursor pool */
+    WT_CURSOR_LIST *cursor_pool;          /* Locked: hash table of pooled cursors */
+    wt_shared uint32_t cursor_pool_count; /* Locked: pooled cursor count */
+    uint32_t cursor_pool_max;             /* Maximum pooled cursors */
+
     WT_BLKCACHE blkcache;     /* Block cache */
     WT_CHUNKCACHE chunkcache; /* Chunk cache */
 
@@ -507,6 +531,26 @@ struct __wt_connection_impl {
     uint64_t ckpt_write_bytes;
     uint64_t ckpt_write_pages;
 
+    /*
+     * Checkpoint helper threads: the thread writing a tree queues dirty leaf pages, helpers
+     * reconcile them in parallel using a copy of the checkpoint's transaction.
+     */
+    WT_THREAD_GROUP ckpt_helper_threads;
+    uint32_t ckpt_helper_threads_num;    /* Configured helper threads */
+    WT_SPINLOCK ckpt_helper_lock;        /* Helper queue lock */
+    WT_SESSION_IMPL *ckpt_helper_owner;  /* Session queueing pages */
+    WT_DATA_HANDLE *ckpt_helper_dhandle; /* Tree being written */
+    WT_TXN *ckpt_helper_txn;             /* Copy of the checkpoint transaction */
+    wt_timestamp_t ckpt_helper_read_ts;  /* Checkpoint read timestamp */
+    uint32_t ckpt_helper_rec_flags;      /* Reconciliation flags */
+    WT_REF **ckpt_helper_queue;          /* Queued leaf pages */
+    size_t ckpt_helper_queue_alloc;
+    uint32_t ckpt_helper_queue_max;            /* Queue depth before the owner drains */
+    wt_shared uint32_t ckpt_helper_queue_cnt;  /* Queued pages */
+    wt_shared uint32_t ckpt_helper_queue_next; /* Next page to reconcile */
+    wt_shared uint32_t ckpt_helper_busy;       /* Pages being reconciled */
+    int ckpt_helper_ret;                       /* First helper error */
+
     /* Record the important timestamps of each stage in recovery. */
     struct __wt_recovery_timeline {
         uint64_t log_replay_ms;
@@ -539,8 +583,9 @@ struct __wt_connection_impl {
     uint64_t
       rec_maximum_image_build_milliseconds; /* Maximum milliseconds building disk image took. */
     uint64_t rec_maximum_milliseconds;      /* Maximum milliseconds reconciliation took. */
-    WT_CONNECTION_STATS *stats[WT_COUNTER_SLOTS];
+    WT_CONNECTION_STATS **stats;
     WT_CONNECTION_STATS *stat_array;
+    u_int stat_slots; /* Statistics slots, sized from the CPU count */
 
     WT_CAPACITY capacity;              /* Capacity structure */
     WT_SESSION_IMPL *capacity_session; /* Capacity thread session */
@@ -571,6 +616,7 @@ struct __wt_connection_impl {
     TAILQ_HEAD(__wt_pf_qh, __wt_prefetch_queue_entry) pfqh; /* Locked: prefetch_lock */
     bool prefetch_auto_on;
     bool prefetch_available;
+    u_int prefetch_io_depth; /* Asynchronous reads in flight per pre-fetch thread */
 
 #define WT_STATLOG_FILENAME "WiredTigerStat.%d.%H"
     WT_SESSION_IMPL *stat_session; /* Statistics log session */
@@ -598,6 +644,12 @@ struct __wt_connection_impl {
     uint32_t flush_state;            /* State of last flush tier */
     wt_timestamp_t flush_ts;         /* Timestamp of most recent flush_tier */
 
+    WT_THREAD_GROUP tiered_flush_threads; /* Tiered flush threads */
+    uint32_t tiered_flush_threads_num;    /* Configured flush threads */
+    uint64_t tiered_flush_part_size;      /* Multi-part upload part size */
+    /* Multi-part uploads in progress, protected by the tiered lock. */
+    TAILQ_HEAD(__wt_tiered_flushqh, __wt_tiered_flush_job) tiered_flushqh;
+
     WT_SESSION_IMPL *chunkcache_metadata_session; /* Chunk cache metadata server thread session */
     wt_thread_t chunkcache_metadata_tid;          /* Chunk cache metadata thread */
     bool chunkcache_metadata_tid_set;             /* Chunk cache metadata thread set */
@@ -632,6 +684,7 @@ struct __wt_connection_impl {
     bool log_wrlsn_tid_set;                /* Log write lsn thread set */
     WT_LOG *log;                           /* Logging structure */
     WT_COMPRESSOR *log_compressor;         /* Logging compressor */
+    uint32_t log_compress_dict;            /* Logging compression dictionary size */
     wt_shared uint32_t log_cursors;        /* Log cursor count */
     wt_off_t log_dirty_max;                /* Log dirty system cache max size */
     wt_off_t log_file_max;                 /* Log file max size */
@@ -640,6 +693,7 @@ struct __wt_connection_impl {
     uint32_t log_prealloc;                 /* Log file pre-allocation */
     uint16_t log_req_max;                  /* Max required log version */
     uint16_t log_req_min;                  /* Min required log version */
+    uint32_t log_slot_consolidation;       /* Log slot join sub-slots */
     wt_shared uint32_t txn_logsync;        /* Log sync configuration */
 
     WT_ROLLBACK_TO_STABLE *rts, _rts;   /* Rollback to stable subsystem */
@@ -803,13 +857,15 @@ struct __wt_connection_impl {
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
 #define WT_CONN_SERVER_CAPACITY 0x001u
 #define WT_CONN_SERVER_CHECKPOINT 0x002u
-#define WT_CONN_SERVER_CHUNKCACHE_METADATA 0x004u
-#define WT_CONN_SERVER_COMPACT 0x008u
-#define WT_CONN_SERVER_LOG 0x010u
-#define WT_CONN_SERVER_LSM 0x020u
-#define WT_CONN_SERVER_STATISTICS 0x040u
-#define WT_CONN_SERVER_SWEEP 0x080u
-#define WT_CONN_SERVER_TIERED 0x100u
+#define WT_CONN_SERVER_CHECKPOINT_HELPER 0x004u
+#define WT_CONN_SERVER_CHUNKCACHE_METADATA 0x008u
+#define WT_CONN_SERVER_COMPACT 0x010u
+#define WT_CONN_SERVER_LOG 0x020u
+#define WT_CONN_SERVER_LSM 0x040u
+#define WT_CONN_SERVER_STATISTICS 0x080u
+#define WT_CONN_SERVER_SWEEP 0x100u
+#define WT_CONN_SERVER_TIERED 0x200u
+#define WT_CONN_SERVER_TIERED_FLUSH 0x400u
     /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
     uint32_t server_flags;
 
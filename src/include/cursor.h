@@ -13,16 +13,18 @@
  * Initialize a static WT_CURSOR structure.
  */
 #define WT_CURSOR_STATIC_INIT(n, get_key, get_value, get_raw_key_value, set_key, set_value,      \
-  compare, equals, next, prev, reset, search, search_near, insert, modify, update, remove,       \
-  reserve, reconfigure, largest_key, bound, cache, reopen, checkpoint_id, close)                 \
+  compare, equals, next, prev, reset, search, search_near, search_batch, insert, insert_batch,   \
+  modify, update, remove, reserve, reconfigure, largest_key, bound, cache, reopen,               \
+  checkpoint_id, close)                                                                          \
     static const WT_CURSOR n = {                                                                 \
       NULL, /* session */                                                                        \
       NULL, /* uri */                                                                            \
       NULL, /* key_format */                                                                     \
       NULL, /* value_format */                                                                   \
       get_key, get_value, get_raw_key_value, set_key, set_value, compare, equals, next, prev,    \
-      reset, search, search_near, insert, modify, update, remove, reserve, checkpoint_id, close, \
-      largest_key, reconfigure, bound, cache, reopen, 0, /* uri_hash */                          \
+      reset, search, search_near, search_batch, insert, insert_batch, modify, update, remove,    \
+      reserve, checkpoint_id, close, largest_key, reconfigure, bound, cache, reopen,             \
+      0, /* uri_hash */                                                                          \
       {NULL, NULL},                                      /* TAILQ_ENTRY q */                     \
       0,                                                 /* recno key */                         \
       {0},                                               /* recno raw buffer */                  \
@@ -34,6 +36,7 @@
       NULL,                                              /* internal_uri */                      \
       {NULL, 0, NULL, 0, 0},                             /* WT_ITEM lower bound */               \
       {NULL, 0, NULL, 0, 0},                             /* WT_ITEM upper bound */               \
+      {NULL, 0, NULL, 0, 0},                             /* WT_ITEM batch values */              \
       0                                                  /* uint32_t flags */                    \
     }
 
@@ -256,8 +259,9 @@ struct __wt_cursor_btree {
 #define WT_CBT_ITERATE_RETRY_NEXT 0x020u /* Prepare conflict by next. */
 #define WT_CBT_ITERATE_RETRY_PREV 0x040u /* Prepare conflict by prev. */
 #define WT_CBT_READ_ONCE 0x080u          /* Page in with WT_READ_WONT_NEED */
-#define WT_CBT_SEARCH_SMALLEST 0x100u    /* Row-store: small-key insert list */
-#define WT_CBT_VAR_ONPAGE_MATCH 0x200u   /* Var-store: on-page recno match */
+#define WT_CBT_SEARCH_EXACT 0x100u       /* Row-store: exact-match search */
+#define WT_CBT_SEARCH_SMALLEST 0x200u    /* Row-store: small-key insert list */
+#define WT_CBT_VAR_ONPAGE_MATCH 0x400u   /* Var-store: on-page recno match */
     /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
 
 #define WT_CBT_POSITION_MASK /* Flags associated with position */                      \
@@ -95,11 +95,12 @@ struct __wt_data_handle {
      * references; sessions using a connection's data handle will have a non-zero in-use count.
      * Instances of cached cursors referencing the data handle appear in session_cache_ref.
      */
-    wt_shared uint32_t references;   /* References to this handle */
-    wt_shared int32_t session_inuse; /* Sessions using this handle */
-    uint32_t excl_ref;               /* Refs of handle by excl_session */
-    uint64_t timeofdeath;            /* Use count went to 0 */
-    WT_SESSION_IMPL *excl_session;   /* Session with exclusive use, if any */
+    wt_shared uint32_t references;    /* References to this handle */
+    wt_shared int32_t session_inuse;  /* Sessions using this handle */
+    wt_shared volatile bool removing; /* Handle is being removed from the list */
+    uint32_t excl_ref;                /* Refs of handle by excl_session */
+    uint64_t timeofdeath;             /* Use count went to 0 */
+    WT_SESSION_IMPL *excl_session;    /* Session with exclusive use, if any */
 
     WT_DATA_SOURCE *dsrc; /* Data source for this handle */
     void *handle;         /* Generic handle */
@@ -124,7 +125,7 @@ struct __wt_data_handle {
     WT_SPINLOCK close_lock; /* Lock to close the handle */
 
     /* Data-source statistics */
-    WT_DSRC_STATS *stats[WT_COUNTER_SLOTS];
+    WT_DSRC_STATS *stats[WT_COUNTER_SLOTS + 1]; /* NULL-terminated */
     WT_DSRC_STATS *stat_array;
 
 /*
@@ -15,10 +15,11 @@
 /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
 
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
-#define WT_LOG_DSYNC 0x1u
-#define WT_LOG_FLUSH 0x2u
-#define WT_LOG_FSYNC 0x4u
-#define WT_LOG_SYNC_ENABLED 0x8u
+#define WT_LOG_BACKGROUND 0x01u
+#define WT_LOG_DSYNC 0x02u
+#define WT_LOG_FLUSH 0x04u
+#define WT_LOG_FSYNC 0x08u
+#define WT_LOG_SYNC_ENABLED 0x10u
 /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
 
 #define WT_LOGOP_IGNORE 0x80000000
@@ -211,6 +212,35 @@ struct __wt_logslot {
 
 #define WT_SLOT_INIT_FLAGS 0
 
+/*
+ * Join consolidation sub-slots. When configured, threads writing log records first join a sub-slot
+ * chosen by the CPU they are running on. The first thread to join an empty sub-slot leads the
+ * group: it joins the active slot once for the combined size of every thread that joined the
+ * sub-slot in the meantime, then publishes the slot and the group's starting offset so the other
+ * threads can copy their records without touching the active slot's state.
+ *
+ * The sub-slot state packs a generation number (high 24 bits), the count of threads in the current
+ * group (next 8 bits) and the group's combined size (low 32 bits).
+ */
+#define WT_LOG_SUBSLOT_GROUP_MAX 32
+#define WT_LOG_SUBSLOT_GEN_MASK 0xffffffu
+#define WT_LOG_SUBSLOT_GEN(state) ((uint32_t)((state) >> 40))
+#define WT_LOG_SUBSLOT_COUNT(state) ((uint32_t)(((state) >> 32) & 0xff))
+#define WT_LOG_SUBSLOT_SIZE(state) ((uint32_t)((state)&UINT32_MAX))
+#define WT_LOG_SUBSLOT_STATE(gen, count, size)                                         \
+    ((((uint64_t)(gen)&WT_LOG_SUBSLOT_GEN_MASK) << 40) | ((uint64_t)(count) << 32) | \
+      (uint64_t)(size))
+
+struct __wt_log_subslot {
+    WT_CACHE_LINE_PAD_BEGIN
+    wt_shared volatile uint64_t state;    /* Generation, group count and size */
+    wt_shared volatile uint32_t done_gen; /* Last generation published */
+    wt_shared volatile uint32_t readers;  /* Group members yet to read result */
+    WT_LOGSLOT *slot;                     /* Slot the group joined */
+    int32_t offset;                       /* Group's offset in the slot */
+    WT_CACHE_LINE_PAD_END
+};
+
 #define WT_SLOT_SYNC_FLAGS (WT_SLOT_SYNC | WT_SLOT_SYNC_DIR | WT_SLOT_SYNC_DIRTY)
 
 #define WT_WITH_SLOT_LOCK(session, log, op)                                            \
@@ -234,9 +264,22 @@ struct __wt_myslot {
 
 #define WT_LOG_END_HEADER log->allocsize
 
+/*
+ * WT_LOG_DICT --
+ *     A log compression dictionary. Each log file starts with the current and previous
+ *     dictionaries, a dictionary is only replaced once no writer can still place a record
+ *     compressed with it into a new log file.
+ */
+struct __wt_log_dict {
+    WT_ITEM dict;                     /* Dictionary */
+    uint64_t gen;                     /* Dictionary generation */
+    wt_shared volatile uint32_t refs; /* Writers compressing with the dictionary */
+};
+
 struct __wt_log {
     uint32_t allocsize;             /* Allocation alignment size */
     uint32_t first_record;          /* Offset of first record in file */
+    uint32_t first_alloc;           /* Offset of first allocation in current file */
     wt_off_t log_written;           /* Amount of log written this period */
                                     /*
                                      * Log file information
@@ -256,6 +299,7 @@ struct __wt_log {
      * System LSNs
      */
     WT_LSN alloc_lsn;       /* Next LSN for allocation */
+    WT_LSN bg_sync_lsn;     /* Latest background sync LSN */
     WT_LSN ckpt_lsn;        /* Last checkpoint LSN */
     WT_LSN dirty_lsn;       /* LSN of last non-synced write */
     WT_LSN first_lsn;       /* First LSN */
@@ -268,6 +312,7 @@ struct __wt_log {
     /*
      * Synchronization resources
      */
+    WT_SPINLOCK log_dict_lock;     /* Locked: Compression dictionary sample */
     WT_SPINLOCK log_lock;          /* Locked: Logging fields */
     WT_SPINLOCK log_fs_lock;       /* Locked: tmp, prep and log files */
     WT_SPINLOCK log_slot_lock;     /* Locked: Consolidation array */
@@ -293,6 +338,18 @@ struct __wt_log {
     wt_shared WT_LOGSLOT slot_pool[WT_SLOT_POOL]; /* Pool of all slots */
     int32_t pool_index;                           /* Index into slot pool */
     size_t slot_buf_size;                         /* Buffer size for slots */
+
+    WT_LOG_SUBSLOT *subslots; /* Join consolidation sub-slots */
+    uint32_t subslot_count;   /* Count of sub-slots */
+
+    /*
+     * Compression dictionaries, indexed by the parity of their generation. Writers sample records
+     * into the next dictionary, it replaces the oldest one when a new log file is created.
+     */
+    WT_LOG_DICT dict[2];             /* Current and previous dictionaries */
+    wt_shared uint64_t dict_gen;     /* Current dictionary generation */
+    WT_ITEM dict_sample;             /* Records sampled for the next dictionary */
+    wt_shared bool dict_sample_full; /* Sample is complete */
 #ifdef HAVE_DIAGNOSTIC
     uint64_t write_calls; /* Calls to log_write */
 #endif
@@ -315,9 +372,13 @@ struct __wt_log_record {
  * Unused bits in the flags, as well as the 'unused' padding, are expected to be zeroed; we check
  * that to help detect file corruption.
  */
-#define WT_LOG_RECORD_COMPRESSED 0x01u /* Compressed except hdr */
-#define WT_LOG_RECORD_ENCRYPTED 0x02u  /* Encrypted except hdr */
-#define WT_LOG_RECORD_ALL_FLAGS (WT_LOG_RECORD_COMPRESSED | WT_LOG_RECORD_ENCRYPTED)
+#define WT_LOG_RECORD_COMPRESSED 0x01u     /* Compressed except hdr */
+#define WT_LOG_RECORD_ENCRYPTED 0x02u      /* Encrypted except hdr */
+#define WT_LOG_RECORD_DICTIONARY 0x04u     /* Compressed with the file's dictionary */
+#define WT_LOG_RECORD_DICTIONARY_ODD 0x08u /* Dictionary generation is odd */
+#define WT_LOG_RECORD_ALL_FLAGS                                                       \
+    (WT_LOG_RECORD_COMPRESSED | WT_LOG_RECORD_ENCRYPTED | WT_LOG_RECORD_DICTIONARY | \
+      WT_LOG_RECORD_DICTIONARY_ODD)
     uint16_t flags;    /* 08-09: Flags */
     uint8_t unused[2]; /* 10-11: Padding */
     uint32_t mem_len;  /* 12-15: Uncompressed len if needed */
@@ -352,9 +413,9 @@ struct __wt_log_desc {
                          * NOTE: We bumped the log version from 2 to 3 to make it convenient for
                          * MongoDB to detect users accidentally running old binaries on a newer
                          * release. There are no actual log file format changes in versions 2
-                         * through 5.
+                         * through 5. Version 6 added records compressed with a dictionary.
                          */
-#define WT_LOG_VERSION 5
+#define WT_LOG_VERSION 6
     uint16_t version;  /* 04-05: Log version */
     uint16_t unused;   /* 06-07: Unused */
     uint64_t log_size; /* 08-15: Log file size */
@@ -374,6 +435,7 @@ struct __wt_log_desc {
 #define WT_LOG_V3_VERSION ((WT_VERSION){3, 1, 0})
 #define WT_LOG_V4_VERSION ((WT_VERSION){3, 3, 0})
 #define WT_LOG_V5_VERSION ((WT_VERSION){10, 0, 0})
+#define WT_LOG_V6_VERSION ((WT_VERSION){11, 3, 0})
 
 /*
  * __wt_log_desc_byteswap --
@@ -173,6 +173,26 @@ __wt_snprintf_len_incr(char *buf, size_t size, size_t *retsizep, const char *fmt
     return (ret);
 }
 
+/*
+ * __wt_stat_bucket_set --
+ *     Choose the session's statistics buckets from the CPU it's running on, or its ID if the CPU
+ *     can't be determined. Unless forced, only recalculate the buckets if the CPU changed.
+ */
+static inline void
+__wt_stat_bucket_set(WT_SESSION_IMPL *session, bool force)
+{
+    u_int id;
+
+    if (!__wt_thread_cpu(&id))
+        id = session->id;
+    if (id == session->stat_cpu && !force)
+        return;
+
+    session->stat_cpu = id;
+    session->stat_bucket = WT_STATS_SLOT_ID(id);
+    session->stat_conn_bucket = WT_STATS_CONN_SLOT_ID(S2C(session), id);
+}
+
 /*
  * __wt_spin_backoff --
  *     Back off while spinning for a resource. This is used to avoid busy waiting loops that can
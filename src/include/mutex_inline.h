@@ -372,11 +372,11 @@ __wt_spin_lock_track(WT_SESSION_IMPL *session, WT_SPINLOCK *t)
         time_diff = WT_CLOCKDIFF_US(time_stop, time_start);
         stats = (int64_t **)S2C(session)->stats;
         session_stats = (int64_t *)&(session->stats);
-        stats[session->stat_bucket][t->stat_count_off]++;
+        stats[session->stat_conn_bucket][t->stat_count_off]++;
         if (F_ISSET(session, WT_SESSION_INTERNAL))
-            stats[session->stat_bucket][t->stat_int_usecs_off] += (int64_t)time_diff;
+            stats[session->stat_conn_bucket][t->stat_int_usecs_off] += (int64_t)time_diff;
         else {
-            stats[session->stat_bucket][t->stat_app_usecs_off] += (int64_t)time_diff;
+            stats[session->stat_conn_bucket][t->stat_app_usecs_off] += (int64_t)time_diff;
         }
 
         /*
@@ -401,7 +401,7 @@ __wt_spin_trylock_track(WT_SESSION_IMPL *session, WT_SPINLOCK *t)
     if (t->stat_count_off != -1 && WT_STAT_ENABLED(session)) {
         WT_RET(__wt_spin_trylock(session, t));
         stats = (int64_t **)S2C(session)->stats;
-        stats[session->stat_bucket][t->stat_count_off]++;
+        stats[session->stat_conn_bucket][t->stat_count_off]++;
         return (0);
     }
     return (__wt_spin_trylock(session, t));
@@ -166,6 +166,29 @@ struct __wt_file_handle_inmem {
     u_int ref;   /* Reference count */
 };
 
+/*
+ * WT_IO_URING --
+ *	An asynchronous I/O ring, used to keep several reads in flight from a single thread. Rings are
+ * only supported on Linux, and are owned by a single session: none of the fields are shared.
+ */
+struct __wt_io_uring {
+    int fd; /* Ring file descriptor */
+
+    void *sq_ring, *cq_ring; /* Mapped submission and completion rings */
+    size_t sq_ring_size, cq_ring_size;
+    void *sqes; /* Mapped submission queue entries */
+    size_t sqes_size;
+    void *cqes; /* Completion queue entries, in the completion ring */
+
+    uint32_t *sq_head, *sq_tail, *sq_mask, *sq_array;
+    uint32_t *cq_head, *cq_tail, *cq_mask;
+
+    uint32_t entries;       /* Submission queue entries */
+    uint32_t sq_tail_local; /* Next submission queue slot */
+    uint32_t queued;        /* Entries queued, not yet submitted */
+    uint32_t inflight;      /* Entries submitted, not yet completed */
+};
+
 struct __wt_fstream {
     const char *name; /* Stream name */
 
@@ -279,6 +279,7 @@ struct __wt_reconcile {
 /* Don't increase key prefix-compression unless there's a significant gain. */
 #define WT_KEY_PREFIX_PREVIOUS_MINIMUM 10
     uint8_t key_pfx_last; /* Last prefix compression */
+    u_int key_pfx_run;    /* Keys written since the last restart key */
 
     bool key_pfx_compress;      /* If can prefix-compress next key */
     bool key_pfx_compress_conf; /* If prefix compression configured */
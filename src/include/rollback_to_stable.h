@@ -93,6 +93,7 @@ struct __wt_rollback_to_stable {
 
     /* Configuration. */
     bool dryrun;
+    u_int threads_num; /* Configured worker threads */
 };
 
 /*
@@ -166,6 +166,12 @@ __wt_col_append_serial(WT_SESSION_IMPL *session, WT_PAGE *page, WT_INSERT_HEAD *
         WT_PAGE_UNLOCK(session, page);
 
     if (ret != 0) {
+        /* Count lost races for the insert position, the caller restarts its search. */
+        if (ret == WT_RESTART) {
+            WT_STAT_CONN_DATA_INCR(session, cursor_insert_list_restart);
+            (void)__wt_atomic_add32(&page->modify->contention, 1);
+        }
+
         /* Free unused memory on error. */
         __wt_free(session, new_ins);
         return (ret);
@@ -218,6 +224,12 @@ __wt_insert_serial(WT_SESSION_IMPL *session, WT_PAGE *page, WT_INSERT_HEAD *ins_
     }
 
     if (ret != 0) {
+        /* Count lost races for the insert position, the caller restarts its search. */
+        if (ret == WT_RESTART) {
+            WT_STAT_CONN_DATA_INCR(session, cursor_insert_list_restart);
+            (void)__wt_atomic_add32(&page->modify->contention, 1);
+        }
+
         /* Free unused memory on error. */
         __wt_free(session, new_ins);
         return (ret);
@@ -265,6 +277,8 @@ __wt_update_serial(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_PAGE *page
      * Check if our update is still permitted.
      */
     while (!__wt_atomic_cas_ptr(srch_upd, upd->next, upd)) {
+        WT_STAT_CONN_DATA_INCR(session, cursor_update_cas_retry);
+        (void)__wt_atomic_add32(&page->modify->contention, 1);
         if ((ret = __wt_txn_modify_check(
                session, cbt, upd->next = *srch_upd, &prev_upd_ts, upd->type)) != 0) {
             /* Free unused memory on error. */
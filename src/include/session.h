@@ -55,6 +55,11 @@ struct __wt_prefetch {
     WT_PAGE *prefetch_prev_ref_home;
     uint64_t prefetch_disk_read_count; /* Sequential cache requests that caused a leaf read */
     uint64_t prefetch_skipped_with_parent;
+
+    /* Asynchronous reads, pre-fetch threads only. */
+    WT_IO_URING *io_uring;
+    WT_PREFETCH_READ *io_reads;  /* Array of connection's pre-fetch I/O depth reads */
+    WT_PREFETCH_READ *io_staged; /* Completed read the next block read can consume */
 };
 
 /* Get the connection implementation for a session */
@@ -86,6 +91,9 @@ typedef TAILQ_HEAD(__wt_cursor_list, __wt_cursor) WT_CURSOR_LIST;
 /* A fake session ID for when we need to refer to a session that is actually NULL. */
 #define WT_SESSION_ID_NULL 0xfffffffe
 
+/* Default time to wait for a background sync, in milliseconds. */
+#define WT_SESSION_BG_SYNC_MSEC 1200000
+
 /*
  * WT_SESSION_IMPL --
  *	Implementation of WT_SESSION.
@@ -113,6 +121,8 @@ struct __wt_session_impl {
     wt_shared WT_DATA_HANDLE *dhandle; /* Current data handle */
     WT_BUCKET_STORAGE *bucket_storage; /* Current bucket storage and file system */
 
+    WT_LSN bg_sync_lsn; /* Background sync operation LSN */
+
     /*
      * Each session keeps a cache of data handles. The set of handles can grow quite large so we
      * maintain both a simple list and a hash table of lists. The hash table key is based on a hash
@@ -243,8 +253,13 @@ struct __wt_session_impl {
     /* Salvage support. */
     void *salvage_track;
 
-    /* Sessions have an associated statistics bucket based on its ID. */
-    u_int stat_bucket;          /* Statistics bucket offset */
+    /*
+     * Sessions have associated statistics buckets based on the CPU they run on, or their ID if the
+     * CPU can't be determined.
+     */
+    u_int stat_cpu;             /* CPU the buckets were chosen for */
+    u_int stat_bucket;          /* Data-source statistics bucket offset */
+    u_int stat_conn_bucket;     /* Connection statistics bucket offset */
     uint64_t cache_max_wait_us; /* Maximum time an operation waits for space in cache */
 
 #ifdef HAVE_DIAGNOSTIC
@@ -288,24 +303,25 @@ struct __wt_session_impl {
 #define WT_SESSION_BACKUP_DUP 0x000002u
 #define WT_SESSION_CACHE_CURSORS 0x000004u
 #define WT_SESSION_CAN_WAIT 0x000008u
-#define WT_SESSION_DEBUG_CHECKPOINT_FAIL_BEFORE_TURTLE_UPDATE 0x000010u
-#define WT_SESSION_DEBUG_DO_NOT_CLEAR_TXN_ID 0x000020u
-#define WT_SESSION_DEBUG_RELEASE_EVICT 0x000040u
-#define WT_SESSION_EVICTION 0x000080u
-#define WT_SESSION_IGNORE_CACHE_SIZE 0x000100u
-#define WT_SESSION_IMPORT 0x000200u
-#define WT_SESSION_IMPORT_REPAIR 0x000400u
-#define WT_SESSION_INTERNAL 0x000800u
-#define WT_SESSION_LOGGING_INMEM 0x001000u
-#define WT_SESSION_NO_DATA_HANDLES 0x002000u
-#define WT_SESSION_NO_RECONCILE 0x004000u
-#define WT_SESSION_PREFETCH_ENABLED 0x008000u
-#define WT_SESSION_PREFETCH_THREAD 0x010000u
-#define WT_SESSION_QUIET_CORRUPT_FILE 0x020000u
-#define WT_SESSION_READ_WONT_NEED 0x040000u
-#define WT_SESSION_RESOLVING_TXN 0x080000u
-#define WT_SESSION_ROLLBACK_TO_STABLE 0x100000u
-#define WT_SESSION_SCHEMA_TXN 0x200000u
+#define WT_SESSION_CHECKPOINT_HELPER 0x000010u
+#define WT_SESSION_DEBUG_CHECKPOINT_FAIL_BEFORE_TURTLE_UPDATE 0x000020u
+#define WT_SESSION_DEBUG_DO_NOT_CLEAR_TXN_ID 0x000040u
+#define WT_SESSION_DEBUG_RELEASE_EVICT 0x000080u
+#define WT_SESSION_EVICTION 0x000100u
+#define WT_SESSION_IGNORE_CACHE_SIZE 0x000200u
+#define WT_SESSION_IMPORT 0x000400u
+#define WT_SESSION_IMPORT_REPAIR 0x000800u
+#define WT_SESSION_INTERNAL 0x001000u
+#define WT_SESSION_LOGGING_INMEM 0x002000u
+#define WT_SESSION_NO_DATA_HANDLES 0x004000u
+#define WT_SESSION_NO_RECONCILE 0x008000u
+#define WT_SESSION_PREFETCH_ENABLED 0x010000u
+#define WT_SESSION_PREFETCH_THREAD 0x020000u
+#define WT_SESSION_QUIET_CORRUPT_FILE 0x040000u
+#define WT_SESSION_READ_WONT_NEED 0x080000u
+#define WT_SESSION_RESOLVING_TXN 0x100000u
+#define WT_SESSION_ROLLBACK_TO_STABLE 0x200000u
+#define WT_SESSION_SCHEMA_TXN 0x400000u
     /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
     uint32_t flags;
 
@@ -332,11 +348,12 @@ struct __wt_session_impl {
 
 /* Generations manager */
 #define WT_GEN_CHECKPOINT 0   /* Checkpoint generation */
-#define WT_GEN_EVICT 1        /* Eviction generation */
-#define WT_GEN_HAS_SNAPSHOT 2 /* Snapshot generation */
-#define WT_GEN_HAZARD 3       /* Hazard pointer */
-#define WT_GEN_SPLIT 4        /* Page splits */
-#define WT_GENERATIONS 5      /* Total generation manager entries */
+#define WT_GEN_DHANDLE 1      /* Data handle list lookups */
+#define WT_GEN_EVICT 2        /* Eviction generation */
+#define WT_GEN_HAS_SNAPSHOT 3 /* Snapshot generation */
+#define WT_GEN_HAZARD 4       /* Hazard pointer */
+#define WT_GEN_SPLIT 5        /* Page splits */
+#define WT_GENERATIONS 6      /* Total generation manager entries */
     wt_shared volatile uint64_t generations[WT_GENERATIONS];
 
     /*
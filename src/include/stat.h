@@ -32,39 +32,35 @@
  *
  * Ideally, if the application running on the system is CPU-intensive, and using all CPUs on the
  * system, we want to use the same number of slots as there are CPUs (because their L1 caches are
- * the units of coherency). However, in practice we cannot easily determine how many CPUs are
- * actually available to the application.
+ * the units of coherency), and we want each thread to update the slot of the CPU it runs on.
  *
- * Our next best option is to use the number of threads in the application as a heuristic for the
- * number of CPUs (presumably, the application architect has figured out how many CPUs are
- * available). However, inside WiredTiger we don't know when the application creates its threads.
- *
- * For now, we use a fixed number of slots. Ideally, we would approximate the largest number of
- * cores we expect on any machine where WiredTiger might be run, however, we don't want to waste
- * that much memory on smaller machines. As of 2015, machines with more than 24 CPUs are relatively
- * rare.
+ * There is a single set of connection statistics and the hottest counters live there, so the
+ * connection sizes its array from the number of CPUs configured on the system when it's created,
+ * bounded below by WT_COUNTER_SLOTS and above by WT_COUNTER_SLOTS_MAX. There can be many
+ * data-source handles, each with its own array, and they use a fixed number of slots so the memory
+ * cost per handle doesn't grow with the size of the machine.
  *
  * Default hash table size; use a prime number of buckets rather than assuming a good hash
  * (Reference Sedgewick, Algorithms in C, "Hash Functions").
  */
 #define WT_COUNTER_SLOTS 23
+#define WT_COUNTER_SLOTS_MAX 256
 
 /*
  * WT_STATS_SLOT_ID is the thread's slot ID for the array of structures.
  *
  * Ideally, we want a slot per CPU, and we want each thread to index the slot corresponding to the
- * CPU it runs on. Unfortunately, getting the ID of the current CPU is difficult: some operating
- * systems provide a system call to acquire a CPU ID, but not all (regardless, making a system call
- * to increment a statistics value is far too expensive).
- *
- * Our second-best option is to use the thread ID. Unfortunately, there is no portable way to obtain
- * a unique thread ID that's a small-enough number to be used as an array index (portable thread IDs
- * are usually a pointer or an opaque chunk, not a simple integer).
+ * CPU it runs on. Where the operating system can cheaply report the current CPU (for example,
+ * Linux's sched_getcpu, which is a per-thread memory read on recent C libraries), sessions index by
+ * it. The CPU is sampled when the session is opened and again at the start of each top-level API
+ * call, rather than on every update; threads rarely migrate, and a stale index only means sharing
+ * a slot for a while, not a lost update.
  *
- * Our solution is to use the session ID; there is normally a session per thread and the session ID
- * is a small, monotonically increasing number.
+ * Otherwise we fall back to the session ID; there is normally a session per thread and the session
+ * ID is a small, monotonically increasing number.
  */
-#define WT_STATS_SLOT_ID(session) (((session)->id) % WT_COUNTER_SLOTS)
+#define WT_STATS_SLOT_ID(id) ((id) % WT_COUNTER_SLOTS)
+#define WT_STATS_CONN_SLOT_ID(conn, id) ((id) % (conn)->stat_slots)
 
 /*
  * Statistic structures are arrays of int64_t's. We have functions to read/write those structures
@@ -89,6 +85,8 @@
 /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
 
 /*
+ * Statistics arrays are NULL-terminated so they can be walked without knowing their size.
+ *
  * Sum the values from all structures in the array.
  */
 static inline int64_t
@@ -98,7 +96,7 @@ __wt_stats_aggregate(void *stats_arg, int slot)
     int i;
 
     stats = (int64_t **)stats_arg;
-    for (aggr_v = 0, i = 0; i < WT_COUNTER_SLOTS; i++)
+    for (aggr_v = 0, i = 0; stats[i] != NULL; i++)
         aggr_v += stats[i][slot];
 
     /*
@@ -129,10 +127,37 @@ __wt_stats_clear(void *stats_arg, int slot)
     int i;
 
     stats = (int64_t **)stats_arg;
-    for (i = 0; i < WT_COUNTER_SLOTS; i++)
+    for (i = 0; stats[i] != NULL; i++)
         stats[i][slot] = 0;
 }
 
+/*
+ * Sum all of the values from all structures in the array into a snapshot structure. Each structure
+ * is read start to finish before moving to the next, which touches each writer's cache lines once
+ * and keeps the window over which any single slot is read short. Writers are never blocked, so
+ * the snapshot has the same isolation as reading each value separately; negative sums are clamped
+ * the same way.
+ */
+static inline void
+__wt_stats_snapshot(void *stats_arg, void *snap_arg, size_t count)
+{
+    int64_t **stats, *snap, *v;
+    size_t j;
+    int i;
+
+    stats = (int64_t **)stats_arg;
+    snap = (int64_t *)snap_arg;
+    memset(snap, 0, count * sizeof(int64_t));
+    for (i = 0; (v = stats[i]) != NULL; i++)
+        for (j = 0; j < count; j++)
+            snap[j] += v[j];
+    for (j = 0; j < count; j++)
+        if (snap[j] < 0)
+            snap[j] = 0;
+}
+#define WT_STATS_SNAPSHOT(stats, snap) \
+    __wt_stats_snapshot(stats, snap, sizeof(*(snap)) / sizeof(int64_t))
+
 /*
  * Read/write statistics if statistics gathering is enabled. Reading and writing the field requires
  * different actions: reading sums the values across the array of structures, writing updates a
@@ -204,15 +229,15 @@ __wt_stats_clear(void *stats_arg, int slot)
  * Update connection handle statistics if statistics gathering is enabled.
  */
 #define WT_STAT_CONN_DECRV(session, fld, value) \
-    WT_STAT_DECRV_BASE(session, S2C(session)->stats[(session)->stat_bucket], fld, value)
+    WT_STAT_DECRV_BASE(session, S2C(session)->stats[(session)->stat_conn_bucket], fld, value)
 #define WT_STAT_CONN_DECR_ATOMIC(session, fld) \
-    WT_STAT_DECRV_ATOMIC_BASE(session, S2C(session)->stats[(session)->stat_bucket], fld, 1)
+    WT_STAT_DECRV_ATOMIC_BASE(session, S2C(session)->stats[(session)->stat_conn_bucket], fld, 1)
 #define WT_STAT_CONN_DECR(session, fld) WT_STAT_CONN_DECRV(session, fld, 1)
 
 #define WT_STAT_CONN_INCRV(session, fld, value) \
-    WT_STAT_INCRV_BASE(session, S2C(session)->stats[(session)->stat_bucket], fld, value)
+    WT_STAT_INCRV_BASE(session, S2C(session)->stats[(session)->stat_conn_bucket], fld, value)
 #define WT_STAT_CONN_INCR_ATOMIC(session, fld) \
-    WT_STAT_INCRV_ATOMIC_BASE(session, S2C(session)->stats[(session)->stat_bucket], fld, 1)
+    WT_STAT_INCRV_ATOMIC_BASE(session, S2C(session)->stats[(session)->stat_conn_bucket], fld, 1)
 #define WT_STAT_CONN_INCR(session, fld) WT_STAT_CONN_INCRV(session, fld, 1)
 
 #define WT_STAT_CONN_SET(session, fld, value) WT_STAT_SET(session, S2C(session)->stats, fld, value)
@@ -311,6 +336,43 @@ __wt_stats_clear(void *stats_arg, int slot)
             WT_STAT_CONN_INCR(session, stat##_gt10000);                                           \
     }
 
+/*
+ * API call latency histograms have log-scale buckets, each 4 times wider than the one before, so
+ * a dozen buckets cover everything from sub-microsecond cursor calls to checkpoints taking seconds.
+ * Percentiles are estimated from the buckets when statistics are read.
+ */
+#define WT_STAT_LATENCY_BUCKETS 12
+#define WT_STAT_LATENCY_HIST_INCR_FUNC(name, stat)              \
+    static inline void __wt_stat_latency_hist_incr_##name(      \
+      WT_SESSION_IMPL *session, uint64_t usecs)                 \
+    {                                                           \
+        WT_STAT_CONN_INCRV(session, stat##_total_usecs, usecs); \
+        if (usecs < 1)                                          \
+            WT_STAT_CONN_INCR(session, stat##_lt1);             \
+        else if (usecs < 4)                                     \
+            WT_STAT_CONN_INCR(session, stat##_lt4);             \
+        else if (usecs < 16)                                    \
+            WT_STAT_CONN_INCR(session, stat##_lt16);            \
+        else if (usecs < 64)                                    \
+            WT_STAT_CONN_INCR(session, stat##_lt64);            \
+        else if (usecs < 256)                                   \
+            WT_STAT_CONN_INCR(session, stat##_lt256);           \
+        else if (usecs < 1024)                                  \
+            WT_STAT_CONN_INCR(session, stat##_lt1024);          \
+        else if (usecs < 4096)                                  \
+            WT_STAT_CONN_INCR(session, stat##_lt4096);          \
+        else if (usecs < 16384)                                 \
+            WT_STAT_CONN_INCR(session, stat##_lt16384);         \
+        else if (usecs < 65536)                                 \
+            WT_STAT_CONN_INCR(session, stat##_lt65536);         \
+        else if (usecs < 262144)                                \
+            WT_STAT_CONN_INCR(session, stat##_lt262144);        \
+        else if (usecs < 1048576)                               \
+            WT_STAT_CONN_INCR(session, stat##_lt1048576);       \
+        else                                                    \
+            WT_STAT_CONN_INCR(session, stat##_gt1048576);       \
+    }
+
 #define WT_STAT_COMPR_RATIO_READ_HIST_INCR_FUNC(ratio)                \
     static inline void __wt_stat_compr_ratio_read_hist_incr(          \
       WT_SESSION_IMPL *session, uint64_t ratio)                       \
@@ -410,6 +472,7 @@ struct __wt_connection_stats {
     int64_t block_prefetch_skipped_special_handle;
     int64_t block_prefetch_pages_fail;
     int64_t block_prefetch_pages_queued;
+    int64_t block_prefetch_pages_read_async;
     int64_t block_prefetch_pages_read;
     int64_t block_prefetch_attempts;
     int64_t block_cache_blocks_removed;
@@ -450,6 +513,7 @@ struct __wt_connection_stats {
     int64_t cache_eviction_blocked_checkpoint;
     int64_t cache_eviction_blocked_checkpoint_hs;
     int64_t cache_eviction_get_ref;
+    int64_t cache_eviction_get_ref_shard_steal;
     int64_t cache_eviction_get_ref_empty;
     int64_t cache_eviction_get_ref_empty2;
     int64_t cache_eviction_aggressive_set;
@@ -532,6 +596,7 @@ struct __wt_connection_stats {
     int64_t cache_hs_write_squash;
     int64_t cache_inmem_splittable;
     int64_t cache_inmem_split;
+    int64_t cache_inmem_split_contended;
     int64_t cache_eviction_blocked_internal_page_split;
     int64_t cache_eviction_internal;
     int64_t cache_eviction_internal_pages_queued;
@@ -626,8 +691,10 @@ struct __wt_connection_stats {
     int64_t checkpoint_presync;
     int64_t checkpoint_hs_pages_reconciled;
     int64_t checkpoint_pages_visited_internal;
+    int64_t checkpoint_pages_reconciled_helper;
     int64_t checkpoint_pages_visited_leaf;
     int64_t checkpoint_pages_reconciled;
+    int64_t checkpoint_pages_reconciled_helper_wait;
     int64_t checkpoint_cleanup_pages_evict;
     int64_t checkpoint_cleanup_pages_removed;
     int64_t checkpoint_cleanup_pages_walk_skipped;
@@ -652,6 +719,7 @@ struct __wt_connection_stats {
     int64_t checkpoint_wait_reduce_dirty;
     int64_t chunkcache_spans_chunks_read;
     int64_t chunkcache_chunks_evicted;
+    int64_t chunkcache_chunks_preloaded;
     int64_t chunkcache_exceeded_bitmap_capacity;
     int64_t chunkcache_exceeded_capacity;
     int64_t chunkcache_lookups;
@@ -665,7 +733,9 @@ struct __wt_connection_stats {
     int64_t chunkcache_io_failed;
     int64_t chunkcache_retries;
     int64_t chunkcache_retries_checksum_mismatch;
+    int64_t chunkcache_preload_time;
     int64_t chunkcache_toomany_retries;
+    int64_t chunkcache_bytes_preloaded;
     int64_t chunkcache_bytes_read_persistent;
     int64_t chunkcache_bytes_inuse;
     int64_t chunkcache_bytes_inuse_pinned;
@@ -698,6 +768,7 @@ struct __wt_connection_stats {
     int64_t cursor_reposition;
     int64_t cursor_bulk_count;
     int64_t cursor_cached_count;
+    int64_t cursor_pool_count;
     int64_t cursor_bound_error;
     int64_t cursor_bounds_reset;
     int64_t cursor_bounds_comparisons;
@@ -716,13 +787,19 @@ struct __wt_connection_stats {
     int64_t cursor_equals_error;
     int64_t cursor_get_key_error;
     int64_t cursor_get_value_error;
+    int64_t cursor_insert_batch;
+    int64_t cursor_insert_batch_error;
+    int64_t cursor_insert_batch_keys;
+    int64_t cursor_insert_batch_pinned;
     int64_t cursor_insert;
     int64_t cursor_insert_error;
     int64_t cursor_insert_check_error;
     int64_t cursor_insert_bytes;
+    int64_t cursor_insert_list_restart;
     int64_t cursor_largest_key_error;
     int64_t cursor_modify;
     int64_t cursor_modify_error;
+    int64_t cursor_modify_full_value;
     int64_t cursor_modify_bytes;
     int64_t cursor_modify_bytes_touch;
     int64_t cursor_next;
@@ -746,7 +823,12 @@ struct __wt_connection_stats {
     int64_t cursor_reserve_error;
     int64_t cursor_reset;
     int64_t cursor_reset_error;
+    int64_t cursor_search_batch;
+    int64_t cursor_search_batch_error;
+    int64_t cursor_search_batch_pinned;
+    int64_t cursor_search_batch_keys;
     int64_t cursor_search;
+    int64_t cursor_search_leaf_bloom_skip;
     int64_t cursor_search_error;
     int64_t cursor_search_hs;
     int64_t cursor_search_near;
@@ -759,9 +841,13 @@ struct __wt_connection_stats {
     int64_t cursor_truncate_keys_deleted;
     int64_t cursor_update;
     int64_t cursor_update_error;
+    int64_t cursor_update_cas_retry;
     int64_t cursor_update_bytes;
     int64_t cursor_update_bytes_changed;
+    int64_t cursor_pool_add;
+    int64_t cursor_pool_discard;
     int64_t cursor_reopen;
+    int64_t cursor_pool_reuse;
     int64_t cursor_open_count;
     int64_t dh_conn_handle_size;
     int64_t dh_conn_handle_count;
@@ -798,11 +884,14 @@ struct __wt_connection_stats {
     int64_t log_force_remove_sleep;
     int64_t log_bytes_payload;
     int64_t log_bytes_written;
+    int64_t log_compress_dict_switch;
+    int64_t log_compress_dict_busy;
     int64_t log_zero_fills;
     int64_t log_flush;
     int64_t log_force_write;
     int64_t log_force_write_skip;
     int64_t log_compress_writes;
+    int64_t log_compress_dict_writes;
     int64_t log_compress_write_fails;
     int64_t log_compress_small;
     int64_t log_release_write_lsn;
@@ -811,6 +900,7 @@ struct __wt_connection_stats {
     int64_t log_write_lsn;
     int64_t log_write_lsn_skip;
     int64_t log_sync;
+    int64_t log_sync_background;
     int64_t log_sync_duration;
     int64_t log_sync_dir;
     int64_t log_sync_dir_duration;
@@ -827,11 +917,13 @@ struct __wt_connection_stats {
     int64_t log_slot_closes;
     int64_t log_slot_races;
     int64_t log_slot_yield_race;
+    int64_t log_slot_subslot_joins;
     int64_t log_slot_immediate;
     int64_t log_slot_yield_close;
     int64_t log_slot_yield_sleep;
     int64_t log_slot_yield;
     int64_t log_slot_active_closed;
+    int64_t log_slot_subslot_groups;
     int64_t log_slot_yield_duration;
     int64_t log_slot_no_free_slots;
     int64_t log_slot_unbuffered;
@@ -840,6 +932,91 @@ struct __wt_connection_stats {
     int64_t log_compress_len;
     int64_t log_slot_coalesced;
     int64_t log_close_yields;
+    int64_t perf_hist_app_evict_latency_lt1;
+    int64_t perf_hist_app_evict_latency_lt4;
+    int64_t perf_hist_app_evict_latency_lt16;
+    int64_t perf_hist_app_evict_latency_lt64;
+    int64_t perf_hist_app_evict_latency_lt256;
+    int64_t perf_hist_app_evict_latency_lt1024;
+    int64_t perf_hist_app_evict_latency_lt4096;
+    int64_t perf_hist_app_evict_latency_lt16384;
+    int64_t perf_hist_app_evict_latency_lt65536;
+    int64_t perf_hist_app_evict_latency_lt262144;
+    int64_t perf_hist_app_evict_latency_lt1048576;
+    int64_t perf_hist_app_evict_latency_gt1048576;
+    int64_t perf_hist_app_evict_latency_p50;
+    int64_t perf_hist_app_evict_latency_p90;
+    int64_t perf_hist_app_evict_latency_p999;
+    int64_t perf_hist_app_evict_latency_p99;
+    int64_t perf_hist_app_evict_latency_total_usecs;
+    int64_t perf_hist_cursor_insert_latency_lt1;
+    int64_t perf_hist_cursor_insert_latency_lt4;
+    int64_t perf_hist_cursor_insert_latency_lt16;
+    int64_t perf_hist_cursor_insert_latency_lt64;
+    int64_t perf_hist_cursor_insert_latency_lt256;
+    int64_t perf_hist_cursor_insert_latency_lt1024;
+    int64_t perf_hist_cursor_insert_latency_lt4096;
+    int64_t perf_hist_cursor_insert_latency_lt16384;
+    int64_t perf_hist_cursor_insert_latency_lt65536;
+    int64_t perf_hist_cursor_insert_latency_lt262144;
+    int64_t perf_hist_cursor_insert_latency_lt1048576;
+    int64_t perf_hist_cursor_insert_latency_gt1048576;
+    int64_t perf_hist_cursor_insert_latency_p50;
+    int64_t perf_hist_cursor_insert_latency_p90;
+    int64_t perf_hist_cursor_insert_latency_p999;
+    int64_t perf_hist_cursor_insert_latency_p99;
+    int64_t perf_hist_cursor_insert_latency_total_usecs;
+    int64_t perf_hist_cursor_next_latency_lt1;
+    int64_t perf_hist_cursor_next_latency_lt4;
+    int64_t perf_hist_cursor_next_latency_lt16;
+    int64_t perf_hist_cursor_next_latency_lt64;
+    int64_t perf_hist_cursor_next_latency_lt256;
+    int64_t perf_hist_cursor_next_latency_lt1024;
+    int64_t perf_hist_cursor_next_latency_lt4096;
+    int64_t perf_hist_cursor_next_latency_lt16384;
+    int64_t perf_hist_cursor_next_latency_lt65536;
+    int64_t perf_hist_cursor_next_latency_lt262144;
+    int64_t perf_hist_cursor_next_latency_lt1048576;
+    int64_t perf_hist_cursor_next_latency_gt1048576;
+    int64_t perf_hist_cursor_next_latency_p50;
+    int64_t perf_hist_cursor_next_latency_p90;
+    int64_t perf_hist_cursor_next_latency_p999;
+    int64_t perf_hist_cursor_next_latency_p99;
+    int64_t perf_hist_cursor_next_latency_total_usecs;
+    int64_t perf_hist_cursor_search_latency_lt1;
+    int64_t perf_hist_cursor_search_latency_lt4;
+    int64_t perf_hist_cursor_search_latency_lt16;
+    int64_t perf_hist_cursor_search_latency_lt64;
+    int64_t perf_hist_cursor_search_latency_lt256;
+    int64_t perf_hist_cursor_search_latency_lt1024;
+    int64_t perf_hist_cursor_search_latency_lt4096;
+    int64_t perf_hist_cursor_search_latency_lt16384;
+    int64_t perf_hist_cursor_search_latency_lt65536;
+    int64_t perf_hist_cursor_search_latency_lt262144;
+    int64_t perf_hist_cursor_search_latency_lt1048576;
+    int64_t perf_hist_cursor_search_latency_gt1048576;
+    int64_t perf_hist_cursor_search_latency_p50;
+    int64_t perf_hist_cursor_search_latency_p90;
+    int64_t perf_hist_cursor_search_latency_p999;
+    int64_t perf_hist_cursor_search_latency_p99;
+    int64_t perf_hist_cursor_search_latency_total_usecs;
+    int64_t perf_hist_cursor_update_latency_lt1;
+    int64_t perf_hist_cursor_update_latency_lt4;
+    int64_t perf_hist_cursor_update_latency_lt16;
+    int64_t perf_hist_cursor_update_latency_lt64;
+    int64_t perf_hist_cursor_update_latency_lt256;
+    int64_t perf_hist_cursor_update_latency_lt1024;
+    int64_t perf_hist_cursor_update_latency_lt4096;
+    int64_t perf_hist_cursor_update_latency_lt16384;
+    int64_t perf_hist_cursor_update_latency_lt65536;
+    int64_t perf_hist_cursor_update_latency_lt262144;
+    int64_t perf_hist_cursor_update_latency_lt1048576;
+    int64_t perf_hist_cursor_update_latency_gt1048576;
+    int64_t perf_hist_cursor_update_latency_p50;
+    int64_t perf_hist_cursor_update_latency_p90;
+    int64_t perf_hist_cursor_update_latency_p999;
+    int64_t perf_hist_cursor_update_latency_p99;
+    int64_t perf_hist_cursor_update_latency_total_usecs;
     int64_t perf_hist_fsread_latency_lt10;
     int64_t perf_hist_fsread_latency_lt50;
     int64_t perf_hist_fsread_latency_lt100;
@@ -870,6 +1047,57 @@ struct __wt_connection_stats {
     int64_t perf_hist_opwrite_latency_lt10000;
     int64_t perf_hist_opwrite_latency_gt10000;
     int64_t perf_hist_opwrite_latency_total_usecs;
+    int64_t perf_hist_txn_begin_latency_lt1;
+    int64_t perf_hist_txn_begin_latency_lt4;
+    int64_t perf_hist_txn_begin_latency_lt16;
+    int64_t perf_hist_txn_begin_latency_lt64;
+    int64_t perf_hist_txn_begin_latency_lt256;
+    int64_t perf_hist_txn_begin_latency_lt1024;
+    int64_t perf_hist_txn_begin_latency_lt4096;
+    int64_t perf_hist_txn_begin_latency_lt16384;
+    int64_t perf_hist_txn_begin_latency_lt65536;
+    int64_t perf_hist_txn_begin_latency_lt262144;
+    int64_t perf_hist_txn_begin_latency_lt1048576;
+    int64_t perf_hist_txn_begin_latency_gt1048576;
+    int64_t perf_hist_txn_begin_latency_p50;
+    int64_t perf_hist_txn_begin_latency_p90;
+    int64_t perf_hist_txn_begin_latency_p999;
+    int64_t perf_hist_txn_begin_latency_p99;
+    int64_t perf_hist_txn_begin_latency_total_usecs;
+    int64_t perf_hist_checkpoint_latency_lt1;
+    int64_t perf_hist_checkpoint_latency_lt4;
+    int64_t perf_hist_checkpoint_latency_lt16;
+    int64_t perf_hist_checkpoint_latency_lt64;
+    int64_t perf_hist_checkpoint_latency_lt256;
+    int64_t perf_hist_checkpoint_latency_lt1024;
+    int64_t perf_hist_checkpoint_latency_lt4096;
+    int64_t perf_hist_checkpoint_latency_lt16384;
+    int64_t perf_hist_checkpoint_latency_lt65536;
+    int64_t perf_hist_checkpoint_latency_lt262144;
+    int64_t perf_hist_checkpoint_latency_lt1048576;
+    int64_t perf_hist_checkpoint_latency_gt1048576;
+    int64_t perf_hist_checkpoint_latency_p50;
+    int64_t perf_hist_checkpoint_latency_p90;
+    int64_t perf_hist_checkpoint_latency_p999;
+    int64_t perf_hist_checkpoint_latency_p99;
+    int64_t perf_hist_checkpoint_latency_total_usecs;
+    int64_t perf_hist_txn_commit_latency_lt1;
+    int64_t perf_hist_txn_commit_latency_lt4;
+    int64_t perf_hist_txn_commit_latency_lt16;
+    int64_t perf_hist_txn_commit_latency_lt64;
+    int64_t perf_hist_txn_commit_latency_lt256;
+    int64_t perf_hist_txn_commit_latency_lt1024;
+    int64_t perf_hist_txn_commit_latency_lt4096;
+    int64_t perf_hist_txn_commit_latency_lt16384;
+    int64_t perf_hist_txn_commit_latency_lt65536;
+    int64_t perf_hist_txn_commit_latency_lt262144;
+    int64_t perf_hist_txn_commit_latency_lt1048576;
+    int64_t perf_hist_txn_commit_latency_gt1048576;
+    int64_t perf_hist_txn_commit_latency_p50;
+    int64_t perf_hist_txn_commit_latency_p90;
+    int64_t perf_hist_txn_commit_latency_p999;
+    int64_t perf_hist_txn_commit_latency_p99;
+    int64_t perf_hist_txn_commit_latency_total_usecs;
     int64_t rec_vlcs_emptied_pages;
     int64_t rec_time_window_bytes_ts;
     int64_t rec_time_window_bytes_txn;
@@ -908,11 +1136,14 @@ struct __wt_connection_stats {
     int64_t rec_split_stashed_bytes;
     int64_t rec_split_stashed_objects;
     int64_t local_objects_inuse;
+    int64_t tiered_flush_bytes;
     int64_t flush_tier_fail;
     int64_t flush_tier;
     int64_t flush_tier_skipped;
     int64_t flush_tier_switched;
     int64_t local_objects_removed;
+    int64_t tiered_flush_parts;
+    int64_t tiered_flush_objects;
     int64_t session_open;
     int64_t session_query_ts;
     int64_t session_table_alter_fail;
@@ -976,6 +1207,8 @@ struct __wt_connection_stats {
     int64_t txn_prepare_rollback;
     int64_t txn_query_ts;
     int64_t txn_read_race_prepare_update;
+    int64_t txn_recover_parallel_batches;
+    int64_t txn_recover_parallel_wait;
     int64_t txn_rts;
     int64_t txn_rts_sweep_hs_keys_dryrun;
     int64_t txn_rts_hs_stop_older_than_newer_start;
@@ -1017,6 +1250,7 @@ struct __wt_connection_stats {
     int64_t txn_pinned_timestamp_oldest;
     int64_t txn_timestamp_oldest_active_read;
     int64_t txn_rollback_to_stable_running;
+    int64_t txn_sync;
     int64_t txn_walk_sessions;
     int64_t txn_commit;
     int64_t txn_rollback;
@@ -1066,6 +1300,7 @@ struct __wt_dsrc_stats {
     int64_t btree_column_deleted;
     int64_t btree_column_variable;
     int64_t btree_fixed_len;
+    int64_t btree_contention_max;
     int64_t btree_maxintlpage;
     int64_t btree_maxleafkey;
     int64_t btree_maxleafpage;
@@ -1124,6 +1359,7 @@ struct __wt_dsrc_stats {
     int64_t cache_hs_write_squash;
     int64_t cache_inmem_splittable;
     int64_t cache_inmem_split;
+    int64_t cache_inmem_split_contended;
     int64_t cache_eviction_blocked_internal_page_split;
     int64_t cache_eviction_internal;
     int64_t cache_eviction_split_internal;
@@ -1222,8 +1458,10 @@ struct __wt_dsrc_stats {
     int64_t cursor_equals_error;
     int64_t cursor_get_key_error;
     int64_t cursor_get_value_error;
+    int64_t cursor_insert_batch_error;
     int64_t cursor_insert_error;
     int64_t cursor_insert_check_error;
+    int64_t cursor_insert_list_restart;
     int64_t cursor_largest_key_error;
     int64_t cursor_modify_error;
     int64_t cursor_next_error;
@@ -1240,12 +1478,18 @@ struct __wt_dsrc_stats {
     int64_t cursor_reopen_error;
     int64_t cursor_reserve_error;
     int64_t cursor_reset_error;
+    int64_t cursor_search_batch_error;
+    int64_t cursor_search_leaf_bloom_skip;
     int64_t cursor_search_error;
     int64_t cursor_search_near_error;
     int64_t cursor_update_error;
+    int64_t cursor_update_cas_retry;
+    int64_t cursor_insert_batch;
+    int64_t cursor_insert_batch_keys;
     int64_t cursor_insert;
     int64_t cursor_insert_bytes;
     int64_t cursor_modify;
+    int64_t cursor_modify_full_value;
     int64_t cursor_modify_bytes;
     int64_t cursor_modify_bytes_touch;
     int64_t cursor_next;
@@ -1256,6 +1500,8 @@ struct __wt_dsrc_stats {
     int64_t cursor_remove_bytes;
     int64_t cursor_reserve;
     int64_t cursor_reset;
+    int64_t cursor_search_batch;
+    int64_t cursor_search_batch_keys;
     int64_t cursor_search;
     int64_t cursor_search_hs;
     int64_t cursor_search_near;
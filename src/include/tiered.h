@@ -60,6 +60,28 @@ struct __wt_tiered_work_unit {
     uint32_t flags;               /* Flags for operation */
 };
 
+/*
+ * WT_TIERED_FLUSH_JOB --
+ *	A multi-part upload of an object. The flush thread that owns the object queues the job, and
+ *  any flush thread without an object of its own claims and copies parts until none are left.
+ */
+struct __wt_tiered_flush_job {
+    TAILQ_ENTRY(__wt_tiered_flush_job) q; /* Multi-part upload queue */
+
+    WT_STORAGE_SOURCE *storage_source; /* Storage source and bucket */
+    WT_FILE_SYSTEM *file_system;
+    const char *source; /* Local file name */
+    const char *object; /* Object name in the bucket */
+
+    wt_off_t size;       /* Object size */
+    uint64_t part_size;  /* Size of each part, the last part may be shorter */
+    uint32_t part_count; /* Parts in the object */
+    uint32_t part_next;  /* Next part to copy, protected by the tiered lock */
+
+    wt_shared volatile uint32_t part_done; /* Parts copied or skipped */
+    wt_shared volatile int32_t ret;        /* First part error */
+};
+
 /*
  * WT_TIERED_TIERS --
  *	Information we need to keep about each tier such as its data handle and name.
@@ -106,7 +128,8 @@ struct __wt_tiered {
     uint32_t oldest_id;  /* Oldest object id number */
 
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
-#define WT_TIERED_FLAG_UNUSED 0x1u
+#define WT_TIERED_FLAG_FLUSHING 0x1u /* An object is being flushed, protected by the tiered lock */
+#define WT_TIERED_FLAG_UNUSED 0x2u
     /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
     uint32_t flags;
 };
@@ -219,6 +219,8 @@ struct __wt_evict_entry;
 typedef struct __wt_evict_entry WT_EVICT_ENTRY;
 struct __wt_evict_queue;
 typedef struct __wt_evict_queue WT_EVICT_QUEUE;
+struct __wt_evict_shard;
+typedef struct __wt_evict_shard WT_EVICT_SHARD;
 struct __wt_evict_timeline;
 typedef struct __wt_evict_timeline WT_EVICT_TIMELINE;
 struct __wt_ext;
@@ -257,6 +259,8 @@ struct __wt_insert;
 typedef struct __wt_insert WT_INSERT;
 struct __wt_insert_head;
 typedef struct __wt_insert_head WT_INSERT_HEAD;
+struct __wt_io_uring;
+typedef struct __wt_io_uring WT_IO_URING;
 struct __wt_join_stats;
 typedef struct __wt_join_stats WT_JOIN_STATS;
 struct __wt_join_stats_group;
@@ -267,12 +271,16 @@ struct __wt_log;
 typedef struct __wt_log WT_LOG;
 struct __wt_log_desc;
 typedef struct __wt_log_desc WT_LOG_DESC;
+struct __wt_log_dict;
+typedef struct __wt_log_dict WT_LOG_DICT;
 struct __wt_log_op_desc;
 typedef struct __wt_log_op_desc WT_LOG_OP_DESC;
 struct __wt_log_rec_desc;
 typedef struct __wt_log_rec_desc WT_LOG_REC_DESC;
 struct __wt_log_record;
 typedef struct __wt_log_record WT_LOG_RECORD;
+struct __wt_log_subslot;
+typedef struct __wt_log_subslot WT_LOG_SUBSLOT;
 struct __wt_logslot;
 typedef struct __wt_logslot WT_LOGSLOT;
 struct __wt_lsm_chunk;
@@ -319,18 +327,24 @@ struct __wt_ovfl_track;
 typedef struct __wt_ovfl_track WT_OVFL_TRACK;
 struct __wt_page;
 typedef struct __wt_page WT_PAGE;
+struct __wt_page_bloom;
+typedef struct __wt_page_bloom WT_PAGE_BLOOM;
 struct __wt_page_deleted;
 typedef struct __wt_page_deleted WT_PAGE_DELETED;
 struct __wt_page_header;
 typedef struct __wt_page_header WT_PAGE_HEADER;
 struct __wt_page_index;
 typedef struct __wt_page_index WT_PAGE_INDEX;
+struct __wt_page_index_prefix;
+typedef struct __wt_page_index_prefix WT_PAGE_INDEX_PREFIX;
 struct __wt_page_modify;
 typedef struct __wt_page_modify WT_PAGE_MODIFY;
 struct __wt_prefetch;
 typedef struct __wt_prefetch WT_PREFETCH;
 struct __wt_prefetch_queue_entry;
 typedef struct __wt_prefetch_queue_entry WT_PREFETCH_QUEUE_ENTRY;
+struct __wt_prefetch_read;
+typedef struct __wt_prefetch_read WT_PREFETCH_READ;
 struct __wt_process;
 typedef struct __wt_process WT_PROCESS;
 struct __wt_rec_chunk;
@@ -391,6 +405,8 @@ struct __wt_thread_group;
 typedef struct __wt_thread_group WT_THREAD_GROUP;
 struct __wt_tiered;
 typedef struct __wt_tiered WT_TIERED;
+struct __wt_tiered_flush_job;
+typedef struct __wt_tiered_flush_job WT_TIERED_FLUSH_JOB;
 struct __wt_tiered_object;
 typedef struct __wt_tiered_object WT_TIERED_OBJECT;
 struct __wt_tiered_tiers;
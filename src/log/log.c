@@ -293,6 +293,40 @@ err:
     return (ret);
 }
 
+/*
+ * __wt_log_background --
+ *     Record the given LSN as the session's background sync LSN and wake the log servers to write
+ *     and sync it.
+ */
+void
+__wt_log_background(WT_SESSION_IMPL *session, WT_LSN *lsn)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_LOG *log;
+    uint64_t bg_lsn;
+
+    conn = S2C(session);
+    log = conn->log;
+    WT_ASSIGN_LSN(&session->bg_sync_lsn, lsn);
+
+    /*
+     * Other threads may be advancing the log's background sync LSN at the same time, only ever move
+     * it forward.
+     */
+    for (;;) {
+        WT_ORDERED_READ(bg_lsn, log->bg_sync_lsn.file_offset);
+        if (lsn->file_offset <= bg_lsn ||
+          __wt_atomic_cas64(&log->bg_sync_lsn.file_offset, bg_lsn, lsn->file_offset))
+            break;
+    }
+
+    /* The log server writes out the buffered records, the log file server then syncs them. */
+    if (conn->log_cond != NULL)
+        __wt_cond_signal(session, conn->log_cond);
+    if (conn->log_file_cond != NULL)
+        __wt_cond_signal(session, conn->log_file_cond);
+}
+
 /*
  * __wt_log_ckpt --
  *     Record the given LSN as the checkpoint LSN and signal the removal thread as needed.
@@ -620,17 +654,15 @@ err:
 
 /*
  * __log_prealloc --
- *     Pre-allocate a log file.
+ *     Pre-allocate a log file, zero-filling from the given offset if configured.
  */
 static int
-__log_prealloc(WT_SESSION_IMPL *session, WT_FH *fh)
+__log_prealloc(WT_SESSION_IMPL *session, WT_FH *fh, uint32_t start)
 {
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
-    WT_LOG *log;
 
     conn = S2C(session);
-    log = conn->log;
 
     /*
      * If the user configured zero filling, pre-allocate the log file manually. Otherwise use the
@@ -638,8 +670,7 @@ __log_prealloc(WT_SESSION_IMPL *session, WT_FH *fh)
      */
     if (FLD_ISSET(conn->log_flags, WT_CONN_LOG_ZERO_FILL)) {
         WT_STAT_CONN_INCR(session, log_zero_fills);
-        return (
-          __wt_file_zero(session, fh, log->first_record, conn->log_file_max, WT_THROTTLE_LOG));
+        return (__wt_file_zero(session, fh, start, conn->log_file_max, WT_THROTTLE_LOG));
     }
 
     /* If configured to not extend the file, we're done. */
@@ -668,15 +699,15 @@ __log_size_fit(WT_SESSION_IMPL *session, WT_LSN *lsn, uint64_t recsize)
     conn = S2C(session);
     log = conn->log;
     return (
-      lsn->l.offset == log->first_record || lsn->l.offset + (wt_off_t)recsize < conn->log_file_max);
+      lsn->l.offset == log->first_alloc || lsn->l.offset + (wt_off_t)recsize < conn->log_file_max);
 }
 
 /*
  * __log_decompress --
- *     Decompress a log record.
+ *     Decompress a log record, with the dictionary it was compressed with, if any.
  */
 static int
-__log_decompress(WT_SESSION_IMPL *session, WT_ITEM *in, WT_ITEM *out)
+__log_decompress(WT_SESSION_IMPL *session, WT_ITEM *in, WT_ITEM *out, WT_ITEM *dict)
 {
     WT_COMPRESSOR *compressor;
     WT_CONNECTION_IMPL *conn;
@@ -693,8 +724,20 @@ __log_decompress(WT_SESSION_IMPL *session, WT_ITEM *in, WT_ITEM *out)
     uncompressed_size = logrec->mem_len;
     WT_RET(__wt_buf_initsize(session, out, uncompressed_size));
     memcpy(out->mem, in->mem, skip);
-    WT_RET(compressor->decompress(compressor, &session->iface, (uint8_t *)in->mem + skip,
-      in->size - skip, (uint8_t *)out->mem + skip, uncompressed_size - skip, &result_len));
+    if (dict == NULL)
+        WT_RET(compressor->decompress(compressor, &session->iface, (uint8_t *)in->mem + skip,
+          in->size - skip, (uint8_t *)out->mem + skip, uncompressed_size - skip, &result_len));
+    else {
+        if (compressor->decompress_dictionary == NULL)
+            WT_RET_MSG(session, WT_ERROR,
+              "Record compressed with a dictionary and the configured compressor has no "
+              "dictionary support");
+        if (dict->size == 0)
+            WT_RET_MSG(session, WT_ERROR, "Record compressed with a missing dictionary");
+        WT_RET(compressor->decompress_dictionary(compressor, &session->iface, dict->data,
+          dict->size, (uint8_t *)in->mem + skip, in->size - skip, (uint8_t *)out->mem + skip,
+          uncompressed_size - skip, &result_len));
+    }
 
     /*
      * If checksums were turned off because we're depending on the decompression to fail on any
@@ -1127,6 +1170,134 @@ err:
     return (ret);
 }
 
+/*
+ * __log_dict_sample --
+ *     Add the start of a log record to the sample for the next compression dictionary. Sampling is
+ *     opportunistic: threads skip it rather than wait on another thread's sampling.
+ */
+static void
+__log_dict_sample(WT_SESSION_IMPL *session, const uint8_t *src, size_t src_len)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_ITEM *sample;
+    WT_LOG *log;
+    size_t len;
+
+    conn = S2C(session);
+    log = conn->log;
+
+    if (log->dict_sample_full || __wt_spin_trylock(session, &log->log_dict_lock) != 0)
+        return;
+
+    /*
+     * Records start with their operation headers, file IDs and keys, which is what repeats across
+     * records. Limit each record's contribution so a few large values can't fill the sample.
+     */
+    sample = &log->dict_sample;
+    len = WT_MIN(src_len, WT_MAX(conn->log_compress_dict / 16, 1));
+    len = WT_MIN(len, conn->log_compress_dict - sample->size);
+    memcpy((uint8_t *)sample->mem + sample->size, src, len);
+    sample->size += len;
+    if (sample->size == conn->log_compress_dict)
+        log->dict_sample_full = true;
+
+    __wt_spin_unlock(session, &log->log_dict_lock);
+}
+
+/*
+ * __log_dict_acquire --
+ *     Return the current compression dictionary, if any, pinned until the caller's record has
+ *     joined a slot.
+ */
+static void
+__log_dict_acquire(WT_SESSION_IMPL *session, WT_LOG_DICT **dictp)
+{
+    WT_LOG *log;
+    WT_LOG_DICT *dict;
+    uint64_t gen;
+
+    *dictp = NULL;
+    log = S2C(session)->log;
+
+    for (;;) {
+        WT_ORDERED_READ(gen, log->dict_gen);
+        if (gen == 0)
+            return;
+
+        /*
+         * Publish our reference before checking the generation again: a dictionary is only replaced
+         * when its reference count is zero, and not while it is the current one.
+         */
+        dict = &log->dict[gen % 2];
+        (void)__wt_atomic_addv32(&dict->refs, 1);
+        if (gen == log->dict_gen) {
+            *dictp = dict;
+            return;
+        }
+        (void)__wt_atomic_subv32(&dict->refs, 1);
+    }
+}
+
+/*
+ * __log_dict_release --
+ *     Release a pinned compression dictionary.
+ */
+static void
+__log_dict_release(WT_LOG_DICT *dict)
+{
+    if (dict != NULL)
+        (void)__wt_atomic_subv32(&dict->refs, 1);
+}
+
+/*
+ * __log_dict_switch --
+ *     Make the completed sample the current compression dictionary, replacing the previous one.
+ *     Called when switching log files, locked.
+ */
+static int
+__log_dict_switch(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_ITEM tmp;
+    WT_LOG *log;
+    WT_LOG_DICT *dict;
+    uint64_t gen;
+
+    conn = S2C(session);
+    log = conn->log;
+
+    WT_ASSERT(session, FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_SLOT));
+    if (!log->dict_sample_full)
+        return (0);
+
+    /*
+     * The new log file holds the current and previous dictionaries. A writer pinning the previous
+     * dictionary may not have joined a slot yet, and its record could land in this file: wait for
+     * a later file rather than drop that dictionary.
+     */
+    gen = log->dict_gen + 1;
+    dict = &log->dict[gen % 2];
+    WT_FULL_BARRIER();
+    if (dict->refs != 0) {
+        WT_STAT_CONN_INCR(session, log_compress_dict_busy);
+        return (0);
+    }
+
+    /* The replaced dictionary's buffer holds the next sample. */
+    WT_RET(__wt_buf_init(session, &dict->dict, conn->log_compress_dict));
+    __wt_spin_lock(session, &log->log_dict_lock);
+    tmp = dict->dict;
+    dict->dict = log->dict_sample;
+    log->dict_sample = tmp;
+    log->dict_sample_full = false;
+    __wt_spin_unlock(session, &log->log_dict_lock);
+
+    dict->gen = gen;
+    WT_PUBLISH(log->dict_gen, gen);
+    WT_STAT_CONN_INCR(session, log_compress_dict_switch);
+    return (0);
+}
+
 /*
  * __log_newfile --
  *     Create the next log file and write the file header record into it.
@@ -1243,7 +1414,18 @@ __log_newfile(WT_SESSION_IMPL *session, bool conn_open, bool *created)
     if (log->log_version >= WT_LOG_VERSION_SYSTEM) {
         WT_RET(__wt_log_system_prevlsn(session, log_fh, &logrec_lsn));
         WT_SET_LSN(&log->alloc_lsn, log->fileid, log->first_record);
+
+        /*
+         * If compressing with dictionaries, switch to a new one if we can and write the current
+         * and previous dictionaries into the file: every record in this file is compressed with
+         * one of them.
+         */
+        if (conn->log_compress_dict != 0) {
+            WT_RET(__log_dict_switch(session));
+            WT_RET(__wt_log_system_dict(session, log_fh));
+        }
     }
+    log->first_alloc = log->alloc_lsn.l.offset;
     WT_ASSIGN_LSN(&end_lsn, &log->alloc_lsn);
     WT_PUBLISH(log->log_fh, log_fh);
 
@@ -1377,8 +1559,8 @@ __wt_log_acquire(WT_SESSION_IMPL *session, uint64_t recsize, WT_LOGSLOT *slot)
      * Pre-allocate on the first real write into the log file, if it was just created (i.e. not
      * pre-allocated).
      */
-    if (log->alloc_lsn.l.offset == log->first_record && created_log)
-        WT_RET(__log_prealloc(session, log->log_fh));
+    if (log->alloc_lsn.l.offset == log->first_alloc && created_log)
+        WT_RET(__log_prealloc(session, log->log_fh, log->first_alloc));
     /*
      * Initialize the slot for activation.
      */
@@ -1555,7 +1737,7 @@ __wt_log_allocfile(WT_SESSION_IMPL *session, uint32_t lognum, const char *dest)
      */
     WT_ERR(__log_openfile(session, tmp_id, WT_LOG_OPEN_CREATE_OK, &log_fh));
     WT_ERR(__log_file_header(session, log_fh, NULL, true));
-    WT_ERR(__log_prealloc(session, log_fh));
+    WT_ERR(__log_prealloc(session, log_fh, log->first_record));
     WT_ERR(__wt_fsync(session, log_fh, true));
     WT_ERR(__wt_close(session, &log_fh));
     __wt_verbose(session, WT_VERB_LOG, "log_allocfile: rename %s to %s",
@@ -2059,12 +2241,12 @@ __wt_log_scan(WT_SESSION_IMPL *session, WT_LSN *start_lsnp, WT_LSN *end_lsnp, ui
     WT_DECL_ITEM(uncitem);
     WT_DECL_RET;
     WT_FH *log_fh;
-    WT_ITEM *cbbuf;
+    WT_ITEM *cbbuf, dicts[2];
     WT_LOG *log;
     WT_LOG_RECORD *logrec;
     WT_LSN end_lsn, next_lsn, prev_eof, prev_lsn, rd_lsn, start_lsn;
     wt_off_t bad_offset, log_size;
-    uint32_t allocsize, firstlog, lastlog, lognum, rdup_len, reclen;
+    uint32_t allocsize, dict_file, firstlog, lastlog, lognum, rdup_len, reclen;
     uint16_t version;
     u_int i, logcount;
     int firstrecord;
@@ -2076,6 +2258,8 @@ __wt_log_scan(WT_SESSION_IMPL *session, WT_LSN *start_lsnp, WT_LSN *end_lsnp, ui
     log_fh = NULL;
     logcount = 0;
     logfiles = NULL;
+    WT_CLEAR(dicts);
+    dict_file = 0;
     corrupt = eol = false;
     firstrecord = 1;
     need_salvage = false;
@@ -2384,7 +2568,18 @@ advance:
                 cbbuf = decryptitem;
             }
             if (F_ISSET(logrec, WT_LOG_RECORD_COMPRESSED)) {
-                WT_ERR(__log_decompress(session, cbbuf, uncitem));
+                /*
+                 * Records compressed with a dictionary need the dictionaries written at the start
+                 * of their log file, load them the first time we see such a record in a file.
+                 */
+                if (F_ISSET(logrec, WT_LOG_RECORD_DICTIONARY) && dict_file != rd_lsn.l.file) {
+                    WT_ERR(__wt_log_system_dict_load(session, rd_lsn.l.file, dicts));
+                    dict_file = rd_lsn.l.file;
+                }
+                WT_ERR(__log_decompress(session, cbbuf, uncitem,
+                  F_ISSET(logrec, WT_LOG_RECORD_DICTIONARY) ?
+                    &dicts[F_ISSET(logrec, WT_LOG_RECORD_DICTIONARY_ODD) ? 1 : 0] :
+                    NULL));
                 cbbuf = uncitem;
             }
             WT_ERR((*func)(session, cbbuf, &rd_lsn, &next_lsn, cookie, firstrecord));
@@ -2445,6 +2640,8 @@ err:
     __wt_scr_free(session, &buf);
     __wt_scr_free(session, &decryptitem);
     __wt_scr_free(session, &uncitem);
+    __wt_buf_free(session, &dicts[0]);
+    __wt_buf_free(session, &dicts[1]);
 
     /*
      * If the caller wants one record and it is at the end of log, return WT_NOTFOUND.
@@ -2490,6 +2687,7 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, uint32_t
     WT_ITEM *ip;
     WT_KEYED_ENCRYPTOR *kencryptor;
     WT_LOG *log;
+    WT_LOG_DICT *dict;
     WT_LOG_RECORD *newlrp;
     size_t dst_len, len, new_size, result_len, src_len;
     uint8_t *dst, *src;
@@ -2497,6 +2695,7 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, uint32_t
 
     conn = S2C(session);
     log = conn->log;
+    dict = NULL;
     /*
      * An error during opening the logging subsystem can result in it being enabled, but without an
      * open log file. In that case, just return. We can also have logging opened for reading in a
@@ -2512,6 +2711,16 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, uint32_t
         src = (uint8_t *)record->mem + WT_LOG_COMPRESS_SKIP;
         src_len = record->size - WT_LOG_COMPRESS_SKIP;
 
+        /*
+         * If compressing with dictionaries, sample the record for the next dictionary and pin the
+         * current one until the record joins a slot: the record must land in a log file holding
+         * the dictionary it was compressed with.
+         */
+        if (conn->log_compress_dict != 0) {
+            __log_dict_sample(session, src, src_len);
+            __log_dict_acquire(session, &dict);
+        }
+
         /*
          * Compute the size needed for the destination buffer. We only allocate enough memory for a
          * copy of the original by default, if any compressed version is bigger than the original,
@@ -2532,8 +2741,12 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, uint32_t
         dst_len = len;
 
         compression_failed = 0;
-        WT_ERR(compressor->compress(compressor, &session->iface, src, src_len, dst, dst_len,
-          &result_len, &compression_failed));
+        if (dict == NULL)
+            WT_ERR(compressor->compress(compressor, &session->iface, src, src_len, dst, dst_len,
+              &result_len, &compression_failed));
+        else
+            WT_ERR(compressor->compress_dictionary(compressor, &session->iface, dict->dict.data,
+              dict->dict.size, src, src_len, dst, dst_len, &result_len, &compression_failed));
         result_len += WT_LOG_COMPRESS_SKIP;
 
         /*
@@ -2560,6 +2773,12 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, uint32_t
             F_SET(newlrp, WT_LOG_RECORD_COMPRESSED);
             WT_ASSERT(session, result_len < UINT32_MAX && record->size < UINT32_MAX);
             newlrp->mem_len = WT_STORE_SIZE(record->size);
+            if (dict != NULL) {
+                WT_STAT_CONN_INCR(session, log_compress_dict_writes);
+                F_SET(newlrp, WT_LOG_RECORD_DICTIONARY);
+                if (dict->gen % 2 != 0)
+                    F_SET(newlrp, WT_LOG_RECORD_DICTIONARY_ODD);
+            }
         }
     }
     if ((kencryptor = conn->kencryptor) != NULL) {
@@ -2583,6 +2802,7 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, uint32_t
     ret = __log_write_internal(session, ip, lsnp, flags);
 
 err:
+    __log_dict_release(dict);
     __wt_scr_free(session, &citem);
     __wt_scr_free(session, &eitem);
     return (ret);
@@ -2720,7 +2940,9 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, ui
         /* Wait for our writes to reach disk */
         while (__wt_log_cmp(&log->sync_lsn, &lsn) <= 0 && myslot.slot->slot_error == 0)
             __wt_cond_wait(session, log->log_sync_cond, 10 * WT_THOUSAND, NULL);
-    }
+    } else if (LF_ISSET(WT_LOG_BACKGROUND))
+        /* Don't wait, the log file server syncs our records once they're written. */
+        __wt_log_background(session, &lsn);
 
 err:
     if (ret == 0 && lsnp != NULL)
@@ -2820,7 +3042,7 @@ __wt_log_flush(WT_SESSION_IMPL *session, uint32_t flags)
      * to be flushed. Otherwise, if the workload is single-threaded we could wait here forever
      * because the write LSN doesn't switch into the new file until it contains a record.
      */
-    if (last_lsn.l.offset == log->first_record)
+    if (last_lsn.l.offset == log->first_alloc)
         WT_ASSIGN_LSN(&last_lsn, &log->log_close_lsn);
 
     /*
@@ -1696,6 +1696,140 @@ __wt_logop_backup_id_print(
     return (0);
 }
 
+/*
+ * __wt_struct_size_compress_dict --
+ *     Calculate size of compress_dict struct.
+ */
+static inline size_t
+__wt_struct_size_compress_dict(uint64_t gen, WT_ITEM *dict)
+{
+    return (__wt_vsize_uint(gen) + dict->size);
+}
+
+/*
+ * __wt_struct_pack_compress_dict --
+ *     Pack the compress_dict struct.
+ */
+WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result))
+static inline int
+__wt_struct_pack_compress_dict(uint8_t **pp, uint8_t *end, uint64_t gen, WT_ITEM *dict)
+{
+    WT_RET(__pack_encode_uintAny(pp, end, gen));
+    WT_RET(__pack_encode_WT_ITEM_last(pp, end, dict));
+
+    return (0);
+}
+
+/*
+ * __wt_struct_unpack_compress_dict --
+ *     Unpack the compress_dict struct.
+ */
+WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result))
+static inline int
+__wt_struct_unpack_compress_dict(
+  const uint8_t **pp, const uint8_t *end, uint64_t *genp, WT_ITEM *dictp)
+{
+    __pack_decode_uintAny(pp, end, uint64_t, genp);
+    __pack_decode_WT_ITEM_last(pp, end, dictp);
+
+    return (0);
+}
+
+/*
+ * __wt_logop_compress_dict_pack --
+ *     Pack the log operation compress_dict.
+ */
+WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result))
+int
+__wt_logop_compress_dict_pack(
+  WT_SESSION_IMPL *session, WT_ITEM *logrec, uint64_t gen, WT_ITEM *dict)
+{
+    size_t size;
+    uint8_t *buf, *end;
+
+    size = __wt_struct_size_compress_dict(gen, dict);
+    size += __wt_vsize_uint(WT_LOGOP_COMPRESS_DICT) + __wt_vsize_uint(0);
+    __wt_struct_size_adjust(session, &size);
+    WT_RET(__wt_buf_extend(session, logrec, logrec->size + size));
+
+    buf = (uint8_t *)logrec->data + logrec->size;
+    end = buf + size;
+    WT_RET(__wt_logop_write(session, &buf, end, WT_LOGOP_COMPRESS_DICT, (uint32_t)size));
+    WT_RET(__wt_struct_pack_compress_dict(&buf, end, gen, dict));
+
+    logrec->size += (uint32_t)size;
+    return (0);
+}
+
+/*
+ * __wt_logop_compress_dict_unpack --
+ *     Unpack the log operation compress_dict.
+ */
+int
+__wt_logop_compress_dict_unpack(
+  WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end, uint64_t *genp, WT_ITEM *dictp)
+{
+    WT_DECL_RET;
+    uint32_t optype, size;
+
+#if !defined(NO_STRICT_PACKING_CHECK) || defined(PACKING_COMPATIBILITY_MODE)
+    const uint8_t *pp_orig;
+    pp_orig = *pp;
+#endif
+
+    if ((ret = __wt_logop_unpack(session, pp, end, &optype, &size)) != 0 ||
+      (ret = __wt_struct_unpack_compress_dict(pp, end, genp, dictp)) != 0)
+        WT_RET_MSG(session, ret, "logop_compress_dict: unpack failure");
+
+    WT_CHECK_OPTYPE(session, optype, WT_LOGOP_COMPRESS_DICT);
+
+#if !defined(NO_STRICT_PACKING_CHECK)
+    if (WT_PTRDIFF(*pp, pp_orig) != size) {
+        WT_RET_MSG(session, EINVAL,
+          "logop_compress_dict: size mismatch: expected %u, got %" PRIuPTR, size,
+          WT_PTRDIFF(*pp, pp_orig));
+    }
+#endif
+#if defined(PACKING_COMPATIBILITY_MODE)
+    *pp = pp_orig + size;
+#endif
+
+    return (0);
+}
+
+/*
+ * __wt_logop_compress_dict_print --
+ *     Print the log operation compress_dict.
+ */
+int
+__wt_logop_compress_dict_print(
+  WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end, WT_TXN_PRINTLOG_ARGS *args)
+{
+    WT_DECL_RET;
+    uint64_t gen;
+    WT_ITEM dict;
+    WT_DECL_ITEM(escaped);
+
+    WT_RET(__wt_logop_compress_dict_unpack(session, pp, end, &gen, &dict));
+
+    if (!FLD_ISSET(args->flags, WT_TXN_PRINTLOG_UNREDACT))
+        return (__wt_fprintf(session, args->fs, " REDACTED"));
+
+    WT_RET(__wt_fprintf(session, args->fs, " \"optype\": \"compress_dict\",\n"));
+    WT_ERR(__wt_fprintf(session, args->fs, "        \"gen\": %" PRIu64 ",\n", gen));
+    WT_ERR(__logrec_make_json_str(session, &escaped, &dict));
+    WT_ERR(__wt_fprintf(session, args->fs, "        \"dict\": \"%s\"", (char *)escaped->mem));
+    if (FLD_ISSET(args->flags, WT_TXN_PRINTLOG_HEX)) {
+        WT_ERR(__logrec_make_hex_str(session, &escaped, &dict));
+        WT_ERR(
+          __wt_fprintf(session, args->fs, ",\n        \"dict-hex\": \"%s\"", (char *)escaped->mem));
+    }
+
+err:
+    __wt_scr_free(session, &escaped);
+    return (ret);
+}
+
 /*
  * __wt_struct_size_txn_timestamp --
  *     Calculate size of txn_timestamp struct.
@@ -1908,6 +2042,10 @@ __wt_txn_op_printlog(
         WT_RET(__wt_logop_backup_id_print(session, pp, end, args));
         break;
 
+    case WT_LOGOP_COMPRESS_DICT:
+        WT_RET(__wt_logop_compress_dict_print(session, pp, end, args));
+        break;
+
     case WT_LOGOP_TXN_TIMESTAMP:
         WT_RET(__wt_logop_txn_timestamp_print(session, pp, end, args));
         break;
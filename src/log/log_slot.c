@@ -429,6 +429,7 @@ __wt_log_slot_init(WT_SESSION_IMPL *session, bool alloc)
     WT_DECL_RET;
     WT_LOG *log;
     WT_LOGSLOT *slot;
+    uint32_t j;
     int32_t i;
 
     conn = S2C(session);
@@ -454,6 +455,17 @@ __wt_log_slot_init(WT_SESSION_IMPL *session, bool alloc)
             F_SET_ATOMIC_16(&log->slot_pool[i], WT_SLOT_INIT_FLAGS);
         }
         WT_STAT_CONN_SET(session, log_buffer_size, log->slot_buf_size * WT_SLOT_POOL);
+
+        /*
+         * Each sub-slot starts at the first generation with nothing published, so the first
+         * thread to lead a group on it doesn't wait for a previous group.
+         */
+        if (conn->log_slot_consolidation != 0) {
+            WT_ERR(__wt_calloc_def(session, conn->log_slot_consolidation, &log->subslots));
+            log->subslot_count = conn->log_slot_consolidation;
+            for (j = 0; j < log->subslot_count; j++)
+                log->subslots[j].state = WT_LOG_SUBSLOT_STATE(1, 0, 0);
+        }
     }
     /*
      * Set up the available slot from the pool the first time.
@@ -507,47 +519,34 @@ __wt_log_slot_destroy(WT_SESSION_IMPL *session)
         }
         __wt_buf_free(session, &log->slot_pool[i].slot_buf);
     }
+    __wt_free(session, log->subslots);
+    log->subslot_count = 0;
     return (0);
 }
 
 /*
- * __wt_log_slot_join --
- *     Join a consolidated logging slot.
+ * __log_slot_join_active --
+ *     Join the active slot, returning the slot and our offset in it.
  */
-void
-__wt_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize, uint32_t flags, WT_MYSLOT *myslot)
+static WT_LOGSLOT *
+__log_slot_join_active(WT_SESSION_IMPL *session, uint64_t mysize, bool unbuffered,
+  bool diag_yield, int32_t *join_offsetp)
 {
-    WT_CONNECTION_IMPL *conn;
     WT_LOG *log;
     WT_LOGSLOT *slot;
     uint64_t time_start, time_stop, usecs;
     int64_t flag_state, new_state, old_state, released;
     int32_t join_offset, new_join, wait_cnt;
-    bool closed, diag_yield, raced, slept, unbuffered, yielded;
+    bool closed, raced, slept, yielded;
 
-    conn = S2C(session);
-    log = conn->log;
+    log = S2C(session)->log;
     time_start = 0;
 
-    WT_ASSERT(session, !FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_SLOT));
-    WT_ASSERT(session, mysize != 0);
-
     /*
      * There should almost always be a slot open.
      */
-    unbuffered = yielded = false;
-    closed = raced = slept = false;
+    closed = raced = slept = yielded = false;
     wait_cnt = 0;
-#ifdef HAVE_DIAGNOSTIC
-    diag_yield = (++log->write_calls % 7) == 0;
-    if ((log->write_calls % WT_THOUSAND) == 0 || mysize > WT_LOG_SLOT_BUF_MAX) {
-#else
-    diag_yield = false;
-    if (mysize > WT_LOG_SLOT_BUF_MAX) {
-#endif
-        unbuffered = true;
-        F_SET(myslot, WT_MYSLOT_UNBUFFERED);
-    }
     for (;;) {
         WT_COMPILER_BARRIER();
         slot = log->active_slot;
@@ -598,9 +597,6 @@ __wt_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize, uint32_t flags, WT
             slept = true;
         }
     }
-    /*
-     * We joined this slot. Fill in our information to return to the caller.
-     */
     if (!yielded)
         WT_STAT_CONN_INCR(session, log_slot_immediate);
     else {
@@ -615,6 +611,141 @@ __wt_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize, uint32_t flags, WT
         if (slept)
             WT_STAT_CONN_INCR(session, log_slot_yield_sleep);
     }
+    *join_offsetp = join_offset;
+    return (slot);
+}
+
+/*
+ * __log_slot_join_subslot --
+ *     Join the current group in the sub-slot for the CPU we're running on, returning the slot and
+ *     our offset in it. Returns false if the group is full and the caller should join the active
+ *     slot directly.
+ */
+static bool
+__log_slot_join_subslot(WT_SESSION_IMPL *session, uint64_t mysize, bool diag_yield,
+  WT_LOGSLOT **slotp, int32_t *join_offsetp)
+{
+    WT_LOG *log;
+    WT_LOGSLOT *slot;
+    WT_LOG_SUBSLOT *sub;
+    uint64_t new_state, old_state, sleep_usecs, yield_count;
+    uint32_t count, done_gen, gen, group_size, prev_gen;
+    int32_t group_offset;
+    u_int id;
+
+    log = S2C(session)->log;
+    if (!__wt_thread_cpu(&id))
+        id = session->id;
+    sub = &log->subslots[id % log->subslot_count];
+
+    /*
+     * Add our size to the sub-slot's current group. The first thread into an empty sub-slot leads
+     * the group, the rest take the group's size so far as their offset within it.
+     */
+    for (;;) {
+        WT_ORDERED_READ(old_state, sub->state);
+        gen = WT_LOG_SUBSLOT_GEN(old_state);
+        count = WT_LOG_SUBSLOT_COUNT(old_state);
+        group_size = WT_LOG_SUBSLOT_SIZE(old_state);
+        if (count >= WT_LOG_SUBSLOT_GROUP_MAX || group_size + mysize > WT_LOG_SLOT_BUF_MAX)
+            return (false);
+        new_state = WT_LOG_SUBSLOT_STATE(gen, count + 1, group_size + mysize);
+        if (__wt_atomic_casv64(&sub->state, old_state, new_state))
+            break;
+    }
+
+    sleep_usecs = yield_count = 0;
+    if (count != 0) {
+        /* Wait for the leader to join the active slot and publish the group's offset. */
+        for (;;) {
+            WT_ORDERED_READ(done_gen, sub->done_gen);
+            if (done_gen == gen)
+                break;
+            __wt_spin_backoff(&yield_count, &sleep_usecs);
+        }
+        *slotp = sub->slot;
+        *join_offsetp = sub->offset + (int32_t)group_size;
+        (void)__wt_atomic_subv32(&sub->readers, 1);
+        WT_STAT_CONN_INCR(session, log_slot_subslot_joins);
+        return (true);
+    }
+
+    /*
+     * We lead the group. The result fields are shared by successive groups, wait until every member
+     * of the previous group has read them. Other threads join our group while we wait.
+     */
+    prev_gen = (gen - 1) & WT_LOG_SUBSLOT_GEN_MASK;
+    for (;;) {
+        WT_ORDERED_READ(done_gen, sub->done_gen);
+        if (done_gen == prev_gen && sub->readers == 0)
+            break;
+        __wt_spin_backoff(&yield_count, &sleep_usecs);
+    }
+
+    /* Close the group, later threads start the next generation. */
+    for (;;) {
+        WT_ORDERED_READ(old_state, sub->state);
+        if (__wt_atomic_casv64(&sub->state, old_state, WT_LOG_SUBSLOT_STATE(gen + 1, 0, 0)))
+            break;
+    }
+    count = WT_LOG_SUBSLOT_COUNT(old_state);
+    group_size = WT_LOG_SUBSLOT_SIZE(old_state);
+
+    slot = __log_slot_join_active(session, group_size, false, diag_yield, &group_offset);
+    sub->slot = slot;
+    sub->offset = group_offset;
+    sub->readers = count - 1;
+    WT_PUBLISH(sub->done_gen, gen);
+    WT_STAT_CONN_INCR(session, log_slot_subslot_groups);
+
+    *slotp = slot;
+    *join_offsetp = group_offset;
+    return (true);
+}
+
+/*
+ * __wt_log_slot_join --
+ *     Join a consolidated logging slot.
+ */
+void
+__wt_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize, uint32_t flags, WT_MYSLOT *myslot)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_LOG *log;
+    WT_LOGSLOT *slot;
+    int32_t join_offset;
+    bool diag_yield, unbuffered;
+
+    conn = S2C(session);
+    log = conn->log;
+
+    WT_ASSERT(session, !FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_SLOT));
+    WT_ASSERT(session, mysize != 0);
+
+    unbuffered = false;
+#ifdef HAVE_DIAGNOSTIC
+    diag_yield = (++log->write_calls % 7) == 0;
+    if ((log->write_calls % WT_THOUSAND) == 0 || mysize > WT_LOG_SLOT_BUF_MAX) {
+#else
+    diag_yield = false;
+    if (mysize > WT_LOG_SLOT_BUF_MAX) {
+#endif
+        unbuffered = true;
+        F_SET(myslot, WT_MYSLOT_UNBUFFERED);
+    }
+
+    /*
+     * Buffered records join the active slot through a sub-slot group if join consolidation is
+     * configured. Unbuffered records, and records that don't fit in the current group, join the
+     * active slot directly.
+     */
+    if (unbuffered || log->subslot_count == 0 ||
+      !__log_slot_join_subslot(session, mysize, diag_yield, &slot, &join_offset))
+        slot = __log_slot_join_active(session, mysize, unbuffered, diag_yield, &join_offset);
+
+    /*
+     * We joined this slot. Fill in our information to return to the caller.
+     */
     if (LF_ISSET(WT_LOG_DSYNC | WT_LOG_FSYNC))
         F_SET_ATOMIC_16(slot, WT_SLOT_SYNC_DIR);
     if (LF_ISSET(WT_LOG_FLUSH))
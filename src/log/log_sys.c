@@ -155,6 +155,184 @@ __wt_log_recover_prevlsn(
     return (0);
 }
 
+/*
+ * __wt_log_system_dict --
+ *     Write a system log record holding the current and previous compression dictionaries at the
+ *     start of a new log file. Called locked when switching log files.
+ */
+int
+__wt_log_system_dict(WT_SESSION_IMPL *session, WT_FH *log_fh)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_ITEM(eitem);
+    WT_DECL_ITEM(logrec_buf);
+    WT_DECL_RET;
+    WT_ITEM *ip;
+    WT_KEYED_ENCRYPTOR *kencryptor;
+    WT_LOG *log;
+    WT_LOGSLOT tmp;
+    WT_LOG_DICT *dict;
+    WT_LOG_RECORD *logrec;
+    WT_MYSLOT myslot;
+    size_t new_size, recsize;
+    uint64_t gen;
+    uint32_t fill_size, rdup_len, rectype;
+    const char *fmt;
+
+    conn = S2C(session);
+    log = conn->log;
+
+    /* There is nothing to write until the first dictionary is built. */
+    if ((gen = log->dict_gen) == 0)
+        return (0);
+
+    rectype = WT_LOGREC_SYSTEM;
+    fmt = WT_UNCHECKED_STRING(I);
+    WT_RET(__wt_struct_size(session, &recsize, fmt, rectype));
+    WT_RET(__wt_logrec_alloc(session, recsize, &logrec_buf));
+    WT_ERR(__wt_struct_pack(
+      session, (uint8_t *)logrec_buf->data + logrec_buf->size, recsize, fmt, rectype));
+    logrec_buf->size += recsize;
+    dict = &log->dict[gen % 2];
+    WT_ERR(__wt_logop_compress_dict_pack(session, logrec_buf, dict->gen, &dict->dict));
+    if (gen > 1) {
+        dict = &log->dict[(gen - 1) % 2];
+        WT_ERR(__wt_logop_compress_dict_pack(session, logrec_buf, dict->gen, &dict->dict));
+    }
+
+    /*
+     * Dictionaries are sampled from log records: unlike the other system records, encrypt this one
+     * if the log is encrypted.
+     */
+    ip = logrec_buf;
+    if ((kencryptor = conn->kencryptor) != NULL) {
+        __wt_encrypt_size(session, kencryptor, ip->size, &new_size);
+        WT_ERR(__wt_scr_alloc(session, new_size, &eitem));
+        WT_ERR(__wt_encrypt(session, kencryptor, offsetof(WT_LOG_RECORD, record), ip, eitem));
+        ip = eitem;
+        F_SET((WT_LOG_RECORD *)ip->mem, WT_LOG_RECORD_ENCRYPTED);
+    }
+
+    /*
+     * We're not going through the normal log write path, pad the record to the allocation size,
+     * marking the padding as the normal path does.
+     */
+    WT_ASSERT(session, ip->size < UINT32_MAX);
+    rdup_len = __wt_rduppo2((uint32_t)ip->size, log->allocsize);
+    WT_ERR(__wt_buf_grow(session, ip, rdup_len));
+    fill_size = rdup_len - (uint32_t)ip->size;
+    if (fill_size != 0) {
+        memset((uint8_t *)ip->mem + ip->size, 0, fill_size);
+        if (fill_size > 1)
+            *((uint8_t *)ip->mem + rdup_len - 1) = WT_DEBUG_BYTE;
+        ip->size = rdup_len;
+    }
+
+    logrec = (WT_LOG_RECORD *)ip->mem;
+    logrec->len = rdup_len;
+    logrec->checksum = 0;
+    __wt_log_record_byteswap(logrec);
+    logrec->checksum = __wt_checksum(logrec, rdup_len);
+#ifdef WORDS_BIGENDIAN
+    logrec->checksum = __wt_bswap32(logrec->checksum);
+#endif
+    WT_CLEAR(tmp);
+    memset(&myslot, 0, sizeof(myslot));
+    myslot.slot = &tmp;
+    __wt_log_slot_activate(session, &tmp);
+    tmp.slot_fh = log_fh;
+    WT_ERR(__wt_log_fill(session, &myslot, true, ip, NULL));
+    log->alloc_lsn.l.offset += rdup_len;
+
+err:
+    __wt_scr_free(session, &eitem);
+    __wt_logrec_free(session, &logrec_buf);
+    return (ret);
+}
+
+/*
+ * WT_LOG_DICT_LOAD --
+ *     Cookie for the log scan reading the compression dictionaries.
+ */
+typedef struct {
+    WT_ITEM *dicts;   /* Dictionaries, indexed by generation parity */
+    WT_LSN next_lsn;  /* Following record */
+    bool found;       /* Found a dictionary */
+} WT_LOG_DICT_LOAD;
+
+/*
+ * __log_system_dict_load --
+ *     Log scan callback to read the compression dictionaries from a system log record.
+ */
+static int
+__log_system_dict_load(WT_SESSION_IMPL *session, WT_ITEM *logrec, WT_LSN *lsnp, WT_LSN *next_lsnp,
+  void *cookie, int firstrecord)
+{
+    WT_ITEM dict;
+    WT_LOG_DICT_LOAD *load;
+    uint64_t gen;
+    uint32_t opsize, optype, rectype;
+    const uint8_t *end, *p;
+
+    WT_UNUSED(lsnp);
+    WT_UNUSED(firstrecord);
+
+    load = cookie;
+    WT_ASSIGN_LSN(&load->next_lsn, next_lsnp);
+    p = WT_LOG_SKIP_HEADER(logrec->data);
+    end = (const uint8_t *)logrec->data + logrec->size;
+    WT_RET(__wt_logrec_read(session, &p, end, &rectype));
+    if (rectype != WT_LOGREC_SYSTEM)
+        return (0);
+
+    /* The logging subsystem zero-pads records. */
+    while (p < end && *p) {
+        WT_RET(__wt_logop_read(session, &p, end, &optype, &opsize));
+        if (optype != WT_LOGOP_COMPRESS_DICT) {
+            p += opsize;
+            continue;
+        }
+        WT_RET(__wt_logop_compress_dict_unpack(session, &p, p + opsize, &gen, &dict));
+        WT_RET(__wt_buf_set(session, &load->dicts[gen % 2], dict.data, dict.size));
+        load->found = true;
+    }
+    return (0);
+}
+
+/*
+ * __wt_log_system_dict_load --
+ *     Read the compression dictionaries written at the start of a log file, indexed by the parity
+ *     of their generation.
+ */
+int
+__wt_log_system_dict_load(WT_SESSION_IMPL *session, uint32_t fileid, WT_ITEM *dicts)
+{
+    WT_DECL_RET;
+    WT_LOG_DICT_LOAD load;
+    WT_LSN lsn;
+
+    dicts[0].size = dicts[1].size = 0;
+    WT_CLEAR(load);
+    load.dicts = dicts;
+
+    /*
+     * The dictionaries follow the previous LSN record at the start of the file. Scanning a record
+     * at a time doesn't depend on the allocation size the file was written with, which we may not
+     * know when logging isn't enabled.
+     */
+    WT_SET_LSN(&lsn, fileid, 0);
+    ret = __wt_log_scan(session, &lsn, NULL, WT_LOGSCAN_ONE, __log_system_dict_load, &load);
+    if (ret == 0 && !load.found) {
+        WT_ASSIGN_LSN(&lsn, &load.next_lsn);
+        ret = __wt_log_scan(session, &lsn, NULL, WT_LOGSCAN_ONE, __log_system_dict_load, &load);
+    }
+    WT_RET_NOTFOUND_OK(ret);
+    if (!load.found)
+        WT_RET_MSG(session, WT_ERROR,
+          "log compression dictionary record missing from log file %" PRIu32, fileid);
+    return (0);
+}
+
 /*
  * __wt_verbose_dump_log --
  *     Dump information about the logging subsystem.
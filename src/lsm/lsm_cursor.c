@@ -1694,7 +1694,9 @@ __wt_clsm_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner, cons
       __clsm_reset,                                   /* reset */
       __clsm_search,                                  /* search */
       __clsm_search_near,                             /* search-near */
+      __wt_cursor_search_batch,                       /* search-batch */
       __clsm_insert,                                  /* insert */
+      __wt_cursor_insert_batch,                       /* insert-batch */
       __wt_cursor_modify_value_format_notsup,         /* modify */
       __clsm_update,                                  /* update */
       __clsm_remove,                                  /* remove */
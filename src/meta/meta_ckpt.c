@@ -1262,6 +1262,37 @@ err:
     return (ret);
 }
 
+/*
+ * __ckpt_compressor_state --
+ *     Add the state of a tree's customized leaf page compressor, which the blocks written for the
+ *     checkpoint may need to be decompressed. If the compressor has no state, keep any state stored
+ *     when the tree was opened.
+ */
+static int
+__ckpt_compressor_state(WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle, WT_ITEM *buf)
+{
+    WT_BTREE *btree;
+    WT_COMPRESSOR *compressor;
+    WT_CONFIG_ITEM cval;
+    WT_ITEM state;
+
+    btree = dhandle->handle;
+    compressor = btree->compressor;
+
+    WT_CLEAR(state);
+    if (btree->compressor_owned && compressor->get_state != NULL)
+        WT_RET(compressor->get_state(compressor, &session->iface, &state));
+    if (state.size == 0) {
+        WT_RET(__wt_config_gets(session, dhandle->cfg, "block_compressor_state", &cval));
+        state.data = cval.str;
+        state.size = cval.len;
+    }
+    if (state.size != 0)
+        WT_RET(__wt_buf_catfmt(session, buf, ",block_compressor_state=\"%.*s\"", (int)state.size,
+          (const char *)state.data));
+    return (0);
+}
+
 /*
  * __wt_meta_ckptlist_set --
  *     Set a file's checkpoint value from the WT_CKPT list.
@@ -1289,6 +1320,8 @@ __wt_meta_ckptlist_set(
         WT_ERR(__wt_buf_catfmt(session, buf, ",checkpoint_lsn=(%" PRIu32 ",%" PRIuMAX ")",
           ckptlsn->l.file, (uintmax_t)ckptlsn->l.offset));
 
+    if (WT_DHANDLE_BTREE(dhandle))
+        WT_ERR(__ckpt_compressor_state(session, dhandle, buf));
     if (dhandle->type == WT_DHANDLE_TYPE_TIERED)
         WT_ERR(__wt_tiered_set_metadata(session, (WT_TIERED *)dhandle, buf));
     WT_ERR(__ckpt_set(session, fname, buf->mem, has_lsn));
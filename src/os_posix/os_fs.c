@@ -445,6 +445,21 @@ __posix_file_read(
     return (0);
 }
 
+/*
+ * __wt_posix_file_fd --
+ *     Return the descriptor underlying a file handle, for callers issuing their own I/O. Handles
+ *     from other file systems, and handles reading through a mapping, return ENOTSUP.
+ */
+int
+__wt_posix_file_fd(WT_FH *fh, int *fdp)
+{
+    *fdp = -1;
+    if (fh->handle->fh_read != __posix_file_read)
+        return (ENOTSUP);
+    *fdp = ((WT_FILE_HANDLE_POSIX *)fh->handle)->fd;
+    return (0);
+}
+
 /*
  * __posix_file_read_mmap --
  *     Get the buffer from the mapped region.
@@ -138,6 +138,41 @@ __wt_thread_str(char *buf, size_t buflen) WT_GCC_FUNC_ATTRIBUTE((visibility("def
 #endif
 }
 
+/*
+ * __wt_thread_cpu --
+ *     Return the CPU the calling thread is running on, if the system can report it cheaply.
+ */
+bool
+__wt_thread_cpu(u_int *cpup)
+{
+#ifdef HAVE_SCHED_GETCPU
+    int cpu;
+
+    if ((cpu = sched_getcpu()) >= 0) {
+        *cpup = (u_int)cpu;
+        return (true);
+    }
+#endif
+    *cpup = 0;
+    return (false);
+}
+
+/*
+ * __wt_cpu_count --
+ *     Return the number of CPUs configured on the system, or 0 if unknown.
+ */
+u_int
+__wt_cpu_count(void)
+{
+#ifdef _SC_NPROCESSORS_CONF
+    long ncpu;
+
+    if ((ncpu = sysconf(_SC_NPROCESSORS_CONF)) > 0)
+        return ((u_int)ncpu);
+#endif
+    return (0);
+}
+
 /*
  * __wt_process_id --
  *     Return the process ID assigned by the operating system.
@@ -0,0 +1,275 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+#ifdef HAVE_LINUX_IO_URING_H
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+/*
+ * __wt_io_uring_create --
+ *     Create an asynchronous I/O ring with room for the given number of reads in flight.
+ */
+int
+__wt_io_uring_create(WT_SESSION_IMPL *session, u_int depth, WT_IO_URING **ringp)
+{
+    struct io_uring_params params;
+    WT_DECL_RET;
+    WT_IO_URING *ring;
+
+    *ringp = NULL;
+
+    WT_RET(__wt_calloc_one(session, &ring));
+    ring->sq_ring = ring->cq_ring = ring->sqes = MAP_FAILED;
+
+    /*
+     * The ring is an optimization, kernels without io_uring support or where it's disabled (for
+     * example, by a seccomp policy), aren't an error, the caller falls back to synchronous reads.
+     */
+    memset(&params, 0, sizeof(params));
+    if ((ring->fd = (int)syscall(__NR_io_uring_setup, depth, &params)) < 0) {
+        ret = __wt_errno();
+        if (ret == ENOSYS || ret == EPERM)
+            ret = ENOTSUP;
+        else
+            __wt_err(session, ret, "io_uring_setup");
+        goto err;
+    }
+    ring->entries = params.sq_entries;
+
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+      MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+      MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+    ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+      ring->fd, IORING_OFF_SQES);
+    if (ring->sq_ring == MAP_FAILED || ring->cq_ring == MAP_FAILED || ring->sqes == MAP_FAILED)
+        WT_ERR_MSG(session, __wt_errno(), "io_uring: ring mmap");
+
+    ring->sq_head = (uint32_t *)((uint8_t *)ring->sq_ring + params.sq_off.head);
+    ring->sq_tail = (uint32_t *)((uint8_t *)ring->sq_ring + params.sq_off.tail);
+    ring->sq_mask = (uint32_t *)((uint8_t *)ring->sq_ring + params.sq_off.ring_mask);
+    ring->sq_array = (uint32_t *)((uint8_t *)ring->sq_ring + params.sq_off.array);
+    ring->cq_head = (uint32_t *)((uint8_t *)ring->cq_ring + params.cq_off.head);
+    ring->cq_tail = (uint32_t *)((uint8_t *)ring->cq_ring + params.cq_off.tail);
+    ring->cq_mask = (uint32_t *)((uint8_t *)ring->cq_ring + params.cq_off.ring_mask);
+    ring->cqes = (uint8_t *)ring->cq_ring + params.cq_off.cqes;
+
+    *ringp = ring;
+    return (0);
+
+err:
+    WT_TRET(__wt_io_uring_destroy(session, &ring));
+    return (ret);
+}
+
+/*
+ * __wt_io_uring_destroy --
+ *     Discard an asynchronous I/O ring.
+ */
+int
+__wt_io_uring_destroy(WT_SESSION_IMPL *session, WT_IO_URING **ringp)
+{
+    WT_DECL_RET;
+    WT_IO_URING *ring;
+
+    if ((ring = *ringp) == NULL)
+        return (0);
+    *ringp = NULL;
+
+    /* Callers must reap every read first, the kernel could otherwise still write their buffers. */
+    WT_ASSERT(session, ring->inflight == 0 && ring->queued == 0);
+
+    if (ring->sqes != MAP_FAILED && munmap(ring->sqes, ring->sqes_size) != 0)
+        WT_TRET(__wt_errno());
+    if (ring->cq_ring != MAP_FAILED && munmap(ring->cq_ring, ring->cq_ring_size) != 0)
+        WT_TRET(__wt_errno());
+    if (ring->sq_ring != MAP_FAILED && munmap(ring->sq_ring, ring->sq_ring_size) != 0)
+        WT_TRET(__wt_errno());
+    if (ring->fd >= 0 && close(ring->fd) != 0)
+        WT_TRET(__wt_errno());
+
+    __wt_free(session, ring);
+    return (ret);
+}
+
+/*
+ * __wt_io_uring_read --
+ *     Queue a read on the ring, identified by the caller's id. The read isn't submitted until the
+ *     caller waits for a completion.
+ */
+int
+__wt_io_uring_read(WT_SESSION_IMPL *session, WT_IO_URING *ring, WT_FH *fh, wt_off_t offset,
+  size_t len, void *buf, uint64_t id)
+{
+    struct io_uring_sqe *sqe;
+    uint32_t index;
+    int fd;
+
+    /* Only plain POSIX file handles have a descriptor the kernel can read from. */
+    WT_RET(__wt_posix_file_fd(fh, &fd));
+
+    if (ring->queued + ring->inflight >= ring->entries)
+        return (EBUSY);
+
+    index = ring->sq_tail_local++ & *ring->sq_mask;
+    sqe = (struct io_uring_sqe *)ring->sqes + index;
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = fd;
+    sqe->off = (uint64_t)offset;
+    sqe->addr = (uint64_t)(uintptr_t)buf;
+    sqe->len = (uint32_t)len;
+    sqe->user_data = id;
+    ring->sq_array[index] = index;
+    ++ring->queued;
+
+    __wt_verbose_debug2(session, WT_VERB_READ,
+      "read-async: %s, fd=%d, offset=%" PRId64 ", len=%" WT_SIZET_FMT, fh->name, fd, offset, len);
+    WT_STAT_CONN_INCR(session, read_io);
+    return (0);
+}
+
+/*
+ * __wt_io_uring_wait --
+ *     Submit any queued reads, then wait for a read to complete and return its id and result: the
+ *     number of bytes read or an error. Return WT_NOTFOUND if no reads are outstanding.
+ */
+int
+__wt_io_uring_wait(
+  WT_SESSION_IMPL *session, WT_IO_URING *ring, uint64_t *idp, size_t *nbytesp, int *errorp)
+{
+    struct io_uring_cqe *cqe;
+    WT_DECL_RET;
+    uint32_t head;
+    int submitted;
+    bool completed;
+
+    *idp = 0;
+    *nbytesp = 0;
+    *errorp = 0;
+
+    if (ring->queued == 0 && ring->inflight == 0)
+        return (WT_NOTFOUND);
+
+    /* Submit any queued reads and, if nothing has completed yet, wait for a completion. */
+    for (;;) {
+        head = *ring->cq_head;
+        WT_READ_BARRIER();
+        completed = head != *(volatile uint32_t *)ring->cq_tail;
+        if (completed && ring->queued == 0) {
+            /*
+             * The kernel fills in the entry before publishing the new tail, make sure we don't read
+             * the entry until after we've seen the tail move past it.
+             */
+            WT_READ_BARRIER();
+            break;
+        }
+
+        if (ring->queued != 0) {
+            WT_WRITE_BARRIER();
+            *(volatile uint32_t *)ring->sq_tail = ring->sq_tail_local;
+        }
+        if ((submitted = (int)syscall(__NR_io_uring_enter, ring->fd, ring->queued,
+               completed ? 0 : 1, completed ? 0 : IORING_ENTER_GETEVENTS, NULL, 0)) < 0) {
+            ret = __wt_errno();
+            if (ret == EINTR || ret == EAGAIN || ret == EBUSY)
+                continue;
+            WT_RET_MSG(session, ret, "io_uring_enter");
+        }
+        ring->queued -= (uint32_t)submitted;
+        ring->inflight += (uint32_t)submitted;
+    }
+
+    cqe = (struct io_uring_cqe *)ring->cqes + (head & *ring->cq_mask);
+    *idp = cqe->user_data;
+    if (cqe->res < 0)
+        *errorp = -cqe->res;
+    else
+        *nbytesp = (size_t)cqe->res;
+
+    /* Release the completion entry back to the kernel. */
+    WT_WRITE_BARRIER();
+    *ring->cq_head = head + 1;
+    --ring->inflight;
+
+    WT_STAT_CONN_INCRV(session, block_byte_read_syscall, *nbytesp);
+    return (0);
+}
+
+#else
+/*
+ * __wt_io_uring_create --
+ *     Create an asynchronous I/O ring with room for the given number of reads in flight.
+ */
+int
+__wt_io_uring_create(WT_SESSION_IMPL *session, u_int depth, WT_IO_URING **ringp)
+{
+    WT_UNUSED(session);
+    WT_UNUSED(depth);
+
+    *ringp = NULL;
+    return (ENOTSUP);
+}
+
+/*
+ * __wt_io_uring_destroy --
+ *     Discard an asynchronous I/O ring.
+ */
+int
+__wt_io_uring_destroy(WT_SESSION_IMPL *session, WT_IO_URING **ringp)
+{
+    WT_UNUSED(session);
+
+    *ringp = NULL;
+    return (0);
+}
+
+/*
+ * __wt_io_uring_read --
+ *     Queue a read on the ring, identified by the caller's id. The read isn't submitted until the
+ *     caller waits for a completion.
+ */
+int
+__wt_io_uring_read(WT_SESSION_IMPL *session, WT_IO_URING *ring, WT_FH *fh, wt_off_t offset,
+  size_t len, void *buf, uint64_t id)
+{
+    WT_UNUSED(session);
+    WT_UNUSED(ring);
+    WT_UNUSED(fh);
+    WT_UNUSED(offset);
+    WT_UNUSED(len);
+    WT_UNUSED(buf);
+    WT_UNUSED(id);
+
+    return (ENOTSUP);
+}
+
+/*
+ * __wt_io_uring_wait --
+ *     Submit any queued reads, then wait for a read to complete and return its id and result: the
+ *     number of bytes read or an error. Return WT_NOTFOUND if no reads are outstanding.
+ */
+int
+__wt_io_uring_wait(
+  WT_SESSION_IMPL *session, WT_IO_URING *ring, uint64_t *idp, size_t *nbytesp, int *errorp)
+{
+    WT_UNUSED(session);
+    WT_UNUSED(ring);
+
+    *idp = 0;
+    *nbytesp = 0;
+    *errorp = 0;
+    return (WT_NOTFOUND);
+}
+#endif
@@ -94,6 +94,30 @@ __wt_thread_str(char *buf, size_t buflen)
       (uint64_t)GetCurrentThreadId));
 }
 
+/*
+ * __wt_thread_cpu --
+ *     Return the CPU the calling thread is running on, if the system can report it cheaply.
+ */
+bool
+__wt_thread_cpu(u_int *cpup)
+{
+    *cpup = (u_int)GetCurrentProcessorNumber();
+    return (true);
+}
+
+/*
+ * __wt_cpu_count --
+ *     Return the number of CPUs configured on the system, or 0 if unknown.
+ */
+u_int
+__wt_cpu_count(void)
+{
+    SYSTEM_INFO system_info;
+
+    GetSystemInfo(&system_info);
+    return ((u_int)system_info.dwNumberOfProcessors);
+}
+
 /*
  * __wt_process_id --
  *     Return the process ID assigned by the operating system.
@@ -0,0 +1,74 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __wt_io_uring_create --
+ *     Create an asynchronous I/O ring with room for the given number of reads in flight.
+ */
+int
+__wt_io_uring_create(WT_SESSION_IMPL *session, u_int depth, WT_IO_URING **ringp)
+{
+    WT_UNUSED(session);
+    WT_UNUSED(depth);
+
+    *ringp = NULL;
+    return (ENOTSUP);
+}
+
+/*
+ * __wt_io_uring_destroy --
+ *     Discard an asynchronous I/O ring.
+ */
+int
+__wt_io_uring_destroy(WT_SESSION_IMPL *session, WT_IO_URING **ringp)
+{
+    WT_UNUSED(session);
+
+    *ringp = NULL;
+    return (0);
+}
+
+/*
+ * __wt_io_uring_read --
+ *     Queue a read on the ring, identified by the caller's id. The read isn't submitted until the
+ *     caller waits for a completion.
+ */
+int
+__wt_io_uring_read(WT_SESSION_IMPL *session, WT_IO_URING *ring, WT_FH *fh, wt_off_t offset,
+  size_t len, void *buf, uint64_t id)
+{
+    WT_UNUSED(session);
+    WT_UNUSED(ring);
+    WT_UNUSED(fh);
+    WT_UNUSED(offset);
+    WT_UNUSED(len);
+    WT_UNUSED(buf);
+    WT_UNUSED(id);
+
+    return (ENOTSUP);
+}
+
+/*
+ * __wt_io_uring_wait --
+ *     Submit any queued reads, then wait for a read to complete and return its id and result: the
+ *     number of bytes read or an error. Return WT_NOTFOUND if no reads are outstanding.
+ */
+int
+__wt_io_uring_wait(
+  WT_SESSION_IMPL *session, WT_IO_URING *ring, uint64_t *idp, size_t *nbytesp, int *errorp)
+{
+    WT_UNUSED(session);
+    WT_UNUSED(ring);
+
+    *idp = 0;
+    *nbytesp = 0;
+    *errorp = 0;
+    return (WT_NOTFOUND);
+}
@@ -36,10 +36,15 @@ __rec_key_state_update(WT_RECONCILE *r, bool ovfl_key)
      *
      * If we're not writing an overflow key on the page, update the last-key value and turn on both
      * prefix and suffix compression.
+     *
+     * Count the keys written since the last key without prefix compression (the last restart key),
+     * overflow keys included: they can't be used to build a subsequent key either.
      */
-    if (ovfl_key)
+    if (ovfl_key) {
+        ++r->key_pfx_run;
         r->key_sfx_compress = false;
-    else {
+    } else {
+        r->key_pfx_run = r->key_pfx_last == 0 ? 0 : r->key_pfx_run + 1;
         a = r->cur;
         r->cur = r->last;
         r->last = a;
@@ -131,9 +136,15 @@ __rec_cell_build_leaf_key(
              * keys with the same prefix can be quickly built without needing to roll forward
              * through intermediate keys or allocating memory so they can be built faster in the
              * future, for that reason try and create big groups of keys with the same prefix.)
+             * Finally, if configured, write a restart key (a key without prefix compression) at
+             * least every N keys, bounding the number of keys rolled forward to build any key on
+             * the page and giving searches keys they can compare without building them.
              */
             if (pfx < btree->prefix_compression_min)
                 pfx = 0;
+            else if (btree->prefix_compression_restart != 0 &&
+              r->key_pfx_run + 1 >= btree->prefix_compression_restart)
+                pfx = 0;
             else if (r->key_pfx_last != 0 && pfx > r->key_pfx_last &&
               pfx < r->key_pfx_last + WT_KEY_PREFIX_PREVIOUS_MINIMUM)
                 pfx = r->key_pfx_last;
@@ -1019,3 +1030,59 @@ err:
     __wt_scr_free(session, &tmpkey);
     return (ret);
 }
+
+/*
+ * __wt_rec_row_leaf_bloom --
+ *     Build a Bloom filter of the keys on a row-store leaf page image.
+ */
+int
+__wt_rec_row_leaf_bloom(WT_SESSION_IMPL *session, const WT_PAGE_HEADER *dsk, WT_PAGE_BLOOM **bloomp)
+{
+    WT_BTREE *btree;
+    WT_CELL_UNPACK_KV unpack;
+    WT_DECL_ITEM(key);
+    WT_DECL_RET;
+    WT_PAGE_BLOOM *bloom;
+    uint64_t keys;
+
+    *bloomp = NULL;
+
+    btree = S2BT(session);
+    bloom = NULL;
+
+    /*
+     * Count the keys to size the filter. Overflow keys would have to be read back from disk, don't
+     * build a filter for a page that has them.
+     */
+    keys = 0;
+    WT_CELL_FOREACH_KV (session, dsk, unpack) {
+        if (unpack.type == WT_CELL_KEY_OVFL)
+            return (0);
+        if (unpack.type == WT_CELL_KEY)
+            ++keys;
+    }
+    WT_CELL_FOREACH_END;
+
+    WT_RET(__wt_page_bloom_create(
+      session, keys, btree->leaf_bloom_bit_count, btree->leaf_bloom_hash_count, &bloom));
+
+    /* Rebuild each key from its prefix, the leading bytes of the previous key, and its suffix. */
+    WT_ERR(__wt_scr_alloc(session, 0, &key));
+    WT_CELL_FOREACH_KV (session, dsk, unpack) {
+        if (unpack.type != WT_CELL_KEY)
+            continue;
+        WT_ERR(__wt_buf_grow(session, key, unpack.prefix + unpack.size));
+        memcpy((uint8_t *)key->mem + unpack.prefix, unpack.data, unpack.size);
+        key->size = unpack.prefix + unpack.size;
+        __wt_page_bloom_insert(bloom, key->data, key->size);
+    }
+    WT_CELL_FOREACH_END;
+
+    *bloomp = bloom;
+    bloom = NULL;
+
+err:
+    __wt_scr_free(session, &key);
+    __wt_free(session, bloom);
+    return (ret);
+}
@@ -189,10 +189,10 @@ __reconcile_post_wrapup(
     /*
      * When threads perform eviction, don't cache block manager structures (even across calls), we
      * can have a significant number of threads doing eviction at the same time with large items.
-     * Ignore checkpoints, once the checkpoint completes, all unnecessary session resources will be
-     * discarded.
+     * Ignore checkpoints and their helper threads, once the checkpoint completes, all unnecessary
+     * session resources will be discarded.
      */
-    if (!WT_SESSION_IS_CHECKPOINT(session)) {
+    if (!WT_SESSION_IS_CHECKPOINT(session) && !F_ISSET(session, WT_SESSION_CHECKPOINT_HELPER)) {
         /*
          * Clean up the underlying block manager memory too: it's not reconciliation, but threads
          * discarding reconciliation structures want to clean up the block manager's structures as
@@ -405,6 +405,13 @@ __rec_write_page_status(WT_SESSION_IMPL *session, WT_RECONCILE *r)
     mod->rec_max_txn = r->max_txn;
     mod->rec_max_timestamp = r->max_ts;
 
+    /*
+     * Start a new contention window, the page's contention counts are only interesting while
+     * they're recent. Eviction decides whether to split a page while holding it exclusively, it
+     * can't be doing that based on the old counts while we're reconciling the page.
+     */
+    mod->contention = mod->contention_checked = 0;
+
     /*
      * Track the tree's maximum transaction ID (used to decide if it's safe to discard the tree) and
      * maximum timestamp.
@@ -796,6 +803,7 @@ __rec_cleanup(WT_SESSION_IMPL *session, WT_RECONCILE *r)
         __wt_free(session, multi->disk_image);
         __wt_free(session, multi->supd);
         __wt_free(session, multi->addr.addr);
+        __wt_free(session, multi->addr.bloom);
     }
     __wt_free(session, r->multi);
 
@@ -866,6 +874,7 @@ __rec_write(WT_SESSION_IMPL *session, WT_ITEM *buf, uint8_t *addr, size_t *addr_
   size_t *compressed_sizep, bool checkpoint, bool checkpoint_io, bool compressed)
 {
     WT_BTREE *btree;
+    WT_COMPRESSOR *compressor;
     WT_DECL_ITEM(ctmp);
     WT_DECL_RET;
     WT_PAGE_HEADER *dsk;
@@ -895,8 +904,9 @@ __rec_write(WT_SESSION_IMPL *session, WT_ITEM *buf, uint8_t *addr, size_t *addr_
               "Failed to allocate scratch buffer");
 
             memcpy(ctmp->mem, buf->data, WT_BLOCK_COMPRESS_SKIP);
+            compressor = __wt_btree_compressor(btree, dsk->type);
             WT_ASSERT_ALWAYS(session,
-              btree->compressor->decompress(btree->compressor, &session->iface,
+              compressor->decompress(compressor, &session->iface,
                 (uint8_t *)buf->data + WT_BLOCK_COMPRESS_SKIP, buf->size - WT_BLOCK_COMPRESS_SKIP,
                 (uint8_t *)ctmp->data + WT_BLOCK_COMPRESS_SKIP,
                 ctmp->memsize - WT_BLOCK_COMPRESS_SKIP, &result_len) == 0,
@@ -1200,6 +1210,7 @@ __wt_rec_split_init(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_PAGE *page, ui
 
     /* New page, compression off. */
     r->key_pfx_compress = r->key_sfx_compress = false;
+    r->key_pfx_run = 0;
 
     /* Set the first chunk's key. */
     chunk = r->cur_ptr;
@@ -2160,6 +2171,13 @@ __rec_split_write(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_REC_CHUNK *chunk
     WT_RET(__wt_memdup(session, addr, addr_size, &multi->addr.addr));
     multi->addr.size = (uint8_t)addr_size;
 
+    /*
+     * Build the leaf page's key filter from the image we just wrote, it's kept with the address so
+     * searches can skip reading the page for keys it doesn't hold.
+     */
+    if (page->type == WT_PAGE_ROW_LEAF && btree->leaf_bloom_bit_count != 0)
+        WT_RET(__wt_rec_row_leaf_bloom(session, chunk->image.mem, &multi->addr.bloom));
+
     /* Adjust the pre-compression page size based on compression results. */
     if (WT_PAGE_IS_INTERNAL(page) && compressed_size != 0 && btree->intlpage_compadjust)
         __rec_compression_adjust(
@@ -2320,6 +2338,7 @@ __rec_split_discard(WT_SESSION_IMPL *session, WT_PAGE *page)
             WT_RET(__wt_btree_block_free(session, multi->addr.addr, multi->addr.size));
             __wt_free(session, multi->addr.addr);
         }
+        __wt_free(session, multi->addr.bloom);
     }
     __wt_free(session, mod->mod_multi);
     mod->mod_multi_entries = 0;
@@ -2452,6 +2471,7 @@ __rec_write_wrapup(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_PAGE *page)
         /* Discard the replacement page's address and disk image. */
         __wt_free(session, mod->mod_replace.addr);
         mod->mod_replace.size = 0;
+        __wt_free(session, mod->mod_replace.bloom);
         __wt_free(session, mod->mod_disk_image);
         break;
     default:
@@ -2512,6 +2532,7 @@ __rec_write_wrapup(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_PAGE *page)
         if (r->wrapup_checkpoint == NULL) {
             mod->mod_replace = r->multi->addr;
             r->multi->addr.addr = NULL;
+            r->multi->addr.bloom = NULL;
             mod->mod_disk_image = r->multi->disk_image;
             r->multi->disk_image = NULL;
         } else {
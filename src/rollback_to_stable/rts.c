@@ -8,6 +8,56 @@
 
 #include "wt_internal.h"
 
+/*
+ * WT_RTS_WORK_UNIT --
+ *	A file queued for rollback to stable by the worker threads. If the file needs rolling back,
+ *	its handle is opened when it's queued: the worker threads can't acquire the schema lock to
+ *	open it, as the thread queuing the files holds it.
+ */
+typedef struct __wt_rts_work_unit {
+    char *uri;
+    char *config;
+    WT_DATA_HANDLE *dhandle; /* Handle held by the queuing thread */
+    TAILQ_ENTRY(__wt_rts_work_unit) q;
+} WT_RTS_WORK_UNIT;
+
+struct __wt_rts_apply;
+
+/*
+ * WT_RTS_WORKER --
+ *	A rollback to stable worker, with its own session and history store cursors.
+ */
+typedef struct {
+    struct __wt_rts_apply *apply;
+    WT_SESSION_IMPL *session;
+
+    wt_thread_t tid;
+    bool tid_set;
+
+    int ret; /* Worker's error. */
+} WT_RTS_WORKER;
+
+/*
+ * WT_RTS_APPLY --
+ *	Parallel rollback to stable state: the metadata is walked by a single thread and the files
+ *	are rolled back by a set of workers, taking files from a shared queue.
+ */
+typedef struct __wt_rts_apply {
+    WT_RTS_WORKER *workers;
+    u_int nworkers;
+
+    wt_timestamp_t rollback_timestamp;
+
+    WT_SPINLOCK lock; /* Queue lock. */
+    TAILQ_HEAD(__wt_rts_work_qh, __wt_rts_work_unit) qh;
+    WT_RTS_WORK_UNIT *next; /* Next file to roll back. */
+
+    WT_CONDVAR *cond;              /* Coordinator wait mutex. */
+    wt_shared uint64_t done_count; /* Files finished. */
+    wt_shared uint32_t running;    /* Workers still running. */
+    wt_shared bool failed;         /* A worker has failed. */
+} WT_RTS_APPLY;
+
 /*
  * __rts_check_callback --
  *     Check if a single session has an active transaction or open cursors. Callback from the
@@ -105,6 +155,199 @@ __wt_rts_progress_msg(WT_SESSION_IMPL *session, WT_TIMER *rollback_start, uint64
     }
 }
 
+/*
+ * __rts_btree_skip_damage --
+ *     Ignore rollback to stable failures on files that don't exist or files where corruption is
+ *     detected.
+ */
+static int
+__rts_btree_skip_damage(WT_SESSION_IMPL *session, const char *uri, int error)
+{
+    if (error == ENOENT || (error == WT_ERROR && F_ISSET(S2C(session), WT_CONN_DATA_CORRUPTION))) {
+        __wt_verbose_multi(session, WT_VERB_RECOVERY_RTS(session),
+          WT_RTS_VERB_TAG_SKIP_DAMAGE
+          "%s: skipped performing rollback to stable because the file %s",
+          uri, error == ENOENT ? "does not exist" : "is corrupted.");
+        return (0);
+    }
+    return (error);
+}
+
+/*
+ * __rts_btree_apply_one --
+ *     Perform rollback to stable on a single file listed in the metadata.
+ */
+static int
+__rts_btree_apply_one(
+  WT_SESSION_IMPL *session, const char *uri, const char *config, wt_timestamp_t rollback_timestamp)
+{
+    WT_DECL_RET;
+
+    F_SET(session, WT_SESSION_QUIET_CORRUPT_FILE);
+    ret = __wt_rts_btree_walk_btree_apply(session, uri, config, rollback_timestamp);
+    F_CLR(session, WT_SESSION_QUIET_CORRUPT_FILE);
+
+    return (__rts_btree_skip_damage(session, uri, ret));
+}
+
+/*
+ * __rts_btree_queue_one --
+ *     Queue a file listed in the metadata for the worker threads, opening its handle if it needs
+ *     rolling back.
+ */
+static int
+__rts_btree_queue_one(
+  WT_SESSION_IMPL *session, WT_RTS_APPLY *apply, const char *uri, const char *config)
+{
+    WT_DATA_HANDLE *dhandle;
+    WT_DECL_RET;
+    WT_RTS_WORK_UNIT *entry;
+
+    F_SET(session, WT_SESSION_QUIET_CORRUPT_FILE);
+    ret = __wt_rts_btree_walk_btree_open(
+      session, uri, config, apply->rollback_timestamp, &dhandle);
+    F_CLR(session, WT_SESSION_QUIET_CORRUPT_FILE);
+
+    /* A file that can't be opened is skipped rather than queued. */
+    if (ret != 0)
+        return (__rts_btree_skip_damage(session, uri, ret));
+
+    if ((ret = __wt_calloc_one(session, &entry)) != 0) {
+        if (dhandle != NULL)
+            WT_WITH_DHANDLE(session, dhandle, WT_TRET(__wt_session_release_dhandle(session)));
+        return (ret);
+    }
+    entry->dhandle = dhandle;
+    TAILQ_INSERT_TAIL(&apply->qh, entry, q);
+    WT_RET(__wt_strdup(session, uri, &entry->uri));
+    WT_RET(__wt_strdup(session, config, &entry->config));
+    return (0);
+}
+
+/*
+ * __rts_work_free --
+ *     Free a queued file, releasing its handle.
+ */
+static int
+__rts_work_free(WT_SESSION_IMPL *session, WT_RTS_WORK_UNIT *entry)
+{
+    WT_DECL_RET;
+
+    if (entry->dhandle != NULL)
+        WT_WITH_DHANDLE(session, entry->dhandle, ret = __wt_session_release_dhandle(session));
+    __wt_free(session, entry->uri);
+    __wt_free(session, entry->config);
+    __wt_free(session, entry);
+    return (ret);
+}
+
+/*
+ * __rts_worker --
+ *     Roll back files from the shared queue until it is empty or a worker fails.
+ */
+static WT_THREAD_RET
+__rts_worker(void *arg)
+{
+    WT_DECL_RET;
+    WT_RTS_APPLY *apply;
+    WT_RTS_WORKER *worker;
+    WT_RTS_WORK_UNIT *entry;
+    WT_SESSION_IMPL *session;
+    bool failed;
+
+    worker = arg;
+    apply = worker->apply;
+    session = worker->session;
+
+    for (;;) {
+        WT_ORDERED_READ(failed, apply->failed);
+        if (failed)
+            break;
+
+        /* The entries are left on the queue, the coordinator releases their handles. */
+        __wt_spin_lock(session, &apply->lock);
+        if ((entry = apply->next) != NULL)
+            apply->next = TAILQ_NEXT(entry, q);
+        __wt_spin_unlock(session, &apply->lock);
+        if (entry == NULL)
+            break;
+
+        ret = __rts_btree_apply_one(session, entry->uri, entry->config, apply->rollback_timestamp);
+        (void)__wt_atomic_add64(&apply->done_count, 1);
+        if (ret != 0) {
+            worker->ret = ret;
+            WT_PUBLISH(apply->failed, true);
+            break;
+        }
+    }
+
+    (void)__wt_atomic_sub32(&apply->running, 1);
+    __wt_cond_signal(session, apply->cond);
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __rts_btree_apply_parallel --
+ *     Roll back the queued files with a set of worker threads, reporting progress while waiting for
+ *     them to finish.
+ */
+static int
+__rts_btree_apply_parallel(WT_SESSION_IMPL *session, WT_RTS_APPLY *apply, WT_TIMER *timer,
+  uint64_t max_count, uint64_t *rollback_msg_count)
+{
+    WT_DECL_RET;
+    WT_RTS_WORKER *worker;
+    uint64_t done_count;
+    uint32_t running;
+    u_int i;
+
+    apply->next = TAILQ_FIRST(&apply->qh);
+    WT_RET(__wt_cond_alloc(session, "rollback to stable", &apply->cond));
+    WT_RET(__wt_calloc_def(session, apply->nworkers, &apply->workers));
+    for (i = 0; i < apply->nworkers; ++i) {
+        worker = &apply->workers[i];
+        worker->apply = apply;
+        WT_ERR(__wt_open_internal_session(
+          S2C(session), "txn rollback_to_stable worker", true, 0, 0, &worker->session));
+        F_SET(worker->session, WT_SESSION_ROLLBACK_TO_STABLE);
+    }
+    for (i = 0; i < apply->nworkers; ++i) {
+        worker = &apply->workers[i];
+        (void)__wt_atomic_add32(&apply->running, 1);
+        if ((ret = __wt_thread_create(session, &worker->tid, __rts_worker, worker)) != 0) {
+            (void)__wt_atomic_sub32(&apply->running, 1);
+            WT_PUBLISH(apply->failed, true);
+            break;
+        }
+        worker->tid_set = true;
+    }
+
+    /* The aggregate progress across all of the workers is reported from this thread. */
+    for (;;) {
+        WT_ORDERED_READ(done_count, apply->done_count);
+        __wt_rts_progress_msg(session, timer, done_count, max_count, rollback_msg_count, false);
+        WT_ORDERED_READ(running, apply->running);
+        if (running == 0)
+            break;
+        __wt_cond_wait(session, apply->cond, 100 * WT_THOUSAND, NULL);
+    }
+
+err:
+    for (i = 0; i < apply->nworkers; ++i) {
+        worker = &apply->workers[i];
+        if (worker->tid_set) {
+            WT_TRET(__wt_thread_join(session, &worker->tid));
+            worker->tid_set = false;
+        }
+        WT_TRET(worker->ret);
+        if (worker->session != NULL) {
+            F_CLR(worker->session, WT_SESSION_ROLLBACK_TO_STABLE);
+            WT_TRET(__wt_session_close_internal(worker->session));
+        }
+    }
+    return (ret);
+}
+
 /*
  * __wt_rts_btree_apply_all --
  *     Perform rollback to stable to all files listed in the metadata, apart from the metadata and
@@ -115,6 +358,8 @@ __wt_rts_btree_apply_all(WT_SESSION_IMPL *session, wt_timestamp_t rollback_times
 {
     WT_CURSOR *cursor;
     WT_DECL_RET;
+    WT_RTS_APPLY apply;
+    WT_RTS_WORK_UNIT *entry;
     WT_TIMER timer;
     uint64_t max_count, rollback_count, rollback_msg_count;
     char ts_string[WT_TS_INT_STRING_SIZE];
@@ -124,12 +369,19 @@ __wt_rts_btree_apply_all(WT_SESSION_IMPL *session, wt_timestamp_t rollback_times
     __wt_timer_start(session, &timer);
     max_count = rollback_count = 0;
     rollback_msg_count = 0;
+    have_cursor = false;
+
+    WT_CLEAR(apply);
+    TAILQ_INIT(&apply.qh);
+    apply.nworkers = S2C(session)->rts->threads_num;
+    apply.rollback_timestamp = rollback_timestamp;
+    WT_RET(__wt_spin_init(session, &apply.lock, "rollback to stable"));
 
     /*
      * Walk the metadata first to count how many files we have overall. That allows us to give
      * signal about progress.
      */
-    WT_RET(__wt_metadata_cursor(session, &cursor));
+    WT_ERR(__wt_metadata_cursor(session, &cursor));
     have_cursor = true;
     while ((ret = cursor->next(cursor)) == 0) {
         WT_ERR(cursor->get_key(cursor, &uri));
@@ -143,32 +395,35 @@ __wt_rts_btree_apply_all(WT_SESSION_IMPL *session, wt_timestamp_t rollback_times
     WT_ERR(__wt_metadata_cursor(session, &cursor));
     have_cursor = true;
     while ((ret = cursor->next(cursor)) == 0) {
-        /* Log a progress message. */
         WT_ERR(cursor->get_key(cursor, &uri));
         WT_ERR(cursor->get_value(cursor, &config));
-        if (WT_BTREE_PREFIX(uri))
-            ++rollback_count;
-        __wt_rts_progress_msg(
-          session, &timer, rollback_count, max_count, &rollback_msg_count, false);
-
-        F_SET(session, WT_SESSION_QUIET_CORRUPT_FILE);
-        ret = __wt_rts_btree_walk_btree_apply(session, uri, config, rollback_timestamp);
-        F_CLR(session, WT_SESSION_QUIET_CORRUPT_FILE);
 
         /*
-         * Ignore rollback to stable failures on files that don't exist or files where corruption is
-         * detected.
+         * If configured, the files are queued and rolled back by worker threads once the metadata
+         * walk is complete. Each file is rolled back independently, including its history store
+         * entries, so the files can be processed in any order.
          */
-        if (ret == ENOENT || (ret == WT_ERROR && F_ISSET(S2C(session), WT_CONN_DATA_CORRUPTION))) {
-            __wt_verbose_multi(session, WT_VERB_RECOVERY_RTS(session),
-              WT_RTS_VERB_TAG_SKIP_DAMAGE
-              "%s: skipped performing rollback to stable because the file %s",
-              uri, ret == ENOENT ? "does not exist" : "is corrupted.");
+        if (apply.nworkers != 0) {
+            if (WT_BTREE_PREFIX(uri))
+                WT_ERR(__rts_btree_queue_one(session, &apply, uri, config));
             continue;
         }
-        WT_ERR(ret);
+
+        /* Log a progress message. */
+        if (WT_BTREE_PREFIX(uri))
+            ++rollback_count;
+        __wt_rts_progress_msg(
+          session, &timer, rollback_count, max_count, &rollback_msg_count, false);
+
+        WT_ERR(__rts_btree_apply_one(session, uri, config, rollback_timestamp));
     }
     WT_ERR_NOTFOUND_OK(ret, false);
+    WT_ERR(__wt_metadata_cursor_release(session, &cursor));
+    have_cursor = false;
+
+    if (apply.nworkers != 0)
+        WT_ERR(
+          __rts_btree_apply_parallel(session, &apply, &timer, max_count, &rollback_msg_count));
 
     /*
      * Performing eviction in parallel to a checkpoint can lead to a situation where the history
@@ -190,5 +445,12 @@ __wt_rts_btree_apply_all(WT_SESSION_IMPL *session, wt_timestamp_t rollback_times
 err:
     if (have_cursor)
         WT_TRET(__wt_metadata_cursor_release(session, &cursor));
+    while ((entry = TAILQ_FIRST(&apply.qh)) != NULL) {
+        TAILQ_REMOVE(&apply.qh, entry, q);
+        WT_TRET(__rts_work_free(session, entry));
+    }
+    __wt_free(session, apply.workers);
+    __wt_cond_destroy(session, &apply.cond);
+    __wt_spin_destroy(session, &apply.lock);
     return (ret);
 }
@@ -145,38 +145,40 @@ __rts_btree_walk(WT_SESSION_IMPL *session, wt_timestamp_t rollback_timestamp)
 }
 
 /*
- * __wt_rts_btree_walk_btree_apply --
- *     Perform rollback to stable on a single file.
+ * WT_RTS_BTREE_CKPT --
+ *	The checkpoint information used to decide whether a file needs rolling back.
  */
-int
-__wt_rts_btree_walk_btree_apply(
-  WT_SESSION_IMPL *session, const char *uri, const char *config, wt_timestamp_t rollback_timestamp)
+typedef struct {
+    wt_timestamp_t max_durable_ts;
+    uint64_t rollback_txnid;
+    size_t addr_size;
+    bool has_txn_updates_gt_than_ckpt_snap;
+    bool prepared_updates;
+    bool recovery_skip; /* Skipped by recovery */
+    bool rollback;      /* Tree needs rolling back */
+} WT_RTS_BTREE_CKPT;
+
+/*
+ * __rts_btree_walk_btree_check --
+ *     Decide whether a file needs rolling back, from its checkpoint information.
+ */
+static int
+__rts_btree_walk_btree_check(WT_SESSION_IMPL *session, const char *uri, const char *config,
+  wt_timestamp_t rollback_timestamp, WT_RTS_BTREE_CKPT *ckpt)
 {
-    WT_BTREE *btree;
     WT_CONFIG ckptconf;
     WT_CONFIG_ITEM cval, value, key;
     WT_DECL_RET;
-    wt_timestamp_t max_durable_ts, newest_start_durable_ts, newest_stop_durable_ts;
-    size_t addr_size;
-    uint64_t rollback_txnid, write_gen;
-    uint32_t btree_id;
+    wt_timestamp_t newest_start_durable_ts, newest_stop_durable_ts;
+    uint64_t write_gen;
     char ts_string[2][WT_TS_INT_STRING_SIZE];
-    bool dhandle_allocated, has_txn_updates_gt_than_ckpt_snap, modified;
-    bool prepared_updates;
-
-    /* Ignore non-btree objects as well as the metadata and history store files. */
-    if (!WT_BTREE_PREFIX(uri) || strcmp(uri, WT_HS_URI) == 0 || strcmp(uri, WT_METAFILE_URI) == 0)
-        return (0);
+    bool modified;
 
-    addr_size = 0;
-    rollback_txnid = 0;
+    WT_CLEAR(*ckpt);
     write_gen = 0;
-    dhandle_allocated = false;
-    btree = NULL;
 
     /* Find out the max durable timestamp of the object from checkpoint. */
     newest_start_durable_ts = newest_stop_durable_ts = WT_TS_NONE;
-    prepared_updates = has_txn_updates_gt_than_ckpt_snap = false;
 
     WT_RET(__wt_config_getones(session, config, "checkpoint", &cval));
     __wt_config_subinit(session, &ckptconf, &cval);
@@ -192,16 +194,16 @@ __wt_rts_btree_walk_btree_apply(
         ret = __wt_config_subgets(session, &cval, "prepare", &value);
         if (ret == 0) {
             if (value.val)
-                prepared_updates = true;
+                ckpt->prepared_updates = true;
         }
         WT_RET_NOTFOUND_OK(ret);
         ret = __wt_config_subgets(session, &cval, "newest_txn", &value);
         if (ret == 0)
-            rollback_txnid = (uint64_t)value.val;
+            ckpt->rollback_txnid = (uint64_t)value.val;
         WT_RET_NOTFOUND_OK(ret);
         ret = __wt_config_subgets(session, &cval, "addr", &value);
         if (ret == 0)
-            addr_size = value.len;
+            ckpt->addr_size = value.len;
         WT_RET_NOTFOUND_OK(ret);
         ret = __wt_config_subgets(session, &cval, "write_gen", &value);
         if (ret == 0)
@@ -215,10 +217,10 @@ __wt_rts_btree_walk_btree_apply(
               "newest_stop_durable_timestamp=%s, "
               "rollback_txnid=%" PRIu64 ", write_gen=%" PRIu64,
               __wt_timestamp_to_string(newest_start_durable_ts, ts_string[0]),
-              __wt_timestamp_to_string(newest_stop_durable_ts, ts_string[1]), rollback_txnid,
+              __wt_timestamp_to_string(newest_stop_durable_ts, ts_string[1]), ckpt->rollback_txnid,
               write_gen);
     }
-    max_durable_ts = WT_MAX(newest_start_durable_ts, newest_stop_durable_ts);
+    ckpt->max_durable_ts = WT_MAX(newest_start_durable_ts, newest_stop_durable_ts);
 
     /*
      * Perform rollback to stable when the newest written transaction of the btree is greater than
@@ -226,12 +228,9 @@ __wt_rts_btree_walk_btree_apply(
      * write generation number is greater than the last checkpoint connection base write generation
      * to confirm that the btree is modified in the previous restart cycle.
      */
-    if (WT_CHECK_RECOVERY_FLAG_TXNID(session, rollback_txnid) &&
-      (write_gen >= S2C(session)->last_ckpt_base_write_gen)) {
-        has_txn_updates_gt_than_ckpt_snap = true;
-        /* Increment the inconsistent checkpoint stats counter. */
-        WT_STAT_CONN_DATA_INCR(session, txn_rts_inconsistent_ckpt);
-    }
+    if (WT_CHECK_RECOVERY_FLAG_TXNID(session, ckpt->rollback_txnid) &&
+      (write_gen >= S2C(session)->last_ckpt_base_write_gen))
+        ckpt->has_txn_updates_gt_than_ckpt_snap = true;
 
     /*
      * During recovery, a table is skipped by RTS if one of the conditions is met:
@@ -239,11 +238,9 @@ __wt_rts_btree_walk_btree_apply(
      * 2. The table has timestamped updates without a stable timestamp.
      */
     if (F_ISSET(S2C(session), WT_CONN_RECOVERING) &&
-      (addr_size == 0 || (rollback_timestamp == WT_TS_NONE && max_durable_ts != WT_TS_NONE))) {
-        __wt_verbose_multi(session, WT_VERB_RECOVERY_RTS(session),
-          WT_RTS_VERB_TAG_FILE_SKIP "skipping rollback to stable on file=%s because %s ", uri,
-          addr_size == 0 ? "has never been checkpointed" :
-                           "has timestamped updates and the stable timestamp is 0");
+      (ckpt->addr_size == 0 ||
+        (rollback_timestamp == WT_TS_NONE && ckpt->max_durable_ts != WT_TS_NONE))) {
+        ckpt->recovery_skip = true;
         return (0);
     }
 
@@ -257,12 +254,90 @@ __wt_rts_btree_walk_btree_apply(
     WT_WITHOUT_DHANDLE(session,
       WT_WITH_HANDLE_LIST_READ_LOCK(
         session, (ret = __rts_btree_walk_check_btree_modified(session, uri, &modified))));
+    WT_RET_NOTFOUND_OK(ret);
+
+    ckpt->rollback = modified || ckpt->max_durable_ts > rollback_timestamp ||
+      ckpt->prepared_updates || ckpt->has_txn_updates_gt_than_ckpt_snap;
+    return (0);
+}
 
-    WT_ERR_NOTFOUND_OK(ret, false);
+/*
+ * __wt_rts_btree_walk_btree_open --
+ *     Open a handle on a file if it needs rolling back, returning the handle, still referenced by
+ *     the session, or NULL if the file doesn't need rolling back. A caller holding the schema lock
+ *     opens the handles of files it hands to worker threads, as the workers would otherwise need
+ *     the schema lock to open them.
+ */
+int
+__wt_rts_btree_walk_btree_open(WT_SESSION_IMPL *session, const char *uri, const char *config,
+  wt_timestamp_t rollback_timestamp, WT_DATA_HANDLE **dhandlep)
+{
+    WT_DATA_HANDLE *saved_dhandle;
+    WT_DECL_RET;
+    WT_RTS_BTREE_CKPT ckpt;
+
+    *dhandlep = NULL;
+
+    /* Ignore non-btree objects as well as the metadata and history store files. */
+    if (!WT_BTREE_PREFIX(uri) || strcmp(uri, WT_HS_URI) == 0 || strcmp(uri, WT_METAFILE_URI) == 0)
+        return (0);
+
+    WT_RET(__rts_btree_walk_btree_check(session, uri, config, rollback_timestamp, &ckpt));
+    if (ckpt.recovery_skip || !ckpt.rollback)
+        return (0);
+
+    saved_dhandle = session->dhandle;
+    if ((ret = __wt_session_get_dhandle(session, uri, NULL, NULL, 0)) == 0)
+        *dhandlep = session->dhandle;
+    session->dhandle = saved_dhandle;
+    if (ret != 0)
+        WT_RET_MSG(session, ret, "%s: unable to open handle%s", uri,
+          ret == EBUSY ? ", error indicates handle is unavailable due to concurrent use" : "");
+    return (0);
+}
+
+/*
+ * __wt_rts_btree_walk_btree_apply --
+ *     Perform rollback to stable on a single file.
+ */
+int
+__wt_rts_btree_walk_btree_apply(
+  WT_SESSION_IMPL *session, const char *uri, const char *config, wt_timestamp_t rollback_timestamp)
+{
+    WT_BTREE *btree;
+    WT_CONFIG_ITEM cval;
+    WT_DECL_RET;
+    WT_RTS_BTREE_CKPT ckpt;
+    uint32_t btree_id;
+    char ts_string[2][WT_TS_INT_STRING_SIZE];
+    bool dhandle_allocated;
+
+    /* Ignore non-btree objects as well as the metadata and history store files. */
+    if (!WT_BTREE_PREFIX(uri) || strcmp(uri, WT_HS_URI) == 0 || strcmp(uri, WT_METAFILE_URI) == 0)
+        return (0);
+
+    dhandle_allocated = false;
+    btree = NULL;
+
+    WT_RET(__rts_btree_walk_btree_check(session, uri, config, rollback_timestamp, &ckpt));
+
+    /* Increment the inconsistent checkpoint stats counter. */
+    if (ckpt.has_txn_updates_gt_than_ckpt_snap)
+        WT_STAT_CONN_DATA_INCR(session, txn_rts_inconsistent_ckpt);
+
+    if (ckpt.recovery_skip) {
+        __wt_verbose_multi(session, WT_VERB_RECOVERY_RTS(session),
+          WT_RTS_VERB_TAG_FILE_SKIP "skipping rollback to stable on file=%s because %s ", uri,
+          ckpt.addr_size == 0 ? "has never been checkpointed" :
+                                "has timestamped updates and the stable timestamp is 0");
+        return (0);
+    }
 
-    if (modified || max_durable_ts > rollback_timestamp || prepared_updates ||
-      has_txn_updates_gt_than_ckpt_snap) {
-        /* Open a handle for processing. */
+    if (ckpt.rollback) {
+        /*
+         * Open a handle for processing. If this is a worker thread, the thread that queued the file
+         * has already opened the handle and this only takes another reference to it.
+         */
         ret = __wt_session_get_dhandle(session, uri, NULL, NULL, 0);
         if (ret != 0)
             WT_ERR_MSG(session, ret, "%s: unable to open handle%s", uri,
@@ -276,11 +351,12 @@ __wt_rts_btree_walk_btree_apply(
                                "has_prepared_updates=%s, txnid=%" PRIu64
                                " > recovery_checkpoint_snap_min=%" PRIu64 ": %s",
           uri, btree->id, btree->modified ? "true" : "false",
-          __wt_timestamp_to_string(max_durable_ts, ts_string[0]),
+          __wt_timestamp_to_string(ckpt.max_durable_ts, ts_string[0]),
           __wt_timestamp_to_string(rollback_timestamp, ts_string[1]),
-          max_durable_ts > rollback_timestamp ? "true" : "false",
-          prepared_updates ? "true" : "false", rollback_txnid, S2C(session)->recovery_ckpt_snap_min,
-          has_txn_updates_gt_than_ckpt_snap ? "true" : "false");
+          ckpt.max_durable_ts > rollback_timestamp ? "true" : "false",
+          ckpt.prepared_updates ? "true" : "false", ckpt.rollback_txnid,
+          S2C(session)->recovery_ckpt_snap_min,
+          ckpt.has_txn_updates_gt_than_ckpt_snap ? "true" : "false");
 
         WT_ERR(__wt_rts_btree_walk_btree(session, rollback_timestamp));
     } else
@@ -289,10 +365,11 @@ __wt_rts_btree_walk_btree_apply(
           "%s: tree skipped with durable_timestamp=%s and stable_timestamp=%s or txnid=%" PRIu64
           " has_prepared_updates=%s, txnid=%" PRIu64 " > recovery_checkpoint_snap_min=%" PRIu64
           ": %s",
-          uri, __wt_timestamp_to_string(max_durable_ts, ts_string[0]),
-          __wt_timestamp_to_string(rollback_timestamp, ts_string[1]), rollback_txnid,
-          prepared_updates ? "true" : "false", rollback_txnid, S2C(session)->recovery_ckpt_snap_min,
-          has_txn_updates_gt_than_ckpt_snap ? "true" : "false");
+          uri, __wt_timestamp_to_string(ckpt.max_durable_ts, ts_string[0]),
+          __wt_timestamp_to_string(rollback_timestamp, ts_string[1]), ckpt.rollback_txnid,
+          ckpt.prepared_updates ? "true" : "false", ckpt.rollback_txnid,
+          S2C(session)->recovery_ckpt_snap_min,
+          ckpt.has_txn_updates_gt_than_ckpt_snap ? "true" : "false");
 
     /*
      * Truncate history store entries for the non-timestamped table.
@@ -303,7 +380,7 @@ __wt_rts_btree_walk_btree_apply(
      * timestamp to WT_TS_NONE, we need this exception.
      * 2. In-memory database - In this scenario, there is no history store to truncate.
      */
-    if ((!dhandle_allocated || !btree->modified) && max_durable_ts == WT_TS_NONE &&
+    if ((!dhandle_allocated || !btree->modified) && ckpt.max_durable_ts == WT_TS_NONE &&
       !F_ISSET(S2C(session), WT_CONN_IN_MEMORY)) {
         WT_ERR(__wt_config_getones(session, config, "id", &cval));
         btree_id = (uint32_t)cval.val;
@@ -10,6 +10,14 @@
 
 static int __session_rollback_transaction(WT_SESSION *, const char *);
 
+/*
+ * Define functions that increment the per-call latency histograms for transaction and checkpoint
+ * methods.
+ */
+WT_STAT_LATENCY_HIST_INCR_FUNC(checkpoint, perf_hist_checkpoint_latency)
+WT_STAT_LATENCY_HIST_INCR_FUNC(txn_begin, perf_hist_txn_begin_latency)
+WT_STAT_LATENCY_HIST_INCR_FUNC(txn_commit, perf_hist_txn_commit_latency)
+
 /*
  * __wt_session_notsup --
  *     Unsupported session method.
@@ -241,10 +249,10 @@ __session_clear(WT_SESSION_IMPL *session)
 
 /*
  * __session_close_cursors --
- *     Close all cursors in a list.
+ *     Close all cursors in a list, optionally handing cached cursors to the connection's pool.
  */
 static int
-__session_close_cursors(WT_SESSION_IMPL *session, WT_CURSOR_LIST *cursors)
+__session_close_cursors(WT_SESSION_IMPL *session, WT_CURSOR_LIST *cursors, bool pool)
 {
     WT_CURSOR *cursor, *cursor_tmp;
     WT_DECL_RET;
@@ -252,12 +260,16 @@ __session_close_cursors(WT_SESSION_IMPL *session, WT_CURSOR_LIST *cursors)
     /* Close all open cursors. */
     WT_TAILQ_SAFE_REMOVE_BEGIN(cursor, cursors, q, cursor_tmp)
     {
-        if (F_ISSET(cursor, WT_CURSTD_CACHED))
+        if (F_ISSET(cursor, WT_CURSTD_CACHED)) {
+            /* Hand the cached cursor to the connection's pool if the pool will take it. */
+            if (pool && __wt_cursor_pool_put(session, cursor) == 0)
+                continue;
+
             /*
              * Put the cached cursor in an open state that allows it to be closed.
              */
             WT_TRET_NOTFOUND_OK(cursor->reopen(cursor, false));
-        else if (session->event_handler->handle_close != NULL &&
+        } else if (session->event_handler->handle_close != NULL &&
           strcmp(cursor->internal_uri, WT_HS_URI) != 0)
             /*
              * Notify the user that we are closing the cursor handle via the registered close
@@ -275,16 +287,16 @@ __session_close_cursors(WT_SESSION_IMPL *session, WT_CURSOR_LIST *cursors)
 
 /*
  * __session_close_cached_cursors --
- *     Fully close all cached cursors.
+ *     Close all cached cursors, handing them to the connection's pool if requested.
  */
 static int
-__session_close_cached_cursors(WT_SESSION_IMPL *session)
+__session_close_cached_cursors(WT_SESSION_IMPL *session, bool pool)
 {
     WT_DECL_RET;
     uint64_t i;
 
     for (i = 0; i < S2C(session)->hash_size; i++)
-        WT_TRET(__session_close_cursors(session, &session->cursor_cache[i]));
+        WT_TRET(__session_close_cursors(session, &session->cursor_cache[i], pool));
     return (ret);
 }
 
@@ -353,8 +365,8 @@ __wt_session_close_internal(WT_SESSION_IMPL *session)
      * Close all open cursors. We don't need to explicitly close the session's pointer to the
      * history store cursor since it will also be included in session's cursor table.
      */
-    WT_TRET(__session_close_cursors(session, &session->cursors));
-    WT_TRET(__session_close_cached_cursors(session));
+    WT_TRET(__session_close_cursors(session, &session->cursors, true));
+    WT_TRET(__session_close_cached_cursors(session, true));
 
     WT_ASSERT(session, session->ncursors == 0);
 
@@ -470,7 +482,7 @@ __session_reconfigure(WT_SESSION *wt_session, const char *config)
             F_SET(session, WT_SESSION_CACHE_CURSORS);
         else {
             F_CLR(session, WT_SESSION_CACHE_CURSORS);
-            WT_ERR(__session_close_cached_cursors(session));
+            WT_ERR(__session_close_cached_cursors(session, false));
         }
     }
     WT_ERR_NOTFOUND_OK(ret, false);
@@ -1924,6 +1936,7 @@ __session_begin_transaction(WT_SESSION *wt_session, const char *config)
 {
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
+    uint64_t time_start, time_stop;
 
     session = (WT_SESSION_IMPL *)wt_session;
     SESSION_API_CALL_PREPARE_NOT_ALLOWED(session, begin_transaction, config, cfg);
@@ -1932,7 +1945,10 @@ __session_begin_transaction(WT_SESSION *wt_session, const char *config)
 
     WT_ERR(__wt_txn_context_check(session, false));
 
+    time_start = __wt_clock(session);
     ret = __wt_txn_begin(session, cfg);
+    time_stop = __wt_clock(session);
+    __wt_stat_latency_hist_incr_txn_begin(session, WT_CLOCKDIFF_US(time_stop, time_start));
 
 err:
 #ifdef HAVE_CALL_LOG
@@ -1970,6 +1986,7 @@ __session_commit_transaction(WT_SESSION *wt_session, const char *config)
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
     WT_TXN *txn;
+    uint64_t time_start, time_stop;
 
     session = (WT_SESSION_IMPL *)wt_session;
     txn = session->txn;
@@ -1997,7 +2014,10 @@ err:
      */
     if (ret == 0) {
         F_SET(session, WT_SESSION_RESOLVING_TXN);
+        time_start = __wt_clock(session);
         ret = __wt_txn_commit(session, cfg);
+        time_stop = __wt_clock(session);
+        __wt_stat_latency_hist_incr_txn_commit(session, WT_CLOCKDIFF_US(time_stop, time_start));
         F_CLR(session, WT_SESSION_RESOLVING_TXN);
     } else if (F_ISSET(txn, WT_TXN_RUNNING)) {
         if (F_ISSET(txn, WT_TXN_PREPARE))
@@ -2361,6 +2381,89 @@ err:
     API_END_RET(session, ret);
 }
 
+/*
+ * __session_transaction_sync --
+ *     WT_SESSION->transaction_sync method.
+ */
+static int
+__session_transaction_sync(WT_SESSION *wt_session, const char *config)
+{
+    WT_CONFIG_ITEM cval;
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_LOG *log;
+    WT_SESSION_IMPL *session;
+    struct timespec now, start;
+    uint64_t timeout_ms, waited_ms;
+
+    session = (WT_SESSION_IMPL *)wt_session;
+    SESSION_API_CALL(session, transaction_sync, config, cfg);
+    WT_STAT_CONN_INCR(session, txn_sync);
+
+    conn = S2C(session);
+    WT_ERR(__wt_txn_context_check(session, false));
+
+    /*
+     * If logging is not enabled there is nothing to do.
+     */
+    if (!FLD_ISSET(conn->log_flags, WT_CONN_LOG_ENABLED))
+        WT_ERR_MSG(session, EINVAL, "logging not enabled");
+
+    log = conn->log;
+
+    /*
+     * If there is no background sync LSN in this session, or the log has been synchronized past it,
+     * the session's last background commit is durable and we're done.
+     */
+    if (WT_IS_ZERO_LSN(&session->bg_sync_lsn) ||
+      __wt_log_cmp(&session->bg_sync_lsn, &log->sync_lsn) < 0)
+        goto err;
+
+    WT_ERR(__wt_config_gets_def(session, cfg, "timeout_ms", (int)WT_SESSION_BG_SYNC_MSEC, &cval));
+    timeout_ms = (uint64_t)cval.val;
+    if (timeout_ms == 0)
+        WT_ERR(ETIMEDOUT);
+
+    /*
+     * Keep waking the log file server and checking the sync LSN until our LSN is durable, we reach
+     * our timeout or the log server is shutting down.
+     */
+    __wt_epoch(session, &start);
+    while (__wt_log_cmp(&session->bg_sync_lsn, &log->sync_lsn) >= 0) {
+        if (!FLD_ISSET(conn->server_flags, WT_CONN_SERVER_LOG))
+            WT_ERR(ETIMEDOUT);
+        __wt_cond_signal(session, conn->log_file_cond);
+        __wt_epoch(session, &now);
+        waited_ms = WT_TIMEDIFF_MS(now, start);
+        if (waited_ms >= timeout_ms)
+            WT_ERR(ETIMEDOUT);
+        __wt_cond_wait(session, log->log_sync_cond, WT_THOUSAND, NULL);
+    }
+
+err:
+    API_END_RET(session, ret);
+}
+
+/*
+ * __session_transaction_sync_readonly --
+ *     WT_SESSION->transaction_sync method; readonly version.
+ */
+static int
+__session_transaction_sync_readonly(WT_SESSION *wt_session, const char *config)
+{
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+
+    WT_UNUSED(config);
+
+    session = (WT_SESSION_IMPL *)wt_session;
+    SESSION_API_CALL_NOCONF(session, transaction_sync);
+
+    ret = __wt_session_notsup(session);
+err:
+    API_END_RET(session, ret);
+}
+
 /*
  * __session_get_rollback_reason --
  *     WT_SESSION->get_rollback_reason method.
@@ -2384,6 +2487,7 @@ __session_checkpoint(WT_SESSION *wt_session, const char *config)
 {
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
+    uint64_t time_start, time_stop;
 
     session = (WT_SESSION_IMPL *)wt_session;
     WT_STAT_CONN_INCR(session, checkpoints_api);
@@ -2404,7 +2508,10 @@ __session_checkpoint(WT_SESSION *wt_session, const char *config)
      */
     WT_ERR(__wt_txn_context_check(session, false));
 
+    time_start = __wt_clock(session);
     ret = __wt_txn_checkpoint(session, cfg, true);
+    time_stop = __wt_clock(session);
+    __wt_stat_latency_hist_incr_checkpoint(session, WT_CLOCKDIFF_US(time_stop, time_start));
 
     /*
      * Release common session resources (for example, checkpoint may acquire significant
@@ -2479,7 +2586,8 @@ __open_session(WT_CONNECTION_IMPL *conn, WT_EVENT_HANDLER *event_handler, const
         __session_begin_transaction, __session_commit_transaction, __session_prepare_transaction,
         __session_rollback_transaction, __session_query_timestamp, __session_timestamp_transaction,
         __session_timestamp_transaction_uint, __session_checkpoint, __session_reset_snapshot,
-        __session_transaction_pinned_range, __session_get_rollback_reason, __wt_session_breakpoint},
+        __session_transaction_pinned_range, __session_transaction_sync,
+        __session_get_rollback_reason, __wt_session_breakpoint},
       stds_min = {NULL, NULL, __session_close, __session_reconfigure_notsup, __wt_session_strerror,
         __session_open_cursor, __session_alter_readonly, __session_create_readonly,
         __wt_session_compact_readonly, __session_drop_readonly, __session_join_notsup,
@@ -2490,8 +2598,8 @@ __open_session(WT_CONNECTION_IMPL *conn, WT_EVENT_HANDLER *event_handler, const
         __session_rollback_transaction_notsup, __session_query_timestamp_notsup,
         __session_timestamp_transaction_notsup, __session_timestamp_transaction_uint_notsup,
         __session_checkpoint_readonly, __session_reset_snapshot_notsup,
-        __session_transaction_pinned_range_notsup, __session_get_rollback_reason,
-        __wt_session_breakpoint},
+        __session_transaction_pinned_range_notsup, __session_transaction_sync_readonly,
+        __session_get_rollback_reason, __wt_session_breakpoint},
       stds_readonly = {NULL, NULL, __session_close, __session_reconfigure, __wt_session_strerror,
         __session_open_cursor, __session_alter_readonly, __session_create_readonly,
         __wt_session_compact_readonly, __session_drop_readonly, __session_join,
@@ -2501,7 +2609,8 @@ __open_session(WT_CONNECTION_IMPL *conn, WT_EVENT_HANDLER *event_handler, const
         __session_commit_transaction, __session_prepare_transaction_readonly,
         __session_rollback_transaction, __session_query_timestamp, __session_timestamp_transaction,
         __session_timestamp_transaction_uint, __session_checkpoint_readonly,
-        __session_reset_snapshot, __session_transaction_pinned_range, __session_get_rollback_reason,
+        __session_reset_snapshot, __session_transaction_pinned_range,
+        __session_transaction_sync_readonly, __session_get_rollback_reason,
         __wt_session_breakpoint};
     WT_DECL_RET;
     WT_SESSION_IMPL *session, *session_ret;
@@ -2609,13 +2718,15 @@ __open_session(WT_CONNECTION_IMPL *conn, WT_EVENT_HANDLER *event_handler, const
     }
 
     /*
-     * Cache the offset of this session's statistics bucket. It's important we pass the correct
-     * session to the hash define here or we'll calculate the stat bucket with the wrong session id.
+     * Cache the offsets of this session's statistics buckets. It's important we pass the correct
+     * session here or we'll calculate the stat buckets with the wrong session id.
      */
-    session_ret->stat_bucket = WT_STATS_SLOT_ID(session_ret);
+    __wt_stat_bucket_set(session_ret, true);
 
     /* Safety check to make sure we're doing the right thing. */
-    WT_ASSERT(session, session_ret->stat_bucket == session_ret->id % WT_COUNTER_SLOTS);
+    WT_ASSERT(session,
+      session_ret->stat_bucket < WT_COUNTER_SLOTS &&
+        session_ret->stat_conn_bucket < conn->stat_slots);
 
     /* Allocate the buffer for operation tracking */
     if (F_ISSET(conn, WT_CONN_OPTRACK)) {
@@ -756,19 +756,19 @@ __wt_session_dhandle_sweep(WT_SESSION_IMPL *session)
 
 /*
  * __session_find_shared_dhandle --
- *     Search for a data handle in the connection and add it to a session's cache. We must increment
- *     the handle's reference count while holding the handle list lock.
+ *     Search for a data handle in the connection and add it to a session's cache. Existing handles
+ *     are found and referenced without locking, creating a handle requires the handle list lock.
  */
 static int
 __session_find_shared_dhandle(WT_SESSION_IMPL *session, const char *uri, const char *checkpoint)
 {
     WT_DECL_RET;
 
-    WT_WITH_HANDLE_LIST_READ_LOCK(session,
-      if ((ret = __wt_conn_dhandle_find(session, uri, checkpoint)) == 0)
-        WT_DHANDLE_ACQUIRE(session->dhandle));
-
-    if (ret != WT_NOTFOUND)
+    /*
+     * If the lookup doesn't find the handle (or the handle is being removed), allocate it: that
+     * searches again holding the handle list write lock, and waits for any removal to complete.
+     */
+    if ((ret = __wt_conn_dhandle_find_acquire(session, uri, checkpoint)) != WT_NOTFOUND)
         return (ret);
 
     WT_WITH_HANDLE_LIST_WRITE_LOCK(session,
@@ -162,6 +162,9 @@ __global_once(void)
     __wt_process.checksum = wiredtiger_crc32c_func();
     __wt_process.checksum_with_seed = wiredtiger_crc32c_with_seed_func();
 
+    /* Select the vectorized key comparison functions the CPU supports. */
+    __wt_btree_vector_init();
+
     __global_calibrate_ticks();
 
     /* Run-time configuration. */
@@ -130,7 +130,7 @@ __wt_try_readlock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
     WT_STAT_CONN_INCR(session, rwlock_read);
     if (l->stat_read_count_off != -1 && WT_STAT_ENABLED(session)) {
         stats = (int64_t **)S2C(session)->stats;
-        stats[session->stat_bucket][l->stat_read_count_off]++;
+        stats[session->stat_conn_bucket][l->stat_read_count_off]++;
     }
 
     old.u.v = l->u.v;
@@ -246,12 +246,12 @@ stall:
         time_diff = WT_CLOCKDIFF_US(time_stop, time_start);
 
         stats = (int64_t **)S2C(session)->stats;
-        stats[session->stat_bucket][l->stat_read_count_off]++;
+        stats[session->stat_conn_bucket][l->stat_read_count_off]++;
         session_stats = (int64_t *)&(session->stats);
         if (F_ISSET(session, WT_SESSION_INTERNAL))
-            stats[session->stat_bucket][l->stat_int_usecs_off] += (int64_t)time_diff;
+            stats[session->stat_conn_bucket][l->stat_int_usecs_off] += (int64_t)time_diff;
         else {
-            stats[session->stat_bucket][l->stat_app_usecs_off] += (int64_t)time_diff;
+            stats[session->stat_conn_bucket][l->stat_app_usecs_off] += (int64_t)time_diff;
         }
 
         /*
@@ -311,7 +311,7 @@ __wt_try_writelock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
     WT_STAT_CONN_INCR(session, rwlock_write);
     if (l->stat_write_count_off != -1 && WT_STAT_ENABLED(session)) {
         stats = (int64_t **)S2C(session)->stats;
-        stats[session->stat_bucket][l->stat_write_count_off]++;
+        stats[session->stat_conn_bucket][l->stat_write_count_off]++;
     }
 
     /*
@@ -412,12 +412,12 @@ __wt_writelock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
         time_diff = WT_CLOCKDIFF_US(time_stop, time_start);
 
         stats = (int64_t **)S2C(session)->stats;
-        stats[session->stat_bucket][l->stat_write_count_off]++;
+        stats[session->stat_conn_bucket][l->stat_write_count_off]++;
         session_stats = (int64_t *)&(session->stats);
         if (F_ISSET(session, WT_SESSION_INTERNAL))
-            stats[session->stat_bucket][l->stat_int_usecs_off] += (int64_t)time_diff;
+            stats[session->stat_conn_bucket][l->stat_int_usecs_off] += (int64_t)time_diff;
         else
-            stats[session->stat_bucket][l->stat_app_usecs_off] += (int64_t)time_diff;
+            stats[session->stat_conn_bucket][l->stat_app_usecs_off] += (int64_t)time_diff;
 
         /*
          * Not all read-write locks increment session statistics. Check whether the offset is
@@ -41,6 +41,7 @@ static const char *const __stats_dsrc_desc[] = {
   "btree: column-store variable-size deleted values",
   "btree: column-store variable-size leaf pages",
   "btree: fixed-record size",
+  "btree: maximum compare-and-swap retries and restarts modifying a page between reconciliations",
   "btree: maximum internal page size",
   "btree: maximum leaf page key size",
   "btree: maximum leaf page size",
@@ -110,6 +111,7 @@ static const char *const __stats_dsrc_desc[] = {
   "cache: history store table writes requiring squashed modifies",
   "cache: in-memory page passed criteria to be split",
   "cache: in-memory page splits",
+  "cache: in-memory page splits queued for contended pages",
   "cache: internal page split blocked its eviction",
   "cache: internal pages evicted",
   "cache: internal pages split during eviction",
@@ -212,8 +214,10 @@ static const char *const __stats_dsrc_desc[] = {
   "cursor: cursor equals calls that return an error",
   "cursor: cursor get key calls that return an error",
   "cursor: cursor get value calls that return an error",
+  "cursor: cursor insert batch calls that return an error",
   "cursor: cursor insert calls that return an error",
   "cursor: cursor insert check calls that return an error",
+  "cursor: cursor insert list compare-and-swap restarts",
   "cursor: cursor largest key calls that return an error",
   "cursor: cursor modify calls that return an error",
   "cursor: cursor next calls that return an error",
@@ -230,12 +234,18 @@ static const char *const __stats_dsrc_desc[] = {
   "cursor: cursor reopen calls that return an error",
   "cursor: cursor reserve calls that return an error",
   "cursor: cursor reset calls that return an error",
+  "cursor: cursor search batch calls that return an error",
+  "cursor: cursor search calls resolved by a leaf page Bloom filter without reading the page",
   "cursor: cursor search calls that return an error",
   "cursor: cursor search near calls that return an error",
   "cursor: cursor update calls that return an error",
+  "cursor: cursor update chain compare-and-swap retries",
+  "cursor: insert batch calls",
+  "cursor: insert batch keys inserted",
   "cursor: insert calls",
   "cursor: insert key and value bytes",
   "cursor: modify",
+  "cursor: modify calls that write the full value",
   "cursor: modify key and value bytes affected",
   "cursor: modify value bytes modified",
   "cursor: next calls",
@@ -246,6 +256,8 @@ static const char *const __stats_dsrc_desc[] = {
   "cursor: remove key bytes removed",
   "cursor: reserve calls",
   "cursor: reset calls",
+  "cursor: search batch calls",
+  "cursor: search batch keys searched",
   "cursor: search calls",
   "cursor: search history store calls",
   "cursor: search near calls",
@@ -343,6 +355,7 @@ __wt_stat_dsrc_init(WT_SESSION_IMPL *session, WT_DATA_HANDLE *handle)
         handle->stats[i] = &handle->stat_array[i];
         __wt_stat_dsrc_init_single(handle->stats[i]);
     }
+    handle->stats[WT_COUNTER_SLOTS] = NULL;
     return (0);
 }
 
@@ -393,6 +406,7 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->btree_column_deleted = 0;
     stats->btree_column_variable = 0;
     stats->btree_fixed_len = 0;
+    stats->btree_contention_max = 0;
     stats->btree_maxintlpage = 0;
     stats->btree_maxleafkey = 0;
     stats->btree_maxleafpage = 0;
@@ -451,6 +465,7 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->cache_hs_write_squash = 0;
     stats->cache_inmem_splittable = 0;
     stats->cache_inmem_split = 0;
+    stats->cache_inmem_split_contended = 0;
     stats->cache_eviction_blocked_internal_page_split = 0;
     stats->cache_eviction_internal = 0;
     stats->cache_eviction_split_internal = 0;
@@ -549,8 +564,10 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->cursor_equals_error = 0;
     stats->cursor_get_key_error = 0;
     stats->cursor_get_value_error = 0;
+    stats->cursor_insert_batch_error = 0;
     stats->cursor_insert_error = 0;
     stats->cursor_insert_check_error = 0;
+    stats->cursor_insert_list_restart = 0;
     stats->cursor_largest_key_error = 0;
     stats->cursor_modify_error = 0;
     stats->cursor_next_error = 0;
@@ -567,12 +584,18 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->cursor_reopen_error = 0;
     stats->cursor_reserve_error = 0;
     stats->cursor_reset_error = 0;
+    stats->cursor_search_batch_error = 0;
+    stats->cursor_search_leaf_bloom_skip = 0;
     stats->cursor_search_error = 0;
     stats->cursor_search_near_error = 0;
     stats->cursor_update_error = 0;
+    stats->cursor_update_cas_retry = 0;
+    stats->cursor_insert_batch = 0;
+    stats->cursor_insert_batch_keys = 0;
     stats->cursor_insert = 0;
     stats->cursor_insert_bytes = 0;
     stats->cursor_modify = 0;
+    stats->cursor_modify_full_value = 0;
     stats->cursor_modify_bytes = 0;
     stats->cursor_modify_bytes_touch = 0;
     stats->cursor_next = 0;
@@ -583,6 +606,8 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->cursor_remove_bytes = 0;
     stats->cursor_reserve = 0;
     stats->cursor_reset = 0;
+    stats->cursor_search_batch = 0;
+    stats->cursor_search_batch_keys = 0;
     stats->cursor_search = 0;
     stats->cursor_search_hs = 0;
     stats->cursor_search_near = 0;
@@ -654,7 +679,7 @@ __wt_stat_dsrc_clear_all(WT_DSRC_STATS **stats)
 {
     u_int i;
 
-    for (i = 0; i < WT_COUNTER_SLOTS; ++i)
+    for (i = 0; stats[i] != NULL; ++i)
         __wt_stat_dsrc_clear_single(stats[i]);
 }
 
@@ -705,6 +730,8 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->btree_column_variable += from->btree_column_variable;
     if (from->btree_fixed_len > to->btree_fixed_len)
         to->btree_fixed_len = from->btree_fixed_len;
+    if (from->btree_contention_max > to->btree_contention_max)
+        to->btree_contention_max = from->btree_contention_max;
     if (from->btree_maxintlpage > to->btree_maxintlpage)
         to->btree_maxintlpage = from->btree_maxintlpage;
     if (from->btree_maxleafkey > to->btree_maxleafkey)
@@ -774,6 +801,7 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->cache_hs_write_squash += from->cache_hs_write_squash;
     to->cache_inmem_splittable += from->cache_inmem_splittable;
     to->cache_inmem_split += from->cache_inmem_split;
+    to->cache_inmem_split_contended += from->cache_inmem_split_contended;
     to->cache_eviction_blocked_internal_page_split +=
       from->cache_eviction_blocked_internal_page_split;
     to->cache_eviction_internal += from->cache_eviction_internal;
@@ -876,8 +904,10 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->cursor_equals_error += from->cursor_equals_error;
     to->cursor_get_key_error += from->cursor_get_key_error;
     to->cursor_get_value_error += from->cursor_get_value_error;
+    to->cursor_insert_batch_error += from->cursor_insert_batch_error;
     to->cursor_insert_error += from->cursor_insert_error;
     to->cursor_insert_check_error += from->cursor_insert_check_error;
+    to->cursor_insert_list_restart += from->cursor_insert_list_restart;
     to->cursor_largest_key_error += from->cursor_largest_key_error;
     to->cursor_modify_error += from->cursor_modify_error;
     to->cursor_next_error += from->cursor_next_error;
@@ -894,12 +924,18 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->cursor_reopen_error += from->cursor_reopen_error;
     to->cursor_reserve_error += from->cursor_reserve_error;
     to->cursor_reset_error += from->cursor_reset_error;
+    to->cursor_search_batch_error += from->cursor_search_batch_error;
+    to->cursor_search_leaf_bloom_skip += from->cursor_search_leaf_bloom_skip;
     to->cursor_search_error += from->cursor_search_error;
     to->cursor_search_near_error += from->cursor_search_near_error;
     to->cursor_update_error += from->cursor_update_error;
+    to->cursor_update_cas_retry += from->cursor_update_cas_retry;
+    to->cursor_insert_batch += from->cursor_insert_batch;
+    to->cursor_insert_batch_keys += from->cursor_insert_batch_keys;
     to->cursor_insert += from->cursor_insert;
     to->cursor_insert_bytes += from->cursor_insert_bytes;
     to->cursor_modify += from->cursor_modify;
+    to->cursor_modify_full_value += from->cursor_modify_full_value;
     to->cursor_modify_bytes += from->cursor_modify_bytes;
     to->cursor_modify_bytes_touch += from->cursor_modify_bytes_touch;
     to->cursor_next += from->cursor_next;
@@ -910,6 +946,8 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->cursor_remove_bytes += from->cursor_remove_bytes;
     to->cursor_reserve += from->cursor_reserve;
     to->cursor_reset += from->cursor_reset;
+    to->cursor_search_batch += from->cursor_search_batch;
+    to->cursor_search_batch_keys += from->cursor_search_batch_keys;
     to->cursor_search += from->cursor_search;
     to->cursor_search_hs += from->cursor_search_hs;
     to->cursor_search_near += from->cursor_search_near;
@@ -980,343 +1018,10 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
 void
 __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
 {
-    int64_t v;
+    WT_DSRC_STATS snap;
 
-    to->bloom_false_positive += WT_STAT_READ(from, bloom_false_positive);
-    to->bloom_hit += WT_STAT_READ(from, bloom_hit);
-    to->bloom_miss += WT_STAT_READ(from, bloom_miss);
-    to->bloom_page_evict += WT_STAT_READ(from, bloom_page_evict);
-    to->bloom_page_read += WT_STAT_READ(from, bloom_page_read);
-    to->bloom_count += WT_STAT_READ(from, bloom_count);
-    to->lsm_chunk_count += WT_STAT_READ(from, lsm_chunk_count);
-    if ((v = WT_STAT_READ(from, lsm_generation_max)) > to->lsm_generation_max)
-        to->lsm_generation_max = v;
-    to->lsm_lookup_no_bloom += WT_STAT_READ(from, lsm_lookup_no_bloom);
-    to->lsm_checkpoint_throttle += WT_STAT_READ(from, lsm_checkpoint_throttle);
-    to->lsm_merge_throttle += WT_STAT_READ(from, lsm_merge_throttle);
-    to->bloom_size += WT_STAT_READ(from, bloom_size);
-    to->autocommit_readonly_retry += WT_STAT_READ(from, autocommit_readonly_retry);
-    to->autocommit_update_retry += WT_STAT_READ(from, autocommit_update_retry);
-    to->block_extension += WT_STAT_READ(from, block_extension);
-    to->block_alloc += WT_STAT_READ(from, block_alloc);
-    to->block_free += WT_STAT_READ(from, block_free);
-    to->block_checkpoint_size += WT_STAT_READ(from, block_checkpoint_size);
-    if ((v = WT_STAT_READ(from, allocation_size)) > to->allocation_size)
-        to->allocation_size = v;
-    to->block_reuse_bytes += WT_STAT_READ(from, block_reuse_bytes);
-    if ((v = WT_STAT_READ(from, block_magic)) > to->block_magic)
-        to->block_magic = v;
-    if ((v = WT_STAT_READ(from, block_major)) > to->block_major)
-        to->block_major = v;
-    to->block_size += WT_STAT_READ(from, block_size);
-    if ((v = WT_STAT_READ(from, block_minor)) > to->block_minor)
-        to->block_minor = v;
-    to->btree_checkpoint_generation += WT_STAT_READ(from, btree_checkpoint_generation);
-    to->btree_clean_checkpoint_timer += WT_STAT_READ(from, btree_clean_checkpoint_timer);
-    to->btree_compact_pages_reviewed += WT_STAT_READ(from, btree_compact_pages_reviewed);
-    to->btree_compact_pages_rewritten += WT_STAT_READ(from, btree_compact_pages_rewritten);
-    to->btree_compact_pages_skipped += WT_STAT_READ(from, btree_compact_pages_skipped);
-    to->btree_compact_pages_rewritten_expected +=
-      WT_STAT_READ(from, btree_compact_pages_rewritten_expected);
-    to->btree_compact_skipped += WT_STAT_READ(from, btree_compact_skipped);
-    to->btree_column_fix += WT_STAT_READ(from, btree_column_fix);
-    to->btree_column_tws += WT_STAT_READ(from, btree_column_tws);
-    to->btree_column_internal += WT_STAT_READ(from, btree_column_internal);
-    to->btree_column_rle += WT_STAT_READ(from, btree_column_rle);
-    to->btree_column_deleted += WT_STAT_READ(from, btree_column_deleted);
-    to->btree_column_variable += WT_STAT_READ(from, btree_column_variable);
-    if ((v = WT_STAT_READ(from, btree_fixed_len)) > to->btree_fixed_len)
-        to->btree_fixed_len = v;
-    if ((v = WT_STAT_READ(from, btree_maxintlpage)) > to->btree_maxintlpage)
-        to->btree_maxintlpage = v;
-    if ((v = WT_STAT_READ(from, btree_maxleafkey)) > to->btree_maxleafkey)
-        to->btree_maxleafkey = v;
-    if ((v = WT_STAT_READ(from, btree_maxleafpage)) > to->btree_maxleafpage)
-        to->btree_maxleafpage = v;
-    if ((v = WT_STAT_READ(from, btree_maxleafvalue)) > to->btree_maxleafvalue)
-        to->btree_maxleafvalue = v;
-    if ((v = WT_STAT_READ(from, btree_maximum_depth)) > to->btree_maximum_depth)
-        to->btree_maximum_depth = v;
-    to->btree_entries += WT_STAT_READ(from, btree_entries);
-    to->btree_overflow += WT_STAT_READ(from, btree_overflow);
-    to->btree_row_empty_values += WT_STAT_READ(from, btree_row_empty_values);
-    to->btree_row_internal += WT_STAT_READ(from, btree_row_internal);
-    to->btree_row_leaf += WT_STAT_READ(from, btree_row_leaf);
-    to->cache_bytes_inuse += WT_STAT_READ(from, cache_bytes_inuse);
-    to->cache_bytes_dirty_total += WT_STAT_READ(from, cache_bytes_dirty_total);
-    to->cache_bytes_read += WT_STAT_READ(from, cache_bytes_read);
-    to->cache_bytes_write += WT_STAT_READ(from, cache_bytes_write);
-    to->cache_eviction_blocked_checkpoint += WT_STAT_READ(from, cache_eviction_blocked_checkpoint);
-    to->cache_eviction_blocked_checkpoint_hs +=
-      WT_STAT_READ(from, cache_eviction_blocked_checkpoint_hs);
-    to->cache_eviction_fail += WT_STAT_READ(from, cache_eviction_fail);
-    to->cache_eviction_blocked_no_ts_checkpoint_race_1 +=
-      WT_STAT_READ(from, cache_eviction_blocked_no_ts_checkpoint_race_1);
-    to->cache_eviction_blocked_no_ts_checkpoint_race_2 +=
-      WT_STAT_READ(from, cache_eviction_blocked_no_ts_checkpoint_race_2);
-    to->cache_eviction_blocked_no_ts_checkpoint_race_3 +=
-      WT_STAT_READ(from, cache_eviction_blocked_no_ts_checkpoint_race_3);
-    to->cache_eviction_blocked_no_ts_checkpoint_race_4 +=
-      WT_STAT_READ(from, cache_eviction_blocked_no_ts_checkpoint_race_4);
-    to->cache_eviction_blocked_remove_hs_race_with_checkpoint +=
-      WT_STAT_READ(from, cache_eviction_blocked_remove_hs_race_with_checkpoint);
-    to->cache_eviction_blocked_no_progress +=
-      WT_STAT_READ(from, cache_eviction_blocked_no_progress);
-    to->cache_eviction_walk_passes += WT_STAT_READ(from, cache_eviction_walk_passes);
-    to->cache_eviction_target_page_lt10 += WT_STAT_READ(from, cache_eviction_target_page_lt10);
-    to->cache_eviction_target_page_lt32 += WT_STAT_READ(from, cache_eviction_target_page_lt32);
-    to->cache_eviction_target_page_ge128 += WT_STAT_READ(from, cache_eviction_target_page_ge128);
-    to->cache_eviction_target_page_lt64 += WT_STAT_READ(from, cache_eviction_target_page_lt64);
-    to->cache_eviction_target_page_lt128 += WT_STAT_READ(from, cache_eviction_target_page_lt128);
-    to->cache_eviction_target_page_reduced +=
-      WT_STAT_READ(from, cache_eviction_target_page_reduced);
-    to->cache_eviction_walks_abandoned += WT_STAT_READ(from, cache_eviction_walks_abandoned);
-    to->cache_eviction_walks_stopped += WT_STAT_READ(from, cache_eviction_walks_stopped);
-    to->cache_eviction_walks_gave_up_no_targets +=
-      WT_STAT_READ(from, cache_eviction_walks_gave_up_no_targets);
-    to->cache_eviction_walks_gave_up_ratio +=
-      WT_STAT_READ(from, cache_eviction_walks_gave_up_ratio);
-    to->cache_eviction_walks_ended += WT_STAT_READ(from, cache_eviction_walks_ended);
-    to->cache_eviction_walk_restart += WT_STAT_READ(from, cache_eviction_walk_restart);
-    to->cache_eviction_walk_from_root += WT_STAT_READ(from, cache_eviction_walk_from_root);
-    to->cache_eviction_walk_saved_pos += WT_STAT_READ(from, cache_eviction_walk_saved_pos);
-    to->cache_eviction_blocked_hazard += WT_STAT_READ(from, cache_eviction_blocked_hazard);
-    to->cache_hs_insert += WT_STAT_READ(from, cache_hs_insert);
-    to->cache_hs_insert_restart += WT_STAT_READ(from, cache_hs_insert_restart);
-    to->cache_hs_read += WT_STAT_READ(from, cache_hs_read);
-    to->cache_hs_read_miss += WT_STAT_READ(from, cache_hs_read_miss);
-    to->cache_hs_read_squash += WT_STAT_READ(from, cache_hs_read_squash);
-    to->cache_hs_order_lose_durable_timestamp +=
-      WT_STAT_READ(from, cache_hs_order_lose_durable_timestamp);
-    to->cache_hs_key_truncate_rts_unstable +=
-      WT_STAT_READ(from, cache_hs_key_truncate_rts_unstable);
-    to->cache_hs_key_truncate_rts += WT_STAT_READ(from, cache_hs_key_truncate_rts);
-    to->cache_hs_btree_truncate += WT_STAT_READ(from, cache_hs_btree_truncate);
-    to->cache_hs_key_truncate += WT_STAT_READ(from, cache_hs_key_truncate);
-    to->cache_hs_order_remove += WT_STAT_READ(from, cache_hs_order_remove);
-    to->cache_hs_key_truncate_onpage_removal +=
-      WT_STAT_READ(from, cache_hs_key_truncate_onpage_removal);
-    to->cache_hs_btree_truncate_dryrun += WT_STAT_READ(from, cache_hs_btree_truncate_dryrun);
-    to->cache_hs_key_truncate_rts_unstable_dryrun +=
-      WT_STAT_READ(from, cache_hs_key_truncate_rts_unstable_dryrun);
-    to->cache_hs_key_truncate_rts_dryrun += WT_STAT_READ(from, cache_hs_key_truncate_rts_dryrun);
-    to->cache_hs_order_reinsert += WT_STAT_READ(from, cache_hs_order_reinsert);
-    to->cache_hs_write_squash += WT_STAT_READ(from, cache_hs_write_squash);
-    to->cache_inmem_splittable += WT_STAT_READ(from, cache_inmem_splittable);
-    to->cache_inmem_split += WT_STAT_READ(from, cache_inmem_split);
-    to->cache_eviction_blocked_internal_page_split +=
-      WT_STAT_READ(from, cache_eviction_blocked_internal_page_split);
-    to->cache_eviction_internal += WT_STAT_READ(from, cache_eviction_internal);
-    to->cache_eviction_split_internal += WT_STAT_READ(from, cache_eviction_split_internal);
-    to->cache_eviction_split_leaf += WT_STAT_READ(from, cache_eviction_split_leaf);
-    to->cache_eviction_dirty += WT_STAT_READ(from, cache_eviction_dirty);
-    to->cache_eviction_blocked_multi_block_reconcilation_during_checkpoint +=
-      WT_STAT_READ(from, cache_eviction_blocked_multi_block_reconcilation_during_checkpoint);
-    to->cache_eviction_blocked_overflow_keys +=
-      WT_STAT_READ(from, cache_eviction_blocked_overflow_keys);
-    to->cache_read_overflow += WT_STAT_READ(from, cache_read_overflow);
-    to->cache_eviction_deepen += WT_STAT_READ(from, cache_eviction_deepen);
-    to->cache_write_hs += WT_STAT_READ(from, cache_write_hs);
-    to->cache_read += WT_STAT_READ(from, cache_read);
-    to->cache_read_deleted += WT_STAT_READ(from, cache_read_deleted);
-    to->cache_read_deleted_prepared += WT_STAT_READ(from, cache_read_deleted_prepared);
-    to->cache_pages_requested += WT_STAT_READ(from, cache_pages_requested);
-    to->cache_pages_prefetch += WT_STAT_READ(from, cache_pages_prefetch);
-    to->cache_eviction_pages_seen += WT_STAT_READ(from, cache_eviction_pages_seen);
-    to->cache_write += WT_STAT_READ(from, cache_write);
-    to->cache_write_restore += WT_STAT_READ(from, cache_write_restore);
-    to->cache_eviction_blocked_recently_modified +=
-      WT_STAT_READ(from, cache_eviction_blocked_recently_modified);
-    to->cache_reverse_splits += WT_STAT_READ(from, cache_reverse_splits);
-    to->cache_reverse_splits_skipped_vlcs += WT_STAT_READ(from, cache_reverse_splits_skipped_vlcs);
-    to->cache_hs_insert_full_update += WT_STAT_READ(from, cache_hs_insert_full_update);
-    to->cache_hs_insert_reverse_modify += WT_STAT_READ(from, cache_hs_insert_reverse_modify);
-    to->cache_bytes_dirty += WT_STAT_READ(from, cache_bytes_dirty);
-    to->cache_eviction_blocked_uncommitted_truncate +=
-      WT_STAT_READ(from, cache_eviction_blocked_uncommitted_truncate);
-    to->cache_eviction_clean += WT_STAT_READ(from, cache_eviction_clean);
-    to->cache_state_gen_avg_gap += WT_STAT_READ(from, cache_state_gen_avg_gap);
-    to->cache_state_avg_written_size += WT_STAT_READ(from, cache_state_avg_written_size);
-    to->cache_state_avg_visited_age += WT_STAT_READ(from, cache_state_avg_visited_age);
-    to->cache_state_avg_unvisited_age += WT_STAT_READ(from, cache_state_avg_unvisited_age);
-    to->cache_state_pages_clean += WT_STAT_READ(from, cache_state_pages_clean);
-    to->cache_state_gen_current += WT_STAT_READ(from, cache_state_gen_current);
-    to->cache_state_pages_dirty += WT_STAT_READ(from, cache_state_pages_dirty);
-    to->cache_state_root_entries += WT_STAT_READ(from, cache_state_root_entries);
-    to->cache_state_pages_internal += WT_STAT_READ(from, cache_state_pages_internal);
-    to->cache_state_pages_leaf += WT_STAT_READ(from, cache_state_pages_leaf);
-    to->cache_state_gen_max_gap += WT_STAT_READ(from, cache_state_gen_max_gap);
-    to->cache_state_max_pagesize += WT_STAT_READ(from, cache_state_max_pagesize);
-    to->cache_state_min_written_size += WT_STAT_READ(from, cache_state_min_written_size);
-    to->cache_state_unvisited_count += WT_STAT_READ(from, cache_state_unvisited_count);
-    to->cache_state_smaller_alloc_size += WT_STAT_READ(from, cache_state_smaller_alloc_size);
-    to->cache_state_memory += WT_STAT_READ(from, cache_state_memory);
-    to->cache_state_queued += WT_STAT_READ(from, cache_state_queued);
-    to->cache_state_not_queueable += WT_STAT_READ(from, cache_state_not_queueable);
-    to->cache_state_refs_skipped += WT_STAT_READ(from, cache_state_refs_skipped);
-    to->cache_state_root_size += WT_STAT_READ(from, cache_state_root_size);
-    to->cache_state_pages += WT_STAT_READ(from, cache_state_pages);
-    to->checkpoint_snapshot_acquired += WT_STAT_READ(from, checkpoint_snapshot_acquired);
-    to->checkpoint_cleanup_pages_evict += WT_STAT_READ(from, checkpoint_cleanup_pages_evict);
-    to->checkpoint_cleanup_pages_removed += WT_STAT_READ(from, checkpoint_cleanup_pages_removed);
-    to->checkpoint_cleanup_pages_walk_skipped +=
-      WT_STAT_READ(from, checkpoint_cleanup_pages_walk_skipped);
-    to->checkpoint_cleanup_pages_visited += WT_STAT_READ(from, checkpoint_cleanup_pages_visited);
-    to->checkpoint_obsolete_applied += WT_STAT_READ(from, checkpoint_obsolete_applied);
-    to->compress_precomp_intl_max_page_size +=
-      WT_STAT_READ(from, compress_precomp_intl_max_page_size);
-    to->compress_precomp_leaf_max_page_size +=
-      WT_STAT_READ(from, compress_precomp_leaf_max_page_size);
-    to->compress_write_fail += WT_STAT_READ(from, compress_write_fail);
-    to->compress_write_too_small += WT_STAT_READ(from, compress_write_too_small);
-    to->compress_read += WT_STAT_READ(from, compress_read);
-    to->compress_read_ratio_hist_max += WT_STAT_READ(from, compress_read_ratio_hist_max);
-    to->compress_read_ratio_hist_2 += WT_STAT_READ(from, compress_read_ratio_hist_2);
-    to->compress_read_ratio_hist_4 += WT_STAT_READ(from, compress_read_ratio_hist_4);
-    to->compress_read_ratio_hist_8 += WT_STAT_READ(from, compress_read_ratio_hist_8);
-    to->compress_read_ratio_hist_16 += WT_STAT_READ(from, compress_read_ratio_hist_16);
-    to->compress_read_ratio_hist_32 += WT_STAT_READ(from, compress_read_ratio_hist_32);
-    to->compress_read_ratio_hist_64 += WT_STAT_READ(from, compress_read_ratio_hist_64);
-    to->compress_write += WT_STAT_READ(from, compress_write);
-    to->compress_write_ratio_hist_max += WT_STAT_READ(from, compress_write_ratio_hist_max);
-    to->compress_write_ratio_hist_2 += WT_STAT_READ(from, compress_write_ratio_hist_2);
-    to->compress_write_ratio_hist_4 += WT_STAT_READ(from, compress_write_ratio_hist_4);
-    to->compress_write_ratio_hist_8 += WT_STAT_READ(from, compress_write_ratio_hist_8);
-    to->compress_write_ratio_hist_16 += WT_STAT_READ(from, compress_write_ratio_hist_16);
-    to->compress_write_ratio_hist_32 += WT_STAT_READ(from, compress_write_ratio_hist_32);
-    to->compress_write_ratio_hist_64 += WT_STAT_READ(from, compress_write_ratio_hist_64);
-    to->cursor_next_skip_total += WT_STAT_READ(from, cursor_next_skip_total);
-    to->cursor_prev_skip_total += WT_STAT_READ(from, cursor_prev_skip_total);
-    to->cursor_skip_hs_cur_position += WT_STAT_READ(from, cursor_skip_hs_cur_position);
-    to->cursor_search_near_prefix_fast_paths +=
-      WT_STAT_READ(from, cursor_search_near_prefix_fast_paths);
-    to->cursor_reposition_failed += WT_STAT_READ(from, cursor_reposition_failed);
-    to->cursor_reposition += WT_STAT_READ(from, cursor_reposition);
-    to->cursor_insert_bulk += WT_STAT_READ(from, cursor_insert_bulk);
-    to->cursor_reopen += WT_STAT_READ(from, cursor_reopen);
-    to->cursor_cache += WT_STAT_READ(from, cursor_cache);
-    to->cursor_create += WT_STAT_READ(from, cursor_create);
-    to->cursor_bound_error += WT_STAT_READ(from, cursor_bound_error);
-    to->cursor_bounds_reset += WT_STAT_READ(from, cursor_bounds_reset);
-    to->cursor_bounds_comparisons += WT_STAT_READ(from, cursor_bounds_comparisons);
-    to->cursor_bounds_next_unpositioned += WT_STAT_READ(from, cursor_bounds_next_unpositioned);
-    to->cursor_bounds_next_early_exit += WT_STAT_READ(from, cursor_bounds_next_early_exit);
-    to->cursor_bounds_prev_unpositioned += WT_STAT_READ(from, cursor_bounds_prev_unpositioned);
-    to->cursor_bounds_prev_early_exit += WT_STAT_READ(from, cursor_bounds_prev_early_exit);
-    to->cursor_bounds_search_early_exit += WT_STAT_READ(from, cursor_bounds_search_early_exit);
-    to->cursor_bounds_search_near_repositioned_cursor +=
-      WT_STAT_READ(from, cursor_bounds_search_near_repositioned_cursor);
-    to->cursor_cache_error += WT_STAT_READ(from, cursor_cache_error);
-    to->cursor_close_error += WT_STAT_READ(from, cursor_close_error);
-    to->cursor_compare_error += WT_STAT_READ(from, cursor_compare_error);
-    to->cursor_equals_error += WT_STAT_READ(from, cursor_equals_error);
-    to->cursor_get_key_error += WT_STAT_READ(from, cursor_get_key_error);
-    to->cursor_get_value_error += WT_STAT_READ(from, cursor_get_value_error);
-    to->cursor_insert_error += WT_STAT_READ(from, cursor_insert_error);
-    to->cursor_insert_check_error += WT_STAT_READ(from, cursor_insert_check_error);
-    to->cursor_largest_key_error += WT_STAT_READ(from, cursor_largest_key_error);
-    to->cursor_modify_error += WT_STAT_READ(from, cursor_modify_error);
-    to->cursor_next_error += WT_STAT_READ(from, cursor_next_error);
-    to->cursor_next_hs_tombstone += WT_STAT_READ(from, cursor_next_hs_tombstone);
-    to->cursor_next_skip_lt_100 += WT_STAT_READ(from, cursor_next_skip_lt_100);
-    to->cursor_next_skip_ge_100 += WT_STAT_READ(from, cursor_next_skip_ge_100);
-    to->cursor_next_random_error += WT_STAT_READ(from, cursor_next_random_error);
-    to->cursor_prev_error += WT_STAT_READ(from, cursor_prev_error);
-    to->cursor_prev_hs_tombstone += WT_STAT_READ(from, cursor_prev_hs_tombstone);
-    to->cursor_prev_skip_ge_100 += WT_STAT_READ(from, cursor_prev_skip_ge_100);
-    to->cursor_prev_skip_lt_100 += WT_STAT_READ(from, cursor_prev_skip_lt_100);
-    to->cursor_reconfigure_error += WT_STAT_READ(from, cursor_reconfigure_error);
-    to->cursor_remove_error += WT_STAT_READ(from, cursor_remove_error);
-    to->cursor_reopen_error += WT_STAT_READ(from, cursor_reopen_error);
-    to->cursor_reserve_error += WT_STAT_READ(from, cursor_reserve_error);
-    to->cursor_reset_error += WT_STAT_READ(from, cursor_reset_error);
-    to->cursor_search_error += WT_STAT_READ(from, cursor_search_error);
-    to->cursor_search_near_error += WT_STAT_READ(from, cursor_search_near_error);
-    to->cursor_update_error += WT_STAT_READ(from, cursor_update_error);
-    to->cursor_insert += WT_STAT_READ(from, cursor_insert);
-    to->cursor_insert_bytes += WT_STAT_READ(from, cursor_insert_bytes);
-    to->cursor_modify += WT_STAT_READ(from, cursor_modify);
-    to->cursor_modify_bytes += WT_STAT_READ(from, cursor_modify_bytes);
-    to->cursor_modify_bytes_touch += WT_STAT_READ(from, cursor_modify_bytes_touch);
-    to->cursor_next += WT_STAT_READ(from, cursor_next);
-    to->cursor_open_count += WT_STAT_READ(from, cursor_open_count);
-    to->cursor_restart += WT_STAT_READ(from, cursor_restart);
-    to->cursor_prev += WT_STAT_READ(from, cursor_prev);
-    to->cursor_remove += WT_STAT_READ(from, cursor_remove);
-    to->cursor_remove_bytes += WT_STAT_READ(from, cursor_remove_bytes);
-    to->cursor_reserve += WT_STAT_READ(from, cursor_reserve);
-    to->cursor_reset += WT_STAT_READ(from, cursor_reset);
-    to->cursor_search += WT_STAT_READ(from, cursor_search);
-    to->cursor_search_hs += WT_STAT_READ(from, cursor_search_hs);
-    to->cursor_search_near += WT_STAT_READ(from, cursor_search_near);
-    to->cursor_truncate += WT_STAT_READ(from, cursor_truncate);
-    to->cursor_update += WT_STAT_READ(from, cursor_update);
-    to->cursor_update_bytes += WT_STAT_READ(from, cursor_update_bytes);
-    to->cursor_update_bytes_changed += WT_STAT_READ(from, cursor_update_bytes_changed);
-    to->rec_vlcs_emptied_pages += WT_STAT_READ(from, rec_vlcs_emptied_pages);
-    to->rec_time_window_bytes_ts += WT_STAT_READ(from, rec_time_window_bytes_ts);
-    to->rec_time_window_bytes_txn += WT_STAT_READ(from, rec_time_window_bytes_txn);
-    to->rec_dictionary += WT_STAT_READ(from, rec_dictionary);
-    to->rec_page_delete_fast += WT_STAT_READ(from, rec_page_delete_fast);
-    to->rec_suffix_compression += WT_STAT_READ(from, rec_suffix_compression);
-    to->rec_multiblock_internal += WT_STAT_READ(from, rec_multiblock_internal);
-    to->rec_prefix_compression += WT_STAT_READ(from, rec_prefix_compression);
-    to->rec_multiblock_leaf += WT_STAT_READ(from, rec_multiblock_leaf);
-    to->rec_overflow_key_leaf += WT_STAT_READ(from, rec_overflow_key_leaf);
-    if ((v = WT_STAT_READ(from, rec_multiblock_max)) > to->rec_multiblock_max)
-        to->rec_multiblock_max = v;
-    to->rec_overflow_value += WT_STAT_READ(from, rec_overflow_value);
-    to->rec_pages += WT_STAT_READ(from, rec_pages);
-    to->rec_pages_eviction += WT_STAT_READ(from, rec_pages_eviction);
-    to->rec_page_delete += WT_STAT_READ(from, rec_page_delete);
-    to->rec_time_aggr_newest_start_durable_ts +=
-      WT_STAT_READ(from, rec_time_aggr_newest_start_durable_ts);
-    to->rec_time_aggr_newest_stop_durable_ts +=
-      WT_STAT_READ(from, rec_time_aggr_newest_stop_durable_ts);
-    to->rec_time_aggr_newest_stop_ts += WT_STAT_READ(from, rec_time_aggr_newest_stop_ts);
-    to->rec_time_aggr_newest_stop_txn += WT_STAT_READ(from, rec_time_aggr_newest_stop_txn);
-    to->rec_time_aggr_newest_txn += WT_STAT_READ(from, rec_time_aggr_newest_txn);
-    to->rec_time_aggr_oldest_start_ts += WT_STAT_READ(from, rec_time_aggr_oldest_start_ts);
-    to->rec_time_aggr_prepared += WT_STAT_READ(from, rec_time_aggr_prepared);
-    to->rec_time_window_pages_prepared += WT_STAT_READ(from, rec_time_window_pages_prepared);
-    to->rec_time_window_pages_durable_start_ts +=
-      WT_STAT_READ(from, rec_time_window_pages_durable_start_ts);
-    to->rec_time_window_pages_start_ts += WT_STAT_READ(from, rec_time_window_pages_start_ts);
-    to->rec_time_window_pages_start_txn += WT_STAT_READ(from, rec_time_window_pages_start_txn);
-    to->rec_time_window_pages_durable_stop_ts +=
-      WT_STAT_READ(from, rec_time_window_pages_durable_stop_ts);
-    to->rec_time_window_pages_stop_ts += WT_STAT_READ(from, rec_time_window_pages_stop_ts);
-    to->rec_time_window_pages_stop_txn += WT_STAT_READ(from, rec_time_window_pages_stop_txn);
-    to->rec_time_window_prepared += WT_STAT_READ(from, rec_time_window_prepared);
-    to->rec_time_window_durable_start_ts += WT_STAT_READ(from, rec_time_window_durable_start_ts);
-    to->rec_time_window_start_ts += WT_STAT_READ(from, rec_time_window_start_ts);
-    to->rec_time_window_start_txn += WT_STAT_READ(from, rec_time_window_start_txn);
-    to->rec_time_window_durable_stop_ts += WT_STAT_READ(from, rec_time_window_durable_stop_ts);
-    to->rec_time_window_stop_ts += WT_STAT_READ(from, rec_time_window_stop_ts);
-    to->rec_time_window_stop_txn += WT_STAT_READ(from, rec_time_window_stop_txn);
-    to->session_compact += WT_STAT_READ(from, session_compact);
-    to->txn_read_race_prepare_commit += WT_STAT_READ(from, txn_read_race_prepare_commit);
-    to->txn_read_overflow_remove += WT_STAT_READ(from, txn_read_overflow_remove);
-    to->txn_read_race_prepare_update += WT_STAT_READ(from, txn_read_race_prepare_update);
-    to->txn_rts_sweep_hs_keys_dryrun += WT_STAT_READ(from, txn_rts_sweep_hs_keys_dryrun);
-    to->txn_rts_hs_stop_older_than_newer_start +=
-      WT_STAT_READ(from, txn_rts_hs_stop_older_than_newer_start);
-    to->txn_rts_inconsistent_ckpt += WT_STAT_READ(from, txn_rts_inconsistent_ckpt);
-    to->txn_rts_keys_removed += WT_STAT_READ(from, txn_rts_keys_removed);
-    to->txn_rts_keys_restored += WT_STAT_READ(from, txn_rts_keys_restored);
-    to->txn_rts_keys_removed_dryrun += WT_STAT_READ(from, txn_rts_keys_removed_dryrun);
-    to->txn_rts_keys_restored_dryrun += WT_STAT_READ(from, txn_rts_keys_restored_dryrun);
-    to->txn_rts_hs_restore_tombstones += WT_STAT_READ(from, txn_rts_hs_restore_tombstones);
-    to->txn_rts_hs_restore_updates += WT_STAT_READ(from, txn_rts_hs_restore_updates);
-    to->txn_rts_delete_rle_skipped += WT_STAT_READ(from, txn_rts_delete_rle_skipped);
-    to->txn_rts_stable_rle_skipped += WT_STAT_READ(from, txn_rts_stable_rle_skipped);
-    to->txn_rts_sweep_hs_keys += WT_STAT_READ(from, txn_rts_sweep_hs_keys);
-    to->txn_rts_hs_restore_tombstones_dryrun +=
-      WT_STAT_READ(from, txn_rts_hs_restore_tombstones_dryrun);
-    to->txn_rts_hs_restore_updates_dryrun += WT_STAT_READ(from, txn_rts_hs_restore_updates_dryrun);
-    to->txn_rts_hs_removed += WT_STAT_READ(from, txn_rts_hs_removed);
-    to->txn_rts_hs_removed_dryrun += WT_STAT_READ(from, txn_rts_hs_removed_dryrun);
-    to->txn_update_conflict += WT_STAT_READ(from, txn_update_conflict);
+    WT_STATS_SNAPSHOT(from, &snap);
+    __wt_stat_dsrc_aggregate_single(&snap, to);
 }
 
 static const char *const __stats_connection_desc[] = {
@@ -1369,6 +1074,7 @@ static const char *const __stats_connection_desc[] = {
   "block-cache: pre-fetch not triggered due to special btree handle",
   "block-cache: pre-fetch page not on disk when reading",
   "block-cache: pre-fetch pages queued",
+  "block-cache: pre-fetch pages read asynchronously",
   "block-cache: pre-fetch pages read in background",
   "block-cache: pre-fetch triggered by page read",
   "block-cache: removed blocks",
@@ -1410,6 +1116,7 @@ static const char *const __stats_connection_desc[] = {
   "cache: checkpoint blocked page eviction",
   "cache: checkpoint of history store file blocked non-history store page eviction",
   "cache: eviction calls to get a page",
+  "cache: eviction calls to get a page found it in another queue shard",
   "cache: eviction calls to get a page found queue empty",
   "cache: eviction calls to get a page found queue empty after locking",
   "cache: eviction currently operating in aggressive mode",
@@ -1507,6 +1214,7 @@ static const char *const __stats_connection_desc[] = {
   "cache: history store table writes requiring squashed modifies",
   "cache: in-memory page passed criteria to be split",
   "cache: in-memory page splits",
+  "cache: in-memory page splits queued for contended pages",
   "cache: internal page split blocked its eviction",
   "cache: internal pages evicted",
   "cache: internal pages queued for eviction",
@@ -1603,8 +1311,10 @@ static const char *const __stats_connection_desc[] = {
   "checkpoint: number of handles visited after writes complete",
   "checkpoint: number of history store pages caused to be reconciled",
   "checkpoint: number of internal pages visited",
+  "checkpoint: number of leaf pages reconciled by helper threads",
   "checkpoint: number of leaf pages visited",
   "checkpoint: number of pages caused to be reconciled",
+  "checkpoint: number of times the checkpoint waited for helper threads",
   "checkpoint: pages added for eviction during checkpoint cleanup",
   "checkpoint: pages removed during checkpoint cleanup",
   "checkpoint: pages skipped during checkpoint cleanup tree walk",
@@ -1629,6 +1339,7 @@ static const char *const __stats_connection_desc[] = {
   "checkpoint: wait cycles while cache dirty level is decreasing",
   "chunk-cache: aggregate number of spanned chunks on read",
   "chunk-cache: chunks evicted",
+  "chunk-cache: chunks preloaded from persistent content on startup",
   "chunk-cache: could not allocate due to exceeding bitmap capacity",
   "chunk-cache: could not allocate due to exceeding capacity",
   "chunk-cache: lookups",
@@ -1642,7 +1353,9 @@ static const char *const __stats_connection_desc[] = {
   "chunk-cache: number of times a read from storage failed",
   "chunk-cache: retried accessing a chunk while I/O was in progress",
   "chunk-cache: retries from a chunk cache checksum mismatch",
+  "chunk-cache: time spent preloading persistent content on startup (usecs)",
   "chunk-cache: timed out due to too many retries",
+  "chunk-cache: total bytes preloaded from persistent content on startup",
   "chunk-cache: total bytes read from persistent content",
   "chunk-cache: total bytes used by the cache",
   "chunk-cache: total bytes used by the cache for pinned chunks",
@@ -1677,6 +1390,7 @@ static const char *const __stats_connection_desc[] = {
   "hot or large page",
   "cursor: bulk cursor count",
   "cursor: cached cursor count",
+  "cursor: connection cursor pool count",
   "cursor: cursor bound calls that return an error",
   "cursor: cursor bounds cleared from reset",
   "cursor: cursor bounds comparisons performed",
@@ -1695,13 +1409,19 @@ static const char *const __stats_connection_desc[] = {
   "cursor: cursor equals calls that return an error",
   "cursor: cursor get key calls that return an error",
   "cursor: cursor get value calls that return an error",
+  "cursor: cursor insert batch calls",
+  "cursor: cursor insert batch calls that return an error",
+  "cursor: cursor insert batch keys inserted",
+  "cursor: cursor insert batch keys inserted on a pinned leaf page",
   "cursor: cursor insert calls",
   "cursor: cursor insert calls that return an error",
   "cursor: cursor insert check calls that return an error",
   "cursor: cursor insert key and value bytes",
+  "cursor: cursor insert list compare-and-swap restarts",
   "cursor: cursor largest key calls that return an error",
   "cursor: cursor modify calls",
   "cursor: cursor modify calls that return an error",
+  "cursor: cursor modify calls that write the full value",
   "cursor: cursor modify key and value bytes affected",
   "cursor: cursor modify value bytes modified",
   "cursor: cursor next calls",
@@ -1725,7 +1445,12 @@ static const char *const __stats_connection_desc[] = {
   "cursor: cursor reserve calls that return an error",
   "cursor: cursor reset calls",
   "cursor: cursor reset calls that return an error",
+  "cursor: cursor search batch calls",
+  "cursor: cursor search batch calls that return an error",
+  "cursor: cursor search batch keys resolved on a pinned leaf page",
+  "cursor: cursor search batch keys searched",
   "cursor: cursor search calls",
+  "cursor: cursor search calls resolved by a leaf page Bloom filter without reading the page",
   "cursor: cursor search calls that return an error",
   "cursor: cursor search history store calls",
   "cursor: cursor search near calls",
@@ -1738,9 +1463,13 @@ static const char *const __stats_connection_desc[] = {
   "cursor: cursor truncates performed on individual keys",
   "cursor: cursor update calls",
   "cursor: cursor update calls that return an error",
+  "cursor: cursor update chain compare-and-swap retries",
   "cursor: cursor update key and value bytes",
   "cursor: cursor update value size change",
+  "cursor: cursors added to the connection cursor pool",
+  "cursor: cursors discarded from the connection cursor pool",
   "cursor: cursors reused from cache",
+  "cursor: cursors reused from the connection cursor pool",
   "cursor: open cursor count",
   "data-handle: connection data handle size",
   "data-handle: connection data handles currently active",
@@ -1777,11 +1506,14 @@ static const char *const __stats_connection_desc[] = {
   "log: force log remove time sleeping (usecs)",
   "log: log bytes of payload data",
   "log: log bytes written",
+  "log: log compression dictionary switches",
+  "log: log compression dictionary switches skipped while in use",
   "log: log files manually zero-filled",
   "log: log flush operations",
   "log: log force write operations",
   "log: log force write operations skipped",
   "log: log records compressed",
+  "log: log records compressed with a dictionary",
   "log: log records not compressed",
   "log: log records too small to compress",
   "log: log release advances write LSN",
@@ -1790,6 +1522,7 @@ static const char *const __stats_connection_desc[] = {
   "log: log server thread advances write LSN",
   "log: log server thread write LSN walk skipped",
   "log: log sync operations",
+  "log: log sync operations for background commits",
   "log: log sync time duration (usecs)",
   "log: log sync_dir operations",
   "log: log sync_dir time duration (usecs)",
@@ -1806,11 +1539,13 @@ static const char *const __stats_connection_desc[] = {
   "log: slot closures",
   "log: slot join atomic update races",
   "log: slot join calls atomic updates raced",
+  "log: slot join calls consolidated in a sub-slot group",
   "log: slot join calls did not yield",
   "log: slot join calls found active slot closed",
   "log: slot join calls slept",
   "log: slot join calls yielded",
   "log: slot join found active slot closed",
+  "log: slot join sub-slot groups joined to the active slot",
   "log: slot joins yield time (usecs)",
   "log: slot transitions unable to find free slot",
   "log: slot unbuffered writes",
@@ -1819,6 +1554,91 @@ static const char *const __stats_connection_desc[] = {
   "log: total size of compressed records",
   "log: written slots coalesced",
   "log: yields waiting for previous log file close",
+  "perf: application thread eviction wait latency histogram (bucket 01) - less than 1us",
+  "perf: application thread eviction wait latency histogram (bucket 02) - 1-3us",
+  "perf: application thread eviction wait latency histogram (bucket 03) - 4-15us",
+  "perf: application thread eviction wait latency histogram (bucket 04) - 16-63us",
+  "perf: application thread eviction wait latency histogram (bucket 05) - 64-255us",
+  "perf: application thread eviction wait latency histogram (bucket 06) - 256-1023us",
+  "perf: application thread eviction wait latency histogram (bucket 07) - 1024-4095us",
+  "perf: application thread eviction wait latency histogram (bucket 08) - 4096-16383us",
+  "perf: application thread eviction wait latency histogram (bucket 09) - 16384-65535us",
+  "perf: application thread eviction wait latency histogram (bucket 10) - 65536-262143us",
+  "perf: application thread eviction wait latency histogram (bucket 11) - 262144-1048575us",
+  "perf: application thread eviction wait latency histogram (bucket 12) - 1048576us+",
+  "perf: application thread eviction wait latency histogram 50th percentile (usecs)",
+  "perf: application thread eviction wait latency histogram 90th percentile (usecs)",
+  "perf: application thread eviction wait latency histogram 99.9th percentile (usecs)",
+  "perf: application thread eviction wait latency histogram 99th percentile (usecs)",
+  "perf: application thread eviction wait latency histogram total (usecs)",
+  "perf: cursor insert latency histogram (bucket 01) - less than 1us",
+  "perf: cursor insert latency histogram (bucket 02) - 1-3us",
+  "perf: cursor insert latency histogram (bucket 03) - 4-15us",
+  "perf: cursor insert latency histogram (bucket 04) - 16-63us",
+  "perf: cursor insert latency histogram (bucket 05) - 64-255us",
+  "perf: cursor insert latency histogram (bucket 06) - 256-1023us",
+  "perf: cursor insert latency histogram (bucket 07) - 1024-4095us",
+  "perf: cursor insert latency histogram (bucket 08) - 4096-16383us",
+  "perf: cursor insert latency histogram (bucket 09) - 16384-65535us",
+  "perf: cursor insert latency histogram (bucket 10) - 65536-262143us",
+  "perf: cursor insert latency histogram (bucket 11) - 262144-1048575us",
+  "perf: cursor insert latency histogram (bucket 12) - 1048576us+",
+  "perf: cursor insert latency histogram 50th percentile (usecs)",
+  "perf: cursor insert latency histogram 90th percentile (usecs)",
+  "perf: cursor insert latency histogram 99.9th percentile (usecs)",
+  "perf: cursor insert latency histogram 99th percentile (usecs)",
+  "perf: cursor insert latency histogram total (usecs)",
+  "perf: cursor next latency histogram (bucket 01) - less than 1us",
+  "perf: cursor next latency histogram (bucket 02) - 1-3us",
+  "perf: cursor next latency histogram (bucket 03) - 4-15us",
+  "perf: cursor next latency histogram (bucket 04) - 16-63us",
+  "perf: cursor next latency histogram (bucket 05) - 64-255us",
+  "perf: cursor next latency histogram (bucket 06) - 256-1023us",
+  "perf: cursor next latency histogram (bucket 07) - 1024-4095us",
+  "perf: cursor next latency histogram (bucket 08) - 4096-16383us",
+  "perf: cursor next latency histogram (bucket 09) - 16384-65535us",
+  "perf: cursor next latency histogram (bucket 10) - 65536-262143us",
+  "perf: cursor next latency histogram (bucket 11) - 262144-1048575us",
+  "perf: cursor next latency histogram (bucket 12) - 1048576us+",
+  "perf: cursor next latency histogram 50th percentile (usecs)",
+  "perf: cursor next latency histogram 90th percentile (usecs)",
+  "perf: cursor next latency histogram 99.9th percentile (usecs)",
+  "perf: cursor next latency histogram 99th percentile (usecs)",
+  "perf: cursor next latency histogram total (usecs)",
+  "perf: cursor search latency histogram (bucket 01) - less than 1us",
+  "perf: cursor search latency histogram (bucket 02) - 1-3us",
+  "perf: cursor search latency histogram (bucket 03) - 4-15us",
+  "perf: cursor search latency histogram (bucket 04) - 16-63us",
+  "perf: cursor search latency histogram (bucket 05) - 64-255us",
+  "perf: cursor search latency histogram (bucket 06) - 256-1023us",
+  "perf: cursor search latency histogram (bucket 07) - 1024-4095us",
+  "perf: cursor search latency histogram (bucket 08) - 4096-16383us",
+  "perf: cursor search latency histogram (bucket 09) - 16384-65535us",
+  "perf: cursor search latency histogram (bucket 10) - 65536-262143us",
+  "perf: cursor search latency histogram (bucket 11) - 262144-1048575us",
+  "perf: cursor search latency histogram (bucket 12) - 1048576us+",
+  "perf: cursor search latency histogram 50th percentile (usecs)",
+  "perf: cursor search latency histogram 90th percentile (usecs)",
+  "perf: cursor search latency histogram 99.9th percentile (usecs)",
+  "perf: cursor search latency histogram 99th percentile (usecs)",
+  "perf: cursor search latency histogram total (usecs)",
+  "perf: cursor update latency histogram (bucket 01) - less than 1us",
+  "perf: cursor update latency histogram (bucket 02) - 1-3us",
+  "perf: cursor update latency histogram (bucket 03) - 4-15us",
+  "perf: cursor update latency histogram (bucket 04) - 16-63us",
+  "perf: cursor update latency histogram (bucket 05) - 64-255us",
+  "perf: cursor update latency histogram (bucket 06) - 256-1023us",
+  "perf: cursor update latency histogram (bucket 07) - 1024-4095us",
+  "perf: cursor update latency histogram (bucket 08) - 4096-16383us",
+  "perf: cursor update latency histogram (bucket 09) - 16384-65535us",
+  "perf: cursor update latency histogram (bucket 10) - 65536-262143us",
+  "perf: cursor update latency histogram (bucket 11) - 262144-1048575us",
+  "perf: cursor update latency histogram (bucket 12) - 1048576us+",
+  "perf: cursor update latency histogram 50th percentile (usecs)",
+  "perf: cursor update latency histogram 90th percentile (usecs)",
+  "perf: cursor update latency histogram 99.9th percentile (usecs)",
+  "perf: cursor update latency histogram 99th percentile (usecs)",
+  "perf: cursor update latency histogram total (usecs)",
   "perf: file system read latency histogram (bucket 1) - 0-10ms",
   "perf: file system read latency histogram (bucket 2) - 10-49ms",
   "perf: file system read latency histogram (bucket 3) - 50-99ms",
@@ -1849,6 +1669,57 @@ static const char *const __stats_connection_desc[] = {
   "perf: operation write latency histogram (bucket 5) - 1000-9999us",
   "perf: operation write latency histogram (bucket 6) - 10000us+",
   "perf: operation write latency histogram total (usecs)",
+  "perf: session begin transaction latency histogram (bucket 01) - less than 1us",
+  "perf: session begin transaction latency histogram (bucket 02) - 1-3us",
+  "perf: session begin transaction latency histogram (bucket 03) - 4-15us",
+  "perf: session begin transaction latency histogram (bucket 04) - 16-63us",
+  "perf: session begin transaction latency histogram (bucket 05) - 64-255us",
+  "perf: session begin transaction latency histogram (bucket 06) - 256-1023us",
+  "perf: session begin transaction latency histogram (bucket 07) - 1024-4095us",
+  "perf: session begin transaction latency histogram (bucket 08) - 4096-16383us",
+  "perf: session begin transaction latency histogram (bucket 09) - 16384-65535us",
+  "perf: session begin transaction latency histogram (bucket 10) - 65536-262143us",
+  "perf: session begin transaction latency histogram (bucket 11) - 262144-1048575us",
+  "perf: session begin transaction latency histogram (bucket 12) - 1048576us+",
+  "perf: session begin transaction latency histogram 50th percentile (usecs)",
+  "perf: session begin transaction latency histogram 90th percentile (usecs)",
+  "perf: session begin transaction latency histogram 99.9th percentile (usecs)",
+  "perf: session begin transaction latency histogram 99th percentile (usecs)",
+  "perf: session begin transaction latency histogram total (usecs)",
+  "perf: session checkpoint latency histogram (bucket 01) - less than 1us",
+  "perf: session checkpoint latency histogram (bucket 02) - 1-3us",
+  "perf: session checkpoint latency histogram (bucket 03) - 4-15us",
+  "perf: session checkpoint latency histogram (bucket 04) - 16-63us",
+  "perf: session checkpoint latency histogram (bucket 05) - 64-255us",
+  "perf: session checkpoint latency histogram (bucket 06) - 256-1023us",
+  "perf: session checkpoint latency histogram (bucket 07) - 1024-4095us",
+  "perf: session checkpoint latency histogram (bucket 08) - 4096-16383us",
+  "perf: session checkpoint latency histogram (bucket 09) - 16384-65535us",
+  "perf: session checkpoint latency histogram (bucket 10) - 65536-262143us",
+  "perf: session checkpoint latency histogram (bucket 11) - 262144-1048575us",
+  "perf: session checkpoint latency histogram (bucket 12) - 1048576us+",
+  "perf: session checkpoint latency histogram 50th percentile (usecs)",
+  "perf: session checkpoint latency histogram 90th percentile (usecs)",
+  "perf: session checkpoint latency histogram 99.9th percentile (usecs)",
+  "perf: session checkpoint latency histogram 99th percentile (usecs)",
+  "perf: session checkpoint latency histogram total (usecs)",
+  "perf: session commit transaction latency histogram (bucket 01) - less than 1us",
+  "perf: session commit transaction latency histogram (bucket 02) - 1-3us",
+  "perf: session commit transaction latency histogram (bucket 03) - 4-15us",
+  "perf: session commit transaction latency histogram (bucket 04) - 16-63us",
+  "perf: session commit transaction latency histogram (bucket 05) - 64-255us",
+  "perf: session commit transaction latency histogram (bucket 06) - 256-1023us",
+  "perf: session commit transaction latency histogram (bucket 07) - 1024-4095us",
+  "perf: session commit transaction latency histogram (bucket 08) - 4096-16383us",
+  "perf: session commit transaction latency histogram (bucket 09) - 16384-65535us",
+  "perf: session commit transaction latency histogram (bucket 10) - 65536-262143us",
+  "perf: session commit transaction latency histogram (bucket 11) - 262144-1048575us",
+  "perf: session commit transaction latency histogram (bucket 12) - 1048576us+",
+  "perf: session commit transaction latency histogram 50th percentile (usecs)",
+  "perf: session commit transaction latency histogram 90th percentile (usecs)",
+  "perf: session commit transaction latency histogram 99.9th percentile (usecs)",
+  "perf: session commit transaction latency histogram 99th percentile (usecs)",
+  "perf: session commit transaction latency histogram total (usecs)",
   "reconciliation: VLCS pages explicitly reconciled as empty",
   "reconciliation: approximate byte size of timestamps in pages written",
   "reconciliation: approximate byte size of transaction IDs in pages written",
@@ -1889,11 +1760,14 @@ static const char *const __stats_connection_desc[] = {
   "reconciliation: split bytes currently awaiting free",
   "reconciliation: split objects currently awaiting free",
   "session: attempts to remove a local object and the object is in use",
+  "session: bytes flushed to the storage source",
   "session: flush_tier failed calls",
   "session: flush_tier operation calls",
   "session: flush_tier tables skipped due to no checkpoint",
   "session: flush_tier tables switched",
   "session: local objects removed",
+  "session: object parts flushed to the storage source in multi-part uploads",
+  "session: objects flushed to the storage source",
   "session: open session count",
   "session: session query timestamp calls",
   "session: table alter failed calls",
@@ -1957,6 +1831,8 @@ static const char *const __stats_connection_desc[] = {
   "transaction: prepared transactions rolled back",
   "transaction: query timestamp calls",
   "transaction: race to read prepared update retry",
+  "transaction: recovery log batches queued for parallel replay",
+  "transaction: recovery log reader waits for a replay worker",
   "transaction: rollback to stable calls",
   "transaction: rollback to stable history store keys that would have been swept in non-dryrun "
   "mode",
@@ -2004,6 +1880,7 @@ static const char *const __stats_connection_desc[] = {
   "transaction: transaction range of timestamps pinned by the oldest timestamp",
   "transaction: transaction read timestamp of the oldest active reader",
   "transaction: transaction rollback to stable currently running",
+  "transaction: transaction sync calls",
   "transaction: transaction walk of concurrent sessions",
   "transaction: transactions committed",
   "transaction: transactions rolled back",
@@ -2027,12 +1904,13 @@ __wt_stat_connection_init_single(WT_CONNECTION_STATS *stats)
 int
 __wt_stat_connection_init(WT_SESSION_IMPL *session, WT_CONNECTION_IMPL *handle)
 {
-    int i;
+    u_int i;
 
     WT_RET(__wt_calloc(
-      session, (size_t)WT_COUNTER_SLOTS, sizeof(*handle->stat_array), &handle->stat_array));
+      session, (size_t)handle->stat_slots, sizeof(*handle->stat_array), &handle->stat_array));
+    WT_RET(__wt_calloc_def(session, (size_t)handle->stat_slots + 1, &handle->stats));
 
-    for (i = 0; i < WT_COUNTER_SLOTS; ++i) {
+    for (i = 0; i < handle->stat_slots; ++i) {
         handle->stats[i] = &handle->stat_array[i];
         __wt_stat_connection_init_single(handle->stats[i]);
     }
@@ -2043,6 +1921,7 @@ void
 __wt_stat_connection_discard(WT_SESSION_IMPL *session, WT_CONNECTION_IMPL *handle)
 {
     __wt_free(session, handle->stat_array);
+    __wt_free(NULL, handle->stats);
 }
 
 void
@@ -2097,6 +1976,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->block_prefetch_skipped_special_handle = 0;
     stats->block_prefetch_pages_fail = 0;
     stats->block_prefetch_pages_queued = 0;
+    stats->block_prefetch_pages_read_async = 0;
     stats->block_prefetch_pages_read = 0;
     stats->block_prefetch_attempts = 0;
     stats->block_cache_blocks_removed = 0;
@@ -2137,6 +2017,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cache_eviction_blocked_checkpoint = 0;
     stats->cache_eviction_blocked_checkpoint_hs = 0;
     stats->cache_eviction_get_ref = 0;
+    stats->cache_eviction_get_ref_shard_steal = 0;
     stats->cache_eviction_get_ref_empty = 0;
     stats->cache_eviction_get_ref_empty2 = 0;
     /* not clearing cache_eviction_aggressive_set */
@@ -2219,6 +2100,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cache_hs_write_squash = 0;
     stats->cache_inmem_splittable = 0;
     stats->cache_inmem_split = 0;
+    stats->cache_inmem_split_contended = 0;
     stats->cache_eviction_blocked_internal_page_split = 0;
     stats->cache_eviction_internal = 0;
     stats->cache_eviction_internal_pages_queued = 0;
@@ -2313,8 +2195,10 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->checkpoint_presync = 0;
     stats->checkpoint_hs_pages_reconciled = 0;
     stats->checkpoint_pages_visited_internal = 0;
+    stats->checkpoint_pages_reconciled_helper = 0;
     stats->checkpoint_pages_visited_leaf = 0;
     stats->checkpoint_pages_reconciled = 0;
+    stats->checkpoint_pages_reconciled_helper_wait = 0;
     stats->checkpoint_cleanup_pages_evict = 0;
     stats->checkpoint_cleanup_pages_removed = 0;
     stats->checkpoint_cleanup_pages_walk_skipped = 0;
@@ -2339,6 +2223,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->checkpoint_wait_reduce_dirty = 0;
     stats->chunkcache_spans_chunks_read = 0;
     stats->chunkcache_chunks_evicted = 0;
+    stats->chunkcache_chunks_preloaded = 0;
     stats->chunkcache_exceeded_bitmap_capacity = 0;
     stats->chunkcache_exceeded_capacity = 0;
     stats->chunkcache_lookups = 0;
@@ -2352,7 +2237,9 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->chunkcache_io_failed = 0;
     stats->chunkcache_retries = 0;
     stats->chunkcache_retries_checksum_mismatch = 0;
+    /* not clearing chunkcache_preload_time */
     stats->chunkcache_toomany_retries = 0;
+    stats->chunkcache_bytes_preloaded = 0;
     stats->chunkcache_bytes_read_persistent = 0;
     stats->chunkcache_bytes_inuse = 0;
     stats->chunkcache_bytes_inuse_pinned = 0;
@@ -2385,6 +2272,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cursor_reposition = 0;
     /* not clearing cursor_bulk_count */
     /* not clearing cursor_cached_count */
+    /* not clearing cursor_pool_count */
     stats->cursor_bound_error = 0;
     stats->cursor_bounds_reset = 0;
     stats->cursor_bounds_comparisons = 0;
@@ -2403,13 +2291,19 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cursor_equals_error = 0;
     stats->cursor_get_key_error = 0;
     stats->cursor_get_value_error = 0;
+    stats->cursor_insert_batch = 0;
+    stats->cursor_insert_batch_error = 0;
+    stats->cursor_insert_batch_keys = 0;
+    stats->cursor_insert_batch_pinned = 0;
     stats->cursor_insert = 0;
     stats->cursor_insert_error = 0;
     stats->cursor_insert_check_error = 0;
     stats->cursor_insert_bytes = 0;
+    stats->cursor_insert_list_restart = 0;
     stats->cursor_largest_key_error = 0;
     stats->cursor_modify = 0;
     stats->cursor_modify_error = 0;
+    stats->cursor_modify_full_value = 0;
     stats->cursor_modify_bytes = 0;
     stats->cursor_modify_bytes_touch = 0;
     stats->cursor_next = 0;
@@ -2433,7 +2327,12 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cursor_reserve_error = 0;
     stats->cursor_reset = 0;
     stats->cursor_reset_error = 0;
+    stats->cursor_search_batch = 0;
+    stats->cursor_search_batch_error = 0;
+    stats->cursor_search_batch_pinned = 0;
+    stats->cursor_search_batch_keys = 0;
     stats->cursor_search = 0;
+    stats->cursor_search_leaf_bloom_skip = 0;
     stats->cursor_search_error = 0;
     stats->cursor_search_hs = 0;
     stats->cursor_search_near = 0;
@@ -2446,9 +2345,13 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cursor_truncate_keys_deleted = 0;
     stats->cursor_update = 0;
     stats->cursor_update_error = 0;
+    stats->cursor_update_cas_retry = 0;
     stats->cursor_update_bytes = 0;
     stats->cursor_update_bytes_changed = 0;
+    stats->cursor_pool_add = 0;
+    stats->cursor_pool_discard = 0;
     stats->cursor_reopen = 0;
+    stats->cursor_pool_reuse = 0;
     /* not clearing cursor_open_count */
     /* not clearing dh_conn_handle_size */
     /* not clearing dh_conn_handle_count */
@@ -2485,11 +2388,14 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->log_force_remove_sleep = 0;
     stats->log_bytes_payload = 0;
     stats->log_bytes_written = 0;
+    stats->log_compress_dict_switch = 0;
+    stats->log_compress_dict_busy = 0;
     stats->log_zero_fills = 0;
     stats->log_flush = 0;
     stats->log_force_write = 0;
     stats->log_force_write_skip = 0;
     stats->log_compress_writes = 0;
+    stats->log_compress_dict_writes = 0;
     stats->log_compress_write_fails = 0;
     stats->log_compress_small = 0;
     stats->log_release_write_lsn = 0;
@@ -2498,6 +2404,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->log_write_lsn = 0;
     stats->log_write_lsn_skip = 0;
     stats->log_sync = 0;
+    stats->log_sync_background = 0;
     /* not clearing log_sync_duration */
     stats->log_sync_dir = 0;
     /* not clearing log_sync_dir_duration */
@@ -2514,11 +2421,13 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->log_slot_closes = 0;
     stats->log_slot_races = 0;
     stats->log_slot_yield_race = 0;
+    stats->log_slot_subslot_joins = 0;
     stats->log_slot_immediate = 0;
     stats->log_slot_yield_close = 0;
     stats->log_slot_yield_sleep = 0;
     stats->log_slot_yield = 0;
     stats->log_slot_active_closed = 0;
+    stats->log_slot_subslot_groups = 0;
     /* not clearing log_slot_yield_duration */
     stats->log_slot_no_free_slots = 0;
     stats->log_slot_unbuffered = 0;
@@ -2527,6 +2436,91 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->log_compress_len = 0;
     stats->log_slot_coalesced = 0;
     stats->log_close_yields = 0;
+    stats->perf_hist_app_evict_latency_lt1 = 0;
+    stats->perf_hist_app_evict_latency_lt4 = 0;
+    stats->perf_hist_app_evict_latency_lt16 = 0;
+    stats->perf_hist_app_evict_latency_lt64 = 0;
+    stats->perf_hist_app_evict_latency_lt256 = 0;
+    stats->perf_hist_app_evict_latency_lt1024 = 0;
+    stats->perf_hist_app_evict_latency_lt4096 = 0;
+    stats->perf_hist_app_evict_latency_lt16384 = 0;
+    stats->perf_hist_app_evict_latency_lt65536 = 0;
+    stats->perf_hist_app_evict_latency_lt262144 = 0;
+    stats->perf_hist_app_evict_latency_lt1048576 = 0;
+    stats->perf_hist_app_evict_latency_gt1048576 = 0;
+    /* not clearing perf_hist_app_evict_latency_p50 */
+    /* not clearing perf_hist_app_evict_latency_p90 */
+    /* not clearing perf_hist_app_evict_latency_p999 */
+    /* not clearing perf_hist_app_evict_latency_p99 */
+    stats->perf_hist_app_evict_latency_total_usecs = 0;
+    stats->perf_hist_cursor_insert_latency_lt1 = 0;
+    stats->perf_hist_cursor_insert_latency_lt4 = 0;
+    stats->perf_hist_cursor_insert_latency_lt16 = 0;
+    stats->perf_hist_cursor_insert_latency_lt64 = 0;
+    stats->perf_hist_cursor_insert_latency_lt256 = 0;
+    stats->perf_hist_cursor_insert_latency_lt1024 = 0;
+    stats->perf_hist_cursor_insert_latency_lt4096 = 0;
+    stats->perf_hist_cursor_insert_latency_lt16384 = 0;
+    stats->perf_hist_cursor_insert_latency_lt65536 = 0;
+    stats->perf_hist_cursor_insert_latency_lt262144 = 0;
+    stats->perf_hist_cursor_insert_latency_lt1048576 = 0;
+    stats->perf_hist_cursor_insert_latency_gt1048576 = 0;
+    /* not clearing perf_hist_cursor_insert_latency_p50 */
+    /* not clearing perf_hist_cursor_insert_latency_p90 */
+    /* not clearing perf_hist_cursor_insert_latency_p999 */
+    /* not clearing perf_hist_cursor_insert_latency_p99 */
+    stats->perf_hist_cursor_insert_latency_total_usecs = 0;
+    stats->perf_hist_cursor_next_latency_lt1 = 0;
+    stats->perf_hist_cursor_next_latency_lt4 = 0;
+    stats->perf_hist_cursor_next_latency_lt16 = 0;
+    stats->perf_hist_cursor_next_latency_lt64 = 0;
+    stats->perf_hist_cursor_next_latency_lt256 = 0;
+    stats->perf_hist_cursor_next_latency_lt1024 = 0;
+    stats->perf_hist_cursor_next_latency_lt4096 = 0;
+    stats->perf_hist_cursor_next_latency_lt16384 = 0;
+    stats->perf_hist_cursor_next_latency_lt65536 = 0;
+    stats->perf_hist_cursor_next_latency_lt262144 = 0;
+    stats->perf_hist_cursor_next_latency_lt1048576 = 0;
+    stats->perf_hist_cursor_next_latency_gt1048576 = 0;
+    /* not clearing perf_hist_cursor_next_latency_p50 */
+    /* not clearing perf_hist_cursor_next_latency_p90 */
+    /* not clearing perf_hist_cursor_next_latency_p999 */
+    /* not clearing perf_hist_cursor_next_latency_p99 */
+    stats->perf_hist_cursor_next_latency_total_usecs = 0;
+    stats->perf_hist_cursor_search_latency_lt1 = 0;
+    stats->perf_hist_cursor_search_latency_lt4 = 0;
+    stats->perf_hist_cursor_search_latency_lt16 = 0;
+    stats->perf_hist_cursor_search_latency_lt64 = 0;
+    stats->perf_hist_cursor_search_latency_lt256 = 0;
+    stats->perf_hist_cursor_search_latency_lt1024 = 0;
+    stats->perf_hist_cursor_search_latency_lt4096 = 0;
+    stats->perf_hist_cursor_search_latency_lt16384 = 0;
+    stats->perf_hist_cursor_search_latency_lt65536 = 0;
+    stats->perf_hist_cursor_search_latency_lt262144 = 0;
+    stats->perf_hist_cursor_search_latency_lt1048576 = 0;
+    stats->perf_hist_cursor_search_latency_gt1048576 = 0;
+    /* not clearing perf_hist_cursor_search_latency_p50 */
+    /* not clearing perf_hist_cursor_search_latency_p90 */
+    /* not clearing perf_hist_cursor_search_latency_p999 */
+    /* not clearing perf_hist_cursor_search_latency_p99 */
+    stats->perf_hist_cursor_search_latency_total_usecs = 0;
+    stats->perf_hist_cursor_update_latency_lt1 = 0;
+    stats->perf_hist_cursor_update_latency_lt4 = 0;
+    stats->perf_hist_cursor_update_latency_lt16 = 0;
+    stats->perf_hist_cursor_update_latency_lt64 = 0;
+    stats->perf_hist_cursor_update_latency_lt256 = 0;
+    stats->perf_hist_cursor_update_latency_lt1024 = 0;
+    stats->perf_hist_cursor_update_latency_lt4096 = 0;
+    stats->perf_hist_cursor_update_latency_lt16384 = 0;
+    stats->perf_hist_cursor_update_latency_lt65536 = 0;
+    stats->perf_hist_cursor_update_latency_lt262144 = 0;
+    stats->perf_hist_cursor_update_latency_lt1048576 = 0;
+    stats->perf_hist_cursor_update_latency_gt1048576 = 0;
+    /* not clearing perf_hist_cursor_update_latency_p50 */
+    /* not clearing perf_hist_cursor_update_latency_p90 */
+    /* not clearing perf_hist_cursor_update_latency_p999 */
+    /* not clearing perf_hist_cursor_update_latency_p99 */
+    stats->perf_hist_cursor_update_latency_total_usecs = 0;
     stats->perf_hist_fsread_latency_lt10 = 0;
     stats->perf_hist_fsread_latency_lt50 = 0;
     stats->perf_hist_fsread_latency_lt100 = 0;
@@ -2557,6 +2551,57 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->perf_hist_opwrite_latency_lt10000 = 0;
     stats->perf_hist_opwrite_latency_gt10000 = 0;
     stats->perf_hist_opwrite_latency_total_usecs = 0;
+    stats->perf_hist_txn_begin_latency_lt1 = 0;
+    stats->perf_hist_txn_begin_latency_lt4 = 0;
+    stats->perf_hist_txn_begin_latency_lt16 = 0;
+    stats->perf_hist_txn_begin_latency_lt64 = 0;
+    stats->perf_hist_txn_begin_latency_lt256 = 0;
+    stats->perf_hist_txn_begin_latency_lt1024 = 0;
+    stats->perf_hist_txn_begin_latency_lt4096 = 0;
+    stats->perf_hist_txn_begin_latency_lt16384 = 0;
+    stats->perf_hist_txn_begin_latency_lt65536 = 0;
+    stats->perf_hist_txn_begin_latency_lt262144 = 0;
+    stats->perf_hist_txn_begin_latency_lt1048576 = 0;
+    stats->perf_hist_txn_begin_latency_gt1048576 = 0;
+    /* not clearing perf_hist_txn_begin_latency_p50 */
+    /* not clearing perf_hist_txn_begin_latency_p90 */
+    /* not clearing perf_hist_txn_begin_latency_p999 */
+    /* not clearing perf_hist_txn_begin_latency_p99 */
+    stats->perf_hist_txn_begin_latency_total_usecs = 0;
+    stats->perf_hist_checkpoint_latency_lt1 = 0;
+    stats->perf_hist_checkpoint_latency_lt4 = 0;
+    stats->perf_hist_checkpoint_latency_lt16 = 0;
+    stats->perf_hist_checkpoint_latency_lt64 = 0;
+    stats->perf_hist_checkpoint_latency_lt256 = 0;
+    stats->perf_hist_checkpoint_latency_lt1024 = 0;
+    stats->perf_hist_checkpoint_latency_lt4096 = 0;
+    stats->perf_hist_checkpoint_latency_lt16384 = 0;
+    stats->perf_hist_checkpoint_latency_lt65536 = 0;
+    stats->perf_hist_checkpoint_latency_lt262144 = 0;
+    stats->perf_hist_checkpoint_latency_lt1048576 = 0;
+    stats->perf_hist_checkpoint_latency_gt1048576 = 0;
+    /* not clearing perf_hist_checkpoint_latency_p50 */
+    /* not clearing perf_hist_checkpoint_latency_p90 */
+    /* not clearing perf_hist_checkpoint_latency_p999 */
+    /* not clearing perf_hist_checkpoint_latency_p99 */
+    stats->perf_hist_checkpoint_latency_total_usecs = 0;
+    stats->perf_hist_txn_commit_latency_lt1 = 0;
+    stats->perf_hist_txn_commit_latency_lt4 = 0;
+    stats->perf_hist_txn_commit_latency_lt16 = 0;
+    stats->perf_hist_txn_commit_latency_lt64 = 0;
+    stats->perf_hist_txn_commit_latency_lt256 = 0;
+    stats->perf_hist_txn_commit_latency_lt1024 = 0;
+    stats->perf_hist_txn_commit_latency_lt4096 = 0;
+    stats->perf_hist_txn_commit_latency_lt16384 = 0;
+    stats->perf_hist_txn_commit_latency_lt65536 = 0;
+    stats->perf_hist_txn_commit_latency_lt262144 = 0;
+    stats->perf_hist_txn_commit_latency_lt1048576 = 0;
+    stats->perf_hist_txn_commit_latency_gt1048576 = 0;
+    /* not clearing perf_hist_txn_commit_latency_p50 */
+    /* not clearing perf_hist_txn_commit_latency_p90 */
+    /* not clearing perf_hist_txn_commit_latency_p999 */
+    /* not clearing perf_hist_txn_commit_latency_p99 */
+    stats->perf_hist_txn_commit_latency_total_usecs = 0;
     stats->rec_vlcs_emptied_pages = 0;
     stats->rec_time_window_bytes_ts = 0;
     stats->rec_time_window_bytes_txn = 0;
@@ -2595,11 +2640,14 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     /* not clearing rec_split_stashed_bytes */
     /* not clearing rec_split_stashed_objects */
     stats->local_objects_inuse = 0;
+    stats->tiered_flush_bytes = 0;
     stats->flush_tier_fail = 0;
     stats->flush_tier = 0;
     stats->flush_tier_skipped = 0;
     stats->flush_tier_switched = 0;
     stats->local_objects_removed = 0;
+    stats->tiered_flush_parts = 0;
+    stats->tiered_flush_objects = 0;
     /* not clearing session_open */
     stats->session_query_ts = 0;
     /* not clearing session_table_alter_fail */
@@ -2663,6 +2711,8 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->txn_prepare_rollback = 0;
     stats->txn_query_ts = 0;
     stats->txn_read_race_prepare_update = 0;
+    stats->txn_recover_parallel_batches = 0;
+    stats->txn_recover_parallel_wait = 0;
     stats->txn_rts = 0;
     stats->txn_rts_sweep_hs_keys_dryrun = 0;
     stats->txn_rts_hs_stop_older_than_newer_start = 0;
@@ -2704,6 +2754,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     /* not clearing txn_pinned_timestamp_oldest */
     /* not clearing txn_timestamp_oldest_active_read */
     /* not clearing txn_rollback_to_stable_running */
+    stats->txn_sync = 0;
     stats->txn_walk_sessions = 0;
     stats->txn_commit = 0;
     stats->txn_rollback = 0;
@@ -2715,752 +2766,869 @@ __wt_stat_connection_clear_all(WT_CONNECTION_STATS **stats)
 {
     u_int i;
 
-    for (i = 0; i < WT_COUNTER_SLOTS; ++i)
+    for (i = 0; stats[i] != NULL; ++i)
         __wt_stat_connection_clear_single(stats[i]);
 }
 
 void
 __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *to)
 {
-    int64_t v;
+    WT_CONNECTION_STATS snap;
 
-    to->lsm_work_queue_app += WT_STAT_READ(from, lsm_work_queue_app);
-    to->lsm_work_queue_manager += WT_STAT_READ(from, lsm_work_queue_manager);
-    to->lsm_rows_merged += WT_STAT_READ(from, lsm_rows_merged);
-    to->lsm_checkpoint_throttle += WT_STAT_READ(from, lsm_checkpoint_throttle);
-    to->lsm_merge_throttle += WT_STAT_READ(from, lsm_merge_throttle);
-    to->lsm_work_queue_switch += WT_STAT_READ(from, lsm_work_queue_switch);
-    to->lsm_work_units_discarded += WT_STAT_READ(from, lsm_work_units_discarded);
-    to->lsm_work_units_done += WT_STAT_READ(from, lsm_work_units_done);
-    to->lsm_work_units_created += WT_STAT_READ(from, lsm_work_units_created);
-    to->lsm_work_queue_max += WT_STAT_READ(from, lsm_work_queue_max);
-    to->autocommit_readonly_retry += WT_STAT_READ(from, autocommit_readonly_retry);
-    to->autocommit_update_retry += WT_STAT_READ(from, autocommit_update_retry);
-    to->background_compact_fail += WT_STAT_READ(from, background_compact_fail);
-    to->background_compact_fail_cache_pressure +=
-      WT_STAT_READ(from, background_compact_fail_cache_pressure);
-    to->background_compact_interrupted += WT_STAT_READ(from, background_compact_interrupted);
-    to->background_compact_ema += WT_STAT_READ(from, background_compact_ema);
-    to->background_compact_bytes_recovered +=
-      WT_STAT_READ(from, background_compact_bytes_recovered);
-    to->background_compact_running += WT_STAT_READ(from, background_compact_running);
-    to->background_compact_exclude += WT_STAT_READ(from, background_compact_exclude);
-    to->background_compact_skipped += WT_STAT_READ(from, background_compact_skipped);
-    to->background_compact_success += WT_STAT_READ(from, background_compact_success);
-    to->background_compact_timeout += WT_STAT_READ(from, background_compact_timeout);
-    to->background_compact_files_tracked += WT_STAT_READ(from, background_compact_files_tracked);
-    to->block_cache_blocks_update += WT_STAT_READ(from, block_cache_blocks_update);
-    to->block_cache_bytes_update += WT_STAT_READ(from, block_cache_bytes_update);
-    to->block_prefetch_skipped_internal_page +=
-      WT_STAT_READ(from, block_prefetch_skipped_internal_page);
-    to->block_prefetch_skipped_no_flag_set +=
-      WT_STAT_READ(from, block_prefetch_skipped_no_flag_set);
-    to->block_cache_blocks_evicted += WT_STAT_READ(from, block_cache_blocks_evicted);
-    to->block_cache_bypass_filesize += WT_STAT_READ(from, block_cache_bypass_filesize);
-    to->block_cache_lookups += WT_STAT_READ(from, block_cache_lookups);
-    to->block_cache_not_evicted_overhead += WT_STAT_READ(from, block_cache_not_evicted_overhead);
-    to->block_cache_bypass_writealloc += WT_STAT_READ(from, block_cache_bypass_writealloc);
-    to->block_cache_bypass_overhead_put += WT_STAT_READ(from, block_cache_bypass_overhead_put);
-    to->block_cache_bypass_get += WT_STAT_READ(from, block_cache_bypass_get);
-    to->block_cache_bypass_put += WT_STAT_READ(from, block_cache_bypass_put);
-    to->block_cache_eviction_passes += WT_STAT_READ(from, block_cache_eviction_passes);
-    to->block_cache_hits += WT_STAT_READ(from, block_cache_hits);
-    to->block_cache_misses += WT_STAT_READ(from, block_cache_misses);
-    to->block_cache_bypass_chkpt += WT_STAT_READ(from, block_cache_bypass_chkpt);
-    to->block_prefetch_failed_start += WT_STAT_READ(from, block_prefetch_failed_start);
-    to->block_prefetch_skipped_same_ref += WT_STAT_READ(from, block_prefetch_skipped_same_ref);
-    to->block_prefetch_disk_one += WT_STAT_READ(from, block_prefetch_disk_one);
-    to->block_prefetch_skipped_no_valid_dhandle +=
-      WT_STAT_READ(from, block_prefetch_skipped_no_valid_dhandle);
-    to->block_prefetch_skipped += WT_STAT_READ(from, block_prefetch_skipped);
-    to->block_prefetch_skipped_disk_read_count +=
-      WT_STAT_READ(from, block_prefetch_skipped_disk_read_count);
-    to->block_prefetch_skipped_internal_session +=
-      WT_STAT_READ(from, block_prefetch_skipped_internal_session);
-    to->block_prefetch_skipped_special_handle +=
-      WT_STAT_READ(from, block_prefetch_skipped_special_handle);
-    to->block_prefetch_pages_fail += WT_STAT_READ(from, block_prefetch_pages_fail);
-    to->block_prefetch_pages_queued += WT_STAT_READ(from, block_prefetch_pages_queued);
-    to->block_prefetch_pages_read += WT_STAT_READ(from, block_prefetch_pages_read);
-    to->block_prefetch_attempts += WT_STAT_READ(from, block_prefetch_attempts);
-    to->block_cache_blocks_removed += WT_STAT_READ(from, block_cache_blocks_removed);
-    to->block_cache_blocks_removed_blocked +=
-      WT_STAT_READ(from, block_cache_blocks_removed_blocked);
-    to->block_cache_blocks += WT_STAT_READ(from, block_cache_blocks);
-    to->block_cache_blocks_insert_read += WT_STAT_READ(from, block_cache_blocks_insert_read);
-    to->block_cache_blocks_insert_write += WT_STAT_READ(from, block_cache_blocks_insert_write);
-    to->block_cache_bytes += WT_STAT_READ(from, block_cache_bytes);
-    to->block_cache_bytes_insert_read += WT_STAT_READ(from, block_cache_bytes_insert_read);
-    to->block_cache_bytes_insert_write += WT_STAT_READ(from, block_cache_bytes_insert_write);
-    to->block_preload += WT_STAT_READ(from, block_preload);
-    to->block_read += WT_STAT_READ(from, block_read);
-    to->block_write += WT_STAT_READ(from, block_write);
-    to->block_byte_read += WT_STAT_READ(from, block_byte_read);
-    to->block_byte_read_mmap += WT_STAT_READ(from, block_byte_read_mmap);
-    to->block_byte_read_syscall += WT_STAT_READ(from, block_byte_read_syscall);
-    to->block_byte_write += WT_STAT_READ(from, block_byte_write);
-    to->block_byte_write_compact += WT_STAT_READ(from, block_byte_write_compact);
-    to->block_byte_write_checkpoint += WT_STAT_READ(from, block_byte_write_checkpoint);
-    to->block_byte_write_mmap += WT_STAT_READ(from, block_byte_write_mmap);
-    to->block_byte_write_syscall += WT_STAT_READ(from, block_byte_write_syscall);
-    to->block_map_read += WT_STAT_READ(from, block_map_read);
-    to->block_byte_map_read += WT_STAT_READ(from, block_byte_map_read);
-    to->block_remap_file_resize += WT_STAT_READ(from, block_remap_file_resize);
-    to->block_remap_file_write += WT_STAT_READ(from, block_remap_file_write);
-    to->cache_read_app_count += WT_STAT_READ(from, cache_read_app_count);
-    to->cache_read_app_time += WT_STAT_READ(from, cache_read_app_time);
-    to->cache_write_app_count += WT_STAT_READ(from, cache_write_app_count);
-    to->cache_write_app_time += WT_STAT_READ(from, cache_write_app_time);
-    to->cache_bytes_updates += WT_STAT_READ(from, cache_bytes_updates);
-    to->cache_bytes_image += WT_STAT_READ(from, cache_bytes_image);
-    to->cache_bytes_hs += WT_STAT_READ(from, cache_bytes_hs);
-    to->cache_bytes_inuse += WT_STAT_READ(from, cache_bytes_inuse);
-    to->cache_bytes_dirty_total += WT_STAT_READ(from, cache_bytes_dirty_total);
-    to->cache_bytes_other += WT_STAT_READ(from, cache_bytes_other);
-    to->cache_bytes_read += WT_STAT_READ(from, cache_bytes_read);
-    to->cache_bytes_write += WT_STAT_READ(from, cache_bytes_write);
-    to->cache_eviction_blocked_checkpoint += WT_STAT_READ(from, cache_eviction_blocked_checkpoint);
-    to->cache_eviction_blocked_checkpoint_hs +=
-      WT_STAT_READ(from, cache_eviction_blocked_checkpoint_hs);
-    to->cache_eviction_get_ref += WT_STAT_READ(from, cache_eviction_get_ref);
-    to->cache_eviction_get_ref_empty += WT_STAT_READ(from, cache_eviction_get_ref_empty);
-    to->cache_eviction_get_ref_empty2 += WT_STAT_READ(from, cache_eviction_get_ref_empty2);
-    to->cache_eviction_aggressive_set += WT_STAT_READ(from, cache_eviction_aggressive_set);
-    to->cache_eviction_empty_score += WT_STAT_READ(from, cache_eviction_empty_score);
+    WT_STATS_SNAPSHOT(from, &snap);
+    to->lsm_work_queue_app += snap.lsm_work_queue_app;
+    to->lsm_work_queue_manager += snap.lsm_work_queue_manager;
+    to->lsm_rows_merged += snap.lsm_rows_merged;
+    to->lsm_checkpoint_throttle += snap.lsm_checkpoint_throttle;
+    to->lsm_merge_throttle += snap.lsm_merge_throttle;
+    to->lsm_work_queue_switch += snap.lsm_work_queue_switch;
+    to->lsm_work_units_discarded += snap.lsm_work_units_discarded;
+    to->lsm_work_units_done += snap.lsm_work_units_done;
+    to->lsm_work_units_created += snap.lsm_work_units_created;
+    to->lsm_work_queue_max += snap.lsm_work_queue_max;
+    to->autocommit_readonly_retry += snap.autocommit_readonly_retry;
+    to->autocommit_update_retry += snap.autocommit_update_retry;
+    to->background_compact_fail += snap.background_compact_fail;
+    to->background_compact_fail_cache_pressure += snap.background_compact_fail_cache_pressure;
+    to->background_compact_interrupted += snap.background_compact_interrupted;
+    to->background_compact_ema += snap.background_compact_ema;
+    to->background_compact_bytes_recovered += snap.background_compact_bytes_recovered;
+    to->background_compact_running += snap.background_compact_running;
+    to->background_compact_exclude += snap.background_compact_exclude;
+    to->background_compact_skipped += snap.background_compact_skipped;
+    to->background_compact_success += snap.background_compact_success;
+    to->background_compact_timeout += snap.background_compact_timeout;
+    to->background_compact_files_tracked += snap.background_compact_files_tracked;
+    to->block_cache_blocks_update += snap.block_cache_blocks_update;
+    to->block_cache_bytes_update += snap.block_cache_bytes_update;
+    to->block_prefetch_skipped_internal_page += snap.block_prefetch_skipped_internal_page;
+    to->block_prefetch_skipped_no_flag_set += snap.block_prefetch_skipped_no_flag_set;
+    to->block_cache_blocks_evicted += snap.block_cache_blocks_evicted;
+    to->block_cache_bypass_filesize += snap.block_cache_bypass_filesize;
+    to->block_cache_lookups += snap.block_cache_lookups;
+    to->block_cache_not_evicted_overhead += snap.block_cache_not_evicted_overhead;
+    to->block_cache_bypass_writealloc += snap.block_cache_bypass_writealloc;
+    to->block_cache_bypass_overhead_put += snap.block_cache_bypass_overhead_put;
+    to->block_cache_bypass_get += snap.block_cache_bypass_get;
+    to->block_cache_bypass_put += snap.block_cache_bypass_put;
+    to->block_cache_eviction_passes += snap.block_cache_eviction_passes;
+    to->block_cache_hits += snap.block_cache_hits;
+    to->block_cache_misses += snap.block_cache_misses;
+    to->block_cache_bypass_chkpt += snap.block_cache_bypass_chkpt;
+    to->block_prefetch_failed_start += snap.block_prefetch_failed_start;
+    to->block_prefetch_skipped_same_ref += snap.block_prefetch_skipped_same_ref;
+    to->block_prefetch_disk_one += snap.block_prefetch_disk_one;
+    to->block_prefetch_skipped_no_valid_dhandle += snap.block_prefetch_skipped_no_valid_dhandle;
+    to->block_prefetch_skipped += snap.block_prefetch_skipped;
+    to->block_prefetch_skipped_disk_read_count += snap.block_prefetch_skipped_disk_read_count;
+    to->block_prefetch_skipped_internal_session += snap.block_prefetch_skipped_internal_session;
+    to->block_prefetch_skipped_special_handle += snap.block_prefetch_skipped_special_handle;
+    to->block_prefetch_pages_fail += snap.block_prefetch_pages_fail;
+    to->block_prefetch_pages_queued += snap.block_prefetch_pages_queued;
+    to->block_prefetch_pages_read_async += snap.block_prefetch_pages_read_async;
+    to->block_prefetch_pages_read += snap.block_prefetch_pages_read;
+    to->block_prefetch_attempts += snap.block_prefetch_attempts;
+    to->block_cache_blocks_removed += snap.block_cache_blocks_removed;
+    to->block_cache_blocks_removed_blocked += snap.block_cache_blocks_removed_blocked;
+    to->block_cache_blocks += snap.block_cache_blocks;
+    to->block_cache_blocks_insert_read += snap.block_cache_blocks_insert_read;
+    to->block_cache_blocks_insert_write += snap.block_cache_blocks_insert_write;
+    to->block_cache_bytes += snap.block_cache_bytes;
+    to->block_cache_bytes_insert_read += snap.block_cache_bytes_insert_read;
+    to->block_cache_bytes_insert_write += snap.block_cache_bytes_insert_write;
+    to->block_preload += snap.block_preload;
+    to->block_read += snap.block_read;
+    to->block_write += snap.block_write;
+    to->block_byte_read += snap.block_byte_read;
+    to->block_byte_read_mmap += snap.block_byte_read_mmap;
+    to->block_byte_read_syscall += snap.block_byte_read_syscall;
+    to->block_byte_write += snap.block_byte_write;
+    to->block_byte_write_compact += snap.block_byte_write_compact;
+    to->block_byte_write_checkpoint += snap.block_byte_write_checkpoint;
+    to->block_byte_write_mmap += snap.block_byte_write_mmap;
+    to->block_byte_write_syscall += snap.block_byte_write_syscall;
+    to->block_map_read += snap.block_map_read;
+    to->block_byte_map_read += snap.block_byte_map_read;
+    to->block_remap_file_resize += snap.block_remap_file_resize;
+    to->block_remap_file_write += snap.block_remap_file_write;
+    to->cache_read_app_count += snap.cache_read_app_count;
+    to->cache_read_app_time += snap.cache_read_app_time;
+    to->cache_write_app_count += snap.cache_write_app_count;
+    to->cache_write_app_time += snap.cache_write_app_time;
+    to->cache_bytes_updates += snap.cache_bytes_updates;
+    to->cache_bytes_image += snap.cache_bytes_image;
+    to->cache_bytes_hs += snap.cache_bytes_hs;
+    to->cache_bytes_inuse += snap.cache_bytes_inuse;
+    to->cache_bytes_dirty_total += snap.cache_bytes_dirty_total;
+    to->cache_bytes_other += snap.cache_bytes_other;
+    to->cache_bytes_read += snap.cache_bytes_read;
+    to->cache_bytes_write += snap.cache_bytes_write;
+    to->cache_eviction_blocked_checkpoint += snap.cache_eviction_blocked_checkpoint;
+    to->cache_eviction_blocked_checkpoint_hs += snap.cache_eviction_blocked_checkpoint_hs;
+    to->cache_eviction_get_ref += snap.cache_eviction_get_ref;
+    to->cache_eviction_get_ref_shard_steal += snap.cache_eviction_get_ref_shard_steal;
+    to->cache_eviction_get_ref_empty += snap.cache_eviction_get_ref_empty;
+    to->cache_eviction_get_ref_empty2 += snap.cache_eviction_get_ref_empty2;
+    to->cache_eviction_aggressive_set += snap.cache_eviction_aggressive_set;
+    to->cache_eviction_empty_score += snap.cache_eviction_empty_score;
     to->cache_eviction_blocked_no_ts_checkpoint_race_1 +=
-      WT_STAT_READ(from, cache_eviction_blocked_no_ts_checkpoint_race_1);
+      snap.cache_eviction_blocked_no_ts_checkpoint_race_1;
     to->cache_eviction_blocked_no_ts_checkpoint_race_2 +=
-      WT_STAT_READ(from, cache_eviction_blocked_no_ts_checkpoint_race_2);
+      snap.cache_eviction_blocked_no_ts_checkpoint_race_2;
     to->cache_eviction_blocked_no_ts_checkpoint_race_3 +=
-      WT_STAT_READ(from, cache_eviction_blocked_no_ts_checkpoint_race_3);
+      snap.cache_eviction_blocked_no_ts_checkpoint_race_3;
     to->cache_eviction_blocked_no_ts_checkpoint_race_4 +=
-      WT_STAT_READ(from, cache_eviction_blocked_no_ts_checkpoint_race_4);
+      snap.cache_eviction_blocked_no_ts_checkpoint_race_4;
     to->cache_eviction_blocked_remove_hs_race_with_checkpoint +=
-      WT_STAT_READ(from, cache_eviction_blocked_remove_hs_race_with_checkpoint);
-    to->cache_eviction_blocked_no_progress +=
-      WT_STAT_READ(from, cache_eviction_blocked_no_progress);
-    to->cache_eviction_walk_passes += WT_STAT_READ(from, cache_eviction_walk_passes);
-    to->cache_eviction_queue_empty += WT_STAT_READ(from, cache_eviction_queue_empty);
-    to->cache_eviction_queue_not_empty += WT_STAT_READ(from, cache_eviction_queue_not_empty);
-    to->cache_eviction_server_evicting += WT_STAT_READ(from, cache_eviction_server_evicting);
-    to->cache_eviction_server_slept += WT_STAT_READ(from, cache_eviction_server_slept);
-    to->cache_eviction_slow += WT_STAT_READ(from, cache_eviction_slow);
-    to->cache_eviction_walk_leaf_notfound += WT_STAT_READ(from, cache_eviction_walk_leaf_notfound);
-    to->cache_eviction_state += WT_STAT_READ(from, cache_eviction_state);
-    to->cache_eviction_walk_sleeps += WT_STAT_READ(from, cache_eviction_walk_sleeps);
-    to->cache_eviction_target_page_lt10 += WT_STAT_READ(from, cache_eviction_target_page_lt10);
-    to->cache_eviction_target_page_lt32 += WT_STAT_READ(from, cache_eviction_target_page_lt32);
-    to->cache_eviction_target_page_ge128 += WT_STAT_READ(from, cache_eviction_target_page_ge128);
-    to->cache_eviction_target_page_lt64 += WT_STAT_READ(from, cache_eviction_target_page_lt64);
-    to->cache_eviction_target_page_lt128 += WT_STAT_READ(from, cache_eviction_target_page_lt128);
-    to->cache_eviction_target_page_reduced +=
-      WT_STAT_READ(from, cache_eviction_target_page_reduced);
+      snap.cache_eviction_blocked_remove_hs_race_with_checkpoint;
+    to->cache_eviction_blocked_no_progress += snap.cache_eviction_blocked_no_progress;
+    to->cache_eviction_walk_passes += snap.cache_eviction_walk_passes;
+    to->cache_eviction_queue_empty += snap.cache_eviction_queue_empty;
+    to->cache_eviction_queue_not_empty += snap.cache_eviction_queue_not_empty;
+    to->cache_eviction_server_evicting += snap.cache_eviction_server_evicting;
+    to->cache_eviction_server_slept += snap.cache_eviction_server_slept;
+    to->cache_eviction_slow += snap.cache_eviction_slow;
+    to->cache_eviction_walk_leaf_notfound += snap.cache_eviction_walk_leaf_notfound;
+    to->cache_eviction_state += snap.cache_eviction_state;
+    to->cache_eviction_walk_sleeps += snap.cache_eviction_walk_sleeps;
+    to->cache_eviction_target_page_lt10 += snap.cache_eviction_target_page_lt10;
+    to->cache_eviction_target_page_lt32 += snap.cache_eviction_target_page_lt32;
+    to->cache_eviction_target_page_ge128 += snap.cache_eviction_target_page_ge128;
+    to->cache_eviction_target_page_lt64 += snap.cache_eviction_target_page_lt64;
+    to->cache_eviction_target_page_lt128 += snap.cache_eviction_target_page_lt128;
+    to->cache_eviction_target_page_reduced += snap.cache_eviction_target_page_reduced;
     to->cache_eviction_target_strategy_both_clean_and_dirty +=
-      WT_STAT_READ(from, cache_eviction_target_strategy_both_clean_and_dirty);
-    to->cache_eviction_target_strategy_clean +=
-      WT_STAT_READ(from, cache_eviction_target_strategy_clean);
-    to->cache_eviction_target_strategy_dirty +=
-      WT_STAT_READ(from, cache_eviction_target_strategy_dirty);
-    to->cache_eviction_walks_abandoned += WT_STAT_READ(from, cache_eviction_walks_abandoned);
-    to->cache_eviction_walks_stopped += WT_STAT_READ(from, cache_eviction_walks_stopped);
-    to->cache_eviction_walks_gave_up_no_targets +=
-      WT_STAT_READ(from, cache_eviction_walks_gave_up_no_targets);
-    to->cache_eviction_walks_gave_up_ratio +=
-      WT_STAT_READ(from, cache_eviction_walks_gave_up_ratio);
-    to->cache_eviction_walks_ended += WT_STAT_READ(from, cache_eviction_walks_ended);
-    to->cache_eviction_walk_restart += WT_STAT_READ(from, cache_eviction_walk_restart);
-    to->cache_eviction_walk_from_root += WT_STAT_READ(from, cache_eviction_walk_from_root);
-    to->cache_eviction_walk_saved_pos += WT_STAT_READ(from, cache_eviction_walk_saved_pos);
-    to->cache_eviction_active_workers += WT_STAT_READ(from, cache_eviction_active_workers);
-    to->cache_eviction_worker_created += WT_STAT_READ(from, cache_eviction_worker_created);
-    to->cache_eviction_worker_evicting += WT_STAT_READ(from, cache_eviction_worker_evicting);
-    to->cache_eviction_worker_removed += WT_STAT_READ(from, cache_eviction_worker_removed);
-    to->cache_eviction_stable_state_workers +=
-      WT_STAT_READ(from, cache_eviction_stable_state_workers);
-    to->cache_eviction_walks_active += WT_STAT_READ(from, cache_eviction_walks_active);
-    to->cache_eviction_walks_started += WT_STAT_READ(from, cache_eviction_walks_started);
-    to->cache_eviction_force_retune += WT_STAT_READ(from, cache_eviction_force_retune);
-    to->cache_eviction_force_no_retry += WT_STAT_READ(from, cache_eviction_force_no_retry);
-    to->cache_eviction_force_hs_fail += WT_STAT_READ(from, cache_eviction_force_hs_fail);
-    to->cache_eviction_force_hs += WT_STAT_READ(from, cache_eviction_force_hs);
-    to->cache_eviction_force_hs_success += WT_STAT_READ(from, cache_eviction_force_hs_success);
-    to->cache_eviction_force_clean += WT_STAT_READ(from, cache_eviction_force_clean);
-    to->cache_eviction_force_clean_time += WT_STAT_READ(from, cache_eviction_force_clean_time);
-    to->cache_eviction_force_dirty += WT_STAT_READ(from, cache_eviction_force_dirty);
-    to->cache_eviction_force_dirty_time += WT_STAT_READ(from, cache_eviction_force_dirty_time);
-    to->cache_eviction_force_long_update_list +=
-      WT_STAT_READ(from, cache_eviction_force_long_update_list);
-    to->cache_eviction_force_delete += WT_STAT_READ(from, cache_eviction_force_delete);
-    to->cache_eviction_force += WT_STAT_READ(from, cache_eviction_force);
-    to->cache_eviction_force_fail += WT_STAT_READ(from, cache_eviction_force_fail);
-    to->cache_eviction_force_fail_time += WT_STAT_READ(from, cache_eviction_force_fail_time);
-    to->cache_eviction_blocked_hazard += WT_STAT_READ(from, cache_eviction_blocked_hazard);
-    to->cache_hazard_checks += WT_STAT_READ(from, cache_hazard_checks);
-    to->cache_hazard_walks += WT_STAT_READ(from, cache_hazard_walks);
-    if ((v = WT_STAT_READ(from, cache_hazard_max)) > to->cache_hazard_max)
-        to->cache_hazard_max = v;
-    to->cache_hs_insert += WT_STAT_READ(from, cache_hs_insert);
-    to->cache_hs_insert_restart += WT_STAT_READ(from, cache_hs_insert_restart);
-    to->cache_hs_ondisk_max += WT_STAT_READ(from, cache_hs_ondisk_max);
-    to->cache_hs_ondisk += WT_STAT_READ(from, cache_hs_ondisk);
-    to->cache_hs_read += WT_STAT_READ(from, cache_hs_read);
-    to->cache_hs_read_miss += WT_STAT_READ(from, cache_hs_read_miss);
-    to->cache_hs_read_squash += WT_STAT_READ(from, cache_hs_read_squash);
-    to->cache_hs_order_lose_durable_timestamp +=
-      WT_STAT_READ(from, cache_hs_order_lose_durable_timestamp);
-    to->cache_hs_key_truncate_rts_unstable +=
-      WT_STAT_READ(from, cache_hs_key_truncate_rts_unstable);
-    to->cache_hs_key_truncate_rts += WT_STAT_READ(from, cache_hs_key_truncate_rts);
-    to->cache_hs_btree_truncate += WT_STAT_READ(from, cache_hs_btree_truncate);
-    to->cache_hs_key_truncate += WT_STAT_READ(from, cache_hs_key_truncate);
-    to->cache_hs_order_remove += WT_STAT_READ(from, cache_hs_order_remove);
-    to->cache_hs_key_truncate_onpage_removal +=
-      WT_STAT_READ(from, cache_hs_key_truncate_onpage_removal);
-    to->cache_hs_btree_truncate_dryrun += WT_STAT_READ(from, cache_hs_btree_truncate_dryrun);
-    to->cache_hs_key_truncate_rts_unstable_dryrun +=
-      WT_STAT_READ(from, cache_hs_key_truncate_rts_unstable_dryrun);
-    to->cache_hs_key_truncate_rts_dryrun += WT_STAT_READ(from, cache_hs_key_truncate_rts_dryrun);
-    to->cache_hs_order_reinsert += WT_STAT_READ(from, cache_hs_order_reinsert);
-    to->cache_hs_write_squash += WT_STAT_READ(from, cache_hs_write_squash);
-    to->cache_inmem_splittable += WT_STAT_READ(from, cache_inmem_splittable);
-    to->cache_inmem_split += WT_STAT_READ(from, cache_inmem_split);
+      snap.cache_eviction_target_strategy_both_clean_and_dirty;
+    to->cache_eviction_target_strategy_clean += snap.cache_eviction_target_strategy_clean;
+    to->cache_eviction_target_strategy_dirty += snap.cache_eviction_target_strategy_dirty;
+    to->cache_eviction_walks_abandoned += snap.cache_eviction_walks_abandoned;
+    to->cache_eviction_walks_stopped += snap.cache_eviction_walks_stopped;
+    to->cache_eviction_walks_gave_up_no_targets += snap.cache_eviction_walks_gave_up_no_targets;
+    to->cache_eviction_walks_gave_up_ratio += snap.cache_eviction_walks_gave_up_ratio;
+    to->cache_eviction_walks_ended += snap.cache_eviction_walks_ended;
+    to->cache_eviction_walk_restart += snap.cache_eviction_walk_restart;
+    to->cache_eviction_walk_from_root += snap.cache_eviction_walk_from_root;
+    to->cache_eviction_walk_saved_pos += snap.cache_eviction_walk_saved_pos;
+    to->cache_eviction_active_workers += snap.cache_eviction_active_workers;
+    to->cache_eviction_worker_created += snap.cache_eviction_worker_created;
+    to->cache_eviction_worker_evicting += snap.cache_eviction_worker_evicting;
+    to->cache_eviction_worker_removed += snap.cache_eviction_worker_removed;
+    to->cache_eviction_stable_state_workers += snap.cache_eviction_stable_state_workers;
+    to->cache_eviction_walks_active += snap.cache_eviction_walks_active;
+    to->cache_eviction_walks_started += snap.cache_eviction_walks_started;
+    to->cache_eviction_force_retune += snap.cache_eviction_force_retune;
+    to->cache_eviction_force_no_retry += snap.cache_eviction_force_no_retry;
+    to->cache_eviction_force_hs_fail += snap.cache_eviction_force_hs_fail;
+    to->cache_eviction_force_hs += snap.cache_eviction_force_hs;
+    to->cache_eviction_force_hs_success += snap.cache_eviction_force_hs_success;
+    to->cache_eviction_force_clean += snap.cache_eviction_force_clean;
+    to->cache_eviction_force_clean_time += snap.cache_eviction_force_clean_time;
+    to->cache_eviction_force_dirty += snap.cache_eviction_force_dirty;
+    to->cache_eviction_force_dirty_time += snap.cache_eviction_force_dirty_time;
+    to->cache_eviction_force_long_update_list += snap.cache_eviction_force_long_update_list;
+    to->cache_eviction_force_delete += snap.cache_eviction_force_delete;
+    to->cache_eviction_force += snap.cache_eviction_force;
+    to->cache_eviction_force_fail += snap.cache_eviction_force_fail;
+    to->cache_eviction_force_fail_time += snap.cache_eviction_force_fail_time;
+    to->cache_eviction_blocked_hazard += snap.cache_eviction_blocked_hazard;
+    to->cache_hazard_checks += snap.cache_hazard_checks;
+    to->cache_hazard_walks += snap.cache_hazard_walks;
+    if (snap.cache_hazard_max > to->cache_hazard_max)
+        to->cache_hazard_max = snap.cache_hazard_max;
+    to->cache_hs_insert += snap.cache_hs_insert;
+    to->cache_hs_insert_restart += snap.cache_hs_insert_restart;
+    to->cache_hs_ondisk_max += snap.cache_hs_ondisk_max;
+    to->cache_hs_ondisk += snap.cache_hs_ondisk;
+    to->cache_hs_read += snap.cache_hs_read;
+    to->cache_hs_read_miss += snap.cache_hs_read_miss;
+    to->cache_hs_read_squash += snap.cache_hs_read_squash;
+    to->cache_hs_order_lose_durable_timestamp += snap.cache_hs_order_lose_durable_timestamp;
+    to->cache_hs_key_truncate_rts_unstable += snap.cache_hs_key_truncate_rts_unstable;
+    to->cache_hs_key_truncate_rts += snap.cache_hs_key_truncate_rts;
+    to->cache_hs_btree_truncate += snap.cache_hs_btree_truncate;
+    to->cache_hs_key_truncate += snap.cache_hs_key_truncate;
+    to->cache_hs_order_remove += snap.cache_hs_order_remove;
+    to->cache_hs_key_truncate_onpage_removal += snap.cache_hs_key_truncate_onpage_removal;
+    to->cache_hs_btree_truncate_dryrun += snap.cache_hs_btree_truncate_dryrun;
+    to->cache_hs_key_truncate_rts_unstable_dryrun += snap.cache_hs_key_truncate_rts_unstable_dryrun;
+    to->cache_hs_key_truncate_rts_dryrun += snap.cache_hs_key_truncate_rts_dryrun;
+    to->cache_hs_order_reinsert += snap.cache_hs_order_reinsert;
+    to->cache_hs_write_squash += snap.cache_hs_write_squash;
+    to->cache_inmem_splittable += snap.cache_inmem_splittable;
+    to->cache_inmem_split += snap.cache_inmem_split;
+    to->cache_inmem_split_contended += snap.cache_inmem_split_contended;
     to->cache_eviction_blocked_internal_page_split +=
-      WT_STAT_READ(from, cache_eviction_blocked_internal_page_split);
-    to->cache_eviction_internal += WT_STAT_READ(from, cache_eviction_internal);
-    to->cache_eviction_internal_pages_queued +=
-      WT_STAT_READ(from, cache_eviction_internal_pages_queued);
-    to->cache_eviction_internal_pages_seen +=
-      WT_STAT_READ(from, cache_eviction_internal_pages_seen);
+      snap.cache_eviction_blocked_internal_page_split;
+    to->cache_eviction_internal += snap.cache_eviction_internal;
+    to->cache_eviction_internal_pages_queued += snap.cache_eviction_internal_pages_queued;
+    to->cache_eviction_internal_pages_seen += snap.cache_eviction_internal_pages_seen;
     to->cache_eviction_internal_pages_already_queued +=
-      WT_STAT_READ(from, cache_eviction_internal_pages_already_queued);
-    to->cache_eviction_split_internal += WT_STAT_READ(from, cache_eviction_split_internal);
-    to->cache_eviction_split_leaf += WT_STAT_READ(from, cache_eviction_split_leaf);
-    to->cache_bytes_max += WT_STAT_READ(from, cache_bytes_max);
-    to->cache_eviction_maximum_milliseconds +=
-      WT_STAT_READ(from, cache_eviction_maximum_milliseconds);
-    to->cache_eviction_maximum_page_size += WT_STAT_READ(from, cache_eviction_maximum_page_size);
-    to->cache_eviction_dirty += WT_STAT_READ(from, cache_eviction_dirty);
-    to->cache_eviction_app_dirty += WT_STAT_READ(from, cache_eviction_app_dirty);
+      snap.cache_eviction_internal_pages_already_queued;
+    to->cache_eviction_split_internal += snap.cache_eviction_split_internal;
+    to->cache_eviction_split_leaf += snap.cache_eviction_split_leaf;
+    to->cache_bytes_max += snap.cache_bytes_max;
+    to->cache_eviction_maximum_milliseconds += snap.cache_eviction_maximum_milliseconds;
+    to->cache_eviction_maximum_page_size += snap.cache_eviction_maximum_page_size;
+    to->cache_eviction_dirty += snap.cache_eviction_dirty;
+    to->cache_eviction_app_dirty += snap.cache_eviction_app_dirty;
     to->cache_eviction_blocked_multi_block_reconcilation_during_checkpoint +=
-      WT_STAT_READ(from, cache_eviction_blocked_multi_block_reconcilation_during_checkpoint);
-    to->cache_timed_out_ops += WT_STAT_READ(from, cache_timed_out_ops);
-    to->cache_eviction_blocked_overflow_keys +=
-      WT_STAT_READ(from, cache_eviction_blocked_overflow_keys);
-    to->cache_read_overflow += WT_STAT_READ(from, cache_read_overflow);
-    to->cache_eviction_deepen += WT_STAT_READ(from, cache_eviction_deepen);
-    to->cache_write_hs += WT_STAT_READ(from, cache_write_hs);
-    to->cache_eviction_consider_prefetch += WT_STAT_READ(from, cache_eviction_consider_prefetch);
-    to->cache_pages_inuse += WT_STAT_READ(from, cache_pages_inuse);
-    to->cache_eviction_app += WT_STAT_READ(from, cache_eviction_app);
+      snap.cache_eviction_blocked_multi_block_reconcilation_during_checkpoint;
+    to->cache_timed_out_ops += snap.cache_timed_out_ops;
+    to->cache_eviction_blocked_overflow_keys += snap.cache_eviction_blocked_overflow_keys;
+    to->cache_read_overflow += snap.cache_read_overflow;
+    to->cache_eviction_deepen += snap.cache_eviction_deepen;
+    to->cache_write_hs += snap.cache_write_hs;
+    to->cache_eviction_consider_prefetch += snap.cache_eviction_consider_prefetch;
+    to->cache_pages_inuse += snap.cache_pages_inuse;
+    to->cache_eviction_app += snap.cache_eviction_app;
     to->cache_eviction_pages_in_parallel_with_checkpoint +=
-      WT_STAT_READ(from, cache_eviction_pages_in_parallel_with_checkpoint);
-    to->cache_eviction_pages_queued += WT_STAT_READ(from, cache_eviction_pages_queued);
-    to->cache_eviction_pages_queued_post_lru +=
-      WT_STAT_READ(from, cache_eviction_pages_queued_post_lru);
-    to->cache_eviction_pages_queued_urgent +=
-      WT_STAT_READ(from, cache_eviction_pages_queued_urgent);
-    to->cache_eviction_pages_queued_oldest +=
-      WT_STAT_READ(from, cache_eviction_pages_queued_oldest);
+      snap.cache_eviction_pages_in_parallel_with_checkpoint;
+    to->cache_eviction_pages_queued += snap.cache_eviction_pages_queued;
+    to->cache_eviction_pages_queued_post_lru += snap.cache_eviction_pages_queued_post_lru;
+    to->cache_eviction_pages_queued_urgent += snap.cache_eviction_pages_queued_urgent;
+    to->cache_eviction_pages_queued_oldest += snap.cache_eviction_pages_queued_oldest;
     to->cache_eviction_pages_queued_urgent_hs_dirty +=
-      WT_STAT_READ(from, cache_eviction_pages_queued_urgent_hs_dirty);
-    to->cache_read += WT_STAT_READ(from, cache_read);
-    to->cache_read_deleted += WT_STAT_READ(from, cache_read_deleted);
-    to->cache_read_deleted_prepared += WT_STAT_READ(from, cache_read_deleted_prepared);
-    to->cache_eviction_clear_ordinary += WT_STAT_READ(from, cache_eviction_clear_ordinary);
-    to->cache_pages_requested += WT_STAT_READ(from, cache_pages_requested);
-    to->cache_pages_prefetch += WT_STAT_READ(from, cache_pages_prefetch);
-    to->cache_eviction_pages_seen += WT_STAT_READ(from, cache_eviction_pages_seen);
-    to->cache_eviction_pages_already_queued +=
-      WT_STAT_READ(from, cache_eviction_pages_already_queued);
-    to->cache_eviction_fail += WT_STAT_READ(from, cache_eviction_fail);
+      snap.cache_eviction_pages_queued_urgent_hs_dirty;
+    to->cache_read += snap.cache_read;
+    to->cache_read_deleted += snap.cache_read_deleted;
+    to->cache_read_deleted_prepared += snap.cache_read_deleted_prepared;
+    to->cache_eviction_clear_ordinary += snap.cache_eviction_clear_ordinary;
+    to->cache_pages_requested += snap.cache_pages_requested;
+    to->cache_pages_prefetch += snap.cache_pages_prefetch;
+    to->cache_eviction_pages_seen += snap.cache_eviction_pages_seen;
+    to->cache_eviction_pages_already_queued += snap.cache_eviction_pages_already_queued;
+    to->cache_eviction_fail += snap.cache_eviction_fail;
     to->cache_eviction_fail_active_children_on_an_internal_page +=
-      WT_STAT_READ(from, cache_eviction_fail_active_children_on_an_internal_page);
-    to->cache_eviction_fail_in_reconciliation +=
-      WT_STAT_READ(from, cache_eviction_fail_in_reconciliation);
-    to->cache_eviction_fail_checkpoint_no_ts +=
-      WT_STAT_READ(from, cache_eviction_fail_checkpoint_no_ts);
-    to->cache_eviction_walk += WT_STAT_READ(from, cache_eviction_walk);
-    to->cache_write += WT_STAT_READ(from, cache_write);
-    to->cache_write_restore += WT_STAT_READ(from, cache_write_restore);
-    to->cache_overhead += WT_STAT_READ(from, cache_overhead);
-    to->cache_eviction_blocked_recently_modified +=
-      WT_STAT_READ(from, cache_eviction_blocked_recently_modified);
-    to->cache_reverse_splits += WT_STAT_READ(from, cache_reverse_splits);
-    to->cache_reverse_splits_skipped_vlcs += WT_STAT_READ(from, cache_reverse_splits_skipped_vlcs);
+      snap.cache_eviction_fail_active_children_on_an_internal_page;
+    to->cache_eviction_fail_in_reconciliation += snap.cache_eviction_fail_in_reconciliation;
+    to->cache_eviction_fail_checkpoint_no_ts += snap.cache_eviction_fail_checkpoint_no_ts;
+    to->cache_eviction_walk += snap.cache_eviction_walk;
+    to->cache_write += snap.cache_write;
+    to->cache_write_restore += snap.cache_write_restore;
+    to->cache_overhead += snap.cache_overhead;
+    to->cache_eviction_blocked_recently_modified += snap.cache_eviction_blocked_recently_modified;
+    to->cache_reverse_splits += snap.cache_reverse_splits;
+    to->cache_reverse_splits_skipped_vlcs += snap.cache_reverse_splits_skipped_vlcs;
     to->cache_eviction_server_skip_dirty_pages_during_checkpoint +=
-      WT_STAT_READ(from, cache_eviction_server_skip_dirty_pages_during_checkpoint);
+      snap.cache_eviction_server_skip_dirty_pages_during_checkpoint;
     to->cache_eviction_server_skip_pages_last_running +=
-      WT_STAT_READ(from, cache_eviction_server_skip_pages_last_running);
-    to->cache_eviction_server_skip_pages_retry +=
-      WT_STAT_READ(from, cache_eviction_server_skip_pages_retry);
-    to->cache_hs_insert_full_update += WT_STAT_READ(from, cache_hs_insert_full_update);
-    to->cache_hs_insert_reverse_modify += WT_STAT_READ(from, cache_hs_insert_reverse_modify);
-    to->cache_reentry_hs_eviction_milliseconds +=
-      WT_STAT_READ(from, cache_reentry_hs_eviction_milliseconds);
-    to->cache_bytes_internal += WT_STAT_READ(from, cache_bytes_internal);
-    to->cache_bytes_leaf += WT_STAT_READ(from, cache_bytes_leaf);
-    to->cache_bytes_dirty += WT_STAT_READ(from, cache_bytes_dirty);
-    to->cache_pages_dirty += WT_STAT_READ(from, cache_pages_dirty);
+      snap.cache_eviction_server_skip_pages_last_running;
+    to->cache_eviction_server_skip_pages_retry += snap.cache_eviction_server_skip_pages_retry;
+    to->cache_hs_insert_full_update += snap.cache_hs_insert_full_update;
+    to->cache_hs_insert_reverse_modify += snap.cache_hs_insert_reverse_modify;
+    to->cache_reentry_hs_eviction_milliseconds += snap.cache_reentry_hs_eviction_milliseconds;
+    to->cache_bytes_internal += snap.cache_bytes_internal;
+    to->cache_bytes_leaf += snap.cache_bytes_leaf;
+    to->cache_bytes_dirty += snap.cache_bytes_dirty;
+    to->cache_pages_dirty += snap.cache_pages_dirty;
     to->cache_eviction_blocked_uncommitted_truncate +=
-      WT_STAT_READ(from, cache_eviction_blocked_uncommitted_truncate);
-    to->cache_eviction_clean += WT_STAT_READ(from, cache_eviction_clean);
-    to->fsync_all_fh_total += WT_STAT_READ(from, fsync_all_fh_total);
-    to->fsync_all_fh += WT_STAT_READ(from, fsync_all_fh);
-    to->fsync_all_time += WT_STAT_READ(from, fsync_all_time);
-    to->capacity_bytes_read += WT_STAT_READ(from, capacity_bytes_read);
-    to->capacity_bytes_ckpt += WT_STAT_READ(from, capacity_bytes_ckpt);
-    to->capacity_bytes_chunkcache += WT_STAT_READ(from, capacity_bytes_chunkcache);
-    to->capacity_bytes_evict += WT_STAT_READ(from, capacity_bytes_evict);
-    to->capacity_bytes_log += WT_STAT_READ(from, capacity_bytes_log);
-    to->capacity_bytes_written += WT_STAT_READ(from, capacity_bytes_written);
-    to->capacity_threshold += WT_STAT_READ(from, capacity_threshold);
-    to->capacity_time_total += WT_STAT_READ(from, capacity_time_total);
-    to->capacity_time_ckpt += WT_STAT_READ(from, capacity_time_ckpt);
-    to->capacity_time_evict += WT_STAT_READ(from, capacity_time_evict);
-    to->capacity_time_log += WT_STAT_READ(from, capacity_time_log);
-    to->capacity_time_read += WT_STAT_READ(from, capacity_time_read);
-    to->capacity_time_chunkcache += WT_STAT_READ(from, capacity_time_chunkcache);
-    to->checkpoint_snapshot_acquired += WT_STAT_READ(from, checkpoint_snapshot_acquired);
-    to->checkpoint_skipped += WT_STAT_READ(from, checkpoint_skipped);
-    to->checkpoint_fsync_post += WT_STAT_READ(from, checkpoint_fsync_post);
-    to->checkpoint_fsync_post_duration += WT_STAT_READ(from, checkpoint_fsync_post_duration);
-    to->checkpoint_generation += WT_STAT_READ(from, checkpoint_generation);
-    to->checkpoint_time_max += WT_STAT_READ(from, checkpoint_time_max);
-    to->checkpoint_time_min += WT_STAT_READ(from, checkpoint_time_min);
-    to->checkpoint_handle_duration += WT_STAT_READ(from, checkpoint_handle_duration);
-    to->checkpoint_handle_duration_apply += WT_STAT_READ(from, checkpoint_handle_duration_apply);
-    to->checkpoint_handle_duration_skip += WT_STAT_READ(from, checkpoint_handle_duration_skip);
-    to->checkpoint_handle_applied += WT_STAT_READ(from, checkpoint_handle_applied);
-    to->checkpoint_handle_skipped += WT_STAT_READ(from, checkpoint_handle_skipped);
-    to->checkpoint_handle_walked += WT_STAT_READ(from, checkpoint_handle_walked);
-    to->checkpoint_time_recent += WT_STAT_READ(from, checkpoint_time_recent);
-    to->checkpoints_api += WT_STAT_READ(from, checkpoints_api);
-    to->checkpoints_compact += WT_STAT_READ(from, checkpoints_compact);
-    to->checkpoint_sync += WT_STAT_READ(from, checkpoint_sync);
-    to->checkpoint_presync += WT_STAT_READ(from, checkpoint_presync);
-    to->checkpoint_hs_pages_reconciled += WT_STAT_READ(from, checkpoint_hs_pages_reconciled);
-    to->checkpoint_pages_visited_internal += WT_STAT_READ(from, checkpoint_pages_visited_internal);
-    to->checkpoint_pages_visited_leaf += WT_STAT_READ(from, checkpoint_pages_visited_leaf);
-    to->checkpoint_pages_reconciled += WT_STAT_READ(from, checkpoint_pages_reconciled);
-    to->checkpoint_cleanup_pages_evict += WT_STAT_READ(from, checkpoint_cleanup_pages_evict);
-    to->checkpoint_cleanup_pages_removed += WT_STAT_READ(from, checkpoint_cleanup_pages_removed);
-    to->checkpoint_cleanup_pages_walk_skipped +=
-      WT_STAT_READ(from, checkpoint_cleanup_pages_walk_skipped);
-    to->checkpoint_cleanup_pages_visited += WT_STAT_READ(from, checkpoint_cleanup_pages_visited);
-    to->checkpoint_prep_running += WT_STAT_READ(from, checkpoint_prep_running);
-    to->checkpoint_prep_max += WT_STAT_READ(from, checkpoint_prep_max);
-    to->checkpoint_prep_min += WT_STAT_READ(from, checkpoint_prep_min);
-    to->checkpoint_prep_recent += WT_STAT_READ(from, checkpoint_prep_recent);
-    to->checkpoint_prep_total += WT_STAT_READ(from, checkpoint_prep_total);
-    to->checkpoint_state += WT_STAT_READ(from, checkpoint_state);
-    to->checkpoint_scrub_target += WT_STAT_READ(from, checkpoint_scrub_target);
-    to->checkpoint_scrub_max += WT_STAT_READ(from, checkpoint_scrub_max);
-    to->checkpoint_scrub_min += WT_STAT_READ(from, checkpoint_scrub_min);
-    to->checkpoint_scrub_recent += WT_STAT_READ(from, checkpoint_scrub_recent);
-    to->checkpoint_scrub_total += WT_STAT_READ(from, checkpoint_scrub_total);
-    to->checkpoint_stop_stress_active += WT_STAT_READ(from, checkpoint_stop_stress_active);
-    to->checkpoint_tree_duration += WT_STAT_READ(from, checkpoint_tree_duration);
-    to->checkpoints_total_failed += WT_STAT_READ(from, checkpoints_total_failed);
-    to->checkpoints_total_succeed += WT_STAT_READ(from, checkpoints_total_succeed);
-    to->checkpoint_time_total += WT_STAT_READ(from, checkpoint_time_total);
-    to->checkpoint_obsolete_applied += WT_STAT_READ(from, checkpoint_obsolete_applied);
-    to->checkpoint_wait_reduce_dirty += WT_STAT_READ(from, checkpoint_wait_reduce_dirty);
-    to->chunkcache_spans_chunks_read += WT_STAT_READ(from, chunkcache_spans_chunks_read);
-    to->chunkcache_chunks_evicted += WT_STAT_READ(from, chunkcache_chunks_evicted);
-    to->chunkcache_exceeded_bitmap_capacity +=
-      WT_STAT_READ(from, chunkcache_exceeded_bitmap_capacity);
-    to->chunkcache_exceeded_capacity += WT_STAT_READ(from, chunkcache_exceeded_capacity);
-    to->chunkcache_lookups += WT_STAT_READ(from, chunkcache_lookups);
+      snap.cache_eviction_blocked_uncommitted_truncate;
+    to->cache_eviction_clean += snap.cache_eviction_clean;
+    to->fsync_all_fh_total += snap.fsync_all_fh_total;
+    to->fsync_all_fh += snap.fsync_all_fh;
+    to->fsync_all_time += snap.fsync_all_time;
+    to->capacity_bytes_read += snap.capacity_bytes_read;
+    to->capacity_bytes_ckpt += snap.capacity_bytes_ckpt;
+    to->capacity_bytes_chunkcache += snap.capacity_bytes_chunkcache;
+    to->capacity_bytes_evict += snap.capacity_bytes_evict;
+    to->capacity_bytes_log += snap.capacity_bytes_log;
+    to->capacity_bytes_written += snap.capacity_bytes_written;
+    to->capacity_threshold += snap.capacity_threshold;
+    to->capacity_time_total += snap.capacity_time_total;
+    to->capacity_time_ckpt += snap.capacity_time_ckpt;
+    to->capacity_time_evict += snap.capacity_time_evict;
+    to->capacity_time_log += snap.capacity_time_log;
+    to->capacity_time_read += snap.capacity_time_read;
+    to->capacity_time_chunkcache += snap.capacity_time_chunkcache;
+    to->checkpoint_snapshot_acquired += snap.checkpoint_snapshot_acquired;
+    to->checkpoint_skipped += snap.checkpoint_skipped;
+    to->checkpoint_fsync_post += snap.checkpoint_fsync_post;
+    to->checkpoint_fsync_post_duration += snap.checkpoint_fsync_post_duration;
+    to->checkpoint_generation += snap.checkpoint_generation;
+    to->checkpoint_time_max += snap.checkpoint_time_max;
+    to->checkpoint_time_min += snap.checkpoint_time_min;
+    to->checkpoint_handle_duration += snap.checkpoint_handle_duration;
+    to->checkpoint_handle_duration_apply += snap.checkpoint_handle_duration_apply;
+    to->checkpoint_handle_duration_skip += snap.checkpoint_handle_duration_skip;
+    to->checkpoint_handle_applied += snap.checkpoint_handle_applied;
+    to->checkpoint_handle_skipped += snap.checkpoint_handle_skipped;
+    to->checkpoint_handle_walked += snap.checkpoint_handle_walked;
+    to->checkpoint_time_recent += snap.checkpoint_time_recent;
+    to->checkpoints_api += snap.checkpoints_api;
+    to->checkpoints_compact += snap.checkpoints_compact;
+    to->checkpoint_sync += snap.checkpoint_sync;
+    to->checkpoint_presync += snap.checkpoint_presync;
+    to->checkpoint_hs_pages_reconciled += snap.checkpoint_hs_pages_reconciled;
+    to->checkpoint_pages_visited_internal += snap.checkpoint_pages_visited_internal;
+    to->checkpoint_pages_reconciled_helper += snap.checkpoint_pages_reconciled_helper;
+    to->checkpoint_pages_visited_leaf += snap.checkpoint_pages_visited_leaf;
+    to->checkpoint_pages_reconciled += snap.checkpoint_pages_reconciled;
+    to->checkpoint_pages_reconciled_helper_wait += snap.checkpoint_pages_reconciled_helper_wait;
+    to->checkpoint_cleanup_pages_evict += snap.checkpoint_cleanup_pages_evict;
+    to->checkpoint_cleanup_pages_removed += snap.checkpoint_cleanup_pages_removed;
+    to->checkpoint_cleanup_pages_walk_skipped += snap.checkpoint_cleanup_pages_walk_skipped;
+    to->checkpoint_cleanup_pages_visited += snap.checkpoint_cleanup_pages_visited;
+    to->checkpoint_prep_running += snap.checkpoint_prep_running;
+    to->checkpoint_prep_max += snap.checkpoint_prep_max;
+    to->checkpoint_prep_min += snap.checkpoint_prep_min;
+    to->checkpoint_prep_recent += snap.checkpoint_prep_recent;
+    to->checkpoint_prep_total += snap.checkpoint_prep_total;
+    to->checkpoint_state += snap.checkpoint_state;
+    to->checkpoint_scrub_target += snap.checkpoint_scrub_target;
+    to->checkpoint_scrub_max += snap.checkpoint_scrub_max;
+    to->checkpoint_scrub_min += snap.checkpoint_scrub_min;
+    to->checkpoint_scrub_recent += snap.checkpoint_scrub_recent;
+    to->checkpoint_scrub_total += snap.checkpoint_scrub_total;
+    to->checkpoint_stop_stress_active += snap.checkpoint_stop_stress_active;
+    to->checkpoint_tree_duration += snap.checkpoint_tree_duration;
+    to->checkpoints_total_failed += snap.checkpoints_total_failed;
+    to->checkpoints_total_succeed += snap.checkpoints_total_succeed;
+    to->checkpoint_time_total += snap.checkpoint_time_total;
+    to->checkpoint_obsolete_applied += snap.checkpoint_obsolete_applied;
+    to->checkpoint_wait_reduce_dirty += snap.checkpoint_wait_reduce_dirty;
+    to->chunkcache_spans_chunks_read += snap.chunkcache_spans_chunks_read;
+    to->chunkcache_chunks_evicted += snap.chunkcache_chunks_evicted;
+    to->chunkcache_chunks_preloaded += snap.chunkcache_chunks_preloaded;
+    to->chunkcache_exceeded_bitmap_capacity += snap.chunkcache_exceeded_bitmap_capacity;
+    to->chunkcache_exceeded_capacity += snap.chunkcache_exceeded_capacity;
+    to->chunkcache_lookups += snap.chunkcache_lookups;
     to->chunkcache_chunks_loaded_from_flushed_tables +=
-      WT_STAT_READ(from, chunkcache_chunks_loaded_from_flushed_tables);
-    to->chunkcache_metadata_inserted += WT_STAT_READ(from, chunkcache_metadata_inserted);
-    to->chunkcache_metadata_removed += WT_STAT_READ(from, chunkcache_metadata_removed);
-    to->chunkcache_metadata_work_units_dropped +=
-      WT_STAT_READ(from, chunkcache_metadata_work_units_dropped);
-    to->chunkcache_metadata_work_units_created +=
-      WT_STAT_READ(from, chunkcache_metadata_work_units_created);
-    to->chunkcache_metadata_work_units_dequeued +=
-      WT_STAT_READ(from, chunkcache_metadata_work_units_dequeued);
-    to->chunkcache_misses += WT_STAT_READ(from, chunkcache_misses);
-    to->chunkcache_io_failed += WT_STAT_READ(from, chunkcache_io_failed);
-    to->chunkcache_retries += WT_STAT_READ(from, chunkcache_retries);
-    to->chunkcache_retries_checksum_mismatch +=
-      WT_STAT_READ(from, chunkcache_retries_checksum_mismatch);
-    to->chunkcache_toomany_retries += WT_STAT_READ(from, chunkcache_toomany_retries);
-    to->chunkcache_bytes_read_persistent += WT_STAT_READ(from, chunkcache_bytes_read_persistent);
-    to->chunkcache_bytes_inuse += WT_STAT_READ(from, chunkcache_bytes_inuse);
-    to->chunkcache_bytes_inuse_pinned += WT_STAT_READ(from, chunkcache_bytes_inuse_pinned);
-    to->chunkcache_chunks_inuse += WT_STAT_READ(from, chunkcache_chunks_inuse);
-    to->chunkcache_created_from_metadata += WT_STAT_READ(from, chunkcache_created_from_metadata);
-    to->chunkcache_chunks_pinned += WT_STAT_READ(from, chunkcache_chunks_pinned);
-    to->cond_auto_wait_reset += WT_STAT_READ(from, cond_auto_wait_reset);
-    to->cond_auto_wait += WT_STAT_READ(from, cond_auto_wait);
-    to->cond_auto_wait_skipped += WT_STAT_READ(from, cond_auto_wait_skipped);
-    to->time_travel += WT_STAT_READ(from, time_travel);
-    to->file_open += WT_STAT_READ(from, file_open);
-    to->buckets_dh += WT_STAT_READ(from, buckets_dh);
-    to->buckets += WT_STAT_READ(from, buckets);
-    to->memory_allocation += WT_STAT_READ(from, memory_allocation);
-    to->memory_free += WT_STAT_READ(from, memory_free);
-    to->memory_grow += WT_STAT_READ(from, memory_grow);
-    to->no_session_sweep_5min += WT_STAT_READ(from, no_session_sweep_5min);
-    to->no_session_sweep_60min += WT_STAT_READ(from, no_session_sweep_60min);
-    to->cond_wait += WT_STAT_READ(from, cond_wait);
-    to->rwlock_read += WT_STAT_READ(from, rwlock_read);
-    to->rwlock_write += WT_STAT_READ(from, rwlock_write);
-    to->fsync_io += WT_STAT_READ(from, fsync_io);
-    to->read_io += WT_STAT_READ(from, read_io);
-    to->write_io += WT_STAT_READ(from, write_io);
-    to->cursor_next_skip_total += WT_STAT_READ(from, cursor_next_skip_total);
-    to->cursor_prev_skip_total += WT_STAT_READ(from, cursor_prev_skip_total);
-    to->cursor_skip_hs_cur_position += WT_STAT_READ(from, cursor_skip_hs_cur_position);
-    to->cursor_search_near_prefix_fast_paths +=
-      WT_STAT_READ(from, cursor_search_near_prefix_fast_paths);
-    to->cursor_reposition_failed += WT_STAT_READ(from, cursor_reposition_failed);
-    to->cursor_reposition += WT_STAT_READ(from, cursor_reposition);
-    to->cursor_bulk_count += WT_STAT_READ(from, cursor_bulk_count);
-    to->cursor_cached_count += WT_STAT_READ(from, cursor_cached_count);
-    to->cursor_bound_error += WT_STAT_READ(from, cursor_bound_error);
-    to->cursor_bounds_reset += WT_STAT_READ(from, cursor_bounds_reset);
-    to->cursor_bounds_comparisons += WT_STAT_READ(from, cursor_bounds_comparisons);
-    to->cursor_bounds_next_unpositioned += WT_STAT_READ(from, cursor_bounds_next_unpositioned);
-    to->cursor_bounds_next_early_exit += WT_STAT_READ(from, cursor_bounds_next_early_exit);
-    to->cursor_bounds_prev_unpositioned += WT_STAT_READ(from, cursor_bounds_prev_unpositioned);
-    to->cursor_bounds_prev_early_exit += WT_STAT_READ(from, cursor_bounds_prev_early_exit);
-    to->cursor_bounds_search_early_exit += WT_STAT_READ(from, cursor_bounds_search_early_exit);
+      snap.chunkcache_chunks_loaded_from_flushed_tables;
+    to->chunkcache_metadata_inserted += snap.chunkcache_metadata_inserted;
+    to->chunkcache_metadata_removed += snap.chunkcache_metadata_removed;
+    to->chunkcache_metadata_work_units_dropped += snap.chunkcache_metadata_work_units_dropped;
+    to->chunkcache_metadata_work_units_created += snap.chunkcache_metadata_work_units_created;
+    to->chunkcache_metadata_work_units_dequeued += snap.chunkcache_metadata_work_units_dequeued;
+    to->chunkcache_misses += snap.chunkcache_misses;
+    to->chunkcache_io_failed += snap.chunkcache_io_failed;
+    to->chunkcache_retries += snap.chunkcache_retries;
+    to->chunkcache_retries_checksum_mismatch += snap.chunkcache_retries_checksum_mismatch;
+    to->chunkcache_preload_time += snap.chunkcache_preload_time;
+    to->chunkcache_toomany_retries += snap.chunkcache_toomany_retries;
+    to->chunkcache_bytes_preloaded += snap.chunkcache_bytes_preloaded;
+    to->chunkcache_bytes_read_persistent += snap.chunkcache_bytes_read_persistent;
+    to->chunkcache_bytes_inuse += snap.chunkcache_bytes_inuse;
+    to->chunkcache_bytes_inuse_pinned += snap.chunkcache_bytes_inuse_pinned;
+    to->chunkcache_chunks_inuse += snap.chunkcache_chunks_inuse;
+    to->chunkcache_created_from_metadata += snap.chunkcache_created_from_metadata;
+    to->chunkcache_chunks_pinned += snap.chunkcache_chunks_pinned;
+    to->cond_auto_wait_reset += snap.cond_auto_wait_reset;
+    to->cond_auto_wait += snap.cond_auto_wait;
+    to->cond_auto_wait_skipped += snap.cond_auto_wait_skipped;
+    to->time_travel += snap.time_travel;
+    to->file_open += snap.file_open;
+    to->buckets_dh += snap.buckets_dh;
+    to->buckets += snap.buckets;
+    to->memory_allocation += snap.memory_allocation;
+    to->memory_free += snap.memory_free;
+    to->memory_grow += snap.memory_grow;
+    to->no_session_sweep_5min += snap.no_session_sweep_5min;
+    to->no_session_sweep_60min += snap.no_session_sweep_60min;
+    to->cond_wait += snap.cond_wait;
+    to->rwlock_read += snap.rwlock_read;
+    to->rwlock_write += snap.rwlock_write;
+    to->fsync_io += snap.fsync_io;
+    to->read_io += snap.read_io;
+    to->write_io += snap.write_io;
+    to->cursor_next_skip_total += snap.cursor_next_skip_total;
+    to->cursor_prev_skip_total += snap.cursor_prev_skip_total;
+    to->cursor_skip_hs_cur_position += snap.cursor_skip_hs_cur_position;
+    to->cursor_search_near_prefix_fast_paths += snap.cursor_search_near_prefix_fast_paths;
+    to->cursor_reposition_failed += snap.cursor_reposition_failed;
+    to->cursor_reposition += snap.cursor_reposition;
+    to->cursor_bulk_count += snap.cursor_bulk_count;
+    to->cursor_cached_count += snap.cursor_cached_count;
+    to->cursor_pool_count += snap.cursor_pool_count;
+    to->cursor_bound_error += snap.cursor_bound_error;
+    to->cursor_bounds_reset += snap.cursor_bounds_reset;
+    to->cursor_bounds_comparisons += snap.cursor_bounds_comparisons;
+    to->cursor_bounds_next_unpositioned += snap.cursor_bounds_next_unpositioned;
+    to->cursor_bounds_next_early_exit += snap.cursor_bounds_next_early_exit;
+    to->cursor_bounds_prev_unpositioned += snap.cursor_bounds_prev_unpositioned;
+    to->cursor_bounds_prev_early_exit += snap.cursor_bounds_prev_early_exit;
+    to->cursor_bounds_search_early_exit += snap.cursor_bounds_search_early_exit;
     to->cursor_bounds_search_near_repositioned_cursor +=
-      WT_STAT_READ(from, cursor_bounds_search_near_repositioned_cursor);
-    to->cursor_insert_bulk += WT_STAT_READ(from, cursor_insert_bulk);
-    to->cursor_cache_error += WT_STAT_READ(from, cursor_cache_error);
-    to->cursor_cache += WT_STAT_READ(from, cursor_cache);
-    to->cursor_close_error += WT_STAT_READ(from, cursor_close_error);
-    to->cursor_compare_error += WT_STAT_READ(from, cursor_compare_error);
-    to->cursor_create += WT_STAT_READ(from, cursor_create);
-    to->cursor_equals_error += WT_STAT_READ(from, cursor_equals_error);
-    to->cursor_get_key_error += WT_STAT_READ(from, cursor_get_key_error);
-    to->cursor_get_value_error += WT_STAT_READ(from, cursor_get_value_error);
-    to->cursor_insert += WT_STAT_READ(from, cursor_insert);
-    to->cursor_insert_error += WT_STAT_READ(from, cursor_insert_error);
-    to->cursor_insert_check_error += WT_STAT_READ(from, cursor_insert_check_error);
-    to->cursor_insert_bytes += WT_STAT_READ(from, cursor_insert_bytes);
-    to->cursor_largest_key_error += WT_STAT_READ(from, cursor_largest_key_error);
-    to->cursor_modify += WT_STAT_READ(from, cursor_modify);
-    to->cursor_modify_error += WT_STAT_READ(from, cursor_modify_error);
-    to->cursor_modify_bytes += WT_STAT_READ(from, cursor_modify_bytes);
-    to->cursor_modify_bytes_touch += WT_STAT_READ(from, cursor_modify_bytes_touch);
-    to->cursor_next += WT_STAT_READ(from, cursor_next);
-    to->cursor_next_error += WT_STAT_READ(from, cursor_next_error);
-    to->cursor_next_hs_tombstone += WT_STAT_READ(from, cursor_next_hs_tombstone);
-    to->cursor_next_skip_lt_100 += WT_STAT_READ(from, cursor_next_skip_lt_100);
-    to->cursor_next_skip_ge_100 += WT_STAT_READ(from, cursor_next_skip_ge_100);
-    to->cursor_next_random_error += WT_STAT_READ(from, cursor_next_random_error);
-    to->cursor_restart += WT_STAT_READ(from, cursor_restart);
-    to->cursor_prev += WT_STAT_READ(from, cursor_prev);
-    to->cursor_prev_error += WT_STAT_READ(from, cursor_prev_error);
-    to->cursor_prev_hs_tombstone += WT_STAT_READ(from, cursor_prev_hs_tombstone);
-    to->cursor_prev_skip_ge_100 += WT_STAT_READ(from, cursor_prev_skip_ge_100);
-    to->cursor_prev_skip_lt_100 += WT_STAT_READ(from, cursor_prev_skip_lt_100);
-    to->cursor_reconfigure_error += WT_STAT_READ(from, cursor_reconfigure_error);
-    to->cursor_remove += WT_STAT_READ(from, cursor_remove);
-    to->cursor_remove_error += WT_STAT_READ(from, cursor_remove_error);
-    to->cursor_remove_bytes += WT_STAT_READ(from, cursor_remove_bytes);
-    to->cursor_reopen_error += WT_STAT_READ(from, cursor_reopen_error);
-    to->cursor_reserve += WT_STAT_READ(from, cursor_reserve);
-    to->cursor_reserve_error += WT_STAT_READ(from, cursor_reserve_error);
-    to->cursor_reset += WT_STAT_READ(from, cursor_reset);
-    to->cursor_reset_error += WT_STAT_READ(from, cursor_reset_error);
-    to->cursor_search += WT_STAT_READ(from, cursor_search);
-    to->cursor_search_error += WT_STAT_READ(from, cursor_search_error);
-    to->cursor_search_hs += WT_STAT_READ(from, cursor_search_hs);
-    to->cursor_search_near += WT_STAT_READ(from, cursor_search_near);
-    to->cursor_search_near_error += WT_STAT_READ(from, cursor_search_near_error);
-    to->cursor_sweep_buckets += WT_STAT_READ(from, cursor_sweep_buckets);
-    to->cursor_sweep_closed += WT_STAT_READ(from, cursor_sweep_closed);
-    to->cursor_sweep_examined += WT_STAT_READ(from, cursor_sweep_examined);
-    to->cursor_sweep += WT_STAT_READ(from, cursor_sweep);
-    to->cursor_truncate += WT_STAT_READ(from, cursor_truncate);
-    to->cursor_truncate_keys_deleted += WT_STAT_READ(from, cursor_truncate_keys_deleted);
-    to->cursor_update += WT_STAT_READ(from, cursor_update);
-    to->cursor_update_error += WT_STAT_READ(from, cursor_update_error);
-    to->cursor_update_bytes += WT_STAT_READ(from, cursor_update_bytes);
-    to->cursor_update_bytes_changed += WT_STAT_READ(from, cursor_update_bytes_changed);
-    to->cursor_reopen += WT_STAT_READ(from, cursor_reopen);
-    to->cursor_open_count += WT_STAT_READ(from, cursor_open_count);
-    to->dh_conn_handle_size += WT_STAT_READ(from, dh_conn_handle_size);
-    to->dh_conn_handle_count += WT_STAT_READ(from, dh_conn_handle_count);
-    to->dh_sweep_ref += WT_STAT_READ(from, dh_sweep_ref);
-    to->dh_sweep_close += WT_STAT_READ(from, dh_sweep_close);
-    to->dh_sweep_remove += WT_STAT_READ(from, dh_sweep_remove);
-    to->dh_sweep_tod += WT_STAT_READ(from, dh_sweep_tod);
-    to->dh_sweeps += WT_STAT_READ(from, dh_sweeps);
-    to->dh_sweep_skip_ckpt += WT_STAT_READ(from, dh_sweep_skip_ckpt);
-    to->dh_session_handles += WT_STAT_READ(from, dh_session_handles);
-    to->dh_session_sweeps += WT_STAT_READ(from, dh_session_sweeps);
-    to->lock_checkpoint_count += WT_STAT_READ(from, lock_checkpoint_count);
-    to->lock_checkpoint_wait_application += WT_STAT_READ(from, lock_checkpoint_wait_application);
-    to->lock_checkpoint_wait_internal += WT_STAT_READ(from, lock_checkpoint_wait_internal);
-    to->lock_dhandle_wait_application += WT_STAT_READ(from, lock_dhandle_wait_application);
-    to->lock_dhandle_wait_internal += WT_STAT_READ(from, lock_dhandle_wait_internal);
-    to->lock_dhandle_read_count += WT_STAT_READ(from, lock_dhandle_read_count);
-    to->lock_dhandle_write_count += WT_STAT_READ(from, lock_dhandle_write_count);
-    to->lock_metadata_count += WT_STAT_READ(from, lock_metadata_count);
-    to->lock_metadata_wait_application += WT_STAT_READ(from, lock_metadata_wait_application);
-    to->lock_metadata_wait_internal += WT_STAT_READ(from, lock_metadata_wait_internal);
-    to->lock_schema_count += WT_STAT_READ(from, lock_schema_count);
-    to->lock_schema_wait_application += WT_STAT_READ(from, lock_schema_wait_application);
-    to->lock_schema_wait_internal += WT_STAT_READ(from, lock_schema_wait_internal);
-    to->lock_table_wait_application += WT_STAT_READ(from, lock_table_wait_application);
-    to->lock_table_wait_internal += WT_STAT_READ(from, lock_table_wait_internal);
-    to->lock_table_read_count += WT_STAT_READ(from, lock_table_read_count);
-    to->lock_table_write_count += WT_STAT_READ(from, lock_table_write_count);
-    to->lock_txn_global_wait_application += WT_STAT_READ(from, lock_txn_global_wait_application);
-    to->lock_txn_global_wait_internal += WT_STAT_READ(from, lock_txn_global_wait_internal);
-    to->lock_txn_global_read_count += WT_STAT_READ(from, lock_txn_global_read_count);
-    to->lock_txn_global_write_count += WT_STAT_READ(from, lock_txn_global_write_count);
-    to->log_slot_switch_busy += WT_STAT_READ(from, log_slot_switch_busy);
-    to->log_force_remove_sleep += WT_STAT_READ(from, log_force_remove_sleep);
-    to->log_bytes_payload += WT_STAT_READ(from, log_bytes_payload);
-    to->log_bytes_written += WT_STAT_READ(from, log_bytes_written);
-    to->log_zero_fills += WT_STAT_READ(from, log_zero_fills);
-    to->log_flush += WT_STAT_READ(from, log_flush);
-    to->log_force_write += WT_STAT_READ(from, log_force_write);
-    to->log_force_write_skip += WT_STAT_READ(from, log_force_write_skip);
-    to->log_compress_writes += WT_STAT_READ(from, log_compress_writes);
-    to->log_compress_write_fails += WT_STAT_READ(from, log_compress_write_fails);
-    to->log_compress_small += WT_STAT_READ(from, log_compress_small);
-    to->log_release_write_lsn += WT_STAT_READ(from, log_release_write_lsn);
-    to->log_scans += WT_STAT_READ(from, log_scans);
-    to->log_scan_rereads += WT_STAT_READ(from, log_scan_rereads);
-    to->log_write_lsn += WT_STAT_READ(from, log_write_lsn);
-    to->log_write_lsn_skip += WT_STAT_READ(from, log_write_lsn_skip);
-    to->log_sync += WT_STAT_READ(from, log_sync);
-    to->log_sync_duration += WT_STAT_READ(from, log_sync_duration);
-    to->log_sync_dir += WT_STAT_READ(from, log_sync_dir);
-    to->log_sync_dir_duration += WT_STAT_READ(from, log_sync_dir_duration);
-    to->log_writes += WT_STAT_READ(from, log_writes);
-    to->log_slot_consolidated += WT_STAT_READ(from, log_slot_consolidated);
-    to->log_max_filesize += WT_STAT_READ(from, log_max_filesize);
-    to->log_prealloc_max += WT_STAT_READ(from, log_prealloc_max);
-    to->log_prealloc_missed += WT_STAT_READ(from, log_prealloc_missed);
-    to->log_prealloc_files += WT_STAT_READ(from, log_prealloc_files);
-    to->log_prealloc_used += WT_STAT_READ(from, log_prealloc_used);
-    to->log_scan_records += WT_STAT_READ(from, log_scan_records);
-    to->log_slot_close_race += WT_STAT_READ(from, log_slot_close_race);
-    to->log_slot_close_unbuf += WT_STAT_READ(from, log_slot_close_unbuf);
-    to->log_slot_closes += WT_STAT_READ(from, log_slot_closes);
-    to->log_slot_races += WT_STAT_READ(from, log_slot_races);
-    to->log_slot_yield_race += WT_STAT_READ(from, log_slot_yield_race);
-    to->log_slot_immediate += WT_STAT_READ(from, log_slot_immediate);
-    to->log_slot_yield_close += WT_STAT_READ(from, log_slot_yield_close);
-    to->log_slot_yield_sleep += WT_STAT_READ(from, log_slot_yield_sleep);
-    to->log_slot_yield += WT_STAT_READ(from, log_slot_yield);
-    to->log_slot_active_closed += WT_STAT_READ(from, log_slot_active_closed);
-    to->log_slot_yield_duration += WT_STAT_READ(from, log_slot_yield_duration);
-    to->log_slot_no_free_slots += WT_STAT_READ(from, log_slot_no_free_slots);
-    to->log_slot_unbuffered += WT_STAT_READ(from, log_slot_unbuffered);
-    to->log_compress_mem += WT_STAT_READ(from, log_compress_mem);
-    to->log_buffer_size += WT_STAT_READ(from, log_buffer_size);
-    to->log_compress_len += WT_STAT_READ(from, log_compress_len);
-    to->log_slot_coalesced += WT_STAT_READ(from, log_slot_coalesced);
-    to->log_close_yields += WT_STAT_READ(from, log_close_yields);
-    to->perf_hist_fsread_latency_lt10 += WT_STAT_READ(from, perf_hist_fsread_latency_lt10);
-    to->perf_hist_fsread_latency_lt50 += WT_STAT_READ(from, perf_hist_fsread_latency_lt50);
-    to->perf_hist_fsread_latency_lt100 += WT_STAT_READ(from, perf_hist_fsread_latency_lt100);
-    to->perf_hist_fsread_latency_lt250 += WT_STAT_READ(from, perf_hist_fsread_latency_lt250);
-    to->perf_hist_fsread_latency_lt500 += WT_STAT_READ(from, perf_hist_fsread_latency_lt500);
-    to->perf_hist_fsread_latency_lt1000 += WT_STAT_READ(from, perf_hist_fsread_latency_lt1000);
-    to->perf_hist_fsread_latency_gt1000 += WT_STAT_READ(from, perf_hist_fsread_latency_gt1000);
-    to->perf_hist_fsread_latency_total_msecs +=
-      WT_STAT_READ(from, perf_hist_fsread_latency_total_msecs);
-    to->perf_hist_fswrite_latency_lt10 += WT_STAT_READ(from, perf_hist_fswrite_latency_lt10);
-    to->perf_hist_fswrite_latency_lt50 += WT_STAT_READ(from, perf_hist_fswrite_latency_lt50);
-    to->perf_hist_fswrite_latency_lt100 += WT_STAT_READ(from, perf_hist_fswrite_latency_lt100);
-    to->perf_hist_fswrite_latency_lt250 += WT_STAT_READ(from, perf_hist_fswrite_latency_lt250);
-    to->perf_hist_fswrite_latency_lt500 += WT_STAT_READ(from, perf_hist_fswrite_latency_lt500);
-    to->perf_hist_fswrite_latency_lt1000 += WT_STAT_READ(from, perf_hist_fswrite_latency_lt1000);
-    to->perf_hist_fswrite_latency_gt1000 += WT_STAT_READ(from, perf_hist_fswrite_latency_gt1000);
-    to->perf_hist_fswrite_latency_total_msecs +=
-      WT_STAT_READ(from, perf_hist_fswrite_latency_total_msecs);
-    to->perf_hist_opread_latency_lt100 += WT_STAT_READ(from, perf_hist_opread_latency_lt100);
-    to->perf_hist_opread_latency_lt250 += WT_STAT_READ(from, perf_hist_opread_latency_lt250);
-    to->perf_hist_opread_latency_lt500 += WT_STAT_READ(from, perf_hist_opread_latency_lt500);
-    to->perf_hist_opread_latency_lt1000 += WT_STAT_READ(from, perf_hist_opread_latency_lt1000);
-    to->perf_hist_opread_latency_lt10000 += WT_STAT_READ(from, perf_hist_opread_latency_lt10000);
-    to->perf_hist_opread_latency_gt10000 += WT_STAT_READ(from, perf_hist_opread_latency_gt10000);
-    to->perf_hist_opread_latency_total_usecs +=
-      WT_STAT_READ(from, perf_hist_opread_latency_total_usecs);
-    to->perf_hist_opwrite_latency_lt100 += WT_STAT_READ(from, perf_hist_opwrite_latency_lt100);
-    to->perf_hist_opwrite_latency_lt250 += WT_STAT_READ(from, perf_hist_opwrite_latency_lt250);
-    to->perf_hist_opwrite_latency_lt500 += WT_STAT_READ(from, perf_hist_opwrite_latency_lt500);
-    to->perf_hist_opwrite_latency_lt1000 += WT_STAT_READ(from, perf_hist_opwrite_latency_lt1000);
-    to->perf_hist_opwrite_latency_lt10000 += WT_STAT_READ(from, perf_hist_opwrite_latency_lt10000);
-    to->perf_hist_opwrite_latency_gt10000 += WT_STAT_READ(from, perf_hist_opwrite_latency_gt10000);
-    to->perf_hist_opwrite_latency_total_usecs +=
-      WT_STAT_READ(from, perf_hist_opwrite_latency_total_usecs);
-    to->rec_vlcs_emptied_pages += WT_STAT_READ(from, rec_vlcs_emptied_pages);
-    to->rec_time_window_bytes_ts += WT_STAT_READ(from, rec_time_window_bytes_ts);
-    to->rec_time_window_bytes_txn += WT_STAT_READ(from, rec_time_window_bytes_txn);
-    to->rec_page_delete_fast += WT_STAT_READ(from, rec_page_delete_fast);
-    to->rec_overflow_key_leaf += WT_STAT_READ(from, rec_overflow_key_leaf);
-    to->rec_maximum_milliseconds += WT_STAT_READ(from, rec_maximum_milliseconds);
-    to->rec_maximum_image_build_milliseconds +=
-      WT_STAT_READ(from, rec_maximum_image_build_milliseconds);
-    to->rec_maximum_hs_wrapup_milliseconds +=
-      WT_STAT_READ(from, rec_maximum_hs_wrapup_milliseconds);
-    to->rec_pages += WT_STAT_READ(from, rec_pages);
-    to->rec_pages_eviction += WT_STAT_READ(from, rec_pages_eviction);
-    to->rec_pages_with_prepare += WT_STAT_READ(from, rec_pages_with_prepare);
-    to->rec_pages_with_ts += WT_STAT_READ(from, rec_pages_with_ts);
-    to->rec_pages_with_txn += WT_STAT_READ(from, rec_pages_with_txn);
-    to->rec_page_delete += WT_STAT_READ(from, rec_page_delete);
-    to->rec_time_aggr_newest_start_durable_ts +=
-      WT_STAT_READ(from, rec_time_aggr_newest_start_durable_ts);
-    to->rec_time_aggr_newest_stop_durable_ts +=
-      WT_STAT_READ(from, rec_time_aggr_newest_stop_durable_ts);
-    to->rec_time_aggr_newest_stop_ts += WT_STAT_READ(from, rec_time_aggr_newest_stop_ts);
-    to->rec_time_aggr_newest_stop_txn += WT_STAT_READ(from, rec_time_aggr_newest_stop_txn);
-    to->rec_time_aggr_newest_txn += WT_STAT_READ(from, rec_time_aggr_newest_txn);
-    to->rec_time_aggr_oldest_start_ts += WT_STAT_READ(from, rec_time_aggr_oldest_start_ts);
-    to->rec_time_aggr_prepared += WT_STAT_READ(from, rec_time_aggr_prepared);
-    to->rec_time_window_pages_prepared += WT_STAT_READ(from, rec_time_window_pages_prepared);
-    to->rec_time_window_pages_durable_start_ts +=
-      WT_STAT_READ(from, rec_time_window_pages_durable_start_ts);
-    to->rec_time_window_pages_start_ts += WT_STAT_READ(from, rec_time_window_pages_start_ts);
-    to->rec_time_window_pages_start_txn += WT_STAT_READ(from, rec_time_window_pages_start_txn);
-    to->rec_time_window_pages_durable_stop_ts +=
-      WT_STAT_READ(from, rec_time_window_pages_durable_stop_ts);
-    to->rec_time_window_pages_stop_ts += WT_STAT_READ(from, rec_time_window_pages_stop_ts);
-    to->rec_time_window_pages_stop_txn += WT_STAT_READ(from, rec_time_window_pages_stop_txn);
-    to->rec_time_window_prepared += WT_STAT_READ(from, rec_time_window_prepared);
-    to->rec_time_window_durable_start_ts += WT_STAT_READ(from, rec_time_window_durable_start_ts);
-    to->rec_time_window_start_ts += WT_STAT_READ(from, rec_time_window_start_ts);
-    to->rec_time_window_start_txn += WT_STAT_READ(from, rec_time_window_start_txn);
-    to->rec_time_window_durable_stop_ts += WT_STAT_READ(from, rec_time_window_durable_stop_ts);
-    to->rec_time_window_stop_ts += WT_STAT_READ(from, rec_time_window_stop_ts);
-    to->rec_time_window_stop_txn += WT_STAT_READ(from, rec_time_window_stop_txn);
-    to->rec_split_stashed_bytes += WT_STAT_READ(from, rec_split_stashed_bytes);
-    to->rec_split_stashed_objects += WT_STAT_READ(from, rec_split_stashed_objects);
-    to->local_objects_inuse += WT_STAT_READ(from, local_objects_inuse);
-    to->flush_tier_fail += WT_STAT_READ(from, flush_tier_fail);
-    to->flush_tier += WT_STAT_READ(from, flush_tier);
-    to->flush_tier_skipped += WT_STAT_READ(from, flush_tier_skipped);
-    to->flush_tier_switched += WT_STAT_READ(from, flush_tier_switched);
-    to->local_objects_removed += WT_STAT_READ(from, local_objects_removed);
-    to->session_open += WT_STAT_READ(from, session_open);
-    to->session_query_ts += WT_STAT_READ(from, session_query_ts);
-    to->session_table_alter_fail += WT_STAT_READ(from, session_table_alter_fail);
-    to->session_table_alter_success += WT_STAT_READ(from, session_table_alter_success);
-    to->session_table_alter_trigger_checkpoint +=
-      WT_STAT_READ(from, session_table_alter_trigger_checkpoint);
-    to->session_table_alter_skip += WT_STAT_READ(from, session_table_alter_skip);
-    to->session_table_compact_dhandle_success +=
-      WT_STAT_READ(from, session_table_compact_dhandle_success);
-    to->session_table_compact_fail += WT_STAT_READ(from, session_table_compact_fail);
-    to->session_table_compact_fail_cache_pressure +=
-      WT_STAT_READ(from, session_table_compact_fail_cache_pressure);
-    to->session_table_compact_passes += WT_STAT_READ(from, session_table_compact_passes);
-    to->session_table_compact_running += WT_STAT_READ(from, session_table_compact_running);
-    to->session_table_compact_skipped += WT_STAT_READ(from, session_table_compact_skipped);
-    to->session_table_compact_success += WT_STAT_READ(from, session_table_compact_success);
-    to->session_table_compact_timeout += WT_STAT_READ(from, session_table_compact_timeout);
-    to->session_table_create_fail += WT_STAT_READ(from, session_table_create_fail);
-    to->session_table_create_success += WT_STAT_READ(from, session_table_create_success);
-    to->session_table_create_import_fail += WT_STAT_READ(from, session_table_create_import_fail);
-    to->session_table_create_import_success +=
-      WT_STAT_READ(from, session_table_create_import_success);
-    to->session_table_drop_fail += WT_STAT_READ(from, session_table_drop_fail);
-    to->session_table_drop_success += WT_STAT_READ(from, session_table_drop_success);
-    to->session_table_rename_fail += WT_STAT_READ(from, session_table_rename_fail);
-    to->session_table_rename_success += WT_STAT_READ(from, session_table_rename_success);
-    to->session_table_salvage_fail += WT_STAT_READ(from, session_table_salvage_fail);
-    to->session_table_salvage_success += WT_STAT_READ(from, session_table_salvage_success);
-    to->session_table_truncate_fail += WT_STAT_READ(from, session_table_truncate_fail);
-    to->session_table_truncate_success += WT_STAT_READ(from, session_table_truncate_success);
-    to->session_table_verify_fail += WT_STAT_READ(from, session_table_verify_fail);
-    to->session_table_verify_success += WT_STAT_READ(from, session_table_verify_success);
-    to->tiered_work_units_dequeued += WT_STAT_READ(from, tiered_work_units_dequeued);
-    to->tiered_work_units_removed += WT_STAT_READ(from, tiered_work_units_removed);
-    to->tiered_work_units_created += WT_STAT_READ(from, tiered_work_units_created);
-    to->tiered_retention += WT_STAT_READ(from, tiered_retention);
-    to->thread_fsync_active += WT_STAT_READ(from, thread_fsync_active);
-    to->thread_read_active += WT_STAT_READ(from, thread_read_active);
-    to->thread_write_active += WT_STAT_READ(from, thread_write_active);
-    to->application_evict_snapshot_refreshed +=
-      WT_STAT_READ(from, application_evict_snapshot_refreshed);
-    to->application_evict_time += WT_STAT_READ(from, application_evict_time);
-    to->application_cache_time += WT_STAT_READ(from, application_cache_time);
-    to->txn_release_blocked += WT_STAT_READ(from, txn_release_blocked);
-    to->conn_close_blocked_lsm += WT_STAT_READ(from, conn_close_blocked_lsm);
-    to->dhandle_lock_blocked += WT_STAT_READ(from, dhandle_lock_blocked);
-    to->page_index_slot_ref_blocked += WT_STAT_READ(from, page_index_slot_ref_blocked);
-    to->prepared_transition_blocked_page += WT_STAT_READ(from, prepared_transition_blocked_page);
-    to->page_busy_blocked += WT_STAT_READ(from, page_busy_blocked);
-    to->page_forcible_evict_blocked += WT_STAT_READ(from, page_forcible_evict_blocked);
-    to->page_locked_blocked += WT_STAT_READ(from, page_locked_blocked);
-    to->page_read_blocked += WT_STAT_READ(from, page_read_blocked);
-    to->page_sleep += WT_STAT_READ(from, page_sleep);
-    to->page_del_rollback_blocked += WT_STAT_READ(from, page_del_rollback_blocked);
-    to->child_modify_blocked_page += WT_STAT_READ(from, child_modify_blocked_page);
-    to->txn_prepared_updates += WT_STAT_READ(from, txn_prepared_updates);
-    to->txn_prepared_updates_committed += WT_STAT_READ(from, txn_prepared_updates_committed);
-    to->txn_prepared_updates_key_repeated += WT_STAT_READ(from, txn_prepared_updates_key_repeated);
-    to->txn_prepared_updates_rolledback += WT_STAT_READ(from, txn_prepared_updates_rolledback);
-    to->txn_read_race_prepare_commit += WT_STAT_READ(from, txn_read_race_prepare_commit);
-    to->txn_read_overflow_remove += WT_STAT_READ(from, txn_read_overflow_remove);
-    to->txn_rollback_oldest_pinned += WT_STAT_READ(from, txn_rollback_oldest_pinned);
-    to->txn_prepare += WT_STAT_READ(from, txn_prepare);
-    to->txn_prepare_commit += WT_STAT_READ(from, txn_prepare_commit);
-    to->txn_prepare_active += WT_STAT_READ(from, txn_prepare_active);
-    to->txn_prepare_rollback += WT_STAT_READ(from, txn_prepare_rollback);
-    to->txn_query_ts += WT_STAT_READ(from, txn_query_ts);
-    to->txn_read_race_prepare_update += WT_STAT_READ(from, txn_read_race_prepare_update);
-    to->txn_rts += WT_STAT_READ(from, txn_rts);
-    to->txn_rts_sweep_hs_keys_dryrun += WT_STAT_READ(from, txn_rts_sweep_hs_keys_dryrun);
-    to->txn_rts_hs_stop_older_than_newer_start +=
-      WT_STAT_READ(from, txn_rts_hs_stop_older_than_newer_start);
-    to->txn_rts_inconsistent_ckpt += WT_STAT_READ(from, txn_rts_inconsistent_ckpt);
-    to->txn_rts_keys_removed += WT_STAT_READ(from, txn_rts_keys_removed);
-    to->txn_rts_keys_restored += WT_STAT_READ(from, txn_rts_keys_restored);
-    to->txn_rts_keys_removed_dryrun += WT_STAT_READ(from, txn_rts_keys_removed_dryrun);
-    to->txn_rts_keys_restored_dryrun += WT_STAT_READ(from, txn_rts_keys_restored_dryrun);
-    to->txn_rts_pages_visited += WT_STAT_READ(from, txn_rts_pages_visited);
-    to->txn_rts_hs_restore_tombstones += WT_STAT_READ(from, txn_rts_hs_restore_tombstones);
-    to->txn_rts_hs_restore_updates += WT_STAT_READ(from, txn_rts_hs_restore_updates);
-    to->txn_rts_delete_rle_skipped += WT_STAT_READ(from, txn_rts_delete_rle_skipped);
-    to->txn_rts_stable_rle_skipped += WT_STAT_READ(from, txn_rts_stable_rle_skipped);
-    to->txn_rts_sweep_hs_keys += WT_STAT_READ(from, txn_rts_sweep_hs_keys);
-    to->txn_rts_hs_restore_tombstones_dryrun +=
-      WT_STAT_READ(from, txn_rts_hs_restore_tombstones_dryrun);
-    to->txn_rts_tree_walk_skip_pages += WT_STAT_READ(from, txn_rts_tree_walk_skip_pages);
-    to->txn_rts_upd_aborted += WT_STAT_READ(from, txn_rts_upd_aborted);
-    to->txn_rts_hs_restore_updates_dryrun += WT_STAT_READ(from, txn_rts_hs_restore_updates_dryrun);
-    to->txn_rts_hs_removed += WT_STAT_READ(from, txn_rts_hs_removed);
-    to->txn_rts_upd_aborted_dryrun += WT_STAT_READ(from, txn_rts_upd_aborted_dryrun);
-    to->txn_rts_hs_removed_dryrun += WT_STAT_READ(from, txn_rts_hs_removed_dryrun);
-    to->txn_sessions_walked += WT_STAT_READ(from, txn_sessions_walked);
-    to->txn_set_ts += WT_STAT_READ(from, txn_set_ts);
-    to->txn_set_ts_durable += WT_STAT_READ(from, txn_set_ts_durable);
-    to->txn_set_ts_durable_upd += WT_STAT_READ(from, txn_set_ts_durable_upd);
-    to->txn_set_ts_force += WT_STAT_READ(from, txn_set_ts_force);
-    to->txn_set_ts_out_of_order += WT_STAT_READ(from, txn_set_ts_out_of_order);
-    to->txn_set_ts_oldest += WT_STAT_READ(from, txn_set_ts_oldest);
-    to->txn_set_ts_oldest_upd += WT_STAT_READ(from, txn_set_ts_oldest_upd);
-    to->txn_set_ts_stable += WT_STAT_READ(from, txn_set_ts_stable);
-    to->txn_set_ts_stable_upd += WT_STAT_READ(from, txn_set_ts_stable_upd);
-    to->txn_begin += WT_STAT_READ(from, txn_begin);
-    to->txn_hs_ckpt_duration += WT_STAT_READ(from, txn_hs_ckpt_duration);
-    to->txn_pinned_range += WT_STAT_READ(from, txn_pinned_range);
-    to->txn_pinned_checkpoint_range += WT_STAT_READ(from, txn_pinned_checkpoint_range);
-    to->txn_pinned_timestamp += WT_STAT_READ(from, txn_pinned_timestamp);
-    to->txn_pinned_timestamp_checkpoint += WT_STAT_READ(from, txn_pinned_timestamp_checkpoint);
-    to->txn_pinned_timestamp_reader += WT_STAT_READ(from, txn_pinned_timestamp_reader);
-    to->txn_pinned_timestamp_oldest += WT_STAT_READ(from, txn_pinned_timestamp_oldest);
-    to->txn_timestamp_oldest_active_read += WT_STAT_READ(from, txn_timestamp_oldest_active_read);
-    to->txn_rollback_to_stable_running += WT_STAT_READ(from, txn_rollback_to_stable_running);
-    to->txn_walk_sessions += WT_STAT_READ(from, txn_walk_sessions);
-    to->txn_commit += WT_STAT_READ(from, txn_commit);
-    to->txn_rollback += WT_STAT_READ(from, txn_rollback);
-    to->txn_update_conflict += WT_STAT_READ(from, txn_update_conflict);
+      snap.cursor_bounds_search_near_repositioned_cursor;
+    to->cursor_insert_bulk += snap.cursor_insert_bulk;
+    to->cursor_cache_error += snap.cursor_cache_error;
+    to->cursor_cache += snap.cursor_cache;
+    to->cursor_close_error += snap.cursor_close_error;
+    to->cursor_compare_error += snap.cursor_compare_error;
+    to->cursor_create += snap.cursor_create;
+    to->cursor_equals_error += snap.cursor_equals_error;
+    to->cursor_get_key_error += snap.cursor_get_key_error;
+    to->cursor_get_value_error += snap.cursor_get_value_error;
+    to->cursor_insert_batch += snap.cursor_insert_batch;
+    to->cursor_insert_batch_error += snap.cursor_insert_batch_error;
+    to->cursor_insert_batch_keys += snap.cursor_insert_batch_keys;
+    to->cursor_insert_batch_pinned += snap.cursor_insert_batch_pinned;
+    to->cursor_insert += snap.cursor_insert;
+    to->cursor_insert_error += snap.cursor_insert_error;
+    to->cursor_insert_check_error += snap.cursor_insert_check_error;
+    to->cursor_insert_bytes += snap.cursor_insert_bytes;
+    to->cursor_insert_list_restart += snap.cursor_insert_list_restart;
+    to->cursor_largest_key_error += snap.cursor_largest_key_error;
+    to->cursor_modify += snap.cursor_modify;
+    to->cursor_modify_error += snap.cursor_modify_error;
+    to->cursor_modify_full_value += snap.cursor_modify_full_value;
+    to->cursor_modify_bytes += snap.cursor_modify_bytes;
+    to->cursor_modify_bytes_touch += snap.cursor_modify_bytes_touch;
+    to->cursor_next += snap.cursor_next;
+    to->cursor_next_error += snap.cursor_next_error;
+    to->cursor_next_hs_tombstone += snap.cursor_next_hs_tombstone;
+    to->cursor_next_skip_lt_100 += snap.cursor_next_skip_lt_100;
+    to->cursor_next_skip_ge_100 += snap.cursor_next_skip_ge_100;
+    to->cursor_next_random_error += snap.cursor_next_random_error;
+    to->cursor_restart += snap.cursor_restart;
+    to->cursor_prev += snap.cursor_prev;
+    to->cursor_prev_error += snap.cursor_prev_error;
+    to->cursor_prev_hs_tombstone += snap.cursor_prev_hs_tombstone;
+    to->cursor_prev_skip_ge_100 += snap.cursor_prev_skip_ge_100;
+    to->cursor_prev_skip_lt_100 += snap.cursor_prev_skip_lt_100;
+    to->cursor_reconfigure_error += snap.cursor_reconfigure_error;
+    to->cursor_remove += snap.cursor_remove;
+    to->cursor_remove_error += snap.cursor_remove_error;
+    to->cursor_remove_bytes += snap.cursor_remove_bytes;
+    to->cursor_reopen_error += snap.cursor_reopen_error;
+    to->cursor_reserve += snap.cursor_reserve;
+    to->cursor_reserve_error += snap.cursor_reserve_error;
+    to->cursor_reset += snap.cursor_reset;
+    to->cursor_reset_error += snap.cursor_reset_error;
+    to->cursor_search_batch += snap.cursor_search_batch;
+    to->cursor_search_batch_error += snap.cursor_search_batch_error;
+    to->cursor_search_batch_pinned += snap.cursor_search_batch_pinned;
+    to->cursor_search_batch_keys += snap.cursor_search_batch_keys;
+    to->cursor_search += snap.cursor_search;
+    to->cursor_search_leaf_bloom_skip += snap.cursor_search_leaf_bloom_skip;
+    to->cursor_search_error += snap.cursor_search_error;
+    to->cursor_search_hs += snap.cursor_search_hs;
+    to->cursor_search_near += snap.cursor_search_near;
+    to->cursor_search_near_error += snap.cursor_search_near_error;
+    to->cursor_sweep_buckets += snap.cursor_sweep_buckets;
+    to->cursor_sweep_closed += snap.cursor_sweep_closed;
+    to->cursor_sweep_examined += snap.cursor_sweep_examined;
+    to->cursor_sweep += snap.cursor_sweep;
+    to->cursor_truncate += snap.cursor_truncate;
+    to->cursor_truncate_keys_deleted += snap.cursor_truncate_keys_deleted;
+    to->cursor_update += snap.cursor_update;
+    to->cursor_update_error += snap.cursor_update_error;
+    to->cursor_update_cas_retry += snap.cursor_update_cas_retry;
+    to->cursor_update_bytes += snap.cursor_update_bytes;
+    to->cursor_update_bytes_changed += snap.cursor_update_bytes_changed;
+    to->cursor_pool_add += snap.cursor_pool_add;
+    to->cursor_pool_discard += snap.cursor_pool_discard;
+    to->cursor_reopen += snap.cursor_reopen;
+    to->cursor_pool_reuse += snap.cursor_pool_reuse;
+    to->cursor_open_count += snap.cursor_open_count;
+    to->dh_conn_handle_size += snap.dh_conn_handle_size;
+    to->dh_conn_handle_count += snap.dh_conn_handle_count;
+    to->dh_sweep_ref += snap.dh_sweep_ref;
+    to->dh_sweep_close += snap.dh_sweep_close;
+    to->dh_sweep_remove += snap.dh_sweep_remove;
+    to->dh_sweep_tod += snap.dh_sweep_tod;
+    to->dh_sweeps += snap.dh_sweeps;
+    to->dh_sweep_skip_ckpt += snap.dh_sweep_skip_ckpt;
+    to->dh_session_handles += snap.dh_session_handles;
+    to->dh_session_sweeps += snap.dh_session_sweeps;
+    to->lock_checkpoint_count += snap.lock_checkpoint_count;
+    to->lock_checkpoint_wait_application += snap.lock_checkpoint_wait_application;
+    to->lock_checkpoint_wait_internal += snap.lock_checkpoint_wait_internal;
+    to->lock_dhandle_wait_application += snap.lock_dhandle_wait_application;
+    to->lock_dhandle_wait_internal += snap.lock_dhandle_wait_internal;
+    to->lock_dhandle_read_count += snap.lock_dhandle_read_count;
+    to->lock_dhandle_write_count += snap.lock_dhandle_write_count;
+    to->lock_metadata_count += snap.lock_metadata_count;
+    to->lock_metadata_wait_application += snap.lock_metadata_wait_application;
+    to->lock_metadata_wait_internal += snap.lock_metadata_wait_internal;
+    to->lock_schema_count += snap.lock_schema_count;
+    to->lock_schema_wait_application += snap.lock_schema_wait_application;
+    to->lock_schema_wait_internal += snap.lock_schema_wait_internal;
+    to->lock_table_wait_application += snap.lock_table_wait_application;
+    to->lock_table_wait_internal += snap.lock_table_wait_internal;
+    to->lock_table_read_count += snap.lock_table_read_count;
+    to->lock_table_write_count += snap.lock_table_write_count;
+    to->lock_txn_global_wait_application += snap.lock_txn_global_wait_application;
+    to->lock_txn_global_wait_internal += snap.lock_txn_global_wait_internal;
+    to->lock_txn_global_read_count += snap.lock_txn_global_read_count;
+    to->lock_txn_global_write_count += snap.lock_txn_global_write_count;
+    to->log_slot_switch_busy += snap.log_slot_switch_busy;
+    to->log_force_remove_sleep += snap.log_force_remove_sleep;
+    to->log_bytes_payload += snap.log_bytes_payload;
+    to->log_bytes_written += snap.log_bytes_written;
+    to->log_compress_dict_switch += snap.log_compress_dict_switch;
+    to->log_compress_dict_busy += snap.log_compress_dict_busy;
+    to->log_zero_fills += snap.log_zero_fills;
+    to->log_flush += snap.log_flush;
+    to->log_force_write += snap.log_force_write;
+    to->log_force_write_skip += snap.log_force_write_skip;
+    to->log_compress_writes += snap.log_compress_writes;
+    to->log_compress_dict_writes += snap.log_compress_dict_writes;
+    to->log_compress_write_fails += snap.log_compress_write_fails;
+    to->log_compress_small += snap.log_compress_small;
+    to->log_release_write_lsn += snap.log_release_write_lsn;
+    to->log_scans += snap.log_scans;
+    to->log_scan_rereads += snap.log_scan_rereads;
+    to->log_write_lsn += snap.log_write_lsn;
+    to->log_write_lsn_skip += snap.log_write_lsn_skip;
+    to->log_sync += snap.log_sync;
+    to->log_sync_background += snap.log_sync_background;
+    to->log_sync_duration += snap.log_sync_duration;
+    to->log_sync_dir += snap.log_sync_dir;
+    to->log_sync_dir_duration += snap.log_sync_dir_duration;
+    to->log_writes += snap.log_writes;
+    to->log_slot_consolidated += snap.log_slot_consolidated;
+    to->log_max_filesize += snap.log_max_filesize;
+    to->log_prealloc_max += snap.log_prealloc_max;
+    to->log_prealloc_missed += snap.log_prealloc_missed;
+    to->log_prealloc_files += snap.log_prealloc_files;
+    to->log_prealloc_used += snap.log_prealloc_used;
+    to->log_scan_records += snap.log_scan_records;
+    to->log_slot_close_race += snap.log_slot_close_race;
+    to->log_slot_close_unbuf += snap.log_slot_close_unbuf;
+    to->log_slot_closes += snap.log_slot_closes;
+    to->log_slot_races += snap.log_slot_races;
+    to->log_slot_yield_race += snap.log_slot_yield_race;
+    to->log_slot_subslot_joins += snap.log_slot_subslot_joins;
+    to->log_slot_immediate += snap.log_slot_immediate;
+    to->log_slot_yield_close += snap.log_slot_yield_close;
+    to->log_slot_yield_sleep += snap.log_slot_yield_sleep;
+    to->log_slot_yield += snap.log_slot_yield;
+    to->log_slot_active_closed += snap.log_slot_active_closed;
+    to->log_slot_subslot_groups += snap.log_slot_subslot_groups;
+    to->log_slot_yield_duration += snap.log_slot_yield_duration;
+    to->log_slot_no_free_slots += snap.log_slot_no_free_slots;
+    to->log_slot_unbuffered += snap.log_slot_unbuffered;
+    to->log_compress_mem += snap.log_compress_mem;
+    to->log_buffer_size += snap.log_buffer_size;
+    to->log_compress_len += snap.log_compress_len;
+    to->log_slot_coalesced += snap.log_slot_coalesced;
+    to->log_close_yields += snap.log_close_yields;
+    to->perf_hist_app_evict_latency_lt1 += snap.perf_hist_app_evict_latency_lt1;
+    to->perf_hist_app_evict_latency_lt4 += snap.perf_hist_app_evict_latency_lt4;
+    to->perf_hist_app_evict_latency_lt16 += snap.perf_hist_app_evict_latency_lt16;
+    to->perf_hist_app_evict_latency_lt64 += snap.perf_hist_app_evict_latency_lt64;
+    to->perf_hist_app_evict_latency_lt256 += snap.perf_hist_app_evict_latency_lt256;
+    to->perf_hist_app_evict_latency_lt1024 += snap.perf_hist_app_evict_latency_lt1024;
+    to->perf_hist_app_evict_latency_lt4096 += snap.perf_hist_app_evict_latency_lt4096;
+    to->perf_hist_app_evict_latency_lt16384 += snap.perf_hist_app_evict_latency_lt16384;
+    to->perf_hist_app_evict_latency_lt65536 += snap.perf_hist_app_evict_latency_lt65536;
+    to->perf_hist_app_evict_latency_lt262144 += snap.perf_hist_app_evict_latency_lt262144;
+    to->perf_hist_app_evict_latency_lt1048576 += snap.perf_hist_app_evict_latency_lt1048576;
+    to->perf_hist_app_evict_latency_gt1048576 += snap.perf_hist_app_evict_latency_gt1048576;
+    to->perf_hist_app_evict_latency_p50 += snap.perf_hist_app_evict_latency_p50;
+    to->perf_hist_app_evict_latency_p90 += snap.perf_hist_app_evict_latency_p90;
+    to->perf_hist_app_evict_latency_p999 += snap.perf_hist_app_evict_latency_p999;
+    to->perf_hist_app_evict_latency_p99 += snap.perf_hist_app_evict_latency_p99;
+    to->perf_hist_app_evict_latency_total_usecs += snap.perf_hist_app_evict_latency_total_usecs;
+    to->perf_hist_cursor_insert_latency_lt1 += snap.perf_hist_cursor_insert_latency_lt1;
+    to->perf_hist_cursor_insert_latency_lt4 += snap.perf_hist_cursor_insert_latency_lt4;
+    to->perf_hist_cursor_insert_latency_lt16 += snap.perf_hist_cursor_insert_latency_lt16;
+    to->perf_hist_cursor_insert_latency_lt64 += snap.perf_hist_cursor_insert_latency_lt64;
+    to->perf_hist_cursor_insert_latency_lt256 += snap.perf_hist_cursor_insert_latency_lt256;
+    to->perf_hist_cursor_insert_latency_lt1024 += snap.perf_hist_cursor_insert_latency_lt1024;
+    to->perf_hist_cursor_insert_latency_lt4096 += snap.perf_hist_cursor_insert_latency_lt4096;
+    to->perf_hist_cursor_insert_latency_lt16384 += snap.perf_hist_cursor_insert_latency_lt16384;
+    to->perf_hist_cursor_insert_latency_lt65536 += snap.perf_hist_cursor_insert_latency_lt65536;
+    to->perf_hist_cursor_insert_latency_lt262144 += snap.perf_hist_cursor_insert_latency_lt262144;
+    to->perf_hist_cursor_insert_latency_lt1048576 += snap.perf_hist_cursor_insert_latency_lt1048576;
+    to->perf_hist_cursor_insert_latency_gt1048576 += snap.perf_hist_cursor_insert_latency_gt1048576;
+    to->perf_hist_cursor_insert_latency_p50 += snap.perf_hist_cursor_insert_latency_p50;
+    to->perf_hist_cursor_insert_latency_p90 += snap.perf_hist_cursor_insert_latency_p90;
+    to->perf_hist_cursor_insert_latency_p999 += snap.perf_hist_cursor_insert_latency_p999;
+    to->perf_hist_cursor_insert_latency_p99 += snap.perf_hist_cursor_insert_latency_p99;
+    to->perf_hist_cursor_insert_latency_total_usecs +=
+      snap.perf_hist_cursor_insert_latency_total_usecs;
+    to->perf_hist_cursor_next_latency_lt1 += snap.perf_hist_cursor_next_latency_lt1;
+    to->perf_hist_cursor_next_latency_lt4 += snap.perf_hist_cursor_next_latency_lt4;
+    to->perf_hist_cursor_next_latency_lt16 += snap.perf_hist_cursor_next_latency_lt16;
+    to->perf_hist_cursor_next_latency_lt64 += snap.perf_hist_cursor_next_latency_lt64;
+    to->perf_hist_cursor_next_latency_lt256 += snap.perf_hist_cursor_next_latency_lt256;
+    to->perf_hist_cursor_next_latency_lt1024 += snap.perf_hist_cursor_next_latency_lt1024;
+    to->perf_hist_cursor_next_latency_lt4096 += snap.perf_hist_cursor_next_latency_lt4096;
+    to->perf_hist_cursor_next_latency_lt16384 += snap.perf_hist_cursor_next_latency_lt16384;
+    to->perf_hist_cursor_next_latency_lt65536 += snap.perf_hist_cursor_next_latency_lt65536;
+    to->perf_hist_cursor_next_latency_lt262144 += snap.perf_hist_cursor_next_latency_lt262144;
+    to->perf_hist_cursor_next_latency_lt1048576 += snap.perf_hist_cursor_next_latency_lt1048576;
+    to->perf_hist_cursor_next_latency_gt1048576 += snap.perf_hist_cursor_next_latency_gt1048576;
+    to->perf_hist_cursor_next_latency_p50 += snap.perf_hist_cursor_next_latency_p50;
+    to->perf_hist_cursor_next_latency_p90 += snap.perf_hist_cursor_next_latency_p90;
+    to->perf_hist_cursor_next_latency_p999 += snap.perf_hist_cursor_next_latency_p999;
+    to->perf_hist_cursor_next_latency_p99 += snap.perf_hist_cursor_next_latency_p99;
+    to->perf_hist_cursor_next_latency_total_usecs += snap.perf_hist_cursor_next_latency_total_usecs;
+    to->perf_hist_cursor_search_latency_lt1 += snap.perf_hist_cursor_search_latency_lt1;
+    to->perf_hist_cursor_search_latency_lt4 += snap.perf_hist_cursor_search_latency_lt4;
+    to->perf_hist_cursor_search_latency_lt16 += snap.perf_hist_cursor_search_latency_lt16;
+    to->perf_hist_cursor_search_latency_lt64 += snap.perf_hist_cursor_search_latency_lt64;
+    to->perf_hist_cursor_search_latency_lt256 += snap.perf_hist_cursor_search_latency_lt256;
+    to->perf_hist_cursor_search_latency_lt1024 += snap.perf_hist_cursor_search_latency_lt1024;
+    to->perf_hist_cursor_search_latency_lt4096 += snap.perf_hist_cursor_search_latency_lt4096;
+    to->perf_hist_cursor_search_latency_lt16384 += snap.perf_hist_cursor_search_latency_lt16384;
+    to->perf_hist_cursor_search_latency_lt65536 += snap.perf_hist_cursor_search_latency_lt65536;
+    to->perf_hist_cursor_search_latency_lt262144 += snap.perf_hist_cursor_search_latency_lt262144;
+    to->perf_hist_cursor_search_latency_lt1048576 += snap.perf_hist_cursor_search_latency_lt1048576;
+    to->perf_hist_cursor_search_latency_gt1048576 += snap.perf_hist_cursor_search_latency_gt1048576;
+    to->perf_hist_cursor_search_latency_p50 += snap.perf_hist_cursor_search_latency_p50;
+    to->perf_hist_cursor_search_latency_p90 += snap.perf_hist_cursor_search_latency_p90;
+    to->perf_hist_cursor_search_latency_p999 += snap.perf_hist_cursor_search_latency_p999;
+    to->perf_hist_cursor_search_latency_p99 += snap.perf_hist_cursor_search_latency_p99;
+    to->perf_hist_cursor_search_latency_total_usecs +=
+      snap.perf_hist_cursor_search_latency_total_usecs;
+    to->perf_hist_cursor_update_latency_lt1 += snap.perf_hist_cursor_update_latency_lt1;
+    to->perf_hist_cursor_update_latency_lt4 += snap.perf_hist_cursor_update_latency_lt4;
+    to->perf_hist_cursor_update_latency_lt16 += snap.perf_hist_cursor_update_latency_lt16;
+    to->perf_hist_cursor_update_latency_lt64 += snap.perf_hist_cursor_update_latency_lt64;
+    to->perf_hist_cursor_update_latency_lt256 += snap.perf_hist_cursor_update_latency_lt256;
+    to->perf_hist_cursor_update_latency_lt1024 += snap.perf_hist_cursor_update_latency_lt1024;
+    to->perf_hist_cursor_update_latency_lt4096 += snap.perf_hist_cursor_update_latency_lt4096;
+    to->perf_hist_cursor_update_latency_lt16384 += snap.perf_hist_cursor_update_latency_lt16384;
+    to->perf_hist_cursor_update_latency_lt65536 += snap.perf_hist_cursor_update_latency_lt65536;
+    to->perf_hist_cursor_update_latency_lt262144 += snap.perf_hist_cursor_update_latency_lt262144;
+    to->perf_hist_cursor_update_latency_lt1048576 += snap.perf_hist_cursor_update_latency_lt1048576;
+    to->perf_hist_cursor_update_latency_gt1048576 += snap.perf_hist_cursor_update_latency_gt1048576;
+    to->perf_hist_cursor_update_latency_p50 += snap.perf_hist_cursor_update_latency_p50;
+    to->perf_hist_cursor_update_latency_p90 += snap.perf_hist_cursor_update_latency_p90;
+    to->perf_hist_cursor_update_latency_p999 += snap.perf_hist_cursor_update_latency_p999;
+    to->perf_hist_cursor_update_latency_p99 += snap.perf_hist_cursor_update_latency_p99;
+    to->perf_hist_cursor_update_latency_total_usecs +=
+      snap.perf_hist_cursor_update_latency_total_usecs;
+    to->perf_hist_fsread_latency_lt10 += snap.perf_hist_fsread_latency_lt10;
+    to->perf_hist_fsread_latency_lt50 += snap.perf_hist_fsread_latency_lt50;
+    to->perf_hist_fsread_latency_lt100 += snap.perf_hist_fsread_latency_lt100;
+    to->perf_hist_fsread_latency_lt250 += snap.perf_hist_fsread_latency_lt250;
+    to->perf_hist_fsread_latency_lt500 += snap.perf_hist_fsread_latency_lt500;
+    to->perf_hist_fsread_latency_lt1000 += snap.perf_hist_fsread_latency_lt1000;
+    to->perf_hist_fsread_latency_gt1000 += snap.perf_hist_fsread_latency_gt1000;
+    to->perf_hist_fsread_latency_total_msecs += snap.perf_hist_fsread_latency_total_msecs;
+    to->perf_hist_fswrite_latency_lt10 += snap.perf_hist_fswrite_latency_lt10;
+    to->perf_hist_fswrite_latency_lt50 += snap.perf_hist_fswrite_latency_lt50;
+    to->perf_hist_fswrite_latency_lt100 += snap.perf_hist_fswrite_latency_lt100;
+    to->perf_hist_fswrite_latency_lt250 += snap.perf_hist_fswrite_latency_lt250;
+    to->perf_hist_fswrite_latency_lt500 += snap.perf_hist_fswrite_latency_lt500;
+    to->perf_hist_fswrite_latency_lt1000 += snap.perf_hist_fswrite_latency_lt1000;
+    to->perf_hist_fswrite_latency_gt1000 += snap.perf_hist_fswrite_latency_gt1000;
+    to->perf_hist_fswrite_latency_total_msecs += snap.perf_hist_fswrite_latency_total_msecs;
+    to->perf_hist_opread_latency_lt100 += snap.perf_hist_opread_latency_lt100;
+    to->perf_hist_opread_latency_lt250 += snap.perf_hist_opread_latency_lt250;
+    to->perf_hist_opread_latency_lt500 += snap.perf_hist_opread_latency_lt500;
+    to->perf_hist_opread_latency_lt1000 += snap.perf_hist_opread_latency_lt1000;
+    to->perf_hist_opread_latency_lt10000 += snap.perf_hist_opread_latency_lt10000;
+    to->perf_hist_opread_latency_gt10000 += snap.perf_hist_opread_latency_gt10000;
+    to->perf_hist_opread_latency_total_usecs += snap.perf_hist_opread_latency_total_usecs;
+    to->perf_hist_opwrite_latency_lt100 += snap.perf_hist_opwrite_latency_lt100;
+    to->perf_hist_opwrite_latency_lt250 += snap.perf_hist_opwrite_latency_lt250;
+    to->perf_hist_opwrite_latency_lt500 += snap.perf_hist_opwrite_latency_lt500;
+    to->perf_hist_opwrite_latency_lt1000 += snap.perf_hist_opwrite_latency_lt1000;
+    to->perf_hist_opwrite_latency_lt10000 += snap.perf_hist_opwrite_latency_lt10000;
+    to->perf_hist_opwrite_latency_gt10000 += snap.perf_hist_opwrite_latency_gt10000;
+    to->perf_hist_opwrite_latency_total_usecs += snap.perf_hist_opwrite_latency_total_usecs;
+    to->perf_hist_txn_begin_latency_lt1 += snap.perf_hist_txn_begin_latency_lt1;
+    to->perf_hist_txn_begin_latency_lt4 += snap.perf_hist_txn_begin_latency_lt4;
+    to->perf_hist_txn_begin_latency_lt16 += snap.perf_hist_txn_begin_latency_lt16;
+    to->perf_hist_txn_begin_latency_lt64 += snap.perf_hist_txn_begin_latency_lt64;
+    to->perf_hist_txn_begin_latency_lt256 += snap.perf_hist_txn_begin_latency_lt256;
+    to->perf_hist_txn_begin_latency_lt1024 += snap.perf_hist_txn_begin_latency_lt1024;
+    to->perf_hist_txn_begin_latency_lt4096 += snap.perf_hist_txn_begin_latency_lt4096;
+    to->perf_hist_txn_begin_latency_lt16384 += snap.perf_hist_txn_begin_latency_lt16384;
+    to->perf_hist_txn_begin_latency_lt65536 += snap.perf_hist_txn_begin_latency_lt65536;
+    to->perf_hist_txn_begin_latency_lt262144 += snap.perf_hist_txn_begin_latency_lt262144;
+    to->perf_hist_txn_begin_latency_lt1048576 += snap.perf_hist_txn_begin_latency_lt1048576;
+    to->perf_hist_txn_begin_latency_gt1048576 += snap.perf_hist_txn_begin_latency_gt1048576;
+    to->perf_hist_txn_begin_latency_p50 += snap.perf_hist_txn_begin_latency_p50;
+    to->perf_hist_txn_begin_latency_p90 += snap.perf_hist_txn_begin_latency_p90;
+    to->perf_hist_txn_begin_latency_p999 += snap.perf_hist_txn_begin_latency_p999;
+    to->perf_hist_txn_begin_latency_p99 += snap.perf_hist_txn_begin_latency_p99;
+    to->perf_hist_txn_begin_latency_total_usecs += snap.perf_hist_txn_begin_latency_total_usecs;
+    to->perf_hist_checkpoint_latency_lt1 += snap.perf_hist_checkpoint_latency_lt1;
+    to->perf_hist_checkpoint_latency_lt4 += snap.perf_hist_checkpoint_latency_lt4;
+    to->perf_hist_checkpoint_latency_lt16 += snap.perf_hist_checkpoint_latency_lt16;
+    to->perf_hist_checkpoint_latency_lt64 += snap.perf_hist_checkpoint_latency_lt64;
+    to->perf_hist_checkpoint_latency_lt256 += snap.perf_hist_checkpoint_latency_lt256;
+    to->perf_hist_checkpoint_latency_lt1024 += snap.perf_hist_checkpoint_latency_lt1024;
+    to->perf_hist_checkpoint_latency_lt4096 += snap.perf_hist_checkpoint_latency_lt4096;
+    to->perf_hist_checkpoint_latency_lt16384 += snap.perf_hist_checkpoint_latency_lt16384;
+    to->perf_hist_checkpoint_latency_lt65536 += snap.perf_hist_checkpoint_latency_lt65536;
+    to->perf_hist_checkpoint_latency_lt262144 += snap.perf_hist_checkpoint_latency_lt262144;
+    to->perf_hist_checkpoint_latency_lt1048576 += snap.perf_hist_checkpoint_latency_lt1048576;
+    to->perf_hist_checkpoint_latency_gt1048576 += snap.perf_hist_checkpoint_latency_gt1048576;
+    to->perf_hist_checkpoint_latency_p50 += snap.perf_hist_checkpoint_latency_p50;
+    to->perf_hist_checkpoint_latency_p90 += snap.perf_hist_checkpoint_latency_p90;
+    to->perf_hist_checkpoint_latency_p999 += snap.perf_hist_checkpoint_latency_p999;
+    to->perf_hist_checkpoint_latency_p99 += snap.perf_hist_checkpoint_latency_p99;
+    to->perf_hist_checkpoint_latency_total_usecs += snap.perf_hist_checkpoint_latency_total_usecs;
+    to->perf_hist_txn_commit_latency_lt1 += snap.perf_hist_txn_commit_latency_lt1;
+    to->perf_hist_txn_commit_latency_lt4 += snap.perf_hist_txn_commit_latency_lt4;
+    to->perf_hist_txn_commit_latency_lt16 += snap.perf_hist_txn_commit_latency_lt16;
+    to->perf_hist_txn_commit_latency_lt64 += snap.perf_hist_txn_commit_latency_lt64;
+    to->perf_hist_txn_commit_latency_lt256 += snap.perf_hist_txn_commit_latency_lt256;
+    to->perf_hist_txn_commit_latency_lt1024 += snap.perf_hist_txn_commit_latency_lt1024;
+    to->perf_hist_txn_commit_latency_lt4096 += snap.perf_hist_txn_commit_latency_lt4096;
+    to->perf_hist_txn_commit_latency_lt16384 += snap.perf_hist_txn_commit_latency_lt16384;
+    to->perf_hist_txn_commit_latency_lt65536 += snap.perf_hist_txn_commit_latency_lt65536;
+    to->perf_hist_txn_commit_latency_lt262144 += snap.perf_hist_txn_commit_latency_lt262144;
+    to->perf_hist_txn_commit_latency_lt1048576 += snap.perf_hist_txn_commit_latency_lt1048576;
+    to->perf_hist_txn_commit_latency_gt1048576 += snap.perf_hist_txn_commit_latency_gt1048576;
+    to->perf_hist_txn_commit_latency_p50 += snap.perf_hist_txn_commit_latency_p50;
+    to->perf_hist_txn_commit_latency_p90 += snap.perf_hist_txn_commit_latency_p90;
+    to->perf_hist_txn_commit_latency_p999 += snap.perf_hist_txn_commit_latency_p999;
+    to->perf_hist_txn_commit_latency_p99 += snap.perf_hist_txn_commit_latency_p99;
+    to->perf_hist_txn_commit_latency_total_usecs += snap.perf_hist_txn_commit_latency_total_usecs;
+    to->rec_vlcs_emptied_pages += snap.rec_vlcs_emptied_pages;
+    to->rec_time_window_bytes_ts += snap.rec_time_window_bytes_ts;
+    to->rec_time_window_bytes_txn += snap.rec_time_window_bytes_txn;
+    to->rec_page_delete_fast += snap.rec_page_delete_fast;
+    to->rec_overflow_key_leaf += snap.rec_overflow_key_leaf;
+    to->rec_maximum_milliseconds += snap.rec_maximum_milliseconds;
+    to->rec_maximum_image_build_milliseconds += snap.rec_maximum_image_build_milliseconds;
+    to->rec_maximum_hs_wrapup_milliseconds += snap.rec_maximum_hs_wrapup_milliseconds;
+    to->rec_pages += snap.rec_pages;
+    to->rec_pages_eviction += snap.rec_pages_eviction;
+    to->rec_pages_with_prepare += snap.rec_pages_with_prepare;
+    to->rec_pages_with_ts += snap.rec_pages_with_ts;
+    to->rec_pages_with_txn += snap.rec_pages_with_txn;
+    to->rec_page_delete += snap.rec_page_delete;
+    to->rec_time_aggr_newest_start_durable_ts += snap.rec_time_aggr_newest_start_durable_ts;
+    to->rec_time_aggr_newest_stop_durable_ts += snap.rec_time_aggr_newest_stop_durable_ts;
+    to->rec_time_aggr_newest_stop_ts += snap.rec_time_aggr_newest_stop_ts;
+    to->rec_time_aggr_newest_stop_txn += snap.rec_time_aggr_newest_stop_txn;
+    to->rec_time_aggr_newest_txn += snap.rec_time_aggr_newest_txn;
+    to->rec_time_aggr_oldest_start_ts += snap.rec_time_aggr_oldest_start_ts;
+    to->rec_time_aggr_prepared += snap.rec_time_aggr_prepared;
+    to->rec_time_window_pages_prepared += snap.rec_time_window_pages_prepared;
+    to->rec_time_window_pages_durable_start_ts += snap.rec_time_window_pages_durable_start_ts;
+    to->rec_time_window_pages_start_ts += snap.rec_time_window_pages_start_ts;
+    to->rec_time_window_pages_start_txn += snap.rec_time_window_pages_start_txn;
+    to->rec_time_window_pages_durable_stop_ts += snap.rec_time_window_pages_durable_stop_ts;
+    to->rec_time_window_pages_stop_ts += snap.rec_time_window_pages_stop_ts;
+    to->rec_time_window_pages_stop_txn += snap.rec_time_window_pages_stop_txn;
+    to->rec_time_window_prepared += snap.rec_time_window_prepared;
+    to->rec_time_window_durable_start_ts += snap.rec_time_window_durable_start_ts;
+    to->rec_time_window_start_ts += snap.rec_time_window_start_ts;
+    to->rec_time_window_start_txn += snap.rec_time_window_start_txn;
+    to->rec_time_window_durable_stop_ts += snap.rec_time_window_durable_stop_ts;
+    to->rec_time_window_stop_ts += snap.rec_time_window_stop_ts;
+    to->rec_time_window_stop_txn += snap.rec_time_window_stop_txn;
+    to->rec_split_stashed_bytes += snap.rec_split_stashed_bytes;
+    to->rec_split_stashed_objects += snap.rec_split_stashed_objects;
+    to->local_objects_inuse += snap.local_objects_inuse;
+    to->tiered_flush_bytes += snap.tiered_flush_bytes;
+    to->flush_tier_fail += snap.flush_tier_fail;
+    to->flush_tier += snap.flush_tier;
+    to->flush_tier_skipped += snap.flush_tier_skipped;
+    to->flush_tier_switched += snap.flush_tier_switched;
+    to->local_objects_removed += snap.local_objects_removed;
+    to->tiered_flush_parts += snap.tiered_flush_parts;
+    to->tiered_flush_objects += snap.tiered_flush_objects;
+    to->session_open += snap.session_open;
+    to->session_query_ts += snap.session_query_ts;
+    to->session_table_alter_fail += snap.session_table_alter_fail;
+    to->session_table_alter_success += snap.session_table_alter_success;
+    to->session_table_alter_trigger_checkpoint += snap.session_table_alter_trigger_checkpoint;
+    to->session_table_alter_skip += snap.session_table_alter_skip;
+    to->session_table_compact_dhandle_success += snap.session_table_compact_dhandle_success;
+    to->session_table_compact_fail += snap.session_table_compact_fail;
+    to->session_table_compact_fail_cache_pressure += snap.session_table_compact_fail_cache_pressure;
+    to->session_table_compact_passes += snap.session_table_compact_passes;
+    to->session_table_compact_running += snap.session_table_compact_running;
+    to->session_table_compact_skipped += snap.session_table_compact_skipped;
+    to->session_table_compact_success += snap.session_table_compact_success;
+    to->session_table_compact_timeout += snap.session_table_compact_timeout;
+    to->session_table_create_fail += snap.session_table_create_fail;
+    to->session_table_create_success += snap.session_table_create_success;
+    to->session_table_create_import_fail += snap.session_table_create_import_fail;
+    to->session_table_create_import_success += snap.session_table_create_import_success;
+    to->session_table_drop_fail += snap.session_table_drop_fail;
+    to->session_table_drop_success += snap.session_table_drop_success;
+    to->session_table_rename_fail += snap.session_table_rename_fail;
+    to->session_table_rename_success += snap.session_table_rename_success;
+    to->session_table_salvage_fail += snap.session_table_salvage_fail;
+    to->session_table_salvage_success += snap.session_table_salvage_success;
+    to->session_table_truncate_fail += snap.session_table_truncate_fail;
+    to->session_table_truncate_success += snap.session_table_truncate_success;
+    to->session_table_verify_fail += snap.session_table_verify_fail;
+    to->session_table_verify_success += snap.session_table_verify_success;
+    to->tiered_work_units_dequeued += snap.tiered_work_units_dequeued;
+    to->tiered_work_units_removed += snap.tiered_work_units_removed;
+    to->tiered_work_units_created += snap.tiered_work_units_created;
+    to->tiered_retention += snap.tiered_retention;
+    to->thread_fsync_active += snap.thread_fsync_active;
+    to->thread_read_active += snap.thread_read_active;
+    to->thread_write_active += snap.thread_write_active;
+    to->application_evict_snapshot_refreshed += snap.application_evict_snapshot_refreshed;
+    to->application_evict_time += snap.application_evict_time;
+    to->application_cache_time += snap.application_cache_time;
+    to->txn_release_blocked += snap.txn_release_blocked;
+    to->conn_close_blocked_lsm += snap.conn_close_blocked_lsm;
+    to->dhandle_lock_blocked += snap.dhandle_lock_blocked;
+    to->page_index_slot_ref_blocked += snap.page_index_slot_ref_blocked;
+    to->prepared_transition_blocked_page += snap.prepared_transition_blocked_page;
+    to->page_busy_blocked += snap.page_busy_blocked;
+    to->page_forcible_evict_blocked += snap.page_forcible_evict_blocked;
+    to->page_locked_blocked += snap.page_locked_blocked;
+    to->page_read_blocked += snap.page_read_blocked;
+    to->page_sleep += snap.page_sleep;
+    to->page_del_rollback_blocked += snap.page_del_rollback_blocked;
+    to->child_modify_blocked_page += snap.child_modify_blocked_page;
+    to->txn_prepared_updates += snap.txn_prepared_updates;
+    to->txn_prepared_updates_committed += snap.txn_prepared_updates_committed;
+    to->txn_prepared_updates_key_repeated += snap.txn_prepared_updates_key_repeated;
+    to->txn_prepared_updates_rolledback += snap.txn_prepared_updates_rolledback;
+    to->txn_read_race_prepare_commit += snap.txn_read_race_prepare_commit;
+    to->txn_read_overflow_remove += snap.txn_read_overflow_remove;
+    to->txn_rollback_oldest_pinned += snap.txn_rollback_oldest_pinned;
+    to->txn_prepare += snap.txn_prepare;
+    to->txn_prepare_commit += snap.txn_prepare_commit;
+    to->txn_prepare_active += snap.txn_prepare_active;
+    to->txn_prepare_rollback += snap.txn_prepare_rollback;
+    to->txn_query_ts += snap.txn_query_ts;
+    to->txn_read_race_prepare_update += snap.txn_read_race_prepare_update;
+    to->txn_recover_parallel_batches += snap.txn_recover_parallel_batches;
+    to->txn_recover_parallel_wait += snap.txn_recover_parallel_wait;
+    to->txn_rts += snap.txn_rts;
+    to->txn_rts_sweep_hs_keys_dryrun += snap.txn_rts_sweep_hs_keys_dryrun;
+    to->txn_rts_hs_stop_older_than_newer_start += snap.txn_rts_hs_stop_older_than_newer_start;
+    to->txn_rts_inconsistent_ckpt += snap.txn_rts_inconsistent_ckpt;
+    to->txn_rts_keys_removed += snap.txn_rts_keys_removed;
+    to->txn_rts_keys_restored += snap.txn_rts_keys_restored;
+    to->txn_rts_keys_removed_dryrun += snap.txn_rts_keys_removed_dryrun;
+    to->txn_rts_keys_restored_dryrun += snap.txn_rts_keys_restored_dryrun;
+    to->txn_rts_pages_visited += snap.txn_rts_pages_visited;
+    to->txn_rts_hs_restore_tombstones += snap.txn_rts_hs_restore_tombstones;
+    to->txn_rts_hs_restore_updates += snap.txn_rts_hs_restore_updates;
+    to->txn_rts_delete_rle_skipped += snap.txn_rts_delete_rle_skipped;
+    to->txn_rts_stable_rle_skipped += snap.txn_rts_stable_rle_skipped;
+    to->txn_rts_sweep_hs_keys += snap.txn_rts_sweep_hs_keys;
+    to->txn_rts_hs_restore_tombstones_dryrun += snap.txn_rts_hs_restore_tombstones_dryrun;
+    to->txn_rts_tree_walk_skip_pages += snap.txn_rts_tree_walk_skip_pages;
+    to->txn_rts_upd_aborted += snap.txn_rts_upd_aborted;
+    to->txn_rts_hs_restore_updates_dryrun += snap.txn_rts_hs_restore_updates_dryrun;
+    to->txn_rts_hs_removed += snap.txn_rts_hs_removed;
+    to->txn_rts_upd_aborted_dryrun += snap.txn_rts_upd_aborted_dryrun;
+    to->txn_rts_hs_removed_dryrun += snap.txn_rts_hs_removed_dryrun;
+    to->txn_sessions_walked += snap.txn_sessions_walked;
+    to->txn_set_ts += snap.txn_set_ts;
+    to->txn_set_ts_durable += snap.txn_set_ts_durable;
+    to->txn_set_ts_durable_upd += snap.txn_set_ts_durable_upd;
+    to->txn_set_ts_force += snap.txn_set_ts_force;
+    to->txn_set_ts_out_of_order += snap.txn_set_ts_out_of_order;
+    to->txn_set_ts_oldest += snap.txn_set_ts_oldest;
+    to->txn_set_ts_oldest_upd += snap.txn_set_ts_oldest_upd;
+    to->txn_set_ts_stable += snap.txn_set_ts_stable;
+    to->txn_set_ts_stable_upd += snap.txn_set_ts_stable_upd;
+    to->txn_begin += snap.txn_begin;
+    to->txn_hs_ckpt_duration += snap.txn_hs_ckpt_duration;
+    to->txn_pinned_range += snap.txn_pinned_range;
+    to->txn_pinned_checkpoint_range += snap.txn_pinned_checkpoint_range;
+    to->txn_pinned_timestamp += snap.txn_pinned_timestamp;
+    to->txn_pinned_timestamp_checkpoint += snap.txn_pinned_timestamp_checkpoint;
+    to->txn_pinned_timestamp_reader += snap.txn_pinned_timestamp_reader;
+    to->txn_pinned_timestamp_oldest += snap.txn_pinned_timestamp_oldest;
+    to->txn_timestamp_oldest_active_read += snap.txn_timestamp_oldest_active_read;
+    to->txn_rollback_to_stable_running += snap.txn_rollback_to_stable_running;
+    to->txn_sync += snap.txn_sync;
+    to->txn_walk_sessions += snap.txn_walk_sessions;
+    to->txn_commit += snap.txn_commit;
+    to->txn_rollback += snap.txn_rollback;
+    to->txn_update_conflict += snap.txn_update_conflict;
 }
 
 static const char *const __stats_join_desc[] = {
@@ -3500,18 +3668,21 @@ __wt_stat_join_clear_all(WT_JOIN_STATS **stats)
 {
     u_int i;
 
-    for (i = 0; i < WT_COUNTER_SLOTS; ++i)
+    for (i = 0; stats[i] != NULL; ++i)
         __wt_stat_join_clear_single(stats[i]);
 }
 
 void
 __wt_stat_join_aggregate(WT_JOIN_STATS **from, WT_JOIN_STATS *to)
 {
-    to->main_access += WT_STAT_READ(from, main_access);
-    to->bloom_false_positive += WT_STAT_READ(from, bloom_false_positive);
-    to->membership_check += WT_STAT_READ(from, membership_check);
-    to->bloom_insert += WT_STAT_READ(from, bloom_insert);
-    to->iterated += WT_STAT_READ(from, iterated);
+    WT_JOIN_STATS snap;
+
+    WT_STATS_SNAPSHOT(from, &snap);
+    to->main_access += snap.main_access;
+    to->bloom_false_positive += snap.bloom_false_positive;
+    to->membership_check += snap.membership_check;
+    to->bloom_insert += snap.bloom_insert;
+    to->iterated += snap.iterated;
 }
 
 static const char *const __stats_session_desc[] = {
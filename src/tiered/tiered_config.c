@@ -193,6 +193,12 @@ __wt_tiered_conn_config(WT_SESSION_IMPL *session, const char **cfg, bool reconfi
     /* Set up the rest of the tiered storage configuration. c*/
     WT_ERR(__wt_config_gets(session, cfg, "tiered_storage.interval", &cval));
     conn->tiered_interval = (uint64_t)cval.val;
+    if (!reconfig) {
+        WT_ERR(__wt_config_gets(session, cfg, "tiered_storage.flush_threads", &cval));
+        conn->tiered_flush_threads_num = (uint32_t)cval.val;
+        WT_ERR(__wt_config_gets(session, cfg, "tiered_storage.flush_part_size", &cval));
+        conn->tiered_flush_part_size = (uint64_t)cval.val;
+    }
 
     WT_ASSERT(session, WT_CONN_TIERED_STORAGE_ENABLED(conn));
     WT_STAT_CONN_SET(session, tiered_retention, conn->bstorage->retain_secs);
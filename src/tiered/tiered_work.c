@@ -145,6 +145,15 @@ __wt_tiered_pop_work(
 
     TAILQ_FOREACH (entry, &conn->tieredqh, q) {
         if (FLD_ISSET(type, entry->type) && (maxval == 0 || entry->op_val < maxval)) {
+            /*
+             * A table's objects must be flushed in order: with several flush threads, skip tables
+             * that already have an object being flushed.
+             */
+            if (entry->type == WT_TIERED_WORK_FLUSH) {
+                if (F_ISSET(entry->tiered, WT_TIERED_FLAG_FLUSHING))
+                    continue;
+                F_SET(entry->tiered, WT_TIERED_FLAG_FLUSHING);
+            }
             TAILQ_REMOVE(&conn->tieredqh, entry, q);
             WT_STAT_CONN_INCR(session, tiered_work_units_dequeued);
             WT_ASSERT(session, entry->tiered != NULL);
@@ -219,6 +228,21 @@ __wt_tiered_get_flush(WT_SESSION_IMPL *session, uint64_t generation, WT_TIERED_W
     return;
 }
 
+/*
+ * __wt_tiered_flush_release --
+ *     Allow the next object of a table to be flushed once a flush work unit has been processed.
+ */
+void
+__wt_tiered_flush_release(WT_SESSION_IMPL *session, WT_TIERED *tiered)
+{
+    WT_CONNECTION_IMPL *conn;
+
+    conn = S2C(session);
+    __wt_spin_lock(session, &conn->tiered_lock);
+    F_CLR(tiered, WT_TIERED_FLAG_FLUSHING);
+    __wt_spin_unlock(session, &conn->tiered_lock);
+}
+
 /*
  * __wt_tiered_get_remove_local --
  *     Get a remove local work unit if it is less than the time given. The caller is responsible for
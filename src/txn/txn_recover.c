@@ -20,9 +20,13 @@ typedef struct {
     WT_LSN ckpt_lsn; /* File's checkpoint LSN. */
 } WT_RECOVERY_FILE;
 
+struct __wt_recovery_apply;
+
 typedef struct {
     WT_SESSION_IMPL *session;
 
+    struct __wt_recovery_apply *apply; /* Parallel replay, if configured. */
+
     /* Files from the metadata, indexed by file ID. */
     WT_RECOVERY_FILE *files;
     size_t file_alloc; /* Allocated size of files array. */
@@ -41,6 +45,54 @@ typedef struct {
                          */
 } WT_RECOVERY;
 
+/*
+ * WT_RECOVERY_BATCH --
+ *	The operations from a single commit record that belong to one replay worker.
+ */
+typedef struct __wt_recovery_batch {
+    WT_LSN lsn;  /* Commit record LSN. */
+    WT_ITEM buf; /* Packed log operations. */
+    TAILQ_ENTRY(__wt_recovery_batch) q;
+} WT_RECOVERY_BATCH;
+
+/*
+ * WT_RECOVERY_WORKER --
+ *	A replay worker, applying the operations for the files hashed to it in log order.
+ */
+typedef struct {
+    struct __wt_recovery_apply *apply;
+
+    WT_RECOVERY r; /* Worker's recovery state and cursors. */
+
+    wt_thread_t tid;
+    bool tid_set;
+
+    WT_CONDVAR *cond; /* Worker wait mutex. */
+    WT_SPINLOCK lock; /* Queue lock. */
+    TAILQ_HEAD(__wt_recovery_batch_qh, __wt_recovery_batch) qh;
+    wt_shared uint32_t count; /* Queued batches. */
+
+    WT_RECOVERY_BATCH *pending; /* Batch being built by the reader. */
+
+    wt_shared int ret; /* Worker's first error. */
+} WT_RECOVERY_WORKER;
+
+/*
+ * WT_RECOVERY_APPLY --
+ *	Parallel log replay state: the log is read by a single thread and the operations are applied
+ *	by a set of workers, partitioned by file ID.
+ */
+typedef struct __wt_recovery_apply {
+    WT_RECOVERY_WORKER *workers;
+    u_int nworkers;
+
+    WT_CONDVAR *reader_cond; /* Reader wait mutex. */
+    wt_shared bool done;     /* Reader has finished. */
+} WT_RECOVERY_APPLY;
+
+/* The most batches queued for a single worker before the reader waits. */
+#define WT_RECOVERY_QUEUE_MAX 256
+
 /*
  * __recovery_cursor --
  *     Get a cursor for a recovery operation.
@@ -459,6 +511,287 @@ __txn_commit_apply(WT_RECOVERY *r, WT_LSN *lsnp, const uint8_t **pp, const uint8
     return (0);
 }
 
+/*
+ * __recovery_worker --
+ *     Apply the operations queued for a replay worker.
+ */
+static WT_THREAD_RET
+__recovery_worker(void *arg)
+{
+    WT_DECL_RET;
+    WT_RECOVERY_APPLY *apply;
+    WT_RECOVERY_BATCH *batch;
+    WT_RECOVERY_WORKER *worker;
+    WT_SESSION_IMPL *session;
+    uint32_t count;
+    const uint8_t *end, *p;
+    bool done;
+
+    worker = arg;
+    apply = worker->apply;
+    session = worker->r.session;
+
+    for (;;) {
+        /*
+         * Check if the reader has finished before looking at the queue, otherwise we could miss
+         * the last batches it queued.
+         */
+        WT_ORDERED_READ(done, apply->done);
+
+        count = 0;
+        __wt_spin_lock(session, &worker->lock);
+        if ((batch = TAILQ_FIRST(&worker->qh)) != NULL) {
+            TAILQ_REMOVE(&worker->qh, batch, q);
+            count = --worker->count;
+        }
+        __wt_spin_unlock(session, &worker->lock);
+
+        if (batch == NULL) {
+            if (done)
+                break;
+            __wt_cond_wait(session, worker->cond, 10 * WT_THOUSAND, NULL);
+            continue;
+        }
+
+        /* Wake the reader if it might be waiting for space in the queue. */
+        if (count == WT_RECOVERY_QUEUE_MAX / 2)
+            __wt_cond_signal(session, apply->reader_cond);
+
+        p = batch->buf.data;
+        end = p + batch->buf.size;
+        ret = __txn_commit_apply(&worker->r, &batch->lsn, &p, end);
+        __wt_buf_free(session, &batch->buf);
+        __wt_free(session, batch);
+        if (ret != 0) {
+            WT_PUBLISH(worker->ret, ret);
+            __wt_cond_signal(session, apply->reader_cond);
+            break;
+        }
+    }
+
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __recovery_batch_queue --
+ *     Queue the batch the reader has built for a replay worker.
+ */
+static int
+__recovery_batch_queue(
+  WT_SESSION_IMPL *session, WT_RECOVERY_APPLY *apply, WT_RECOVERY_WORKER *worker)
+{
+    WT_RECOVERY_BATCH *batch;
+    uint32_t count;
+    int wret;
+
+    /* Wait for space in the worker's queue, giving up if the worker has failed. */
+    for (;;) {
+        WT_ORDERED_READ(wret, worker->ret);
+        if (wret != 0)
+            return (wret);
+        WT_ORDERED_READ(count, worker->count);
+        if (count < WT_RECOVERY_QUEUE_MAX)
+            break;
+        WT_STAT_CONN_INCR(session, txn_recover_parallel_wait);
+        __wt_cond_wait(session, apply->reader_cond, 10 * WT_THOUSAND, NULL);
+    }
+
+    batch = worker->pending;
+    worker->pending = NULL;
+
+    __wt_spin_lock(session, &worker->lock);
+    TAILQ_INSERT_TAIL(&worker->qh, batch, q);
+    count = ++worker->count;
+    __wt_spin_unlock(session, &worker->lock);
+    WT_STAT_CONN_INCR(session, txn_recover_parallel_batches);
+
+    /* The worker only waits when its queue is empty. */
+    if (count == 1)
+        __wt_cond_signal(session, worker->cond);
+    return (0);
+}
+
+/*
+ * __recovery_commit_dispatch --
+ *     Split the operations in a commit record by file ID and queue them for the replay workers.
+ *     Operations on a file are always applied by the same worker, so each file sees its updates in
+ *     log order.
+ */
+static int
+__recovery_commit_dispatch(WT_RECOVERY *r, WT_LSN *lsnp, const uint8_t **pp, const uint8_t *end)
+{
+    WT_RECOVERY_APPLY *apply;
+    WT_RECOVERY_BATCH *batch;
+    WT_RECOVERY_WORKER *worker;
+    WT_SESSION_IMPL *session;
+    uint64_t fileid;
+    uint32_t optype, opsize;
+    u_int i;
+    const uint8_t *op, *p;
+
+    session = r->session;
+    apply = r->apply;
+
+    /* The logging subsystem zero-pads records. */
+    while (*pp < end && **pp) {
+        op = *pp;
+        WT_RET(__wt_logop_read(session, pp, end, &optype, &opsize));
+        if (opsize == 0 || opsize > WT_PTRDIFF(end, op))
+            WT_RET_MSG(session, WT_ERROR,
+              "txn_log_recover: operation size %" PRIu32 " at LSN %" PRIu32 "/%" PRIu32
+              " is invalid",
+              opsize, lsnp->l.file, lsnp->l.offset);
+        *pp = op + opsize;
+
+        /* Operations that should be ignored, including timestamp records, aren't queued. */
+        if (WT_LOGOP_IS_IGNORED(optype))
+            continue;
+
+        /*
+         * Every data operation starts with the file ID. Anything else goes to the first worker,
+         * which fails it the same way the single-threaded replay would.
+         */
+        fileid = 0;
+        switch (optype) {
+        case WT_LOGOP_COL_MODIFY:
+        case WT_LOGOP_COL_PUT:
+        case WT_LOGOP_COL_REMOVE:
+        case WT_LOGOP_COL_TRUNCATE:
+        case WT_LOGOP_ROW_MODIFY:
+        case WT_LOGOP_ROW_PUT:
+        case WT_LOGOP_ROW_REMOVE:
+        case WT_LOGOP_ROW_TRUNCATE:
+            p = op;
+            WT_RET(__wt_logop_unpack(session, &p, end, &optype, &opsize));
+            WT_RET(__wt_vunpack_uint(&p, WT_PTRDIFF(end, p), &fileid));
+            break;
+        }
+
+        worker = &apply->workers[fileid % apply->nworkers];
+        if ((batch = worker->pending) == NULL) {
+            WT_RET(__wt_calloc_one(session, &worker->pending));
+            batch = worker->pending;
+            WT_ASSIGN_LSN(&batch->lsn, lsnp);
+        }
+        WT_RET(__wt_buf_grow(session, &batch->buf, batch->buf.size + opsize));
+        memcpy((uint8_t *)batch->buf.mem + batch->buf.size, op, opsize);
+        batch->buf.size += opsize;
+    }
+
+    for (i = 0; i < apply->nworkers; ++i)
+        if (apply->workers[i].pending != NULL)
+            WT_RET(__recovery_batch_queue(session, apply, &apply->workers[i]));
+    return (0);
+}
+
+/*
+ * __recovery_apply_start --
+ *     Start the parallel replay workers for the main recovery pass.
+ */
+static int
+__recovery_apply_start(WT_RECOVERY *r, u_int nworkers)
+{
+    WT_RECOVERY_APPLY *apply;
+    WT_RECOVERY_WORKER *worker;
+    WT_SESSION_IMPL *session;
+    u_int i, j;
+
+    session = r->session;
+
+    WT_RET(__wt_calloc_one(session, &r->apply));
+    apply = r->apply;
+    WT_RET(__wt_cond_alloc(session, "recovery reader", &apply->reader_cond));
+    WT_RET(__wt_calloc_def(session, nworkers, &apply->workers));
+    for (i = 0; i < nworkers; ++i) {
+        worker = &apply->workers[i];
+        worker->apply = apply;
+        TAILQ_INIT(&worker->qh);
+        WT_RET(__wt_spin_init(session, &worker->lock, "recovery worker"));
+        apply->nworkers = i + 1;
+        WT_RET(__wt_cond_alloc(session, "recovery worker", &worker->cond));
+        WT_RET(__wt_open_internal_session(
+          S2C(session), "txn-recover-worker", false, 0, 0, &worker->r.session));
+
+        /*
+         * Each worker opens its own cursors, the file names and checkpoint LSNs are shared with the
+         * reader's recovery state.
+         */
+        WT_RET(__wt_calloc_def(session, r->nfiles, &worker->r.files));
+        worker->r.file_alloc = r->nfiles * sizeof(WT_RECOVERY_FILE);
+        worker->r.nfiles = r->nfiles;
+        for (j = 0; j < r->nfiles; ++j) {
+            worker->r.files[j].uri = r->files[j].uri;
+            WT_ASSIGN_LSN(&worker->r.files[j].ckpt_lsn, &r->files[j].ckpt_lsn);
+        }
+    }
+
+    for (i = 0; i < nworkers; ++i) {
+        worker = &apply->workers[i];
+        WT_RET(__wt_thread_create(session, &worker->tid, __recovery_worker, worker));
+        worker->tid_set = true;
+    }
+    return (0);
+}
+
+/*
+ * __recovery_apply_stop --
+ *     Wait for the parallel replay workers to apply everything queued, then shut them down.
+ */
+static int
+__recovery_apply_stop(WT_RECOVERY *r)
+{
+    WT_CURSOR *c;
+    WT_DECL_RET;
+    WT_RECOVERY_APPLY *apply;
+    WT_RECOVERY_BATCH *batch;
+    WT_RECOVERY_WORKER *worker;
+    WT_SESSION_IMPL *session;
+    u_int i, j;
+
+    session = r->session;
+    if ((apply = r->apply) == NULL)
+        return (0);
+    r->apply = NULL;
+
+    WT_PUBLISH(apply->done, true);
+    for (i = 0; i < apply->nworkers; ++i) {
+        worker = &apply->workers[i];
+        if (worker->tid_set) {
+            __wt_cond_signal(session, worker->cond);
+            WT_TRET(__wt_thread_join(session, &worker->tid));
+            worker->tid_set = false;
+        }
+        WT_TRET(worker->ret);
+    }
+
+    for (i = 0; i < apply->nworkers; ++i) {
+        worker = &apply->workers[i];
+        if (worker->r.session != NULL) {
+            for (j = 0; j < worker->r.nfiles; ++j)
+                if ((c = worker->r.files[j].c) != NULL)
+                    WT_TRET(c->close(c));
+            WT_TRET(__wt_session_close_internal(worker->r.session));
+        }
+        __wt_free(session, worker->r.files);
+
+        while ((batch = TAILQ_FIRST(&worker->qh)) != NULL) {
+            TAILQ_REMOVE(&worker->qh, batch, q);
+            __wt_buf_free(session, &batch->buf);
+            __wt_free(session, batch);
+        }
+        if ((batch = worker->pending) != NULL) {
+            __wt_buf_free(session, &batch->buf);
+            __wt_free(session, batch);
+        }
+        __wt_cond_destroy(session, &worker->cond);
+        __wt_spin_destroy(session, &worker->lock);
+    }
+    __wt_free(session, apply->workers);
+    __wt_cond_destroy(session, &apply->reader_cond);
+    __wt_free(session, apply);
+    return (ret);
+}
+
 /*
  * __txn_log_recover --
  *     Roll the log forward to recover committed changes.
@@ -504,7 +837,10 @@ __txn_log_recover(WT_SESSION_IMPL *session, WT_ITEM *logrec, WT_LSN *lsnp, WT_LS
     case WT_LOGREC_COMMIT:
         if ((ret = __wt_vunpack_uint(&p, WT_PTRDIFF(end, p), &txnid_unused)) != 0)
             WT_RET_MSG(session, ret, "txn_log_recover: unpack failure");
-        WT_RET(__txn_commit_apply(r, lsnp, &p, end));
+        if (r->apply != NULL)
+            WT_RET(__recovery_commit_dispatch(r, lsnp, &p, end));
+        else
+            WT_RET(__txn_commit_apply(r, lsnp, &p, end));
         break;
     case WT_LOGREC_SYSTEM:
         if (r->backup_only || r->metadata_only)
@@ -898,6 +1234,7 @@ err:
 int
 __wt_txn_recover(WT_SESSION_IMPL *session, const char *cfg[])
 {
+    WT_CONFIG_ITEM cval;
     WT_CONNECTION_IMPL *conn;
     WT_CURSOR *metac;
     WT_DECL_RET;
@@ -1097,11 +1434,24 @@ __wt_txn_recover(WT_SESSION_IMPL *session, const char *cfg[])
      */
     if (needs_rec)
         FLD_SET(conn->log_flags, WT_CONN_LOG_RECOVER_DIRTY);
+
+    /*
+     * If configured, this thread only reads the log and the operations are applied by a set of
+     * workers. Recovery applies each operation independently, outside of any transaction, so the
+     * only order that matters is the order of operations on the same file.
+     */
+    WT_ERR(__wt_config_gets(session, cfg, "log.recover_threads", &cval));
+    if (cval.val != 0) {
+        __wt_verbose_multi(session, WT_VERB_RECOVERY_ALL,
+          "Main recovery loop: applying operations with %" PRId64 " worker threads", cval.val);
+        WT_ERR(__recovery_apply_start(&r, (u_int)cval.val));
+    }
     if (WT_IS_INIT_LSN(&r.ckpt_lsn))
         ret = __wt_log_scan(
           session, NULL, NULL, WT_LOGSCAN_FIRST | WT_LOGSCAN_RECOVER, __txn_log_recover, &r);
     else
         ret = __wt_log_scan(session, &r.ckpt_lsn, NULL, WT_LOGSCAN_RECOVER, __txn_log_recover, &r);
+    WT_TRET(__recovery_apply_stop(&r));
     if (F_ISSET(conn, WT_CONN_SALVAGE))
         ret = 0;
     WT_ERR(ret);
@@ -1220,6 +1570,7 @@ done:
       conn->recovery_timeline.rts_ms, conn->recovery_timeline.checkpoint_ms);
 
 err:
+    WT_TRET(__recovery_apply_stop(&r));
     WT_TRET(__recovery_close_cursors(&r));
     __wt_free(session, config);
     FLD_CLR(conn->log_flags, WT_CONN_LOG_RECOVER_DIRTY);
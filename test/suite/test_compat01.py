@@ -47,13 +47,13 @@ class test_compat01(wttest.WiredTigerTestCase, suite_subprocess):
     # Log version 2 introduced that record.
     # Log versions 3 and higher continue to have that record.
     min_logv = 2
-    latest_logv = 5
+    latest_logv = 6
 
     # The API uses only the major and minor numbers but accepts with
     # and without the patch number.  Test both.
     start_compat = [
-        ('def', dict(compat1='none', logv1=5)),
-        ('113', dict(compat1='11.3', logv1=5)),
+        ('def', dict(compat1='none', logv1=6)),
+        ('113', dict(compat1='11.3', logv1=6)),
         ('112', dict(compat1='11.2', logv1=5)),
         ('111', dict(compat1='11.1', logv1=5)),
         ('110', dict(compat1='11.0', logv1=5)),
@@ -68,8 +68,8 @@ class test_compat01(wttest.WiredTigerTestCase, suite_subprocess):
         ('old_patch', dict(compat1="1.8.1", logv1=1)),
     ]
     restart_compat = [
-        ('def2', dict(compat2='none', logv2=5)),
-        ('113_2', dict(compat2='11.3', logv2=5)),
+        ('def2', dict(compat2='none', logv2=6)),
+        ('113_2', dict(compat2='11.3', logv2=6)),
         ('112_2', dict(compat2='11.2', logv2=5)),
         ('111_2', dict(compat2='11.1', logv2=5)),
         ('110_2', dict(compat2='11.0', logv2=5)),
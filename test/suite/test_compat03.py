@@ -57,8 +57,8 @@ class test_compat03(wttest.WiredTigerTestCase, suite_subprocess):
     # required minimum just for testing of parsing.
     compat_release = [
         ('future_rel', dict(rel=future_rel, log_rel=future_logv)),
-        ('def_rel', dict(rel='none', log_rel=5)),
-        ('113_rel', dict(rel="11.3", log_rel=5)),
+        ('def_rel', dict(rel='none', log_rel=6)),
+        ('113_rel', dict(rel="11.3", log_rel=6)),
         ('112_rel', dict(rel="11.2", log_rel=5)),
         ('111_rel', dict(rel="11.1", log_rel=5)),
         ('110_rel', dict(rel="11.0", log_rel=5)),
@@ -79,8 +79,9 @@ class test_compat03(wttest.WiredTigerTestCase, suite_subprocess):
     # This rule exemption applies to the minimum version check as well.
     compat_max = [
         ('future_max', dict(max_req=future_rel, log_max=future_logv)),
-        ('def_max', dict(max_req='none', log_max=5)),
-        ('113_max', dict(max_req="11.3", log_max=5)),
+        ('def_max', dict(max_req='none', log_max=6)),
+        ('113_max', dict(max_req="11.3", log_max=6)),
+        ('112_max', dict(max_req="11.2", log_max=5)),
         ('33_max', dict(max_req="3.3", log_max=4)),
         ('32_max', dict(max_req="3.2", log_max=3)),
         ('30_max', dict(max_req="3.0", log_max=2)),
@@ -91,7 +92,8 @@ class test_compat03(wttest.WiredTigerTestCase, suite_subprocess):
     # Only the minimum version should exist below for each log version.
     compat_min = [
         ('future_min', dict(min_req=future_rel, log_min=future_logv)),
-        ('def_min', dict(min_req='none', log_min=5)),
+        ('def_min', dict(min_req='none', log_min=6)),
+        ('113_min', dict(min_req="11.3", log_min=6)),
         ('100_min', dict(min_req="10.0", log_min=5)),
         ('33_min', dict(min_req="3.3", log_min=4)),
         ('31_min', dict(min_req="3.1", log_min=3)),
@@ -53,8 +53,8 @@ class test_compat04(wttest.WiredTigerTestCase, suite_subprocess):
     # should be successful for all directions.
     #
     create_release = [
-        ('def_rel', dict(create_rel='none', log_crrel=5)),
-        ('113_rel', dict(create_rel="11.3", log_crrel=5)),
+        ('def_rel', dict(create_rel='none', log_crrel=6)),
+        ('113_rel', dict(create_rel="11.3", log_crrel=6)),
         ('112_rel', dict(create_rel="11.2", log_crrel=5)),
         ('111_rel', dict(create_rel="11.1", log_crrel=5)),
         ('110_rel', dict(create_rel="11.0", log_crrel=5)),
@@ -66,7 +66,7 @@ class test_compat04(wttest.WiredTigerTestCase, suite_subprocess):
         ('26_rel', dict(create_rel="2.6", log_crrel=1)),
     ]
     reconfig_release = [
-        ('113_rel', dict(rel="11.3", log_rel=5)),
+        ('113_rel', dict(rel="11.3", log_rel=6)),
         ('112_rel', dict(rel="11.2", log_rel=5)),
         ('111_rel', dict(rel="11.1", log_rel=5)),
         ('110_rel', dict(rel="11.0", log_rel=5)),
@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_compat06.py
+# Check log=(compressor_dictionary) against the compatibility release: log records compressed
+# with a dictionary need log version 6, so older releases are refused.
+
+import wiredtiger, wttest
+from helper import simulate_crash_restart
+from wtscenario import make_scenarios
+
+class test_compat06(wttest.WiredTigerTestCase):
+    compressors = [
+        ('zlib', dict(compress='zlib')),
+        ('zstd', dict(compress='zstd')),
+    ]
+    scenarios = make_scenarios(compressors)
+
+    uri = 'table:test_compat06'
+    nrows = 5000
+    log_str = 'log=(enabled,compressor={},compressor_dictionary=16KB,file_max=100K,remove=false)'
+
+    def conn_config(self):
+        return 'config_base=false,' + self.log_str.format(self.compress)
+
+    # Load the compression extension, skip the test if missing.
+    def conn_extensions(self, extlist):
+        extlist.skip_if_missing = True
+        extlist.extension('compressors', self.compress)
+
+    def value(self, i):
+        return '{"_id": %d, "name": "customer-%d", "city": "Springfield", "status": "active"}' % \
+            (i, i * 7)
+
+    def test_compat06(self):
+        # Refuse a compatibility release that can't write the records.
+        self.close_conn()
+        config = 'create,config_base=false,compatibility=(release="11.2"),' + \
+            self.log_str.format(self.compress) + self.extensionsConfig()
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.wiredtiger_open('.', config),
+            '/requires a compatibility release of 11.3 or later/')
+        self.open_conn()
+
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(self.nrows):
+            cursor[i] = self.value(i)
+        cursor.close()
+
+        # Refuse a downgrade while the log is compressed with dictionaries.
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.conn.reconfigure('compatibility=(release="11.2")'),
+            '/Version incompatibility detected/')
+        self.conn.reconfigure('compatibility=(release="11.3")')
+
+        # Recover from the log and check the contents.
+        simulate_crash_restart(self, '.', 'RESTART')
+        cursor = self.session.open_cursor(self.uri)
+        count = 0
+        for k, v in cursor:
+            self.assertEqual(v, self.value(k))
+            count += 1
+        cursor.close()
+        self.assertEqual(count, self.nrows)
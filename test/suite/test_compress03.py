@@ -0,0 +1,111 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import os, shutil
+import wttest
+
+# test_compress03.py
+#   This test checks zstd dictionary compression: the dictionaries are stored in the table's
+#   metadata, the table can be read after a restart without dictionary compression configured,
+#   and the dictionaries follow the table when it's renamed, backed up and dropped.
+#
+class test_compress03(wttest.WiredTigerTestCase):
+    uri = "table:test_compress03"
+    renamed_uri = "table:test_compress03_renamed"
+    nrows = 50000
+    dictionary = 'true'
+
+    def zstd_config(self):
+        return 'dictionary={},dictionary_samples=50,dictionary_size=4KB'.format(self.dictionary)
+
+    def conn_config(self):
+        return 'builtin_extension_config={zstd={' + self.zstd_config() + '}},cache_size=10MB'
+
+    # Load the compression extension, skip the test if missing
+    def conn_extensions(self, extlist):
+        extlist.skip_if_missing = True
+        extlist.extension('compressors', 'zstd', '(config=\"' + self.zstd_config() + '\")')
+
+    def value(self, i):
+        return 'customer {} region {} status active flags {}'.format(i, i % 13, i % 7)
+
+    def check(self, uri):
+        cursor = self.session.open_cursor(uri)
+        count = 0
+        for k, v in cursor:
+            self.assertEqual(v, self.value(k))
+            count += 1
+        cursor.close()
+        self.assertEqual(count, self.nrows)
+
+    def compressor_state(self, uri):
+        cursor = self.session.open_cursor('metadata:', None, None)
+        cursor.set_key('file:' + uri[len('table:'):] + '.wt')
+        if cursor.search() != 0:
+            cursor.close()
+            return None
+        value = cursor.get_value()
+        cursor.close()
+        return 'block_compressor_state=' in value
+
+    @wttest.zstdtest('Skip zstd on pcc and zseries machines')
+    def test_compress03(self):
+        self.session.create(self.uri,
+            'key_format=i,value_format=S,block_compressor=zstd,leaf_page_max=16KB')
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(0, self.nrows):
+            cursor[i] = self.value(i)
+        cursor.close()
+
+        # Writing the pages trains the table's dictionary, the checkpoint stores it.
+        self.session.checkpoint()
+        self.assertTrue(self.compressor_state(self.uri))
+
+        # The table is readable without dictionary compression configured.
+        self.dictionary = 'false'
+        self.reopen_conn()
+        self.check(self.uri)
+        self.session.verify(self.uri)
+
+        # The dictionaries are renamed with the table.
+        self.session.rename(self.uri, self.renamed_uri)
+        self.assertTrue(self.compressor_state(self.renamed_uri))
+        self.check(self.renamed_uri)
+
+        # The dictionaries are backed up with the table.
+        os.mkdir('BACKUP')
+        cursor = self.session.open_cursor('backup:', None, None)
+        while cursor.next() == 0:
+            shutil.copy(cursor.get_key(), 'BACKUP')
+        cursor.close()
+        self.reopen_conn('BACKUP')
+        self.check(self.renamed_uri)
+
+        # The dictionaries are dropped with the table.
+        self.session.drop(self.renamed_uri)
+        self.assertEqual(self.compressor_state(self.renamed_uri), None)
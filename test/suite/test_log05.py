@@ -0,0 +1,112 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import os, random, threading
+import wttest
+from helper import simulate_crash_restart
+from wtscenario import make_scenarios
+from wiredtiger import stat
+
+# test_log05.py
+#    Write the log from many threads with log=(slot_consolidation) configured, forcing slot
+#    switches and log file switches, then recover and check every committed record is present.
+class test_log05(wttest.WiredTigerTestCase):
+    uri = 'table:test_log05'
+    nthreads = 8
+    ntxns = 400
+
+    subslots = [
+        ('subslot-1', dict(subslots=1)),
+        ('subslot-4', dict(subslots=4)),
+        ('subslot-16', dict(subslots=16)),
+    ]
+    scenarios = make_scenarios(subslots)
+
+    # A small log file size gives a 10KB slot buffer, so groups fill the active slot quickly.
+    def conn_config(self):
+        return 'statistics=(all),' + \
+            'log=(enabled,file_max=100K,remove=false,slot_consolidation={})'.format(self.subslots)
+
+    def key(self, t, i, j):
+        return 'thread{}-txn{}-{}'.format(t, str(i).zfill(6), j)
+
+    # Most records are small enough to be consolidated, some don't fit in a group and some are
+    # larger than the slot buffer and are written unbuffered.
+    def value(self, t, i, j):
+        size = [50, 400, 3000, 8000][random.Random(t * self.ntxns + i).randrange(4)]
+        return (self.key(t, i, j) + ' ') * (size // 20)
+
+    def writer(self, t, errors):
+        try:
+            session = self.conn.open_session()
+            cursor = session.open_cursor(self.uri)
+            for i in range(self.ntxns):
+                session.begin_transaction()
+                for j in range(3):
+                    cursor[self.key(t, i, j)] = self.value(t, i, j)
+                session.commit_transaction()
+
+                # Flushing the log switches the active slot.
+                if i % 50 == t:
+                    session.log_flush('sync=off')
+            session.close()
+        except Exception as e:
+            errors.append(e)
+
+    def test_slot_consolidation(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+
+        errors = []
+        threads = [threading.Thread(target=self.writer, args=(t, errors))
+            for t in range(self.nthreads)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        self.assertEqual(errors, [])
+
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        groups = stat_cursor[stat.conn.log_slot_subslot_groups][2]
+        stat_cursor.close()
+        self.assertGreater(groups, 0)
+
+        # The records span several log files, recover from them and check every record.
+        self.session.log_flush('sync=on')
+        logs = [f for f in os.listdir('.') if f.startswith('WiredTigerLog.')]
+        self.assertGreater(len(logs), 1)
+        simulate_crash_restart(self, '.', 'RESTART')
+        cursor = self.session.open_cursor(self.uri)
+        for t in range(self.nthreads):
+            for i in range(self.ntxns):
+                for j in range(3):
+                    self.assertEqual(cursor[self.key(t, i, j)], self.value(t, i, j))
+        count = 0
+        for k, v in cursor:
+            count += 1
+        cursor.close()
+        self.assertEqual(count, self.nthreads * self.ntxns * 3)
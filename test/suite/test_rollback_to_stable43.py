@@ -0,0 +1,89 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+from helper import simulate_crash_restart
+from rollback_to_stable_util import test_rollback_to_stable_base
+from wtdataset import SimpleDataSet
+from wtscenario import make_scenarios
+
+# test_rollback_to_stable43.py
+# Test rollback to stable with worker threads in recovery. None of the files are open when recovery
+# rolls them back, and the thread queuing the files holds the schema lock, so the worker threads
+# must not need it to open them.
+class test_rollback_to_stable43(test_rollback_to_stable_base):
+    format_values = [
+        ('column', dict(key_format='r', value_format='S')),
+        ('column_fix', dict(key_format='r', value_format='8t')),
+        ('row_integer', dict(key_format='i', value_format='S')),
+    ]
+
+    threads_values = [
+        ('threads_1', dict(threads=1)),
+        ('threads_4', dict(threads=4)),
+    ]
+
+    scenarios = make_scenarios(format_values, threads_values)
+
+    def conn_config(self):
+        return 'rollback_to_stable=(threads={})'.format(self.threads)
+
+    def test_rollback_to_stable_workers(self):
+        nrows = 1000
+        ntables = 10
+
+        if self.value_format == '8t':
+            value_a = 97
+            value_b = 98
+        else:
+            value_a = 'a' * 10
+            value_b = 'b' * 10
+
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(10) +
+            ',stable_timestamp=' + self.timestamp_str(10))
+
+        # Write stable and unstable values to a set of tables.
+        uris = []
+        for i in range(ntables):
+            uri = 'table:rollback_to_stable43_{}'.format(i)
+            ds = SimpleDataSet(
+                self, uri, 0, key_format=self.key_format, value_format=self.value_format)
+            ds.populate()
+            self.large_updates(uri, value_a, ds, nrows, False, 20)
+            self.large_updates(uri, value_b, ds, nrows, False, 50)
+            uris.append(uri)
+
+        # Checkpoint the unstable values, then crash: recovery has to open every table to roll it
+        # back.
+        self.conn.set_timestamp('stable_timestamp=' + self.timestamp_str(30))
+        self.session.checkpoint()
+        simulate_crash_restart(self, ".", "RESTART")
+
+        # The unstable values are gone from every table.
+        for uri in uris:
+            self.check(value_a, uri, nrows, None, 50)
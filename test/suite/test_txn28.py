@@ -0,0 +1,89 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn28.py
+#   Transactions: background commit sync and WT_SESSION.transaction_sync
+#
+
+import errno, os
+import helper, wiredtiger, wttest
+
+class test_txn28(wttest.WiredTigerTestCase):
+    uri = 'table:test_txn28'
+    nentries = 1000
+    conn_config = 'log=(enabled,file_max=100K,remove=false),statistics=(fast)'
+
+    # Poll for durability of the session's last background commit, returning whether the commit
+    # was durable. Only ETIMEDOUT is an acceptable failure.
+    def poll(self):
+        try:
+            self.session.transaction_sync('timeout_ms=0')
+        except wiredtiger.WiredTigerError as e:
+            self.assertEqual(str(e), os.strerror(errno.ETIMEDOUT))
+            return False
+        return True
+
+    def test_transaction_sync(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+
+        # Without a background commit there is nothing to wait for.
+        self.assertTrue(self.poll())
+        self.session.transaction_sync()
+
+        c = self.session.open_cursor(self.uri)
+        for i in range(1, self.nentries + 1):
+            self.session.begin_transaction()
+            c[i] = 'value' + str(i)
+            self.session.commit_transaction('sync=background')
+
+            # Check without waiting now and then: the commit is either durable or reported as not
+            # durable yet, never an error.
+            if i % 100 == 0:
+                self.poll()
+        c.close()
+
+        # Wait for the last commit to be durable. Once we return, checking without waiting must
+        # agree.
+        self.session.transaction_sync('timeout_ms=60000')
+        self.assertTrue(self.poll())
+
+        # Copy the database while it's still open to simulate a crash, then recover the copy: every
+        # background commit made before transaction_sync returned must be there.
+        helper.copy_wiredtiger_home(self, '.', 'RESTART')
+        conn = self.wiredtiger_open('RESTART', 'log=(enabled)')
+        session = conn.open_session()
+        c = session.open_cursor(self.uri)
+        count = 0
+        for k, v in c:
+            count += 1
+            self.assertEqual(v, 'value' + str(k))
+        self.assertEqual(count, self.nentries)
+        conn.close()
+
+if __name__ == '__main__':
+    wttest.run()
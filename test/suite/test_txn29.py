@@ -0,0 +1,123 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn29.py
+#   Transactions: recovery with log=(recover_threads) replays the log to the same contents as
+#   single-threaded recovery.
+#
+
+import random
+import helper, wiredtiger, wttest
+
+class test_txn29(wttest.WiredTigerTestCase):
+    conn_config = 'log=(enabled,file_max=100K,remove=false)'
+    formats = [('i', 'S'), ('r', 'S'), ('S', 'S')]
+    ntables = 6
+    ntxns = 3000
+    nkeys = 500
+    workers = [0, 1, 4]
+
+    def key(self, key_format, i):
+        if key_format == 'S':
+            return 'key' + str(i).zfill(6)
+        # Column-store record numbers start at 1.
+        return i + 1
+
+    def create_table(self, uri, formats):
+        self.session.create(uri, 'key_format={},value_format={}'.format(*formats))
+        self.tables.append((uri, formats[0]))
+        self.model[uri] = {}
+
+    # Run a random transaction updating several tables, committing it most of the time.
+    def transaction(self, r):
+        self.session.begin_transaction()
+        # The transaction's view of each table: its own updates over the committed contents.
+        pending = {}
+        for uri, key_format in r.sample(self.tables, r.randint(1, 3)):
+            view = dict(self.model[uri])
+            cursor = self.session.open_cursor(uri)
+            for j in range(r.randint(1, 5)):
+                k = self.key(key_format, r.randrange(self.nkeys))
+                op = r.randrange(10)
+                if op == 0 and k in view:
+                    cursor.set_key(k)
+                    self.assertEqual(cursor.remove(), 0)
+                    del view[k]
+                elif op == 1 and k in view:
+                    # Partial updates are logged as modify operations.
+                    data = 'm' + str(r.randrange(100))
+                    cursor.set_key(k)
+                    self.assertEqual(cursor.modify([wiredtiger.Modify(data, 2, 1)]), 0)
+                    view[k] = view[k][:2] + data + view[k][3:]
+                else:
+                    view[k] = 'value {} {} '.format(uri, k) + str(r.randrange(1000)) * 5
+                    cursor[k] = view[k]
+            cursor.close()
+            pending[uri] = view
+        if r.randrange(10) == 0:
+            self.session.rollback_transaction()
+            return
+        self.session.commit_transaction()
+        self.model.update(pending)
+
+    def dump(self, session, uri):
+        cursor = session.open_cursor(uri)
+        contents = {k: v for k, v in cursor}
+        cursor.close()
+        return contents
+
+    def test_recover_threads(self):
+        r = random.Random(29)
+        self.tables = []
+        self.model = {}
+        for i in range(self.ntables):
+            self.create_table('table:test_txn29_' + str(i), self.formats[i % len(self.formats)])
+
+        # Checkpoint part way through so recovery starts from a checkpoint LSN, and create a table
+        # after the checkpoint so recovery replays its creation too.
+        for i in range(self.ntxns):
+            if i == self.ntxns // 3:
+                self.session.checkpoint()
+            if i == self.ntxns // 2:
+                self.create_table('table:test_txn29_late', self.formats[0])
+            self.transaction(r)
+
+        # Copy the database while it's still open to simulate a crash, once for each number of
+        # recovery workers.
+        for n in self.workers:
+            helper.copy_wiredtiger_home(self, '.', 'RESTART' + str(n))
+        self.close_conn()
+
+        # Each recovery must match the committed transactions, and so each other.
+        for n in self.workers:
+            conn = self.wiredtiger_open('RESTART' + str(n),
+                'log=(enabled,file_max=100K,remove=false,recover_threads={})'.format(n))
+            session = conn.open_session()
+            for uri, _ in self.tables:
+                self.assertEqual(self.dump(session, uri), self.model[uri])
+            conn.close()
@@ -37,7 +37,7 @@ class test_util19(wttest.WiredTigerTestCase, suite_subprocess):
     uri = 'table:' + tablename
     entries = 100
     log_max = "100K"
-    log_latest_compat = 5
+    log_latest_compat = 6
 
     create_release = [
         ('def', dict(create_rel='none')),
@@ -50,6 +50,8 @@ class test_util19(wttest.WiredTigerTestCase, suite_subprocess):
     ]
 
     downgrade_release = [
+        ('113_rel', dict(downgrade_rel="11.3", log_downgrade_compat=6)),
+        ('112_rel', dict(downgrade_rel="11.2", log_downgrade_compat=5)),
         ('100_rel', dict(downgrade_rel="10.0", log_downgrade_compat=5)),
         ('33_rel', dict(downgrade_rel="3.3", log_downgrade_compat=4)),
         ('32_rel', dict(downgrade_rel="3.2", log_downgrade_compat=3)),
@@ -0,0 +1,215 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include "wt_internal.h"
+#include "../wrappers/mock_session.h"
+
+using extent_vector = std::vector<std::pair<wt_off_t, wt_off_t>>;
+
+static void
+extlist_insert(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *el, const extent_vector &v)
+{
+    for (const auto &e : v)
+        REQUIRE(__wt_block_insert_ext(session, block, el, e.first, e.second) == 0);
+}
+
+static extent_vector
+extlist_contents(WT_EXTLIST *el)
+{
+    extent_vector v;
+    WT_EXT *ext;
+
+    WT_EXT_FOREACH (ext, el->off)
+        v.emplace_back(ext->off, ext->size);
+    return (v);
+}
+
+// Check every skiplist level is in offset order and only links extents deep enough to be on it.
+static void
+check_skiplist(WT_EXTLIST *el)
+{
+    WT_EXT *ext, *prev;
+
+    for (int i = 0; i < WT_SKIP_MAXDEPTH; i++)
+        for (prev = nullptr, ext = el->off[i]; ext != nullptr; prev = ext, ext = ext->next[i]) {
+            REQUIRE(ext->depth > i);
+            if (prev != nullptr)
+                REQUIRE(prev->off + prev->size < ext->off);
+        }
+}
+
+// Return the lowest-offset extent at least as large as the size, by walking the offset list.
+static WT_EXT *
+first_fit_walk(WT_EXTLIST *el, wt_off_t size)
+{
+    WT_EXT *ext;
+
+    WT_EXT_FOREACH (ext, el->off)
+        if (ext->size >= size)
+            return (ext);
+    return (nullptr);
+}
+
+static void
+check_first_fit(WT_SESSION_IMPL *session, WT_EXTLIST *el)
+{
+    // Check each power-of-two size, where the whole size class is large enough, and sizes either
+    // side of it, where only part of the class is.
+    for (wt_off_t size = 512; size <= 4 * WT_MEGABYTE; size *= 2)
+        for (wt_off_t s : {size - 512, size, size + 512})
+            if (s > 0)
+                REQUIRE(__wt_block_first_fit(session, el, s) == first_fit_walk(el, s));
+}
+
+TEST_CASE("Extent Lists: block_first_fit", "[extent_list]")
+{
+    std::shared_ptr<MockSession> mock_session = MockSession::buildTestMockSession();
+    WT_SESSION_IMPL *session = mock_session->getWtSessionImpl();
+    WT_BLOCK block;
+    WT_EXTLIST el;
+    std::mt19937 rng(42);
+
+    WT_CLEAR(block);
+    REQUIRE(__wt_block_extlist_init(session, &el, "test", "avail", true) == 0);
+
+    SECTION("empty list has no first fit")
+    {
+        REQUIRE(__wt_block_first_fit(session, &el, 512) == nullptr);
+    }
+
+    SECTION("first fit matches an offset list walk")
+    {
+        // Insert extents of random sizes, separated by gaps so they aren't combined.
+        extent_vector v;
+        wt_off_t off = 0;
+        for (int i = 0; i < 2000; i++) {
+            wt_off_t size = (wt_off_t)(rng() % 2048 + 1) * 512;
+            v.emplace_back(off, size);
+            off += size + 512;
+        }
+        std::shuffle(v.begin(), v.end(), rng);
+        extlist_insert(session, &block, &el, v);
+        check_first_fit(session, &el);
+
+        // Allocate from the front of the first fitting extents, shrinking them and removing the
+        // lowest-offset extents of their size classes.
+        for (int i = 0; i < 500; i++) {
+            wt_off_t size = (wt_off_t)(rng() % 1024 + 1) * 512;
+            WT_EXT *ext = __wt_block_first_fit(session, &el, size);
+            REQUIRE(ext == first_fit_walk(&el, size));
+            if (ext != nullptr)
+                REQUIRE(
+                  __wt_block_off_remove_overlap(session, &block, &el, ext->off, size) == 0);
+        }
+        check_first_fit(session, &el);
+
+        // Free the ranges again, merging with their neighbors.
+        for (int i = 0; i < 500; i++) {
+            auto &e = v[rng() % v.size()];
+            WT_EXT *ext = __wt_block_off_srch_inclusive(&el, e.first);
+            if (ext == nullptr || ext->off > e.first)
+                REQUIRE(__wt_block_insert_ext(session, &block, &el, e.first, 512) == 0);
+        }
+        check_first_fit(session, &el);
+        check_skiplist(&el);
+    }
+
+    __wt_block_extlist_free(session, &el);
+}
+
+TEST_CASE("Extent Lists: block_extlist_merge_linear", "[extent_list]")
+{
+    std::shared_ptr<MockSession> mock_session = MockSession::buildTestMockSession();
+    WT_SESSION_IMPL *session = mock_session->getWtSessionImpl();
+    WT_BLOCK block;
+    WT_EXTLIST a, b;
+
+    WT_CLEAR(block);
+    REQUIRE(__wt_block_extlist_init(session, &a, "test", "a", false) == 0);
+    REQUIRE(__wt_block_extlist_init(session, &b, "test", "b", false) == 0);
+
+    SECTION("merge into an empty list")
+    {
+        extlist_insert(session, &block, &a, {{0, 512}, {1024, 512}});
+        REQUIRE(__ut_block_extlist_merge_linear(session, &block, &a, &b) == 0);
+        REQUIRE(extlist_contents(&b) == extent_vector({{0, 512}, {1024, 512}}));
+        REQUIRE(b.entries == 2);
+        REQUIRE(b.bytes == 1024);
+        REQUIRE(b.last->off == 1024);
+        check_skiplist(&b);
+
+        // The merged list is copied, not consumed.
+        REQUIRE(extlist_contents(&a) == extent_vector({{0, 512}, {1024, 512}}));
+    }
+
+    SECTION("merge an empty list")
+    {
+        extlist_insert(session, &block, &b, {{0, 512}, {1024, 512}});
+        REQUIRE(__ut_block_extlist_merge_linear(session, &block, &a, &b) == 0);
+        REQUIRE(extlist_contents(&b) == extent_vector({{0, 512}, {1024, 512}}));
+        REQUIRE(b.entries == 2);
+        REQUIRE(b.bytes == 1024);
+        check_skiplist(&b);
+    }
+
+    SECTION("interleaved ranges are kept in offset order")
+    {
+        extlist_insert(session, &block, &a, {{1024, 512}, {8192, 1024}});
+        extlist_insert(session, &block, &b, {{0, 512}, {4096, 512}, {16384, 512}});
+        REQUIRE(__ut_block_extlist_merge_linear(session, &block, &a, &b) == 0);
+        REQUIRE(extlist_contents(&b) ==
+          extent_vector({{0, 512}, {1024, 512}, {4096, 512}, {8192, 1024}, {16384, 512}}));
+        REQUIRE(b.entries == 5);
+        REQUIRE(b.bytes == 3072);
+        REQUIRE(b.last->off == 16384);
+        check_skiplist(&b);
+    }
+
+    SECTION("adjacent ranges are combined")
+    {
+        extlist_insert(session, &block, &a, {{512, 512}, {1536, 512}, {3072, 1024}});
+        extlist_insert(session, &block, &b, {{0, 512}, {1024, 512}, {4096, 1024}, {8192, 512}});
+        REQUIRE(__ut_block_extlist_merge_linear(session, &block, &a, &b) == 0);
+        REQUIRE(extlist_contents(&b) == extent_vector({{0, 2048}, {3072, 2048}, {8192, 512}}));
+        REQUIRE(b.entries == 3);
+        REQUIRE(b.bytes == 4608);
+        REQUIRE(b.last->off == 8192);
+        check_skiplist(&b);
+    }
+
+    SECTION("overlapping ranges fail and leave the target list unchanged")
+    {
+        // Fail instead of panicking, as when verifying.
+        __wt_event_handler_set(session, nullptr);
+        block.verify = true;
+
+        extlist_insert(session, &block, &b, {{0, 1024}, {4096, 512}});
+        for (const auto &overlap :
+          {extent_vector({{512, 1024}}), extent_vector({{4096, 512}}),
+            extent_vector({{2048, 512}, {3584, 1024}})}) {
+            extlist_insert(session, &block, &a, overlap);
+            REQUIRE(__ut_block_extlist_merge_linear(session, &block, &a, &b) == EINVAL);
+            REQUIRE(extlist_contents(&b) == extent_vector({{0, 1024}, {4096, 512}}));
+            REQUIRE(b.entries == 2);
+            REQUIRE(b.bytes == 1536);
+            check_skiplist(&b);
+
+            __wt_block_extlist_free(session, &a);
+            REQUIRE(__wt_block_extlist_init(session, &a, "test", "a", false) == 0);
+        }
+    }
+
+    __wt_block_extlist_free(session, &a);
+    __wt_block_extlist_free(session, &b);
+}
@@ -32,7 +32,7 @@ proc log_desc {} {
   globals WT_LOG_*
   ssection record:__wt_log_desc {
     uint32 -hex log_magic  ; # WT_LOG_MAGIC = 0x101064u
-    uint16 version  ; # = WT_LOG_VERSION = 5
+    uint16 version  ; # = WT_LOG_VERSION = 6
     uint16 unused
     xentry log_size { dx [uint64] }
   }